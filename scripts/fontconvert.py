@@ -221,6 +221,20 @@ for i_start, i_end in intervals:
     offset += i_end - i_start + 1
 print ("};");
 
+# Direct code point -> glyph index table for the Latin-1 range; 0xFFFF marks a missing glyph.
+# Lets the drawing code skip the interval search for nearly all characters.
+latin1 = [0xFFFF] * 256
+offset = 0
+for i_start, i_end in intervals:
+    for cp in range(i_start, min(i_end, 255) + 1):
+        latin1[cp] = offset + cp - i_start
+    offset += i_end - i_start + 1
+
+print(f"const uint16_t {font_name}Latin1[256] = {{")
+for c in chunks(latin1, 16):
+    print ("    " + " ".join(f"0x{i:04X}," for i in c))
+print ("};");
+
 print(f"const GFXfont {font_name} = {{")
 print(f"    (uint8_t*){font_name}Bitmaps,")
 print(f"    (GFXglyph*){font_name}Glyphs,")
@@ -169,13 +169,96 @@ L6KCq9NjRHDEjf8tM7qtj3u1cIiuPhnPQCjY/MiQu12ZIvVS5ljFH4gxQ+6IHdfG
 jjxDah2nGN59PRbxYvnKkKj9
 -----END CERTIFICATE-----)";
 
+
+// 17. Band rendering
+// If 0, the UI is drawn into a full-screen framebuffer (about 253 KiB, allocated in PSRAM) that is then sent to the
+// screen in one go.
+// Otherwise, the UI is drawn and sent to the screen in horizontal bands of that many rows, using a buffer of only
+// `BandRows` * 480 bytes in internal RAM. This allows boards without PSRAM to run, but every band is a separate screen
+// update pass, so updating the screen takes longer.
+constexpr unsigned BandRows = 0;
+
+// 18. Dual-core rendering
+// If true, the UI sections are split into two groups that are drawn at the same time, one on each of the two CPU cores.
+// (On single-core chips, the sections are simply drawn one after another.) Ignored in band mode.
+constexpr bool DualCoreRender = false;
+
+// 19. Partial refresh
+// If greater than 1, screen updates only clear and redraw the areas of the screen that changed since the previous
+// update, when that's known; every `FullRefreshEvery`-th update of an area is still a full one, to clear the ghosting
+// partial updates leave behind (see also 25.). With 0 or 1, every update is a full refresh. Ignored in band mode.
+constexpr unsigned FullRefreshEvery = 6;
+
+// 20. Background layer
+// If true, the parts of the UI that don't depend on the weather data (the compass rose, the graph frames, most images,
+// etc.) are drawn once, kept in flash and copied into the framebuffer before every update; only the rest is drawn on
+// top. It's drawn again when the firmware or the configuration changes what it looks like. Ignored in band mode.
+constexpr bool CacheBackground = true;
+
+// 21. Adaptive waveform
+// If true, the screen is updated with only as many frames as the grey levels the image actually has need: frames that
+// drive the same pixels are merged into longer ones, and frames that drive none are skipped. The UI is mostly black and
+// white, so this makes updates quicker. Each grey level still gets the same drive time as with the full 15 frames.
+// Needs `EpdOutputTasks`; off until the grey levels have been checked on a panel.
+constexpr bool AdaptiveWaveform = false;
+
+// 22. Early screen clear
+// If true, when the next update is going to be a full refresh, the screen is powered on and cleared in the background
+// right after waking up, while WiFi connects and the data is fetched, rather than after all that. The screen stays
+// powered on a bit longer, but the whole cycle should be shorter. Off until the overlap has been measured on a device.
+constexpr bool EarlyScreenClear = false;
+
+// 23. Progressive drawing
+// If true, the UI is drawn by a background task while the data is being fetched: each section as soon as the data it
+// shows is in, e.g. the wind and astronomy sections while the forecast is still being downloaded. What's left is drawn
+// once all the data is in, as usual. The result is the same. Takes precedence over DualCoreRender; ignored in band
+// mode.
+constexpr bool ProgressiveDraw = true;
+
+// 24. 1-bit error screen
+// If true, the error screen (black text in a box) is sent to the screen as a 1-bit image: the text loses its
+// antialiasing, but it's drawn in 6 steps instead of 15 frames, without the grey level conversion tables. Off until
+// the merged steps have been checked on a panel, like `AdaptiveWaveform`.
+constexpr bool MonoErrorScreen = false;
+
+// 25. Refresh policy
+// With partial refreshes (see 19.), an update is a full refresh, rather than a partial one, also when it's been
+// `FullRefreshMaxAge` since the last full refresh (the screen slowly fades, e.g. over the night); when the changes span
+// more than `PartialRowsLimit` rows (a full refresh would take about as long); or when an area of the screen has changed
+// so much since the last full refresh that its ghosting shows: `RegionChangeLimit` is in % of all of the area's pixels
+// going from black to white. If nothing changed at all, the screen is not updated.
+constexpr std::chrono::seconds FullRefreshMaxAge = std::chrono::hours{8};
+constexpr unsigned PartialRowsLimit              = 360;
+constexpr unsigned RegionChangeLimit             = 150;
+
+// 26. Power model
+// For the estimates of the charge drawn per wake and per day, and of the battery life (see energy.h), logged after every
+// cycle. While awake, the board draws `AwakeMa`, plus `RadioMa` while the WiFi is on, plus `EpdMa` while the panel is
+// powered; in deep sleep, `SleepMa`. These are rough figures for the LilyGo T5 4.7"; measure your board (and set the
+// capacity of your battery) for better estimates.
+constexpr float AwakeMa    = 45;
+constexpr float RadioMa    = 85;
+constexpr float EpdMa      = 110;
+constexpr float SleepMa    = 0.17f;
+constexpr float BatteryMah = 2000;
+
+// 27. EPD output tasks
+// If true, images are sent to the screen by two long-lived tasks that prepare each frame while the previous one is still
+// being sent (see esp32/epd_output.h), rather than by the EPD driver, which starts new tasks for every frame and pauses
+// between frames. Required by `AdaptiveWaveform`. Off until the grey levels and the ghosting have been checked on a
+// panel: the row timing is the driver's, but it hasn't been verified on the hardware.
+constexpr bool EpdOutputTasks = false;
+
 // ensure configuration has been set
 #define REQUIRE_SET(var, msg) static_assert(sizeof(var) / sizeof(var[0]) > 1, msg);
 
+// the unit tests are built with the src folder, but connect nowhere
+#ifndef PIO_UNIT_TESTING
 REQUIRE_SET(WiFiSSID, "Set your WiFi networks name in WiFiSSID");
 REQUIRE_SET(WiFiPassword, "Set your WiFi  password in WiFiPassword");
 
 REQUIRE_SET(ApiKey, "Specify OWM API key");
+#endif
 
 REQUIRE_SET(City, "Specify City name");
 REQUIRE_SET(Latitude, "Specify Latitude coord");
@@ -183,5 +266,6 @@ REQUIRE_SET(Longitude, "Specify Longitude coord");
 REQUIRE_SET(NTPServer, "NTP server must be set");
 REQUIRE_SET(ApiServer, "API Server must be set");
 static_assert(MaxDrift < RefreshPeriod, "MaxDrift should be strictly less than RefreshPeriod");
+static_assert(BandRows <= 540, "BandRows should not exceed the screen height");
 
 } // namespace cfg
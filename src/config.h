@@ -22,6 +22,8 @@ constexpr bool Log_HttpBody  = false;
 constexpr bool Log_Payloads  = false;
 /// Draws the timing in the UI
 constexpr bool Log_DrawTimings = false;
+/// Along with the timing, draws its p50/p90/max over the last cycles in the UI, see timing_history.h
+constexpr bool Log_DrawTimingTrends = false;
 
 namespace cfg
 {
@@ -52,4 +54,22 @@ extern char const ApiServer[];
 extern bool const UseHTTPS;
 extern char const *const OWM_ROOT_CA;
 
+extern unsigned const BandRows;
+extern bool const DualCoreRender;
+extern unsigned const FullRefreshEvery;
+extern bool const CacheBackground;
+extern bool const AdaptiveWaveform;
+extern bool const EarlyScreenClear;
+extern bool const ProgressiveDraw;
+extern bool const MonoErrorScreen;
+extern std::chrono::seconds const FullRefreshMaxAge;
+extern unsigned const PartialRowsLimit;
+extern unsigned const RegionChangeLimit;
+extern float const AwakeMa;
+extern float const RadioMa;
+extern float const EpdMa;
+extern float const SleepMa;
+extern float const BatteryMah;
+extern bool const EpdOutputTasks;
+
 } // namespace cfg
\ No newline at end of file
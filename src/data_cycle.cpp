@@ -51,6 +51,7 @@ OpResult<String> call_owm_api(ApiCall api)
 
     do
     {
+        TIMING_SPAN("HTTP request"); // one per attempt
         auto result = get_url(cfg::ApiServer, uri);
         if (result || (++attempt == cfg::MaxHTTPRetries)) return result;
     } while (true);
@@ -319,7 +320,7 @@ OpResult<void> populate_from_aqi_api_data(String const& json)
 
 namespace
 {
-OpResult<void> do_data_cycle_core()
+OpResult<void> do_data_cycle_core(void (*on_ready)(DataPart))
 {
     OPT_LOG(Log_Lifecycle, Serial.println("Fetching current weather data..."););
 
@@ -332,6 +333,7 @@ OpResult<void> do_data_cycle_core()
     auto parse_weather = populate_from_weather_api_data(*std::move(weather));
     mark_event_done(TimeEvent::ParseWeather);
     if (!parse_weather) return parse_weather;
+    if (on_ready) on_ready(DataPart::Weather);
 
     OPT_LOG(Log_Lifecycle, Serial.println("Fetching weather forecast data..."););
 
@@ -345,6 +347,10 @@ OpResult<void> do_data_cycle_core()
     mark_event_done(TimeEvent::ParseForecast);
     if (!parse_forecast) return parse_forecast;
 
+    // it only needs the weather and the forecast
+    postprocess_weather_data();
+    if (on_ready) on_ready(DataPart::Forecast);
+
     OPT_LOG(Log_Lifecycle, Serial.println("Fetching current AQI data..."););
 
     mark_event(TimeEvent::FetchAQI);
@@ -356,16 +362,15 @@ OpResult<void> do_data_cycle_core()
     auto parse_aqi = populate_from_aqi_api_data(*std::move(aqi));
     mark_event_done(TimeEvent::ParseAQI);
     if (!parse_aqi) return parse_aqi;
-
-    postprocess_weather_data();
+    if (on_ready) on_ready(DataPart::AQI);
 
     return {};
 }
 } // namespace
 
-OpResult<void> do_data_cycle()
+OpResult<void> do_data_cycle(void (*on_ready)(DataPart))
 {
-    auto r = do_data_cycle_core();
+    auto r = do_data_cycle_core(on_ready);
 
     {
         AutoTiming timer{TimeEvent::CloseHttp};
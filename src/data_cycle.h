@@ -10,7 +10,20 @@
 #pragma once
 #include "common.h"
 
+#include <cstdint>
+
+/// The parts of the data do_data_cycle() populates, in that order.
+enum class DataPart : uint8_t
+{
+    Weather,  ///< the current conditions and sunrise/sunset
+    Forecast, ///< the forecast, and the conditions derived from it (daily high/low, pressure trend, unit conversions)
+    AQI,      ///< the air quality
+};
+
 /**
  * Calls the weather provider API and populates the variables in the `shared` namespace.
+ *
+ * `on_ready`, if not null, is called (on the calling task) as soon as each part of the data is populated; that part
+ * isn't modified afterwards.
  */
-OpResult<void> do_data_cycle();
\ No newline at end of file
+OpResult<void> do_data_cycle(void (*on_ready)(DataPart) = nullptr);
\ No newline at end of file
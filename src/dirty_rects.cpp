@@ -0,0 +1,82 @@
+/*
+ * Copyright (c) 2024 zahical. All rights reserved.
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+/**
+ * @file Dirty rects implementation.
+ */
+
+#include "dirty_rects.h"
+
+#include <algorithm>
+#include <cstring>
+
+namespace
+{
+constexpr int32_t Stride   = EPD_WIDTH / 2;
+constexpr int32_t MergeGap = DirtyRects::MergeGap;
+
+/// A band of changed rows: [top, bottom) x [left, right) in bytes.
+struct Band
+{
+    int32_t top, bottom, left, right;
+};
+
+void merge_into(Band& a, Band const& b)
+{
+    a.top    = std::min(a.top, b.top);
+    a.bottom = std::max(a.bottom, b.bottom);
+    a.left   = std::min(a.left, b.left);
+    a.right  = std::max(a.right, b.right);
+}
+
+} // namespace
+
+DirtyRects find_dirty_rects(uint8_t const *prev, uint8_t const *next)
+{
+    // bands closer than MergeGap are merged right away, so there can only be this many
+    Band bands[EPD_HEIGHT / (MergeGap + 1) + 1];
+    size_t count = 0;
+
+    for (int32_t y = 0; y < EPD_HEIGHT; y++)
+    {
+        uint8_t const *p = &prev[y * Stride];
+        uint8_t const *n = &next[y * Stride];
+        if (memcmp(p, n, Stride) == 0) continue;
+
+        int32_t left = 0, right = Stride;
+        while (p[left] == n[left])
+            left++;
+        while (p[right - 1] == n[right - 1])
+            right--;
+
+        Band const row{y, y + 1, left, right};
+        if (count > 0 && y - bands[count - 1].bottom < MergeGap)
+            merge_into(bands[count - 1], row);
+        else
+            bands[count++] = row;
+    }
+
+    // too many: merge the neighbours with the smallest gap between them
+    while (count > DirtyRects::Max)
+    {
+        size_t best = 0;
+        for (size_t i = 1; i + 1 < count; i++)
+            if (bands[i + 1].top - bands[i].bottom < bands[best + 1].top - bands[best].bottom) best = i;
+
+        merge_into(bands[best], bands[best + 1]);
+        std::copy(&bands[best + 2], &bands[count], &bands[best + 1]);
+        count--;
+    }
+
+    DirtyRects r{};
+    r.count = count;
+    for (size_t i = 0; i < count; i++)
+    {
+        Band const& b = bands[i];
+        r.rects[i]    = {b.left * 2, b.top, (b.right - b.left) * 2, b.bottom - b.top};
+        r.rows += b.bottom - b.top;
+    }
+    return r;
+}
@@ -0,0 +1,40 @@
+/*
+ * Copyright (c) 2024 zahical. All rights reserved.
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+/**
+ * @file Finding the areas of the screen that changed between two frames, for partial refreshes.
+ *
+ * The EPD driver sends a whole row to the panel for every row of an area it clears or draws, no matter how narrow the
+ * area is, and every clear/draw call has a fixed cost on top; so the time of a refresh is mostly a function of the
+ * number of rows and passes, not of the area. The changes are therefore collected into a few horizontal bands, each
+ * as wide as the changes within it, merging bands that are only a few rows apart.
+ */
+
+#pragma once
+#include <epd_driver.h>
+
+#include <cstddef>
+#include <cstdint>
+
+struct DirtyRects
+{
+    /// More than this many bands are merged into fewer ones.
+    static constexpr size_t Max = 8;
+    /// Changed rows at most this far apart are refreshed in one pass; a separate pass costs more than the extra rows.
+    static constexpr int32_t MergeGap = 16;
+
+    size_t count;
+    Rect_t rects[Max];
+    /// The total height of the rects.
+    int32_t rows;
+};
+
+/**
+ * @brief Finds the areas where the framebuffer `next` differs from `prev` (both full-screen), sorted from top to
+ * bottom and not overlapping. Empty, if the frames are the same.
+ *
+ * Rects start at an even x and have an even width, so they are byte-aligned in the framebuffer.
+ */
+DirtyRects find_dirty_rects(uint8_t const *prev, uint8_t const *next);
@@ -17,14 +17,30 @@
 // clang-format off
 #include <Arduino.h>
 #include <epd_driver.h>
+#ifndef HOST_BUILD
+#include <esp_heap_caps.h>
+#include <esp_ota_ops.h>
+#endif
+#include "esp32/epd_output.h" // on the host, the EPD model, see host/epd_model.h
 
 #include "app_ver.h"
 #include "aqi_metric.h"
 #include "display.h"
+#include "data_cycle.h"
+#include "dirty_rects.h"
+#include "display_list.h"
+#include "energy.h"
+#include "frame_store.h"
+#include "fb_view.h"
+#include "nibble_ops.h"
+#include "refresh_policy.h"
 #include "shared_data.h"
 #include "config.h"
 #include "common.h"
+#include "timing_history.h"
 #include "timings.h"
+#include "trig.h"
+#include "text.h"
 #include "lang/lang.h"
 
 #include "fonts/opensans5cb_special2.h"
@@ -49,6 +65,7 @@
 #include "imgs/Gauge2.h"
 #include "imgs/Gauge3.h"
 #include "imgs/Gauge4.h"
+#include "imgs/icons.h"
 
 #include <algorithm>
 #include <cassert>
@@ -56,9 +73,13 @@
 #include <cstddef>
 #include <cstdint>
 #include <cstring>
+#include <atomic>
 #include <bitset>
 #include <utility>
 #include <tuple>
+#ifdef HOST_BUILD
+#include <thread>
+#endif
 
 // clang-format on
 
@@ -74,6 +95,10 @@
 constexpr bool LargeIcon = true;
 constexpr bool SmallIcon = false;
 
+/// If true, weather condition icons are blitted from the pre-rendered sprites in imgs/icons.h (when a matching one
+/// exists) instead of being drawn with primitives.
+constexpr bool UseIconSprites = true;
+
 #define Large 20 // For icon drawing
 #define Small 10 // For icon drawing
 
@@ -85,8 +110,118 @@ constexpr bool SmallIcon = false;
 // module globals
 namespace
 {
-GFXfont const *currentFont = nullptr;
-uint8_t *framebuffer       = nullptr;
+// clang-format on
+
+/// All the fonts used, along with their direct glyph index tables.
+UiFont const uiFonts[] = {
+    {"OpenSans5CB_Special2", {&OpenSans5CB_Special2, OpenSans5CB_Special2Latin1}},
+    {"OpenSans6B", {&OpenSans6B, OpenSans6BLatin1}},
+    {"OpenSans8B", {&OpenSans8B, OpenSans8BLatin1}},
+    {"OpenSans10B", {&OpenSans10B, OpenSans10BLatin1}},
+    {"OpenSans12B", {&OpenSans12B, OpenSans12BLatin1}},
+    {"OpenSans18B", {&OpenSans18B, OpenSans18BLatin1}},
+    {"OpenSans24B", {&OpenSans24B, OpenSans24BLatin1}},
+};
+
+uint8_t *framebuffer = nullptr;
+/// Only used in band mode, see cfg::BandRows
+uint8_t *band_buffer = nullptr;
+
+/// The parts of the UI that don't depend on the weather data, see cfg::CacheBackground.
+uint8_t *background_layer = nullptr;
+
+/// A copy of the framebuffer as last sent to the screen, for partial refreshes (see cfg::FullRefreshEvery).
+uint8_t *screen_frame = nullptr;
+/// If screen_frame is actually what's on the screen. Restored on wake-up, see frame_store.h.
+bool screen_frame_valid = false;
+/// The partial refreshes since the last full one, see refresh_policy.h; kept across deep sleep.
+RTC_DATA_ATTR RefreshState refresh_state;
+/// If the last cycle ended on the error screen, which leaves the rest of the last weather on the screen.
+RTC_DATA_ATTR bool error_on_screen = false;
+
+// The drawing state is per task, so that UI sections can be drawn concurrently, see cfg::DualCoreRender.
+
+struct DrawState
+{
+    FontFace const *font = nullptr;
+
+    /// All drawing primitives go through this view of `framebuffer` (or `band_buffer`).
+    ScreenView fb;
+
+    /// When set, the drawing primitives record into this list instead of drawing into `fb`.
+    DisplayList *recording = nullptr;
+};
+
+/**
+ * The drawing state of the caller of the UI functions (and of any other task), then of the draw tasks (ui_draw,
+ * ui_progressive) while they run, see DrawTask.
+ *
+ * Not thread_local: ESP-IDF reserves the static TLS segment on the stack of every task, the system ones included.
+ */
+constexpr size_t DrawStates = 3;
+DrawState draw_states[DrawStates];
+/// The owners of draw_states[1...], null when free.
+std::atomic<void const *> draw_tasks[DrawStates];
+
+/// Identifies the calling task (thread).
+void const *current_task()
+{
+#ifndef HOST_BUILD
+    return xTaskGetCurrentTaskHandle();
+#else
+    static thread_local char id; // threads have no such stack cost on the host
+    return &id;
+#endif
+}
+
+DrawState& draw_state()
+{
+    void const *const task = current_task();
+    for (size_t i = 1; i < DrawStates; i++)
+        if (draw_tasks[i].load(std::memory_order_acquire) == task) return draw_states[i];
+    return draw_states[0];
+}
+
+/// Gives the calling task a drawing state of its own, for its lifetime; for the tasks that draw along with the caller.
+class DrawTask
+{
+  public:
+    DrawTask()
+    {
+        for (size_t i = 1; i < DrawStates && !_slot; i++)
+        {
+            void const *free = nullptr;
+            if (draw_tasks[i].compare_exchange_strong(free, current_task(), std::memory_order_acq_rel)) _slot = i;
+        }
+        // only once it's ours: the entry may have been in use until then
+        if (_slot) draw_states[_slot] = DrawState();
+        assert(_slot && "more draw tasks than DrawStates");
+    }
+
+    ~DrawTask()
+    {
+        if (_slot) draw_tasks[_slot].store(nullptr, std::memory_order_release);
+    }
+
+    DrawTask(DrawTask const&)            = delete;
+    DrawTask& operator=(DrawTask const&) = delete;
+
+  private:
+    size_t _slot = 0;
+};
+
+/// Calls `f` with the current drawing target, either `fb` or `recording`; they have the same drawing methods.
+template <typename FCall>
+void with_target(FCall&& f)
+{
+    DrawState& state = draw_state();
+    if (state.recording)
+        f(*state.recording);
+    else
+        f(state.fb);
+}
+
+// clang-format off
 } // namespace
 
 // screen ops
@@ -96,27 +231,96 @@ namespace
 
 bool init_epd_alloc_fb()
 {
-#ifndef HOST_BUILD
+    size_t const band_size = cfg::BandRows * EPD_WIDTH / 2;
+
     epd_init();
-    framebuffer = (uint8_t *)ps_calloc(sizeof(uint8_t), EPD_WIDTH * EPD_HEIGHT / 2);
+    epd_output_init();
+
+#ifndef HOST_BUILD
+    if (cfg::BandRows == 0)
+        framebuffer = (uint8_t *)ps_calloc(sizeof(uint8_t), EPD_WIDTH * EPD_HEIGHT / 2);
+    else
+        band_buffer = (uint8_t *)heap_caps_malloc(band_size, MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT);
 #else
+    // the host always has the full framebuffer: in band mode it stands in for the screen
     framebuffer = (uint8_t *)calloc(sizeof(uint8_t), EPD_WIDTH * EPD_HEIGHT / 2);
+    if (cfg::BandRows != 0) band_buffer = (uint8_t *)malloc(band_size);
+#endif
+
+    if (cfg::BandRows == 0 && cfg::FullRefreshEvery > 1)
+    {
+        // without it, every refresh is a full one
+#ifndef HOST_BUILD
+        screen_frame = (uint8_t *)ps_malloc(EPD_WIDTH * EPD_HEIGHT / 2);
+#else
+        screen_frame = (uint8_t *)malloc(EPD_WIDTH * EPD_HEIGHT / 2);
 #endif
+    }
 
-    if (!framebuffer) return false;
+    if (screen_frame)
+    {
+        unsigned long const start = millis();
+        screen_frame_valid        = load_screen_frame(screen_frame);
 
-    memset(framebuffer, 0xFF, EPD_WIDTH * EPD_HEIGHT / 2);
+        OPT_LOG(Log_Lifecycle, Serial.println(screen_frame_valid ? "Restored the last frame in " +
+                                                                       String(millis() - start) + " ms"
+                                                                 : String("No last frame to restore")));
+    }
+
+    if (cfg::BandRows == 0 ? !framebuffer : !band_buffer) return false;
+
+    if (framebuffer)
+    {
+        memset(framebuffer, 0xFF, EPD_WIDTH * EPD_HEIGHT / 2);
+        draw_state().fb.set_buffer(framebuffer);
+    }
 
     return true;
 }
 
-void clear_epd_flush_fb_and_power_off(Rect_t const *rect = nullptr)
-{
 #ifndef HOST_BUILD
-    {
-        AutoTiming timing{TimeEvent::PowerOnScreen};
-        epd_poweron();
-    }
+/// If the screen is being, or has been, powered on and cleared in the background, see StartScreenClear().
+bool early_clear = false;
+/// Given when the background clear is done.
+SemaphoreHandle_t early_clear_done = nullptr;
+
+/**
+ * @brief Waits for the background clear, if one was started.
+ *
+ * Returns true if there was one; the screen is then on and blank.
+ */
+bool join_early_clear()
+{
+    if (!early_clear) return false;
+
+    xSemaphoreTake(early_clear_done, portMAX_DELAY);
+    vSemaphoreDelete(early_clear_done);
+    early_clear_done = nullptr;
+    early_clear      = false;
+    return true;
+}
+#endif
+
+/// When the screen was last powered on, see TimeEvent::ScreenOn.
+int64_t screen_on_us = 0;
+
+void power_on_epd()
+{
+    AutoTiming timing{TimeEvent::PowerOnScreen};
+    screen_on_us = span_clock_us();
+    epd_poweron();
+}
+
+/// Powers the screen off; on any task, once the one that powered it on is done with it.
+void power_off_epd()
+{
+    epd_poweroff_all();
+    record_span(span_id(TimeEvent::ScreenOn), screen_on_us, span_clock_us());
+}
+
+void power_on_and_clear(Rect_t const *rect)
+{
+    power_on_epd();
 
     {
         AutoTiming timing{TimeEvent::ClearScreen};
@@ -126,14 +330,258 @@ void clear_epd_flush_fb_and_power_off(Rect_t const *rect = nullptr)
         else
             epd_clear_area(*rect);
     }
+}
+
+void power_on_and_clear_epd(Rect_t const *rect)
+{
+#ifndef HOST_BUILD
+    // a full clear covers any area
+    if (join_early_clear()) return;
+#endif
+    power_on_and_clear(rect);
+}
+
+/**
+ * @brief The current time, in seconds, for the refresh policy. On the device, the system clock: it keeps running in
+ * deep sleep, so it's usable before this cycle's time sync, see StartScreenClear(). On the host, the mock CycleStart.
+ */
+int64_t cycle_time()
+{
+#ifndef HOST_BUILD
+    return time(nullptr);
+#else
+    struct tm start = shared::CycleStart;
+    return mktime(&start);
+#endif
+}
+
+/**
+ * @brief Clears and redraws just the areas of the screen where the framebuffer differs from screen_frame, as the
+ * refresh policy decides (see refresh_policy.h).
+ *
+ * Returns false if a full refresh is needed instead; true also if the screen needs no update at all.
+ */
+bool flush_changes_and_power_off()
+{
+    if (cfg::FullRefreshEvery <= 1) return false;
+
+#ifndef HOST_BUILD
+    // it's been cleared already, screen_frame is gone from the screen
+    if (early_clear) return false;
+#endif
+
+    int64_t const now = cycle_time();
+    init_refresh_state(refresh_state);
+
+    RefreshPlan const plan = plan_refresh(refresh_state, screen_frame_valid ? screen_frame : nullptr, framebuffer, now);
+    if (plan.kind != Refresh::Partial)
+    {
+        OPT_LOG(Log_Lifecycle, Serial.println(String(plan.kind == Refresh::Full ? "Full" : "No") +
+                                              " refresh: " + plan.reason));
+        return plan.kind == Refresh::None;
+    }
+
+    DirtyRects const& dirty = plan.dirty;
+    OPT_LOG(Log_Lifecycle, Serial.println("Partial refresh: " + String((int)dirty.count) + " areas, " +
+                                          String(dirty.rows) + " rows"));
+
+    {
+        // epd_output_draw_image() takes a packed image of just the area
+        size_t staging_size = 0;
+        for (size_t i = 0; i < dirty.count; i++)
+            staging_size = std::max<size_t>(staging_size, dirty.rects[i].width / 2 * dirty.rects[i].height);
+
+#ifndef HOST_BUILD
+        uint8_t *staging = (uint8_t *)ps_malloc(staging_size);
+#else
+        uint8_t *staging = (uint8_t *)malloc(staging_size);
+#endif
+        if (!staging) return false;
+
+        power_on_epd();
+
+        {
+            AutoTiming timing{TimeEvent::ClearScreen};
+            for (size_t i = 0; i < dirty.count; i++)
+                epd_clear_area(dirty.rects[i]);
+        }
+
+        {
+            AutoTiming timing{TimeEvent::UpdateScreen};
+            for (size_t i = 0; i < dirty.count; i++)
+            {
+                Rect_t const& r = dirty.rects[i];
+                for (int32_t y = 0; y < r.height; y++)
+                    memcpy(&staging[y * r.width / 2], &framebuffer[(r.y + y) * EPD_WIDTH / 2 + r.x / 2], r.width / 2);
+                epd_output_draw_image(r, staging, BLACK_ON_WHITE);
+            }
+        }
+
+        power_off_epd();
+        free(staging);
+    }
+
+    record_partial_refresh(refresh_state, plan);
+    return true;
+}
+
+/// Keeps screen_frame up to date with what's been sent to the screen: the framebuffer, if it's been sent as a whole.
+void update_screen_frame(bool whole_screen)
+{
+    if (screen_frame)
+    {
+        bool const was_valid = screen_frame_valid;
+
+        // with only a part of the screen cleared, the rest is a mix of the old and the new content
+        screen_frame_valid = whole_screen;
+
+        if (!screen_frame_valid)
+        {
+            if (was_valid) forget_screen_frame();
+        }
+        else if (!was_valid || memcmp(screen_frame, framebuffer, EPD_WIDTH * EPD_HEIGHT / 2) != 0)
+        {
+            memcpy(screen_frame, framebuffer, EPD_WIDTH * EPD_HEIGHT / 2);
+
+            // for the partial refresh after the next wake-up
+            size_t const size = save_screen_frame(screen_frame);
+            OPT_LOG(Log_Lifecycle, Serial.println(size ? "Saved the frame, " + String((int)size) + " bytes compressed"
+                                                       : String("Failed to save the frame")));
+        }
+    }
+}
+
+/// Sends the framebuffer to the screen; only the area `rect` (if not null) is cleared first.
+void clear_epd_flush_fb_and_power_off(Rect_t const *rect = nullptr)
+{
+    if (rect != nullptr || !flush_changes_and_power_off())
+    {
+        power_on_and_clear_epd(rect);
+
+        {
+            AutoTiming timing{TimeEvent::UpdateScreen};
+            epd_output_draw_image(epd_full_screen(), framebuffer, BLACK_ON_WHITE);
+        }
+
+        power_off_epd();
+        if (rect == nullptr) record_full_refresh(refresh_state, cycle_time());
+    }
+
+    update_screen_frame(rect == nullptr);
+}
+
+/**
+ * @brief The band mode (see cfg::BandRows) counterpart of drawing into the framebuffer and then calling
+ * clear_epd_flush_fb_and_power_off().
+ *
+ * Calls `draw` once for every band overlapping `rect` (or the whole screen), with drawing clipped to that band, and
+ * sends each band to the screen as soon as it's drawn.
+ */
+template <typename FDraw>
+void draw_bands_flush_and_power_off(FDraw&& draw, Rect_t const *rect = nullptr)
+{
+    assert(band_buffer);
+
+    power_on_and_clear_epd(rect);
+
+    int32_t const rows = cfg::BandRows;
+    int32_t const top  = rect ? std::max<int32_t>(rect->y, 0) : 0;
+    int32_t const end  = rect ? std::min<int32_t>(rect->y + rect->height, SCREEN_HEIGHT) : SCREEN_HEIGHT;
 
     {
         AutoTiming timing{TimeEvent::UpdateScreen};
-        epd_draw_grayscale_image(epd_full_screen(), framebuffer);
+
+        for (int32_t y = top - top % rows; y < end; y += rows)
+        {
+            int32_t const band_rows = std::min<int32_t>(rows, SCREEN_HEIGHT - y);
+
+            memset(band_buffer, 0xFF, band_rows * SCREEN_WIDTH / 2);
+            draw_state().fb.set_band(band_buffer, y, band_rows);
+
+            draw();
+
+            epd_output_draw_image({.x = 0, .y = y, .width = SCREEN_WIDTH, .height = band_rows}, band_buffer,
+                                  BLACK_ON_WHITE);
+#ifdef HOST_BUILD
+            memcpy(&framebuffer[y * SCREEN_WIDTH / 2], band_buffer, band_rows * SCREEN_WIDTH / 2);
+#endif
+        }
     }
 
-    epd_poweroff_all();
+    power_off_epd();
+#ifdef HOST_BUILD
+    draw_state().fb.set_buffer(framebuffer);
+#endif
+}
+
+/**
+ * @brief Draws with `draw` (into the framebuffer, or band by band in band mode, see cfg::BandRows) and sends just
+ * `area` to the screen, as a 1-bit image (see epd_output_draw_1bit()): what's lighter than mid-grey comes out white,
+ * the rest black.
+ *
+ * `area` must start at an even x. Returns false, without drawing, if there's no memory for the 1-bit image.
+ */
+template <typename FDraw>
+bool draw_mono_flush_and_power_off(FDraw&& draw, Rect_t const& area)
+{
+    assert(area.x % 2 == 0);
+
+    int32_t const row_bytes = area.width / 8 + (area.width % 8 != 0);
+    uint8_t *mono           = (uint8_t *)malloc(row_bytes * area.height);
+    if (!mono) return false;
+
+    // packs the rows of `area` among the full-width rows [y, y + rows) in `buffer`
+    auto pack = [&](uint8_t const *buffer, int32_t y, int32_t rows) {
+        int32_t const end = std::min(y + rows, area.y + area.height);
+        for (int32_t r = std::max(y, area.y); r < end; r++)
+            nibble_ops::pack_1bit(&buffer[(r - y) * SCREEN_WIDTH / 2 + area.x / 2], &mono[(r - area.y) * row_bytes],
+                                  area.width, Grey >> 4);
+    };
+
+    if (cfg::BandRows == 0)
+    {
+        draw();
+        pack(framebuffer, 0, SCREEN_HEIGHT);
+    }
+    else
+    {
+        int32_t const rows = cfg::BandRows;
+        for (int32_t y = area.y - area.y % rows; y < area.y + area.height; y += rows)
+        {
+            int32_t const band_rows = std::min<int32_t>(rows, SCREEN_HEIGHT - y);
+
+            memset(band_buffer, 0xFF, band_rows * SCREEN_WIDTH / 2);
+            draw_state().fb.set_band(band_buffer, y, band_rows);
+
+            draw();
+            pack(band_buffer, y, band_rows);
+#ifdef HOST_BUILD
+            memcpy(&framebuffer[y * SCREEN_WIDTH / 2], band_buffer, band_rows * SCREEN_WIDTH / 2);
+#endif
+        }
+#ifdef HOST_BUILD
+        draw_state().fb.set_buffer(framebuffer);
 #endif
+    }
+
+#ifdef HOST_BUILD
+    // as the screen shows it
+    draw_state().fb.threshold_rect(area, Grey);
+#endif
+
+    power_on_and_clear_epd(&area);
+
+    {
+        AutoTiming timing{TimeEvent::UpdateScreen};
+        epd_output_draw_1bit(area, mono);
+    }
+
+    power_off_epd();
+    free(mono);
+
+    // the next update is a full one, with screen_frame no longer valid
+    update_screen_frame(false);
+    return true;
 }
 
 // clang-format on
@@ -147,7 +595,7 @@ namespace
 int text_width(char const *str)
 {
     int x = 0, y = 0, x1, y1, w, h;
-    get_text_bounds(currentFont, str, &x, &y, &x1, &y1, &w, &h, nullptr);
+    text_bounds(*draw_state().font, str, &x, &y, &x1, &y1, &w, &h, nullptr);
     return w;
 }
 
@@ -170,67 +618,87 @@ int drawString(int x, int y, String const& text, alignment align, uint8_t color
     int x1, y1; // the bounds of x,y and w and h of the variable 'text' in pixels.
     int w, h;
     int xx = x, yy = y;
-    get_text_bounds(currentFont, text.c_str(), &xx, &yy, &x1, &y1, &w, &h, propsPtr);
+    DrawState& state = draw_state();
+    text_bounds(*state.font, text.c_str(), &xx, &yy, &x1, &y1, &w, &h, propsPtr);
     if (align == RIGHT) x = x - w;
     if (align == CENTER) x = x - w / 2;
     int cursor_y = y + h;
 
-    write_mode(currentFont, text.c_str(), &x, &cursor_y, framebuffer, (DrawMode_t)0 /*unused*/, propsPtr);
+    if (state.recording)
+        state.recording->text(*state.font, text.c_str(), x, cursor_y, propsPtr);
+    else
+        draw_text(*state.font, text.c_str(), &x, &cursor_y, state.fb, propsPtr);
 
     return w;
 }
 
 void drawString_multiline(int x, int y, String const& text) {
-  write_string(currentFont, text.c_str(), &x, &y, framebuffer);
+  DrawState& state = draw_state();
+  if (state.recording)
+    state.recording->text_multiline(*state.font, text.c_str(), x, y);
+  else
+    draw_text_multiline(*state.font, text.c_str(), &x, &y, state.fb);
 }
 
 void fillCircle(int x, int y, int r, uint8_t color) {
-  epd_fill_circle(x, y, r, color, framebuffer);
+  with_target([&](auto& t) { t.fill_circle(x, y, r, color); });
+}
+
+// the pixels of fillCircle(x, y, r_outer) minus those of fillCircle(x, y, r_inner), in one pass
+void fillRing(int x, int y, int r_outer, int r_inner, uint8_t color) {
+  with_target([&](auto& t) { t.fill_ring(x, y, r_outer, r_inner, color); });
 }
 
 void drawFastHLine(int16_t x0, int16_t y0, int length, uint16_t color) {
-  epd_draw_hline(x0, y0, length, color, framebuffer);
+  with_target([&](auto& t) { t.hline(x0, y0, length, color); });
 }
 
 void drawFastVLine(int16_t x0, int16_t y0, int length, uint16_t color) {
-  epd_draw_vline(x0, y0, length, color, framebuffer);
+  with_target([&](auto& t) { t.vline(x0, y0, length, color); });
 }
 
 void drawLine(int16_t x0, int16_t y0, int16_t x1, int16_t y1, uint16_t color) {
-  epd_write_line(x0, y0, x1, y1, color, framebuffer);
+  with_target([&](auto& t) { t.line(x0, y0, x1, y1, color); });
 }
 
 void drawCircle(int x0, int y0, int r, uint8_t color) {
-  epd_draw_circle(x0, y0, r, color, framebuffer);
+  with_target([&](auto& t) { t.circle(x0, y0, r, color); });
 }
 
 void drawRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color) {
-  epd_draw_rect(x, y, w, h, color, framebuffer);
+  with_target([&](auto& t) { t.rect(x, y, w, h, color); });
 }
 
 void fillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color) {
-  epd_fill_rect(x, y, w, h, color, framebuffer);
+  with_target([&](auto& t) { t.fill_rect(x, y, w, h, color); });
 }
 
 void fillTriangle(int16_t x0, int16_t y0, int16_t x1, int16_t y1,
                   int16_t x2, int16_t y2, uint16_t color) {
-  epd_fill_triangle(x0, y0, x1, y1, x2, y2, color, framebuffer);
+  with_target([&](auto& t) { t.fill_triangle(x0, y0, x1, y1, x2, y2, color); });
 }
 
 void drawPixel(int x, int y, uint8_t color) {
-  epd_draw_pixel(x, y, color, framebuffer);
+  with_target([&](auto& t) { t.pixel(x, y, color); });
 }
 
+// clang-format on
+
+// clang-format off
+
 void drawGrayscaleImage(Rect_t const& area, uint8_t const * data) {
   // epd_draw_grayscale_image(area, (uint8_t *) data);
 
   // unlike the original code, this method does not flush the image the screen,
   // but only copies it to the framebuffer
-  epd_copy_to_framebuffer(area, (uint8_t *)data, framebuffer);
+  with_target([&](auto& t) { t.blit(area, data); });
 }
 
 void setFont(GFXfont const & font) {
-  currentFont = &font;
+  auto const face = std::find_if(std::begin(uiFonts), std::end(uiFonts),
+                                 [&](UiFont const& f) { return f.face.font == &font; });
+  assert(face != std::end(uiFonts));
+  draw_state().font = &face->face;
 }
 
 // clang-format on
@@ -280,100 +748,24 @@ void drawDottedLine(int32_t x0, int32_t y0, int32_t x1, int32_t y1, uint8_t colo
     }
 }
 
-/**
- * @brief Executes the provided `FCall` callback for all pixels in the rectangular area defined by rect
- * passing it the current pixel color and then replacing the pixel color with the value returned by the callback.
- *
- * @tparam FCall a callable with `uint8_t(uint8_t)` sig.
- * @param rect framebuffer rect to modify
- * @param mod the callback; color is passed and returned as 8-bit
- */
+/// see FbView::modify_rect()
 template <typename FCall>
 void modifyRect(Rect_t const rect, FCall&& mod)
 {
-    for (int32_t hline = 0; hline < rect.height; hline++)
-    {
-        auto y = rect.y + hline;
-
-        uint8_t *pix_ptr = &framebuffer[y * SCREEN_WIDTH / 2 + rect.x / 2];
-        bool even_start  = (rect.x % 2) == 0;
-        bool even_width  = (rect.width % 2) == 0;
-        bool even_end    = even_start == even_width;
-
-        int width = rect.width;
-
-        if (!even_start)
-        {
-            uint8_t pix = *pix_ptr;
-
-            uint8_t c_half = pix & 0xF0;
-            c_half |= c_half >> 4;
-
-            uint8_t new_val = mod(c_half);
-
-            pix &= 0x0F;
-            pix |= new_val & 0xF0;
-            *pix_ptr = pix;
-
-            pix_ptr++;
-            width--;
-        }
-
-        for (int i = width / 2; i > 0; i--)
-        {
-
-            uint8_t pix = *pix_ptr;
-
-            uint8_t l_half = pix & 0x0F;
-            l_half |= l_half << 4;
-
-            uint8_t u_half = pix & 0xF0;
-            u_half |= u_half >> 4;
-
-            l_half = mod(l_half);
-            u_half = mod(u_half);
-
-            pix      = (u_half & 0xF0) | (l_half >> 4);
-            *pix_ptr = pix;
-            pix_ptr++;
-        }
-
-        if (!even_end)
-        {
-            uint8_t pix = *pix_ptr;
-
-            uint8_t c_half = pix & 0x0F;
-            c_half |= c_half << 4;
-
-            uint8_t new_val = mod(c_half);
-
-            pix &= 0xF0;
-            pix |= new_val >> 4;
-            *pix_ptr = pix;
-        }
-    }
+    with_target([&](auto& t) { t.modify_rect(rect, mod); });
 }
 
 void invertRect(Rect_t const& rect)
 {
-    modifyRect(rect, [](uint8_t c) { return 255 - c; });
+    with_target([&](auto& t) { t.invert_rect(rect); });
 }
 
-/// changes the color of the specified HLine (x1,y)-(x2,y) by adding (with min/max clipping) the signed value
-/// specified in `change` to the current pixel color
-void sumColorHLine(uint16_t x1, uint16_t x2, uint16_t y, int16_t change)
+/// changes the color of the specified HLine (x1,y)-(x2,y) by adding (with min/max clipping) `levels` gray levels (of
+/// the 16) to the current pixel color
+void sumColorHLine(uint16_t x1, uint16_t x2, uint16_t y, int8_t levels)
 {
     Rect_t r{x1, y, x2 - x1, 1};
-
-    modifyRect(r, [change](uint8_t c) {
-        int16_t c_new = c + change;
-        if (c_new > 255)
-            c_new = 255;
-        else if (c_new < 0)
-            c_new = 0;
-
-        return c_new;
-    });
+    with_target([&](auto& t) { t.add_rect(r, levels); });
 }
 } // namespace
 
@@ -386,13 +778,14 @@ String ConvertUnixTime(int unix_time) {
   // Returns either '21:12  ' or ' 09:12pm' depending on Units mode
   time_t tm = unix_time;
   tm += shared::time_offset.count();
-  struct tm *now_tm = localtime(&tm);
+  struct tm now_tm;
+  localtime_r(&tm, &now_tm); // sections may be drawn concurrently, so not localtime()
   char output[40];
   if (cfg::UseMetricUnits) {
-    strftime(output, sizeof(output), "%H:%M %d/%m/%y", now_tm);
+    strftime(output, sizeof(output), "%H:%M %d/%m/%y", &now_tm);
   }
   else {
-    strftime(output, sizeof(output), "%I:%M%P %m/%d/%y", now_tm);
+    strftime(output, sizeof(output), "%I:%M%P %m/%d/%y", &now_tm);
   }
   return output;
 }
@@ -414,14 +807,17 @@ constexpr T max_of(T a, T b, T c)
     return a > b ? (a > c ? a : c) : (b > c ? b : c);
 }
 
-std::tuple<int, int> circle_pos(int x, int y, float angle_deg, float radius)
+std::tuple<int, int> circle_pos(int x, int y, float angle_deg, int radius)
 {
-    return {round(x + cos((angle_deg)*PI / 180) * radius), round(y + sin((angle_deg)*PI / 180) * radius)};
+    trig::Vec const v = trig::polar(radius, trig::from_deg(angle_deg));
+    return {x + v.x, y + v.y};
 }
 
-std::tuple<float, float> circle_unit_pos(float angle_deg)
+/// (cos, sin) of the angle, in Q14 (see trig.h)
+std::tuple<int32_t, int32_t> circle_unit_pos(float angle_deg)
 {
-    return {cos((angle_deg)*PI / 180), sin((angle_deg)*PI / 180)};
+    int32_t const a = trig::from_deg(angle_deg);
+    return {trig::cos(a), trig::sin(a)};
 }
 
 // clang-format on
@@ -510,8 +906,7 @@ void addsun(int x, int y, int scale, bool IconSize) {
   DrawAngledLine(x + scale * 1.4, y + scale * 1.4, (x - scale * 1.4), (y - scale * 1.4), linesize * 1.5, Black); // Actually sqrt(2) but 1.4 is good enough
   DrawAngledLine(x - scale * 1.4, y + scale * 1.4, (x + scale * 1.4), (y - scale * 1.4), linesize * 1.5, Black);
   fillCircle(x, y, scale * 1.3, White);
-  fillCircle(x, y, scale, Black);
-  fillCircle(x, y, scale - linesize, White);
+  fillRing(x, y, scale, scale - linesize, Black);
 }
 
 void addfog(int x, int y, int scale, int linesize, bool IconSize) {
@@ -574,8 +969,6 @@ void DrawGraph(int x_pos, int y_pos, int gwidth, int gheight, float Y1Min, float
   // Draw the graph
   last_x = x_pos + 1;
   last_y = y_pos + (Y1Max - constrain(DataArray[1], Y1Min, Y1Max)) / (Y1Max - Y1Min) * gheight;
-  drawRect(x_pos, y_pos, gwidth + 3, gheight + 2, Grey);
-  drawString(x_pos - 20 + gwidth / 2, y_pos - 28, title, CENTER);
   for (int gx = 0; gx < readings; gx++) {
     x2 = x_pos + gx * gwidth / (readings - 1.0) - 1 ; // max_readings is the global variable that sets the maximum data that can be plotted
     y2 = y_pos + (Y1Max - constrain(DataArray[gx], Y1Min, Y1Max)) / (Y1Max - Y1Min) * gheight + 1;
@@ -607,12 +1000,44 @@ void DrawGraph(int x_pos, int y_pos, int gwidth, int gheight, float Y1Min, float
       }
     }
   }
+  for (int i = 0; i < 2; i++) {
+    drawFastVLine(x_pos + gwidth / 3 * i + gwidth / 3, y_pos, gheight, LightGrey);
+  }
+}
+
+// The parts of DrawGraph() that don't depend on the data: the frame and the days below it.
+void DrawGraphFrame(int x_pos, int y_pos, int gwidth, int gheight) {
+  setFont(OpenSans10B);
+  drawRect(x_pos, y_pos, gwidth + 3, gheight + 2, Grey);
   for (int i = 0; i < 3; i++) {
     drawString(20 + x_pos + gwidth / 3 * i, y_pos + gheight + 10, String(i) + "d", LEFT);
-    if (i < 2) drawFastVLine(x_pos + gwidth / 3 * i + gwidth / 3, y_pos, gheight, LightGrey);
   }
 }
 
+void DrawGraphTitle(int x_pos, int y_pos, int gwidth, String title) {
+  setFont(OpenSans10B);
+  drawString(x_pos - 20 + gwidth / 2, y_pos - 28, title, CENTER);
+}
+
+// clang-format on
+
+/// Where the four graphs are.
+struct GraphLayout
+{
+    int width  = 175;
+    int height = 100;
+    int y      = SCREEN_HEIGHT - height - 30;
+
+    int x(int index) const
+    {
+        int const gx  = (SCREEN_WIDTH - width * 4) / 5 + 8;
+        int const gap = width + gx;
+        return gx + index * gap + (index == 3 ? 5 : 0);
+    }
+};
+
+// clang-format off
+
 float SumOfPrecip(float DataArray[], int readings) {
   float sum = 0;
   for (int i = 0; i <= readings; i++) sum += DataArray[i];
@@ -632,18 +1057,29 @@ void DisplayGraphSection(int x, int y) {
     humidity_readings[r]                   = wx_obj.Humidity;
     r++;
   } while (r < max_readings);
-  int gwidth = 175, gheight = 100;
-  int gx = (SCREEN_WIDTH - gwidth * 4) / 5 + 8;
-  int gy = (SCREEN_HEIGHT - gheight - 30);
-  int gap = gwidth + gx;
+  GraphLayout const g;
   // (x,y,width,height,MinValue, MaxValue, Title, Data Array, AutoScale, ChartMode)
-  DrawGraph(gx + 0 * gap, gy, gwidth, gheight, 900, 1050, cfg::UseMetricUnits ? TXT_PRESSURE_HPA : TXT_PRESSURE_IN, pressure_readings, max_readings, autoscale_on, barchart_off);
-  DrawGraph(gx + 1 * gap, gy, gwidth, gheight, 10, 30,    cfg::UseMetricUnits ? TXT_TEMPERATURE_C : TXT_TEMPERATURE_F, temperature_readings, max_readings, autoscale_on, barchart_off);
-  DrawGraph(gx + 2 * gap, gy, gwidth, gheight, 0, 100,   TXT_HUMIDITY_PERCENT, humidity_readings, max_readings, autoscale_off, barchart_off);
-  if (SumOfPrecip(rain_readings, max_readings) >= SumOfPrecip(snow_readings, max_readings))
-    DrawGraph(gx + 3 * gap + 5, gy, gwidth, gheight, 0, 30, cfg::UseMetricUnits ? TXT_RAINFALL_MM : TXT_RAINFALL_IN, rain_readings, max_readings, autoscale_on, barchart_on);
-  else
-    DrawGraph(gx + 3 * gap + 5, gy, gwidth, gheight, 0, 30, cfg::UseMetricUnits ? TXT_SNOWFALL_MM : TXT_SNOWFALL_IN, snow_readings, max_readings, autoscale_on, barchart_on);
+  DrawGraph(g.x(0), g.y, g.width, g.height, 900, 1050, cfg::UseMetricUnits ? TXT_PRESSURE_HPA : TXT_PRESSURE_IN, pressure_readings, max_readings, autoscale_on, barchart_off);
+  DrawGraph(g.x(1), g.y, g.width, g.height, 10, 30,    cfg::UseMetricUnits ? TXT_TEMPERATURE_C : TXT_TEMPERATURE_F, temperature_readings, max_readings, autoscale_on, barchart_off);
+  DrawGraph(g.x(2), g.y, g.width, g.height, 0, 100,   TXT_HUMIDITY_PERCENT, humidity_readings, max_readings, autoscale_off, barchart_off);
+  if (SumOfPrecip(rain_readings, max_readings) >= SumOfPrecip(snow_readings, max_readings)) {
+    DrawGraphTitle(g.x(3), g.y, g.width, cfg::UseMetricUnits ? TXT_RAINFALL_MM : TXT_RAINFALL_IN);
+    DrawGraph(g.x(3), g.y, g.width, g.height, 0, 30, cfg::UseMetricUnits ? TXT_RAINFALL_MM : TXT_RAINFALL_IN, rain_readings, max_readings, autoscale_on, barchart_on);
+  }
+  else {
+    DrawGraphTitle(g.x(3), g.y, g.width, cfg::UseMetricUnits ? TXT_SNOWFALL_MM : TXT_SNOWFALL_IN);
+    DrawGraph(g.x(3), g.y, g.width, g.height, 0, 30, cfg::UseMetricUnits ? TXT_SNOWFALL_MM : TXT_SNOWFALL_IN, snow_readings, max_readings, autoscale_on, barchart_on);
+  }
+}
+
+// The background of DisplayGraphSection(): the frames and the titles that don't depend on the data.
+void DisplayGraphFrames() {
+  GraphLayout const g;
+  for (int i = 0; i < 4; i++)
+    DrawGraphFrame(g.x(i), g.y, g.width, g.height);
+  DrawGraphTitle(g.x(0), g.y, g.width, cfg::UseMetricUnits ? TXT_PRESSURE_HPA : TXT_PRESSURE_IN);
+  DrawGraphTitle(g.x(1), g.y, g.width, cfg::UseMetricUnits ? TXT_TEMPERATURE_C : TXT_TEMPERATURE_F);
+  DrawGraphTitle(g.x(2), g.y, g.width, TXT_HUMIDITY_PERCENT);
 }
 
 // clang-format on
@@ -732,8 +1168,45 @@ void Nodata(int x, int y, bool IconSize) {
   drawString(x - 3, y - 10, "?", CENTER);
 }
 
-void DisplayConditionsSection(int x, int y, String IconName, bool IconSize) {
-  //Serial.println("Icon name: " + IconName);
+// clang-format on
+
+/**
+ * @brief Blits the pre-rendered sprite for the condition icon, if imgs/icons.h has one for that icon, size and
+ * position.
+ *
+ * @return false, if there's no matching sprite and the icon should be drawn with primitives instead.
+ */
+bool DrawConditionsSprite(int x, int y, String const& IconName, bool IconSize)
+{
+    for (IconSpriteSpec const& spr : IconSprites)
+    {
+        if (spr.large != IconSize || IconName != spr.icon) continue;
+        if (spr.y_locked && spr.anchor_y != y) continue;
+
+        int32_t const left = x + spr.dx;
+        int32_t const top  = (spr.y_locked ? spr.anchor_y : y) + spr.dy;
+
+        uint8_t const *run = spr.runs;
+        for (int32_t row = 0; row < spr.height; row++)
+        {
+            int32_t pos = left;
+            for (uint8_t n = *run++; n > 0; n--)
+            {
+                pos += run[0];
+                drawFastHLine(pos, top + row, run[1], run[2]);
+                pos += run[1];
+                run += 3;
+            }
+        }
+        return true;
+    }
+
+    return false;
+}
+
+// clang-format off
+
+void DrawConditionsProcedural(int x, int y, String const& IconName, bool IconSize) {
   if      (IconName.endsWith("n"))                 addmoon(x, y, IconSize);
   if      (IconName == "01d" || IconName == "01n") ClearSky(x, y, IconSize);
   else if (IconName == "02d" || IconName == "02n") FewClouds(x, y, IconSize);
@@ -747,6 +1220,12 @@ void DisplayConditionsSection(int x, int y, String IconName, bool IconSize) {
   else                                             Nodata(x, y, IconSize);
 }
 
+void DisplayConditionsSection(int x, int y, String IconName, bool IconSize) {
+  //Serial.println("Icon name: " + IconName);
+  if (UseIconSprites && DrawConditionsSprite(x, y, IconName, IconSize)) return;
+  DrawConditionsProcedural(x, y, IconName, IconSize);
+}
+
 // clang-format on
 
 } // namespace
@@ -837,7 +1316,7 @@ bool DisplayWeatherText(int x, int y)
     constexpr auto t_color = DarkGrey;
 
     // uncomment to draw the bounding rect for debugging
-    // fillRect(x - max_weather_width, y - currentFont->advance_y, max_weather_width, currentFont->advance_y * 2,
+    // fillRect(x - max_weather_width, y - currentFont->font->advance_y, max_weather_width, currentFont->font->advance_y * 2,
     // DarkGrey);
 
     String w_text = TitleCase(shared::WxConditions.Forecast0);
@@ -863,17 +1342,17 @@ bool DisplayWeatherText(int x, int y)
         int w1    = text_width(l1.c_str());
         int w2    = text_width(l2.c_str());
         int w_max = std::max(w1, w2);
+        int y1    = y - draw_state().font->font->advance_y + line_height_adjust;
 
         if (w_max / 2 + icon_center_line_x < x)
         {
-            drawString(icon_center_line_x, y, l2, CENTER, t_color); // 2nd line
-            drawString(icon_center_line_x, y - currentFont->advance_y + line_height_adjust, l1, CENTER,
-                       t_color); // 1st line
+            drawString(icon_center_line_x, y, l2, CENTER, t_color);  // 2nd line
+            drawString(icon_center_line_x, y1, l1, CENTER, t_color); // 1st line
         }
         else
         {
-            drawString(x, y, l2, RIGHT, t_color);                                               // 2nd line
-            drawString(x, y - currentFont->advance_y + line_height_adjust, l1, RIGHT, t_color); // 1st line
+            drawString(x, y, l2, RIGHT, t_color);  // 2nd line
+            drawString(x, y1, l1, RIGHT, t_color); // 1st line
         }
         return true;
     }
@@ -913,26 +1392,35 @@ void Display_UVIndexLevel(int x, int y, float UVI) {
   DrawUVI(x - 10, y - 5);
 }
 
-void CloudCover(int x, int y, int CloudCover) {
+void CloudCoverIcon(int x, int y) {
   addcloud(x - 9, y,     Small * 0.3, 2); // Cloud top left
   addcloud(x + 3, y - 2, Small * 0.3, 2); // Cloud top right
   addcloud(x, y + 15,    Small * 0.6, 2); // Main cloud
+}
+
+void CloudCover(int x, int y, int CloudCover) {
   drawString(x + 30, y, String(CloudCover) + "%", LEFT);
 }
 
-void Visibility(int x, int y, String Visibility) {
-  float start_angle = 0.52, end_angle = 2.61, Offset = 10;
+void VisibilityIcon(int x, int y) {
+  float start_angle = 0.52f, end_angle = 2.61f;
+  int Offset = 10;
   int r = 14;
-  for (float i = start_angle; i < end_angle; i = i + 0.05) {
-    drawPixel(x + r * cos(i), y - r / 2.0 + r * sin(i) + Offset, Black);
-    drawPixel(x + r * cos(i), 1 + y - r / 2.0 + r * sin(i) + Offset, Black);
+  for (float i = start_angle; i < end_angle; i = i + 0.05f) {
+    trig::Vec const v = trig::polar(r, trig::from_rad(i));
+    drawPixel(x + v.x, y - r / 2 + v.y + Offset, Black);
+    drawPixel(x + v.x, 1 + y - r / 2 + v.y + Offset, Black);
   }
-  start_angle = 3.61; end_angle = 5.78;
-  for (float i = start_angle; i < end_angle; i = i + 0.05) {
-    drawPixel(x + r * cos(i), y + r / 2.0 + r * sin(i) + Offset, Black);
-    drawPixel(x + r * cos(i), 1 + y + r / 2.0 + r * sin(i) + Offset, Black);
+  start_angle = 3.61f; end_angle = 5.78f;
+  for (float i = start_angle; i < end_angle; i = i + 0.05f) {
+    trig::Vec const v = trig::polar(r, trig::from_rad(i));
+    drawPixel(x + v.x, y + r / 2 + v.y + Offset, Black);
+    drawPixel(x + v.x, 1 + y + r / 2 + v.y + Offset, Black);
   }
   fillCircle(x, y + Offset, r / 4, Black);
+}
+
+void Visibility(int x, int y, String Visibility) {
   drawString(x + 20, y, Visibility, LEFT);
 }
 
@@ -946,6 +1434,11 @@ void DisplayVisiCCoverUVISection(int x, int y) {
     Display_UVIndexLevel(x + 265, y, wx.UVI);
 }
 
+void DisplayVisiCCoverIcons(int x, int y) {
+  VisibilityIcon(x + 5, y);
+  CloudCoverIcon(x + 155, y);
+}
+
 void DrawSegment(int x, int y, int o1, int o2, int o3, int o4, int o11, int o12, int o13, int o14) {
   drawLine(x + o1,  y + o2,  x + o3,  y + o4,  Black);
   drawLine(x + o11, y + o12, x + o13, y + o14, Black);
@@ -1017,6 +1510,11 @@ void DisplayMainWeatherSection(int x, int y) {
   DisplayVisiCCoverUVISection(x - 10, y + 43);
 }
 
+// The background of DisplayMainWeatherSection()
+void DisplayMainWeatherIcons(int x, int y) {
+  DisplayVisiCCoverIcons(x - 10, y + 43);
+}
+
 // clang-format on
 } // namespace
 
@@ -1079,7 +1577,8 @@ void DrawMoon(int x, int y, int diameter, int dd, int mm, int yy, bool is_south_
     double Phase = NormalizedMoonPhase(dd, mm, yy);
     if (is_south_hemisphere) Phase = 1 - Phase;
 
-    auto const darken_by = 0x66;
+    // in gray levels; same as the 8-bit 0x66 it used to be, which rounded down to 6 levels for every color
+    int8_t const darken_by = 6;
 
     int y_upper_used = -1; // used to help avoid overdraw
     int y_lower_used = -1;
@@ -1114,7 +1613,7 @@ void DrawMoon(int x, int y, int diameter, int dd, int mm, int yy, bool is_south_
         // however, we must avoid darkening the same line twice as this results in double darkening.
         if (y_upper != y_upper_used)
         {
-            sumColorHLine(x_start, x_end, y_upper, -((int16_t)darken_by));
+            sumColorHLine(x_start, x_end, y_upper, -darken_by);
             y_upper_used = y_upper;
         }
 
@@ -1126,7 +1625,7 @@ void DrawMoon(int x, int y, int diameter, int dd, int mm, int yy, bool is_south_
 
         if (y_lower != y_lower_used)
         {
-            sumColorHLine(x_start, x_end, y_lower, -((int16_t)darken_by));
+            sumColorHLine(x_start, x_end, y_lower, -darken_by);
             y_lower_used = y_lower;
         }
     }
@@ -1181,10 +1680,14 @@ void DisplayAstronomySection(int x, int y) {
 
   setFont(OpenSans10B);
   drawString(x + 5, y + 102, MoonPhase(now_utc->tm_mday, now_utc->tm_mon + 1, now_utc->tm_year + 1900, is_south_hemisphere), LEFT);
-  DrawMoonImage(x + 10, y + 23); // Different references!
   DrawMoon(x - 28, y - 15, 75, now_utc->tm_mday, now_utc->tm_mon + 1, now_utc->tm_year + 1900, is_south_hemisphere); // Spaced at 1/2 moon size, so 10 - 75/2 = -28
   drawString(x + 115, y + 40, ConvertUnixTime(shared::LocData.Sunrise).substring(0, 5), LEFT); // Sunrise
   drawString(x + 115, y + 80, ConvertUnixTime(shared::LocData.Sunset).substring(0, 5), LEFT);  // Sunset
+}
+
+// The background of DisplayAstronomySection()
+void DisplayAstronomyImages(int x, int y) {
+  DrawMoonImage(x + 10, y + 23); // Different references!
   DrawSunriseImage(x + 180, y + 20);
   DrawSunsetImage(x + 180, y + 60);
 }
@@ -1222,18 +1725,22 @@ void arrow(int x, int y, int asize, float aangle, int pwidth, int plength) {
   // So, we must draw the arrow pointing the other way.
   aangle += 180;
 
-  float dx = (asize - 10) * cos((aangle - 90) * PI / 180) + x; // calculate X position
-  float dy = (asize - 10) * sin((aangle - 90) * PI / 180) + y; // calculate Y position
-  float x1 =  0;            float y1 = plength;
-  float x2 =  pwidth / 2.0; float y2 = pwidth / 2.0;
-  float x3 = -pwidth / 2.0; float y3 = pwidth / 2.0;
-  float angle = aangle * PI / 180 - 135;
-  float xx1 = x1 * cos(angle) - y1 * sin(angle) + dx;
-  float yy1 = y1 * cos(angle) + x1 * sin(angle) + dy;
-  float xx2 = x2 * cos(angle) - y2 * sin(angle) + dx;
-  float yy2 = y2 * cos(angle) + x2 * sin(angle) + dy;
-  float xx3 = x3 * cos(angle) - y3 * sin(angle) + dx;
-  float yy3 = y3 * cos(angle) + x3 * sin(angle) + dy;
+  // all in Q14 (see trig.h), only the final vertex coordinates are truncated
+  int32_t pos = trig::from_deg(aangle - 90);
+  int32_t dx = (asize - 10) * trig::cos(pos) + x * trig::One; // calculate X position
+  int32_t dy = (asize - 10) * trig::sin(pos) + y * trig::One; // calculate Y position
+  int x1 =  0;          int y1 = plength;
+  int x2 =  pwidth / 2; int y2 = pwidth / 2;
+  int x3 = -pwidth / 2; int y3 = pwidth / 2;
+  // (sic) the original subtracts 135 radians, not degrees
+  int32_t angle = trig::from_deg(aangle) - trig::from_rad(135);
+  int32_t c = trig::cos(angle), s = trig::sin(angle);
+  int xx1 = (x1 * c - y1 * s + dx) >> trig::FracBits;
+  int yy1 = (y1 * c + x1 * s + dy) >> trig::FracBits;
+  int xx2 = (x2 * c - y2 * s + dx) >> trig::FracBits;
+  int yy2 = (y2 * c + x2 * s + dy) >> trig::FracBits;
+  int xx3 = (x3 * c - y3 * s + dx) >> trig::FracBits;
+  int yy3 = (y3 * c + x3 * s + dy) >> trig::FracBits;
   fillTriangle(xx1, yy1, xx3, yy3, xx2, yy2, Black);
 }
 
@@ -1252,11 +1759,11 @@ void wind_barbs(int x, int y, int radius, float wind_dir, int wind_speed_knots)
     else
         radius -= 8;
 
-    float unit_x, unit_y;
+    int32_t unit_x, unit_y; // Q14
     std::tie(unit_x, unit_y) = circle_unit_pos(wind_dir - 90);
 
     // always draw the "blows to" direction line
-    drawDottedLine(x, y, x - unit_x * (radius - 5), y - unit_y * (radius - 5), Black, 0x88);
+    drawDottedLine(x, y, x - trig::mul(radius - 5, unit_x), y - trig::mul(radius - 5, unit_y), Black, 0x88);
 
     constexpr auto barb_spacing   = 3;
     constexpr auto short_barb_len = 5;
@@ -1269,7 +1776,7 @@ void wind_barbs(int x, int y, int radius, float wind_dir, int wind_speed_knots)
     if (wind_speed_knots < 3) return;
 
     // draw the "from direction" line mark
-    drawLine(x + unit_x * radius, y + unit_y * radius, x, y, Black);
+    drawLine(x + trig::mul(radius, unit_x), y + trig::mul(radius, unit_y), x, y, Black);
 
     int used_len = 0;
 
@@ -1284,9 +1791,9 @@ void wind_barbs(int x, int y, int radius, float wind_dir, int wind_speed_knots)
             int mid_len  = far_len - penant_base_len / 2;
             int near_len = far_len - penant_base_len;
 
-            int penn_far_x = far_len * unit_x + x, penn_far_y = far_len * unit_y + y;
-            int penn_mid_x = mid_len * unit_x + x, penn_mid_y = mid_len * unit_y + y;
-            int penn_near_x = near_len * unit_x + x, penn_near_y = near_len * unit_y + y;
+            int penn_far_x = trig::mul(far_len, unit_x) + x, penn_far_y = trig::mul(far_len, unit_y) + y;
+            int penn_mid_x = trig::mul(mid_len, unit_x) + x, penn_mid_y = trig::mul(mid_len, unit_y) + y;
+            int penn_near_x = trig::mul(near_len, unit_x) + x, penn_near_y = trig::mul(near_len, unit_y) + y;
 
             std::tie(penn_mid_x, penn_mid_y) =
                 circle_pos(penn_mid_x, penn_mid_y, wind_dir - 90 + 90, penant_height_len);
@@ -1311,7 +1818,7 @@ void wind_barbs(int x, int y, int radius, float wind_dir, int wind_speed_knots)
         for (int n = 0; n < 2; n++)
         {
             int dist         = radius - used_len - n;
-            int barb_start_x = dist * unit_x + x, barb_start_y = dist * unit_y + y;
+            int barb_start_x = trig::mul(dist, unit_x) + x, barb_start_y = trig::mul(dist, unit_y) + y;
 
             int barb_end_x, barb_end_y;
             std::tie(barb_end_x, barb_end_y) =
@@ -1327,37 +1834,36 @@ void wind_barbs(int x, int y, int radius, float wind_dir, int wind_speed_knots)
 
 // clang-format off
 
-void DisplayDisplayWindSection(int x, int y, float angle, float windspeed, int Cradius) {
+void DrawCompassRose(int x, int y, int Cradius) {
 
   constexpr auto draw_outer_ticks = false;
   constexpr auto draw_inner_ticks = true;
-  constexpr float inner_circle_ration = 0.68f;
-
-  float wind_speed_knots =
-    cfg::UseMetricUnits ? windspeed * 1.94384 : windspeed * 0.8689;
+  constexpr int inner_circle_percent = 68; // of the radius
 
   setFont(OpenSans8B);
   int dxo, dyo, dxi, dyi;
   drawCircle(x, y, Cradius, Black);       // Draw compass circle
   drawCircle(x, y, Cradius + 1, Black);   // Draw compass circle
-  drawCircle(x, y, Cradius * inner_circle_ration, Black); // Draw compass inner circle
-  for (float a = 0; a < 360; a = a + 22.5) {
-    dxo = Cradius * cos((a - 90) * PI / 180);
-    dyo = Cradius * sin((a - 90) * PI / 180);
-    if (a == 45)  drawString(dxo + x + 15, dyo + y - 18, TXT_NE, CENTER);
-    if (a == 135) drawString(dxo + x + 20, dyo + y - 2,  TXT_SE, CENTER);
-    if (a == 225) drawString(dxo + x - 20, dyo + y - 2,  TXT_SW, CENTER);
-    if (a == 315) drawString(dxo + x - 15, dyo + y - 18, TXT_NW, CENTER);
+  drawCircle(x, y, Cradius * inner_circle_percent / 100, Black); // Draw compass inner circle
+  for (int32_t a = 0; a < trig::FullTurn; a += trig::FullTurn / 16) { // every 22.5 degrees
+    trig::Vec const o = trig::polar(Cradius, a - trig::QuarterTurn);
+    dxo = o.x;
+    dyo = o.y;
+    if (a == trig::FullTurn / 8 * 1) drawString(dxo + x + 15, dyo + y - 18, TXT_NE, CENTER);
+    if (a == trig::FullTurn / 8 * 3) drawString(dxo + x + 20, dyo + y - 2,  TXT_SE, CENTER);
+    if (a == trig::FullTurn / 8 * 5) drawString(dxo + x - 20, dyo + y - 2,  TXT_SW, CENTER);
+    if (a == trig::FullTurn / 8 * 7) drawString(dxo + x - 15, dyo + y - 18, TXT_NW, CENTER);
+    // the ticks are 90% of the way to the center; integer division truncates, as the float conversions it replaces did
     if(draw_outer_ticks) {
-      dxi = dxo * 0.9;
-      dyi = dyo * 0.9;
+      dxi = dxo * 9 / 10;
+      dyi = dyo * 9 / 10;
       drawLine(dxo + x, dyo + y, dxi + x, dyi + y, Black);
     }
     if(draw_inner_ticks) {
-      dxo = dxo * inner_circle_ration;
-      dyo = dyo * inner_circle_ration;
-      dxi = dxo * 0.9;
-      dyi = dyo * 0.9;
+      dxo = dxo * inner_circle_percent / 100;
+      dyo = dyo * inner_circle_percent / 100;
+      dxi = dxo * 9 / 10;
+      dyi = dyo * 9 / 10;
       drawLine(dxo + x, dyo + y, dxi + x, dyi + y, Black);
     }
   }
@@ -1365,6 +1871,14 @@ void DisplayDisplayWindSection(int x, int y, float angle, float windspeed, int C
   drawString(x, y + Cradius + 10,     TXT_S, CENTER);
   drawString(x - Cradius - 15, y - 5, TXT_W, CENTER);
   drawString(x + Cradius + 10, y - 5, TXT_E, CENTER);
+}
+
+void DisplayDisplayWindSection(int x, int y, float angle, float windspeed, int Cradius) {
+
+  float wind_speed_knots =
+    cfg::UseMetricUnits ? windspeed * 1.94384 : windspeed * 0.8689;
+
+  setFont(OpenSans8B);
   drawString(x + 3, y + 50, String(angle, 0) + "°", CENTER);
   setFont(OpenSans12B);
   drawString(x, y - 50, WindDegToOrdinalDirection(angle), CENTER);
@@ -1526,7 +2040,6 @@ void DrawGauge(int x, int y, AQIndicator ind)
 
 void DisplayAQI(int x, int y)
 {
-    drawGrayscaleImage(ImgAIQ_info(x, y));
     setFont(OpenSans8B);
     // OWM's api uses 1=best...5=worst and we use x/5 scale, so we need to reverse the output
     int q = 6 - shared::WxAirQ.AQI;
@@ -1545,6 +2058,9 @@ void DisplayAirQualitySection(int x, int y)
     DrawGauge(x + aiq_w + 2 * gauge_w, y, cfg::AQIComponents[2]);
 }
 
+/// The background of DisplayAirQualitySection()
+void DisplayAirQualityImage(int x, int y) { drawGrayscaleImage(ImgAIQ_info(x, y + 1)); }
+
 // clang-format on
 } // namespace
 
@@ -1574,10 +2090,12 @@ void CalcDateTimeString(String&  Date_str, String&  Time_str){
   Time_str = time_output;
 
 }
-void DisplayGeneralInfoSection() {
-
+void DisplayVersion() {
   setFont(OpenSans5CB_Special2);
   drawString(SCREEN_WIDTH - 3, SCREEN_HEIGHT - 10, "v" + String(shared::app_ver), RIGHT);
+}
+
+void DisplayGeneralInfoSection() {
 
   setFont(OpenSans10B);
   drawString(5, 2, cfg::City, LEFT);
@@ -1616,9 +2134,7 @@ void DrawBattery(int x, int y) {
   auto const voltage = shared::voltage;
 
   if (voltage > 1 ) { // Only display if there is a valid reading
-    percentage = 2836.9625 * pow(voltage, 4) - 43987.4889 * pow(voltage, 3) + 255233.8134 * pow(voltage, 2) - 656689.7123 * voltage + 632041.7303;
-    if (voltage >= 4.20) percentage = 100;
-    if (voltage <= 3.20) percentage = 0;  // orig 3.5
+    percentage = battery_percentage(voltage);
     drawRect(x + 25, y - 14, 40, 15, Black);
     fillRect(x + 65, y - 10, 4, 7, Black);
     fillRect(x + 27, y - 12, 36 * percentage / 100.0, 11, Black);
@@ -1680,35 +2196,445 @@ void DisplayDebugTimingInfo()
 
     setFont(OpenSans5CB_Special2);
     drawString(SCREEN_WIDTH - 50, 25, dbg, RIGHT);
+
+    if (!Log_DrawTimingTrends) return;
+
+    // of the cycles before this one, see timing_history.h
+    struct Trend
+    {
+        char const *name;
+        PhaseSummary summary;
+    };
+
+    Trend const trends[] = {
+        {"wifi:", timing_summary({TimeEvent::ConnectWiFi})},
+        {"ntp:", timing_summary({TimeEvent::SetUpNTP, TimeEvent::SyncTime})},
+        {"api:", timing_summary({TimeEvent::FetchWeather, TimeEvent::ParseWeather, TimeEvent::FetchForecast,
+                                 TimeEvent::ParseForecast, TimeEvent::FetchAQI, TimeEvent::ParseAQI,
+                                 TimeEvent::CloseHttp})},
+        {"ui:", timing_summary({TimeEvent::DrawUI})},
+        {"epd:", timing_summary({TimeEvent::PowerOnScreen, TimeEvent::ClearScreen, TimeEvent::UpdateScreen})},
+        {"cycle:", timing_summary({TimeEvent::PowerCycle})},
+    };
+
+    // right-aligned columns: the name, then last, p50, p90 and max, in ms
+    int const right = SCREEN_WIDTH - 10, col = 40, line = 14;
+    int y           = 25 + line;
+
+    auto row = [&](String const& name, String const *values) {
+        drawString(right - 4 * col, y, name, RIGHT);
+        for (int i = 0; i < 4; i++)
+            drawString(right - (3 - i) * col, y, values[i], RIGHT);
+        y += line;
+    };
+
+    uint16_t cycles = 0;
+    int rows        = 1;
+    for (Trend const& t : trends)
+    {
+        cycles = std::max(cycles, t.summary.cycles);
+        rows += t.summary.cycles != 0;
+    }
+
+    // over the UI, so on a background of its own
+    fillRect(right - 4 * col - 70, y - 4, 4 * col + 75, rows * line + 4, White);
+
+    String const header[] = {"last", "p50", "p90", "max"};
+    row(String(cycles) + " cycles; ms", header);
+
+    for (Trend const& t : trends)
+    {
+        PhaseSummary const& s = t.summary;
+        String const values[] = {String(s.last_ms), String(s.p50_ms), String(s.p90_ms), String(s.max_ms)};
+        if (s.cycles != 0) row(t.name, values);
+    }
 }
 
 // clang-format on
 } // namespace
 
+// UI sections
+namespace
+{
+
+/// The data a section depends on, besides the time (see SectionSpec::inputs): a bit for each DataPart, and the battery.
+constexpr uint8_t InNone     = 0;
+constexpr uint8_t InWeather  = 1 << uint8_t(DataPart::Weather);
+constexpr uint8_t InForecast = 1 << uint8_t(DataPart::Forecast);
+constexpr uint8_t InAQI      = 1 << uint8_t(DataPart::AQI);
+constexpr uint8_t InBattery  = 1 << 3;
+constexpr uint8_t InAll      = InWeather | InForecast | InAQI | InBattery;
+
+struct SectionSpec
+{
+    /// Also the timing span the section is drawn in.
+    char const *name;
+    void (*draw)();
+    /// Everything the section draws is within this box; see the host emulator's --check-sections.
+    Rect_t box;
+    /// Sections of group 0 are drawn by the calling task, those of group 1 by a helper task on the other core, see
+    /// DrawWeatherSectionsDualCore().
+    uint8_t group;
+    /// The data `draw` reads, the In* bits; the section can be drawn as soon as that's populated, see BeginWeatherDraw().
+    uint8_t inputs;
+    /// Draws the parts of the section that don't depend on the weather data, before `draw`, or else they are copied
+    /// from the background layer (see cfg::CacheBackground). Optional.
+    void (*background)() = nullptr;
+};
+
+// The upper part of the screen (plus the astronomy section) is group 0; the forecast, the graphs and the version string
+// below them are group 1. On the host, the two take about the same time to draw.
 // clang-format off
-void DisplayWeather() {
-  OPT_LOG(Log_Lifecycle, Serial.println("Drawing UI..."));
-  assert(framebuffer);
+constexpr SectionSpec weatherSections[] = {
+  {"Status",       [] { DisplayStatusSection(600, 20, shared::wifi_signal); },    {772, 0, 188, 38},    0, InBattery}, // Wi-Fi signal strength and Battery voltage
+  {"Version",      [] {},                                                         {0, 382, 960, 158},   1, InNone, [] { DisplayVersion(); }}, // Bottom right corner
+  {"General info", [] { DisplayGeneralInfoSection(); },                           {0, 0, 772, 30},      0, InNone}, // Top line of the display
+  {"Wind",         [] { DisplayDisplayWindSection(137, 150, shared::WxConditions.Winddir, shared::WxConditions.Windspeed, 100); },
+                                                                                  {0, 28, 284, 244},    0, InWeather, [] { DrawCompassRose(137, 150, 100); }},
+  {"Astronomy",    [] { DisplayAstronomySection(5, 252); },                       {0, 272, 284, 110},   0, InWeather, [] { DisplayAstronomyImages(5, 252); }}, // Astronomy section Sun rise/set, Moon phase and Moon icon
+  {"Main weather", [] { DisplayMainWeatherSection(320, 110); },                   {284, 40, 400, 145},  0, InForecast, [] { DisplayMainWeatherIcons(320, 110); }}, // Centre section of display for Location, temperature, Weather report, current Wx Symbol
+  {"Weather text", [] { DisplayWeatherIconAndTextSection(SCREEN_WIDTH - 10, 196); }, {600, 38, 360, 207}, 0, InWeather},
+  {"Forecast",     [] { DisplayForecastSection(285, 220); },                      {284, 245, 676, 137}, 1, InForecast}, // 3hr forecast boxes
+  {"Graphs",       [] { DisplayGraphSection(320, 220); },                         {0, 382, 960, 158},   1, InForecast, [] { DisplayGraphFrames(); }}, // Graphs of pressure, temperature, humidity and rain or snowfall
+  {"Air quality",  [] { DisplayAirQualitySection(300, 195); },                    {284, 185, 400, 60},  0, InAQI, [] { DisplayAirQualityImage(300, 195); }},
+};
+// clang-format on
+
+/// true if the two rects have pixels in the same framebuffer byte
+constexpr bool shareBytes(Rect_t const& a, Rect_t const& b)
+{
+    return a.y < b.y + b.height && b.y < a.y + a.height && a.x / 2 <= (b.x + b.width - 1) / 2 &&
+           b.x / 2 <= (a.x + a.width - 1) / 2;
+}
+
+/// true if no two sections of different groups write to the same framebuffer byte
+constexpr bool groupsAreDisjoint()
+{
+    for (SectionSpec const& a : weatherSections)
+        for (SectionSpec const& b : weatherSections)
+            if (a.group != b.group && shareBytes(a.box, b.box)) return false;
+    return true;
+}
 
-  mark_event(TimeEvent::DrawUI);
-  DisplayStatusSection(600, 20, shared::wifi_signal);    // Wi-Fi signal strength and Battery voltage
-  DisplayGeneralInfoSection();                           // Top line of the display
-  DisplayDisplayWindSection(137, 150, shared::WxConditions.Winddir, shared::WxConditions.Windspeed, 100);
-  DisplayAstronomySection(5, 252);                       // Astronomy section Sun rise/set, Moon phase and Moon icon
-  DisplayMainWeatherSection(320, 110);                   // Centre section of display for Location, temperature, Weather report, current Wx Symbol
-  DisplayWeatherIconAndTextSection(SCREEN_WIDTH - 10, 196);
-  DisplayForecastSection(285, 220);                      // 3hr forecast boxes
-  DisplayGraphSection(320, 220);                         // Graphs of pressure, temperature, humidity and rain or snowfall
-  DisplayAirQualitySection(300, 195);
-  mark_event_done(TimeEvent::DrawUI);
+static_assert(groupsAreDisjoint(), "sections drawn concurrently must not share framebuffer bytes");
 
-  DisplayDebugTimingInfo();
+/// Set while the framebuffer already has the backgrounds of all the sections, copied from background_layer.
+bool backgrounds_drawn = false;
 
-  OPT_LOG(Log_Lifecycle, Serial.println("Updating screen..."));
-  clear_epd_flush_fb_and_power_off();
+void DrawSection(SectionSpec const& s)
+{
+    // looked up on every draw, it's a few string compares
+    AutoSpan span{define_span(s.name)};
+    if (s.background && !backgrounds_drawn) s.background();
+    s.draw();
 }
 
-// clang-format on
+void DrawWeatherSections()
+{
+    for (SectionSpec const& s : weatherSections)
+        DrawSection(s);
+}
+
+/// Draws the sections of a group into the framebuffer, each clipped to its box.
+void DrawSectionGroup(uint8_t group)
+{
+    ScreenView& fb = draw_state().fb;
+    fb.set_buffer(framebuffer);
+    for (SectionSpec const& s : weatherSections)
+        if (s.group == group)
+        {
+            fb.set_clip(s.box);
+            DrawSection(s);
+        }
+    fb.reset_clip();
+}
+
+/**
+ * @brief Draws the same as DrawWeatherSections(), but with the sections of group 1 drawn concurrently by a helper task.
+ *
+ * On the ESP32, the helper task is pinned to the other core. The groups don't share framebuffer bytes (and every
+ * section is clipped to its box), so the result is the same as drawing them in sequence.
+ */
+void DrawWeatherSectionsDualCore()
+{
+#ifndef HOST_BUILD
+#if CONFIG_FREERTOS_UNICORE
+    DrawWeatherSections();
+#else
+    auto helper = [](void *caller) {
+        {
+            DrawTask task;
+            DrawSectionGroup(1);
+        }
+        xTaskNotifyGive((TaskHandle_t)caller);
+        vTaskDelete(nullptr);
+    };
+
+    BaseType_t const other_core = 1 - xPortGetCoreID();
+    if (xTaskCreatePinnedToCore(helper, "ui_draw", 8192, xTaskGetCurrentTaskHandle(), uxTaskPriorityGet(nullptr),
+                                nullptr, other_core) != pdPASS)
+    {
+        DrawWeatherSections();
+        return;
+    }
+
+    DrawSectionGroup(0);
+    ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+#endif
+#else
+    std::thread helper{[] {
+        DrawTask task;
+        DrawSectionGroup(1);
+    }};
+    DrawSectionGroup(0);
+    helper.join();
+#endif
+}
+
+/// The name background_layer is stored under, see save_frame().
+char const *const BackgroundLayerName = "background";
+
+void DrawBackgrounds()
+{
+    for (SectionSpec const& s : weatherSections)
+        if (s.background) s.background();
+}
+
+/// Identifies what the backgrounds of the sections draw.
+uint64_t BackgroundLayerKey()
+{
+#ifndef HOST_BUILD
+    // all they depend on (the configuration, the language, fonts, images) is built into the firmware
+    uint64_t key;
+    memcpy(&key, esp_ota_get_app_description()->app_elf_sha256, sizeof(key));
+    return key;
+#else
+    // there's no firmware image to identify, so it's what's drawn
+    DisplayList list;
+    draw_state().recording = &list;
+    DrawBackgrounds();
+    draw_state().recording = nullptr;
+
+    return list.content_hash();
+#endif
+}
+
+/**
+ * @brief Makes background_layer available: restores it from flash or, if it's not there or it's from another firmware
+ * (with a different configuration, etc.), draws and stores it.
+ *
+ * Returns false if there's no memory for it.
+ */
+bool PrepareBackgroundLayer()
+{
+    if (background_layer) return true;
+
+    uint64_t const key = BackgroundLayerKey();
+
+#ifndef HOST_BUILD
+    background_layer = (uint8_t *)ps_malloc(EPD_WIDTH * EPD_HEIGHT / 2);
+#else
+    background_layer = (uint8_t *)malloc(EPD_WIDTH * EPD_HEIGHT / 2);
+#endif
+    if (!background_layer) return false;
+
+    if (load_frame(BackgroundLayerName, key, background_layer)) return true;
+
+    OPT_LOG(Log_Lifecycle, Serial.println("Drawing the background layer..."));
+
+    memset(background_layer, 0xFF, EPD_WIDTH * EPD_HEIGHT / 2);
+    draw_state().fb.set_buffer(background_layer);
+    DrawBackgrounds();
+    draw_state().fb.set_buffer(framebuffer);
+
+    size_t const size = save_frame(BackgroundLayerName, key, background_layer);
+    OPT_LOG(Log_Lifecycle, Serial.println("Saved the background layer, " + String((int)size) + " bytes compressed"));
+    return true;
+}
+
+/// Copies the background layer into the framebuffer, if it's enabled and available; see DrawSection().
+void CopyBackgroundLayer()
+{
+    backgrounds_drawn = cfg::CacheBackground && PrepareBackgroundLayer();
+    if (backgrounds_drawn) memcpy(framebuffer, background_layer, EPD_WIDTH * EPD_HEIGHT / 2);
+}
+
+constexpr size_t SectionCount = std::size(weatherSections);
+
+/// Set while the UI is being drawn ahead of DisplayWeather(), see BeginWeatherDraw().
+bool progressive = false;
+
+// Only touched by the task drawing progressively (on the host, the caller's).
+
+/// The sections drawn so far.
+std::bitset<SectionCount> sections_drawn;
+/// The In* bits made available so far.
+uint8_t inputs_ready = 0;
+
+/**
+ * @brief Draws, in order, the sections not drawn yet whose inputs are all ready and that don't share framebuffer bytes
+ * with an earlier section that's still to be drawn, so the result is the same as drawing them all in order.
+ */
+void DrawReadySections()
+{
+    draw_state().fb.set_buffer(framebuffer);
+    for (size_t i = 0; i < SectionCount; i++)
+    {
+        SectionSpec const& s = weatherSections[i];
+        bool can_draw        = !sections_drawn[i] && (s.inputs & ~inputs_ready) == 0;
+        for (size_t j = 0; can_draw && j < i; j++)
+            can_draw = sections_drawn[j] || !shareBytes(weatherSections[j].box, s.box);
+
+        if (can_draw)
+        {
+            DrawSection(s);
+            sections_drawn[i] = true;
+        }
+    }
+}
+
+#ifndef HOST_BUILD
+TaskHandle_t progressive_task = nullptr;
+/// Given by progressive_task when it's done.
+SemaphoreHandle_t progressive_done = nullptr;
+
+/// Notified to progressive_task, along with the In* bits, to stop drawing.
+constexpr uint32_t AbortDraw = 1 << 8;
+
+/**
+ * @brief Draws the sections as their inputs are notified, until all are drawn or it's aborted.
+ *
+ * The status section is only drawn once everything is notified, by EndProgressiveDraw(), so the task is still there to
+ * be notified until then.
+ */
+void progressive_draw(void *)
+{
+    {
+        DrawTask task;
+        CopyBackgroundLayer();
+        DrawReadySections();
+
+        while (!sections_drawn.all())
+        {
+            uint32_t bits = 0;
+            xTaskNotifyWait(0, UINT32_MAX, &bits, portMAX_DELAY);
+            if (bits & AbortDraw) break;
+
+            inputs_ready |= bits;
+            DrawReadySections();
+        }
+    }
+
+    xSemaphoreGive(progressive_done);
+    vTaskDelete(nullptr);
+}
+#endif
+
+/// Makes `inputs` available to the sections being drawn progressively.
+void NotifyInputs(uint32_t inputs)
+{
+#ifndef HOST_BUILD
+    xTaskNotify(progressive_task, inputs, eSetBits);
+#else
+    inputs_ready |= inputs;
+    DrawReadySections();
+#endif
+}
+
+/// Draws the sections that are left, or if `abort`, just stops drawing.
+void EndProgressiveDraw(bool abort)
+{
+#ifndef HOST_BUILD
+    xTaskNotify(progressive_task, abort ? AbortDraw : InAll, eSetBits);
+    xSemaphoreTake(progressive_done, portMAX_DELAY);
+    vSemaphoreDelete(progressive_done);
+    progressive_done = nullptr;
+    progressive_task = nullptr;
+#else
+    if (!abort) NotifyInputs(InAll);
+#endif
+    backgrounds_drawn = false;
+    progressive       = false;
+}
+
+} // namespace
+
+void BeginWeatherDraw()
+{
+    if (!cfg::ProgressiveDraw || cfg::BandRows != 0 || progressive) return;
+    assert(framebuffer);
+
+    sections_drawn.reset();
+    inputs_ready = 0;
+
+#ifndef HOST_BUILD
+    progressive_done = xSemaphoreCreateBinary();
+    if (!progressive_done) return;
+
+    // off the WiFi core (when there's a choice), sharing the caller's while it waits for the network
+#if CONFIG_FREERTOS_UNICORE
+    BaseType_t const core = 0;
+#else
+    BaseType_t const core = 1;
+#endif
+    if (xTaskCreatePinnedToCore(progressive_draw, "ui_progressive", 8192, nullptr, uxTaskPriorityGet(nullptr),
+                                &progressive_task, core) != pdPASS)
+    {
+        vSemaphoreDelete(progressive_done);
+        progressive_done = nullptr;
+        return;
+    }
+#else
+    CopyBackgroundLayer();
+    DrawReadySections();
+#endif
+
+    progressive = true;
+}
+
+void WeatherDataReady(DataPart part)
+{
+    if (progressive) NotifyInputs(1 << uint8_t(part));
+}
+
+void DisplayWeather()
+{
+    if (cfg::BandRows != 0)
+    {
+        // the UI is drawn once per band, so there's no separate DrawUI timing; it's all in UpdateScreen
+        OPT_LOG(Log_Lifecycle, Serial.println("Drawing UI and updating screen in bands..."));
+        draw_bands_flush_and_power_off([] {
+            DrawWeatherSections();
+            DisplayDebugTimingInfo();
+        });
+        error_on_screen = false;
+        return;
+    }
+
+    OPT_LOG(Log_Lifecycle, Serial.println("Drawing UI..."));
+    assert(framebuffer);
+
+    // with progressive drawing, just what's left of it
+    mark_event(TimeEvent::DrawUI);
+    if (progressive)
+        EndProgressiveDraw(false);
+    else
+    {
+        CopyBackgroundLayer();
+        if (cfg::DualCoreRender)
+            DrawWeatherSectionsDualCore();
+        else
+            DrawWeatherSections();
+        backgrounds_drawn = false;
+    }
+    mark_event_done(TimeEvent::DrawUI);
+
+    DisplayDebugTimingInfo();
+
+    OPT_LOG(Log_Lifecycle, Serial.println("Updating screen..."));
+    clear_epd_flush_fb_and_power_off();
+    error_on_screen = false;
+}
 
 namespace
 {
@@ -1722,22 +2648,161 @@ Rect_t getErrorArea()
 
 void DisplayError(String const& message)
 {
-    assert(framebuffer);
+    Rect_t const ea           = getErrorArea();
+    unsigned long const start = millis();
+
+    // the whole framebuffer is sent, without what's been drawn ahead
+    if (progressive)
+    {
+        EndProgressiveDraw(true);
+        memset(framebuffer, 0xFF, EPD_WIDTH * EPD_HEIGHT / 2);
+    }
 
-    int const pad = 20;
+    auto draw = [&] {
+        int const pad = 20;
 
-    Rect_t ea = getErrorArea();
-    fillRect(ea.x, ea.y, ea.width, ea.height, White);
+        fillRect(ea.x, ea.y, ea.width, ea.height, White);
 
-    drawRect(ea.x, ea.y, ea.width, ea.height, Black);
-    drawRect(ea.x + 1, ea.y + 1, ea.width - 2, ea.height - 2, Black);
+        drawRect(ea.x, ea.y, ea.width, ea.height, Black);
+        drawRect(ea.x + 1, ea.y + 1, ea.width - 2, ea.height - 2, Black);
 
-    setFont(OpenSans8B);
-    drawString_multiline(ea.x + pad, ea.y + pad, message);
+        setFont(OpenSans8B);
+        drawString_multiline(ea.x + pad, ea.y + pad, message);
+    };
+
+    if (!cfg::MonoErrorScreen || !draw_mono_flush_and_power_off(draw, ea))
+    {
+        if (cfg::BandRows != 0)
+            draw_bands_flush_and_power_off(draw, &ea);
+        else
+        {
+            assert(framebuffer);
+
+            draw();
+            clear_epd_flush_fb_and_power_off(&ea);
+        }
+    }
 
-    clear_epd_flush_fb_and_power_off(&ea);
+    error_on_screen = true;
+    OPT_LOG(Log_Lifecycle, Serial.println("Error screen shown in " + String(millis() - start) + " ms"));
 }
 
 bool InitGraphics() { return init_epd_alloc_fb(); }
 
+void StartScreenClear()
+{
+#ifndef HOST_BUILD
+    // the next cycle may well fail too, and its error screen would then be shown on a blank one
+    if (!cfg::EarlyScreenClear || early_clear || error_on_screen) return;
+
+    int64_t const now = cycle_time();
+    init_refresh_state(refresh_state);
+    if (screen_frame_valid && cfg::FullRefreshEvery > 1 && !full_refresh_due(refresh_state, now)) return;
+
+    early_clear_done = xSemaphoreCreateBinary();
+    if (!early_clear_done) return;
+
+    auto clear = [](void *) {
+        power_on_and_clear(nullptr);
+        xSemaphoreGive(early_clear_done);
+        vTaskDelete(nullptr);
+    };
+
+    // epd_clear() never yields: at the caller's priority, on the WiFi core, the network tasks preempt it and the caller
+    // gets the other core; any higher and it would hold the caller off until it's done
+    if (xTaskCreatePinnedToCore(clear, "epd_clear", 4096, nullptr, uxTaskPriorityGet(nullptr), nullptr, 0) != pdPASS)
+    {
+        vSemaphoreDelete(early_clear_done);
+        early_clear_done = nullptr;
+        return;
+    }
+    early_clear = true;
+#endif
+}
+
+#ifdef HOST_BUILD
+UiFont const *UiFonts(size_t& count)
+{
+    count = sizeof(uiFonts) / sizeof(uiFonts[0]);
+    return uiFonts;
+}
+
+void DrawConditionsIcon(int x, int y, String const& icon, bool large)
+{
+    draw_state().fb.set_buffer(framebuffer);
+    DrawConditionsProcedural(x, y, icon, large);
+}
+
+void DrawWeather()
+{
+    assert(framebuffer);
+
+    draw_state().fb.set_buffer(framebuffer);
+    DrawWeatherSections();
+    DisplayDebugTimingInfo();
+}
+
+void DrawWeatherDualCore()
+{
+    assert(framebuffer);
+
+    DrawWeatherSectionsDualCore();
+    draw_state().fb.set_buffer(framebuffer);
+    DisplayDebugTimingInfo();
+}
+
+size_t WeatherSectionCount() { return std::size(weatherSections); }
+
+bool DrawWeatherOverBackground()
+{
+    assert(framebuffer);
+
+    draw_state().fb.set_buffer(framebuffer);
+    CopyBackgroundLayer();
+    bool const copied = backgrounds_drawn;
+    DrawWeatherSections();
+    backgrounds_drawn = false;
+    DisplayDebugTimingInfo();
+    return copied;
+}
+
+void DrawWeatherProgressively(size_t drawn[4])
+{
+    BeginWeatherDraw();
+    if (!progressive)
+    {
+        DrawWeather();
+        return;
+    }
+
+    if (drawn) drawn[0] = sections_drawn.count();
+    for (DataPart part : {DataPart::Weather, DataPart::Forecast, DataPart::AQI})
+    {
+        WeatherDataReady(part);
+        if (drawn) drawn[uint8_t(part) + 1] = sections_drawn.count();
+    }
+    EndProgressiveDraw(false);
+    DisplayDebugTimingInfo();
+}
+
+char const *WeatherSectionName(size_t index) { return weatherSections[index].name; }
+
+Rect_t DrawWeatherSection(size_t index)
+{
+    draw_state().fb.set_buffer(framebuffer);
+    DrawSection(weatherSections[index]);
+    return weatherSections[index].box;
+}
+
+void RecordWeather(DisplayList& list)
+{
+    list.clear();
+
+    draw_state().recording = &list;
+    DrawWeatherSections();
+    DisplayDebugTimingInfo();
+    draw_state().recording = nullptr;
+}
+#endif
+
 uint8_t *Framebuffer() { return framebuffer; }
\ No newline at end of file
@@ -12,14 +12,91 @@
 #pragma once
 #include <Arduino.h> // for String
 
+#include "data_cycle.h"
+#include "text.h"
+
+#ifdef HOST_BUILD
+#include <epd_driver.h> // for Rect_t
+#endif
+
+/// A font the UI uses, with its name.
+struct UiFont
+{
+    char const *name;
+    FontFace face;
+};
+
 /// Inits the display hardware and allocates the frame buffer. (Safe to call in host build, as well)
 bool InitGraphics();
 
 /// Get the raw framebuffer. (only exposed for host build needs)
 uint8_t *Framebuffer();
 
+/**
+ * @brief Powers the screen on and clears it in a background task, if the next update is going to be a full refresh, so
+ * that it overlaps with the network phase (see cfg::EarlyScreenClear). The next DisplayWeather() or DisplayError()
+ * waits for it to finish, instead of clearing the screen itself. Not done after an error screen, as the rest of the
+ * screen still shows the last weather. Call after InitGraphics(); does nothing on the host.
+ */
+void StartScreenClear();
+
+/**
+ * @brief Starts drawing the weather UI ahead of DisplayWeather(), in a background task: each section is drawn as soon as
+ * the data it depends on is populated (see WeatherDataReady()), while the rest is still being fetched.
+ *
+ * DisplayWeather() then draws what's left and updates the screen; the result is the same as with DisplayWeather()
+ * alone. DisplayError() discards the drawing. Call when the time is set; does nothing unless cfg::ProgressiveDraw is
+ * set, or in band mode. On the host, the drawing is done by the calling thread.
+ */
+void BeginWeatherDraw();
+
+/// Tells the drawing started by BeginWeatherDraw(), if any, that `part` of the data is populated.
+void WeatherDataReady(DataPart part);
+
 /// Draws the weather UI. The data globals in the `shared` ns must be populated before calling this.
 void DisplayWeather();
 
 /// Draws the error UI.
-void DisplayError(String const& message);
\ No newline at end of file
+void DisplayError(String const& message);
+
+#ifdef HOST_BUILD
+/// All the fonts the UI uses; `count` is set to their number.
+UiFont const *UiFonts(size_t& count);
+
+/// Draws a weather condition icon (e.g. "10d") with drawing primitives, bypassing the pre-rendered sprites.
+/// Used to (re)generate the sprites themselves.
+void DrawConditionsIcon(int x, int y, String const& icon, bool large);
+
+/// Draws the weather UI into the framebuffer, like DisplayWeather() does, but without timing or flushing it.
+void DrawWeather();
+
+/// Same as DrawWeather(), but with the UI sections split between two threads (see cfg::DualCoreRender).
+void DrawWeatherDualCore();
+
+/**
+ * @brief Same as DrawWeather(), but the parts of the UI that don't depend on the weather data are copied from the
+ * background layer (see cfg::CacheBackground), which is prepared first, if needed. Returns false if there's no layer,
+ * and so everything is drawn.
+ */
+bool DrawWeatherOverBackground();
+
+/**
+ * @brief Same as DrawWeather(), but drawn progressively (see BeginWeatherDraw()), with the parts of the data made ready
+ * one by one. If not null, `drawn` gets the number of sections drawn before any of the data, then after each DataPart.
+ */
+void DrawWeatherProgressively(size_t drawn[4] = nullptr);
+
+/// The number of sections the weather UI is made of.
+size_t WeatherSectionCount();
+
+/// The name of section `index` of the weather UI, also its timing span.
+char const *WeatherSectionName(size_t index);
+
+/// Draws just the section `index` of the weather UI, unclipped. Returns the box the section is supposed to fit in.
+Rect_t DrawWeatherSection(size_t index);
+
+class DisplayList;
+
+/// Records the drawing of the weather UI into `list` (which is cleared first), instead of drawing it.
+void RecordWeather(DisplayList& list);
+#endif
\ No newline at end of file
@@ -0,0 +1,454 @@
+/*
+ * Copyright (c) 2024 zahical. All rights reserved.
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+/**
+ * @file DisplayList implementation.
+ */
+
+#include "display_list.h"
+
+#include <algorithm>
+#include <cassert>
+#include <cinttypes>
+#include <cstdio>
+#include <cstring>
+#include <limits>
+#include <unordered_map>
+
+namespace
+{
+Rect_t const screen{0, 0, EPD_WIDTH, EPD_HEIGHT};
+
+/// The intersection of `a` and `b`, empty (0x0) if they don't overlap.
+Rect_t intersect(Rect_t const& a, Rect_t const& b)
+{
+    int32_t const x0 = std::max(a.x, b.x), x1 = std::min(a.x + a.width, b.x + b.width);
+    int32_t const y0 = std::max(a.y, b.y), y1 = std::min(a.y + a.height, b.y + b.height);
+    if (x0 >= x1 || y0 >= y1) return {0, 0, 0, 0};
+    return {x0, y0, x1 - x0, y1 - y0};
+}
+
+bool overlap(Rect_t const& a, Rect_t const& b)
+{
+    return a.x < b.x + b.width && b.x < a.x + a.width && a.y < b.y + b.height && b.y < a.y + a.height;
+}
+
+Rect_t unite(Rect_t const& a, Rect_t const& b)
+{
+    int32_t const x0 = std::min(a.x, b.x), x1 = std::max(a.x + a.width, b.x + b.width);
+    int32_t const y0 = std::min(a.y, b.y), y1 = std::max(a.y + a.height, b.y + b.height);
+    return {x0, y0, x1 - x0, y1 - y0};
+}
+
+/// The box of the points, as drawn by 1 pixel wide lines.
+Rect_t points_box(std::initializer_list<int32_t> xs, std::initializer_list<int32_t> ys)
+{
+    auto const [x0, x1] = std::minmax(xs);
+    auto const [y0, y1] = std::minmax(ys);
+    return {x0, y0, x1 - x0 + 1, y1 - y0 + 1};
+}
+
+struct Fnv
+{
+    uint64_t h = 0xcbf29ce484222325;
+
+    void add(void const *data, size_t size)
+    {
+        for (uint8_t const *p = static_cast<uint8_t const *>(data), *end = p + size; p < end; p++)
+            h = (h ^ *p) * 0x100000001b3;
+    }
+
+    template <typename T>
+    void add(T const& v)
+    {
+        add(&v, sizeof(v));
+    }
+};
+
+/// by DisplayList::Kind
+char const *const kind_names[] = {
+    "pixel",
+    "hline",
+    "vline",
+    "rect",
+    "fill_rect",
+    "line",
+    "circle",
+    "fill_circle",
+    "fill_ring",
+    "fill_triangle",
+    "blit",
+    "modify_rect",
+    "invert_rect",
+    "add_rect",
+    "threshold_rect",
+    "text",
+    "text_multiline",
+};
+
+} // namespace
+
+void DisplayList::clear()
+{
+    _ops.clear();
+    _refs.clear();
+    _strings.clear();
+}
+
+size_t DisplayList::bytes() const
+{
+    return _ops.size() * sizeof(Op) + _refs.size() * sizeof(Ref) + _strings.size();
+}
+
+Rect_t DisplayList::bounds(size_t index) const
+{
+    Op const& op = _ops[index];
+    return {op.x, op.y, op.w, op.h};
+}
+
+DisplayList::Op& DisplayList::add(Kind kind, std::initializer_list<int32_t> v, uint8_t color, Rect_t const& box)
+{
+    Rect_t const b = intersect(box, screen);
+
+    Op& op   = _ops.emplace_back();
+    op.kind  = kind;
+    op.color = color;
+    op.ref   = 0;
+    op.x     = b.x;
+    op.y     = b.y;
+    op.w     = b.width;
+    op.h     = b.height;
+
+    int16_t *dst = op.v;
+    for (int32_t value : v)
+    {
+        assert(value >= std::numeric_limits<int16_t>::min() && value <= std::numeric_limits<int16_t>::max());
+        *dst++ = value;
+    }
+    std::fill(dst, std::end(op.v), 0);
+
+    return op;
+}
+
+DisplayList::Ref& DisplayList::add_ref(Op& op)
+{
+    assert(_refs.size() <= std::numeric_limits<uint16_t>::max());
+
+    op.ref   = _refs.size();
+    Ref& ref = _refs.emplace_back();
+    memset(&ref, 0, sizeof(ref));
+    return ref;
+}
+
+void DisplayList::pixel(int32_t x, int32_t y, uint8_t color) { add(Kind::Pixel, {x, y}, color, {x, y, 1, 1}); }
+
+void DisplayList::hline(int32_t x, int32_t y, int32_t length, uint8_t color)
+{
+    add(Kind::HLine, {x, y, length}, color, {x, y, length, 1});
+}
+
+void DisplayList::vline(int32_t x, int32_t y, int32_t length, uint8_t color)
+{
+    add(Kind::VLine, {x, y, length}, color, {x, y, 1, length});
+}
+
+void DisplayList::rect(int32_t x, int32_t y, int32_t w, int32_t h, uint8_t color)
+{
+    // with a negative or 0 size, some of the sides are still drawn, outside of the (x, y, w, h) rect
+    add(Kind::Rect, {x, y, w, h}, color, points_box({x, x + w - 1}, {y, y + h - 1}));
+}
+
+void DisplayList::fill_rect(int32_t x, int32_t y, int32_t w, int32_t h, uint8_t color)
+{
+    add(Kind::FillRect, {x, y, w, h}, color, {x, y, w, h});
+}
+
+void DisplayList::line(int32_t x0, int32_t y0, int32_t x1, int32_t y1, uint8_t color)
+{
+    add(Kind::Line, {x0, y0, x1, y1}, color, points_box({x0, x1}, {y0, y1}));
+}
+
+void DisplayList::circle(int32_t x0, int32_t y0, int32_t r, uint8_t color)
+{
+    // a negative radius still draws the 4 "cardinal" points
+    int32_t const ar = std::abs(r);
+    add(Kind::Circle, {x0, y0, r}, color, {x0 - ar, y0 - ar, 2 * ar + 1, 2 * ar + 1});
+}
+
+void DisplayList::fill_circle(int32_t x0, int32_t y0, int32_t r, uint8_t color)
+{
+    add(Kind::FillCircle, {x0, y0, r}, color, {x0 - r, y0 - r, 2 * r + 1, 2 * r + 1});
+}
+
+void DisplayList::fill_ring(int32_t x0, int32_t y0, int32_t r_outer, int32_t r_inner, uint8_t color)
+{
+    add(Kind::FillRing, {x0, y0, r_outer, r_inner}, color,
+        {x0 - r_outer, y0 - r_outer, 2 * r_outer + 1, 2 * r_outer + 1});
+}
+
+void DisplayList::fill_triangle(int32_t x0, int32_t y0, int32_t x1, int32_t y1, int32_t x2, int32_t y2, uint8_t color)
+{
+    add(Kind::FillTriangle, {x0, y0, x1, y1, x2, y2}, color, points_box({x0, x1, x2}, {y0, y1, y2}));
+}
+
+void DisplayList::blit(Rect_t const& area, uint8_t const *data)
+{
+    add_ref(add(Kind::Blit, {area.x, area.y, area.width, area.height}, 0, area)).data = data;
+}
+
+void DisplayList::invert_rect(Rect_t const& rect)
+{
+    add(Kind::InvertRect, {rect.x, rect.y, rect.width, rect.height}, 0, rect);
+}
+
+void DisplayList::add_rect(Rect_t const& rect, int8_t delta)
+{
+    add(Kind::AddRect, {rect.x, rect.y, rect.width, rect.height, delta}, 0, rect);
+}
+
+void DisplayList::threshold_rect(Rect_t const& rect, uint8_t level)
+{
+    add(Kind::ThresholdRect, {rect.x, rect.y, rect.width, rect.height}, level, rect);
+}
+
+void DisplayList::text(FontFace const& face, char const *str, int32_t x, int32_t y, FontProperties const *props)
+{
+    Ref& ref      = add_ref(add(Kind::Text, {x, y}, 0, text_box(face, str, x, y, props)));
+    ref.face      = &face;
+    ref.has_props = props != nullptr;
+    if (props) ref.props = *props;
+    ref.str = _strings.size();
+    _strings.insert(_strings.end(), str, str + strlen(str) + 1);
+}
+
+void DisplayList::text_multiline(FontFace const& face, char const *str, int32_t x, int32_t y)
+{
+    // not worth measuring, these are rare
+    Ref& ref = add_ref(add(Kind::TextMultiline, {x, y}, 0, screen));
+    ref.face = &face;
+    ref.str  = _strings.size();
+    _strings.insert(_strings.end(), str, str + strlen(str) + 1);
+}
+
+void DisplayList::replay(ScreenView& view) const
+{
+    Rect_t const clip = view.clip();
+    int32_t const top = clip.y;
+    int32_t const end = clip.y + clip.height;
+
+    for (Op const& op : _ops)
+    {
+        if (op.y + op.h <= top || op.y >= end || op.h == 0) continue;
+
+        int16_t const *v = op.v;
+
+        switch (op.kind)
+        {
+        case Kind::Pixel: view.pixel(v[0], v[1], op.color); break;
+        case Kind::HLine: view.hline(v[0], v[1], v[2], op.color); break;
+        case Kind::VLine: view.vline(v[0], v[1], v[2], op.color); break;
+        case Kind::Rect: view.rect(v[0], v[1], v[2], v[3], op.color); break;
+        case Kind::FillRect: view.fill_rect(v[0], v[1], v[2], v[3], op.color); break;
+        case Kind::Line: view.line(v[0], v[1], v[2], v[3], op.color); break;
+        case Kind::Circle: view.circle(v[0], v[1], v[2], op.color); break;
+        case Kind::FillCircle: view.fill_circle(v[0], v[1], v[2], op.color); break;
+        case Kind::FillRing: view.fill_ring(v[0], v[1], v[2], v[3], op.color); break;
+        case Kind::FillTriangle: view.fill_triangle(v[0], v[1], v[2], v[3], v[4], v[5], op.color); break;
+        case Kind::Blit: view.blit({v[0], v[1], v[2], v[3]}, _refs[op.ref].data); break;
+        case Kind::ModifyRect:
+        {
+            uint8_t const *lut = _refs[op.ref].lut;
+            view.modify_rect({v[0], v[1], v[2], v[3]}, [lut](uint8_t c) { return lut[c >> 4] << 4; });
+            break;
+        }
+        case Kind::InvertRect: view.invert_rect({v[0], v[1], v[2], v[3]}); break;
+        case Kind::AddRect: view.add_rect({v[0], v[1], v[2], v[3]}, v[4]); break;
+        case Kind::ThresholdRect: view.threshold_rect({v[0], v[1], v[2], v[3]}, op.color); break;
+        case Kind::Text:
+        {
+            Ref const& ref = _refs[op.ref];
+            int32_t x = v[0], y = v[1];
+            draw_text(*ref.face, &_strings[ref.str], &x, &y, view, ref.has_props ? &ref.props : nullptr);
+            break;
+        }
+        case Kind::TextMultiline:
+        {
+            Ref const& ref = _refs[op.ref];
+            int32_t x = v[0], y = v[1];
+            draw_text_multiline(*ref.face, &_strings[ref.str], &x, &y, view);
+            break;
+        }
+        }
+    }
+}
+
+uint64_t DisplayList::hash(Op const& op) const
+{
+    Fnv h;
+    h.add(op.kind);
+    h.add(op.color);
+    h.add(op.x), h.add(op.y), h.add(op.w), h.add(op.h);
+    h.add(op.v);
+
+    switch (op.kind)
+    {
+    case Kind::Blit: h.add(_refs[op.ref].data); break;
+    case Kind::ModifyRect: h.add(_refs[op.ref].lut); break;
+    case Kind::Text:
+    case Kind::TextMultiline:
+    {
+        Ref const& ref = _refs[op.ref];
+        h.add(ref.face->font);
+        h.add(&_strings[ref.str], strlen(&_strings[ref.str]));
+        if (ref.has_props)
+        {
+            h.add(uint8_t(ref.props.fg_color)), h.add(uint8_t(ref.props.bg_color));
+            h.add(ref.props.fallback_glyph), h.add(ref.props.flags);
+        }
+        break;
+    }
+    default: break;
+    }
+
+    return h.h;
+}
+
+std::vector<Rect_t> DisplayList::diff(DisplayList const& prev) const
+{
+    std::vector<uint64_t> hashes(_ops.size()), prev_hashes(prev._ops.size());
+    for (size_t i = 0; i < _ops.size(); i++)
+        hashes[i] = hash(_ops[i]);
+    for (size_t i = 0; i < prev._ops.size(); i++)
+        prev_hashes[i] = prev.hash(prev._ops[i]);
+
+    // from one cycle to the next most ops are the same, skip the common start and end
+    size_t const common = std::min(hashes.size(), prev_hashes.size());
+    size_t start = 0, end = 0;
+    while (start < common && hashes[start] == prev_hashes[start])
+        start++;
+    while (end < common - start && hashes[hashes.size() - 1 - end] == prev_hashes[prev_hashes.size() - 1 - end])
+        end++;
+
+    size_t const last      = hashes.size() - end;
+    size_t const prev_last = prev_hashes.size() - end;
+
+    // the previous list's ops in between, by hash, in reverse order; matched ones are consumed from the back
+    std::unordered_map<uint64_t, std::vector<uint32_t>> unmatched;
+    for (size_t i = prev_last; i-- > start;)
+        unmatched[prev_hashes[i]].push_back(i);
+
+    std::vector<Rect_t> dirty;
+    std::vector<bool> prev_matched(prev_last);
+    int64_t last_match = -1;
+
+    for (size_t i = start; i < last; i++)
+    {
+        auto it = unmatched.find(hashes[i]);
+        if (it != unmatched.end() && !it->second.empty())
+        {
+            uint32_t const match = it->second.back();
+            it->second.pop_back();
+            prev_matched[match] = true;
+
+            // an op that is drawn in a different order relative to the others may change its overlaps with them
+            if (match > last_match)
+            {
+                last_match = match;
+                continue;
+            }
+        }
+        dirty.push_back(bounds(i));
+    }
+
+    for (size_t i = start; i < prev_last; i++)
+        if (!prev_matched[i]) dirty.push_back(prev.bounds(i));
+
+    // merge overlapping areas, until no two overlap
+    dirty.erase(std::remove_if(dirty.begin(), dirty.end(), [](Rect_t const& r) { return r.width * r.height == 0; }),
+                dirty.end());
+
+    for (bool merged = true; merged;)
+    {
+        merged = false;
+        for (size_t i = 0; i < dirty.size(); i++)
+            for (size_t j = i + 1; j < dirty.size(); j++)
+                if (overlap(dirty[i], dirty[j]))
+                {
+                    dirty[i] = unite(dirty[i], dirty[j]);
+                    dirty.erase(dirty.begin() + j);
+                    merged = true;
+                    j      = i;
+                }
+    }
+
+    return dirty;
+}
+
+std::string DisplayList::serialize() const
+{
+    std::string out;
+    char line[128];
+
+    for (size_t i = 0; i < _ops.size(); i++)
+    {
+        Op const& op = _ops[i];
+        out += kind_names[static_cast<int>(op.kind)];
+
+        for (int16_t v : op.v)
+            out += ' ' + std::to_string(v);
+
+        snprintf(line, sizeof(line), " color=%02X box=%d,%d,%d,%d", op.color, op.x, op.y, op.w, op.h);
+        out += line;
+
+        switch (op.kind)
+        {
+        case Kind::Blit:
+        {
+            Fnv h;
+            h.add(_refs[op.ref].data, (op.v[2] / 2 + op.v[2] % 2) * op.v[3]);
+            snprintf(line, sizeof(line), " data=%016" PRIx64, h.h);
+            out += line;
+            break;
+        }
+        case Kind::ModifyRect:
+            out += " lut=";
+            for (uint8_t c : _refs[op.ref].lut)
+                out += "0123456789ABCDEF"[c & 0x0F];
+            break;
+        case Kind::Text:
+        case Kind::TextMultiline:
+        {
+            Ref const& ref = _refs[op.ref];
+            snprintf(line, sizeof(line), " font=%d/%d/%d", ref.face->font->advance_y, ref.face->font->ascender,
+                     ref.face->font->descender);
+            out += line;
+            if (ref.has_props)
+            {
+                snprintf(line, sizeof(line), " props=%X/%X/%" PRIu32 "/%" PRIu32, ref.props.fg_color,
+                         ref.props.bg_color, ref.props.fallback_glyph, ref.props.flags);
+                out += line;
+            }
+            out += " \"";
+            out += &_strings[ref.str];
+            out += '"';
+            break;
+        }
+        default: break;
+        }
+
+        out += '\n';
+    }
+
+    return out;
+}
+
+uint64_t DisplayList::content_hash() const
+{
+    std::string const dump = serialize();
+
+    Fnv h;
+    h.add(dump.data(), dump.size());
+    return h.h;
+}
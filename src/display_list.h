@@ -0,0 +1,158 @@
+/*
+ * Copyright (c) 2024 zahical. All rights reserved.
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+/**
+ * @file A recorded sequence of drawing operations.
+ *
+ * A DisplayList has the same drawing methods as a ScreenView, but instead of drawing, it records the calls, so they
+ * can be replayed later into any view. Replaying into views clipped to different horizontal bands of the same
+ * framebuffer draws the full screen piece by piece; since no two bands share a framebuffer byte, they can be replayed
+ * concurrently.
+ *
+ * Every operation also records the (exact, or else conservative) box it may draw to, clipped to the screen, so
+ * replaying into a band skips the operations that don't touch it without even looking at their geometry, and two lists
+ * can be compared to find the areas of the screen they draw differently (see diff()).
+ *
+ * Operations are kept compact, 24 bytes each, with the rare bulky arguments (text, images, color tables) stored on
+ * the side. Coordinates are stored in 16 bits, which is plenty for any screen.
+ *
+ * Replaying doesn't modify the list and the list doesn't reference any other mutable state, so a single list may be
+ * replayed from several threads at once.
+ */
+
+#pragma once
+#include "fb_view.h"
+#include "text.h"
+
+#include <cstdint>
+#include <initializer_list>
+#include <string>
+#include <vector>
+
+class DisplayList
+{
+  public:
+    void clear();
+
+    size_t size() const { return _ops.size(); }
+
+    /// Memory used by the recorded operations and their arguments, in bytes.
+    size_t bytes() const;
+
+    /// The screen area operation `index` may draw to; empty if it's entirely off-screen.
+    Rect_t bounds(size_t index) const;
+
+    // ScreenView drawing methods
+
+    void pixel(int32_t x, int32_t y, uint8_t color);
+    void hline(int32_t x, int32_t y, int32_t length, uint8_t color);
+    void vline(int32_t x, int32_t y, int32_t length, uint8_t color);
+    void rect(int32_t x, int32_t y, int32_t w, int32_t h, uint8_t color);
+    void fill_rect(int32_t x, int32_t y, int32_t w, int32_t h, uint8_t color);
+    void line(int32_t x0, int32_t y0, int32_t x1, int32_t y1, uint8_t color);
+    void circle(int32_t x0, int32_t y0, int32_t r, uint8_t color);
+    void fill_circle(int32_t x0, int32_t y0, int32_t r, uint8_t color);
+    void fill_ring(int32_t x0, int32_t y0, int32_t r_outer, int32_t r_inner, uint8_t color);
+    void fill_triangle(int32_t x0, int32_t y0, int32_t x1, int32_t y1, int32_t x2, int32_t y2, uint8_t color);
+    /// `data` is not copied, it must outlive the list.
+    void blit(Rect_t const& area, uint8_t const *data);
+
+    void invert_rect(Rect_t const& rect);
+    void add_rect(Rect_t const& rect, int8_t delta);
+    void threshold_rect(Rect_t const& rect, uint8_t level);
+
+    /// See ScreenView::modify_rect(). `mod` is evaluated right away, for the 16 colors it can ever be passed.
+    template <typename FCall>
+    void modify_rect(Rect_t const& rect, FCall&& mod)
+    {
+        Ref& ref = add_ref(add(Kind::ModifyRect, {rect.x, rect.y, rect.width, rect.height}, 0, rect));
+        for (int c = 0; c < 16; c++)
+            ref.lut[c] = mod(c | c << 4) >> 4;
+    }
+
+    // text.h drawing functions
+
+    /// See draw_text(). The string is copied.
+    void text(FontFace const& face, char const *str, int32_t x, int32_t y, FontProperties const *props);
+    /// See draw_text_multiline(). The string is copied.
+    void text_multiline(FontFace const& face, char const *str, int32_t x, int32_t y);
+
+    /// Draws all the recorded operations into `view`, in order.
+    void replay(ScreenView& view) const;
+
+    /**
+     * @brief Finds the areas of the screen that replaying this list draws differently than replaying `prev`, over the
+     * same framebuffer content.
+     *
+     * These are the boxes of the operations that either list has and the other doesn't, or has in a different order,
+     * merged where they overlap. Equal lists give no areas. Operations are compared by a 64-bit hash of all their
+     * arguments; images by their data pointer, not content.
+     */
+    std::vector<Rect_t> diff(DisplayList const& prev) const;
+
+    /**
+     * @brief A textual dump of the list, one operation per line with its arguments and box.
+     *
+     * Image data is represented by a hash of its content and fonts by their metrics, so dumps of the same drawing are
+     * the same from build to build; meant for comparing with expected output in tests.
+     */
+    std::string serialize() const;
+
+    /// A hash of serialize(), so of image content too: the same for the same drawing from build to build.
+    uint64_t content_hash() const;
+
+  private:
+    enum class Kind : uint8_t
+    {
+        Pixel,
+        HLine,
+        VLine,
+        Rect,
+        FillRect,
+        Line,
+        Circle,
+        FillCircle,
+        FillRing,
+        FillTriangle,
+        Blit,
+        ModifyRect,
+        InvertRect,
+        AddRect,
+        ThresholdRect,
+        Text,
+        TextMultiline,
+    };
+
+    struct Op
+    {
+        Kind kind;
+        uint8_t color;
+        uint16_t ref;       // index in _refs, for the kinds that have one
+        int16_t x, y, w, h; // the box the op may draw to
+        int16_t v[6];       // the arguments
+    };
+    static_assert(sizeof(Op) == 24, "DisplayList::Op should be compact");
+
+    /// The bulky arguments of some operations.
+    struct Ref
+    {
+        uint8_t const *data;  // Blit
+        FontFace const *face; // Text, TextMultiline
+        uint32_t str;         // Text, TextMultiline: offset in _strings
+        bool has_props;       // Text
+        FontProperties props; // Text
+        uint8_t lut[16];      // ModifyRect: new color for each old one
+    };
+
+    Op& add(Kind kind, std::initializer_list<int32_t> v, uint8_t color, Rect_t const& box);
+    Ref& add_ref(Op& op);
+
+    /// A hash of the operation, including its bulky arguments.
+    uint64_t hash(Op const& op) const;
+
+    std::vector<Op> _ops;
+    std::vector<Ref> _refs;
+    std::vector<char> _strings;
+};
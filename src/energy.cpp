@@ -0,0 +1,129 @@
+/*
+ * Copyright (c) 2024 zahical. All rights reserved.
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+/**
+ * @file Energy estimates implementation.
+ */
+
+#include "energy.h"
+#include "config.h"
+#include "shared_data.h"
+#include "timing_history.h"
+#include "timings.h"
+
+#include <Arduino.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <initializer_list>
+#include <tuple>
+
+namespace
+{
+// the WiFi is on from the connection until after the API calls
+constexpr std::initializer_list<TimeEvent> RadioPhases = {
+    TimeEvent::ConnectWiFi,   TimeEvent::SetUpNTP, TimeEvent::SyncTime, TimeEvent::FetchWeather,
+    TimeEvent::ParseWeather,  TimeEvent::FetchForecast,
+    TimeEvent::ParseForecast, TimeEvent::FetchAQI, TimeEvent::ParseAQI, TimeEvent::CloseHttp,
+};
+
+double span_s(std::initializer_list<TimeEvent> phases)
+{
+    uint32_t us = 0;
+    for (TimeEvent e : phases)
+        us += get_span_stats(span_id(e)).total_us;
+    return us / 1e6;
+}
+
+double median_s(std::initializer_list<TimeEvent> phases) { return timing_summary(phases).p50_ms / 1e3; }
+
+constexpr double SecondsPerHour = 3600;
+} // namespace
+
+double wake_mah(WakePhases const& wake)
+{
+    return (wake.awake_s * cfg::AwakeMa + wake.radio_s * cfg::RadioMa + wake.epd_s * cfg::EpdMa) / SecondsPerHour;
+}
+
+WakePhases this_wake()
+{
+    WakePhases wake;
+    wake.radio_s = span_s(RadioPhases);
+    wake.epd_s   = span_s({TimeEvent::ScreenOn});
+
+    // the host has no power cycle; there the phases it measures are all of the wake
+    wake.awake_s = span_s({TimeEvent::PowerCycle});
+    if (wake.awake_s == 0) wake.awake_s = wake.radio_s + wake.epd_s + span_s({TimeEvent::DrawUI});
+    return wake;
+}
+
+WakePhases typical_wake()
+{
+    if (timing_summary({TimeEvent::PowerCycle}).cycles == 0) return this_wake();
+
+    WakePhases wake;
+    wake.awake_s = median_s({TimeEvent::PowerCycle});
+    wake.radio_s = median_s(RadioPhases);
+    wake.epd_s   = median_s({TimeEvent::ScreenOn});
+    return wake;
+}
+
+DayEnergy day_energy(Scheduler scheduler, WakePhases const& wake)
+{
+    using std::chrono::seconds;
+    constexpr seconds Day = std::chrono::hours{24};
+
+    // the wakes of a day, from after midnight to midnight
+    DayEnergy day;
+    seconds elapsed{0};
+    for (;;)
+    {
+        seconds const sleep = std::get<0>(scheduler.plan_sleep(DailyTime{elapsed}));
+        if (sleep <= seconds::zero() || elapsed + sleep > Day) break;
+
+        elapsed += sleep;
+        day.wakes++;
+    }
+
+    double const asleep_s = std::max(0.0, double(Day.count()) - day.wakes * wake.awake_s);
+    day.awake_mah         = day.wakes * wake_mah(wake);
+    day.sleep_mah         = asleep_s * cfg::SleepMa / SecondsPerHour;
+    return day;
+}
+
+uint8_t battery_percentage(float voltage)
+{
+    if (voltage >= 4.20) return 100;
+    // the fit has its minimum, about 0, at 3.515 V, and rises again below it: 125 at 3.3 V, 324 at 3.2 V
+    if (voltage <= 3.52) return 0;
+
+    // and it's a little off either end of the range that's left: -0.3 at 3.52 V, 100.8 at 4.2 V
+    double const percentage = 2836.9625 * pow(voltage, 4) - 43987.4889 * pow(voltage, 3) +
+                              255233.8134 * pow(voltage, 2) - 656689.7123 * voltage + 632041.7303;
+    return uint8_t(std::max(0.0, std::min(percentage, 100.0)));
+}
+
+double battery_days(float voltage, double mah_per_day)
+{
+    double const left = voltage > 1 ? battery_percentage(voltage) / 100.0 : 1.0;
+    return mah_per_day > 0 ? cfg::BatteryMah * left / mah_per_day : 0;
+}
+
+void log_energy()
+{
+    WakePhases const wake = this_wake();
+    DayEnergy const day   = day_energy(Scheduler{cfg::OnTime, cfg::OffTime, cfg::RefreshPeriod, cfg::MaxDrift},
+                                       typical_wake());
+
+    Serial.println("Energy: this wake " + String(wake_mah(wake), 3) + " mAh (awake " + String(wake.awake_s, 1) +
+                   " s, WiFi " + String(wake.radio_s, 1) + " s, EPD " + String(wake.epd_s, 1) + " s); a typical day " +
+                   String(day.wakes) + " wakes, " + String(day.mah(), 1) + " mAh (" + String(day.sleep_mah, 1) +
+                   " asleep)");
+
+    if (shared::voltage > 1)
+        Serial.println("Battery: " + String(battery_percentage(shared::voltage)) + "%, about " +
+                       String(battery_days(shared::voltage, day.mah()), 0) + " days left");
+}
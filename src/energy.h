@@ -0,0 +1,64 @@
+/*
+ * Copyright (c) 2024 zahical. All rights reserved.
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+/**
+ * @file Estimating the charge drawn from the battery, per wake and per day, and the battery life.
+ *
+ * The board draws a current of its own while awake, more while the WiFi is on and while the panel is powered, and a
+ * small one in deep sleep (see the power model in config.cpp). Combined with the phase durations of the timing spans
+ * (see timings.h), that gives the charge of a wake; with the wakes the Scheduler plans in a day, the charge per day;
+ * and with what's left in the battery, how long it will last. The currents are rough, assumed figures: the estimates
+ * are for comparing settings and changes, e.g. the refresh period or the radio settings, not for exact battery life.
+ */
+
+#pragma once
+#include "schedule.h"
+
+#include <cstdint>
+
+/// The time spent in each phase of a wake, in seconds.
+struct WakePhases
+{
+    /// From wake-up to deep sleep.
+    double awake_s = 0;
+    /// With the WiFi on: connecting, the time sync and the API calls.
+    double radio_s = 0;
+    /// With the panel powered, from power-on to power-off (see TimeEvent::ScreenOn), whatever the CPU does meanwhile.
+    double epd_s = 0;
+};
+
+/// The charge drawn in `wake`, in mAh.
+double wake_mah(WakePhases const& wake);
+
+/// This wake's phases, from the timing spans.
+WakePhases this_wake();
+
+/// A typical wake's phases: the median of each over the last cycles (see timing_history.h), or else this wake's.
+WakePhases typical_wake();
+
+/// The charge drawn in a day, in mAh.
+struct DayEnergy
+{
+    unsigned wakes   = 0;
+    double awake_mah = 0;
+    double sleep_mah = 0;
+
+    double mah() const { return awake_mah + sleep_mah; }
+};
+
+/// The charge drawn in a day of the `scheduler` plan, with every wake like `wake`.
+DayEnergy day_energy(Scheduler scheduler, WakePhases const& wake);
+
+/// The charge left in the battery, in %, from its voltage; as the UI shows it.
+uint8_t battery_percentage(float voltage);
+
+/// How long the battery lasts, in days, at `voltage` (or, if 0, fully charged) and `mah_per_day`.
+double battery_days(float voltage, double mah_per_day);
+
+/**
+ * @brief Logs the charge of this wake, of a typical day under the configured schedule, and the battery life left at the
+ * battery voltage measured (see shared::voltage), using Serial.print().
+ */
+void log_energy();
@@ -0,0 +1,57 @@
+/*
+ * Copyright (c) 2024 zahical. All rights reserved.
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+/**
+ * @file EPD conversion table implementation.
+ */
+
+#include "epd_lut.h"
+
+#include <cstring>
+
+void reset_lut(uint8_t *lut, DrawMode_t mode) { memset(lut, mode == BLACK_ON_WHITE ? 0x55 : 0xAA, LutSize); }
+
+void update_lut(uint8_t *lut, uint8_t k, DrawMode_t mode)
+{
+    if (mode == BLACK_ON_WHITE || mode == WHITE_ON_WHITE) k = 15 - k;
+
+    // stop the pixels of level k, at each of the 4 positions
+    for (uint32_t l = k; l < LutSize; l += 16)
+        lut[l] &= 0xFC;
+
+    for (uint32_t l = (k << 4); l < LutSize; l += (1 << 8))
+        for (uint32_t p = 0; p < 16; p++)
+            lut[l + p] &= 0xF3;
+
+    for (uint32_t l = (k << 8); l < LutSize; l += (1 << 12))
+        for (uint32_t p = 0; p < (1 << 8); p++)
+            lut[l + p] &= 0xCF;
+
+    for (uint32_t p = (k << 12); p < (uint32_t(k + 1) << 12); p++)
+        lut[p] &= 0x3F;
+}
+
+void LutPair::begin(DrawMode_t mode)
+{
+    _mode      = mode;
+    _frames[0] = _frames[1] = None;
+}
+
+void LutPair::prepare(uint8_t step, uint8_t k)
+{
+    uint8_t *lut   = _buffers[step % 2];
+    uint8_t& frame = _frames[step % 2];
+    uint8_t first  = frame + 1;
+
+    if (frame == None)
+    {
+        reset_lut(lut, _mode);
+        first = 0;
+    }
+
+    for (uint8_t f = first; f <= k; f++)
+        update_lut(lut, f, _mode);
+    frame = k;
+}
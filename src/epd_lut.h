@@ -0,0 +1,62 @@
+/*
+ * Copyright (c) 2024 zahical. All rights reserved.
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+/**
+ * @file The EPD conversion table: the panel data of 4 pixels (16 bits of a 4bpp image row) in one of the frames an
+ * image is drawn in.
+ *
+ * Every frame applies a voltage to the pixels that haven't reached their level yet, 2 bits per pixel; the table of a
+ * frame is the one of the previous frame, minus the pixels that reach their level with it. See the EPD driver's
+ * reset_lut() and update_LUT(), which these are the same as.
+ */
+
+#pragma once
+#include <epd_driver.h>
+
+#include <cstddef>
+#include <cstdint>
+
+constexpr size_t LutSize        = 1 << 16;
+constexpr uint8_t LutFrameCount = 15;
+
+/// The table before the first frame.
+void reset_lut(uint8_t *lut, DrawMode_t mode);
+
+/// Turns the table of frame `k - 1` (or the reset one, for 0) into the one of frame `k`.
+void update_lut(uint8_t *lut, uint8_t k, DrawMode_t mode);
+
+/**
+ * @brief The tables of the steps of an image (see epd_waveform.h), in two buffers, so that the table of the next step
+ * can be prepared while the one of the current step is still being used.
+ *
+ * Steps alternate between the buffers; each buffer is brought forward from the frame of its previous step, since the
+ * tables only ever lose bits from one frame to the next.
+ */
+class LutPair
+{
+  public:
+    /// `buffers` are LutSize bytes each.
+    LutPair(uint8_t *buffer0, uint8_t *buffer1) : _buffers{buffer0, buffer1} {}
+
+    /// Starts a new image, drawn in `mode`.
+    void begin(DrawMode_t mode);
+
+    /**
+     * @brief Prepares the table of frame `k` for step `step` of the image, overwriting the one of step `step - 2`.
+     *
+     * Steps are expected in order, starting from 0, and their frames in increasing order.
+     */
+    void prepare(uint8_t step, uint8_t k);
+
+    /// The table of step `step`, once prepared.
+    uint8_t const *table(uint8_t step) const { return _buffers[step % 2]; }
+
+  private:
+    static constexpr uint8_t None = 0xFF;
+
+    uint8_t *_buffers[2];
+    uint8_t _frames[2] = {None, None}; // the frame each buffer has the table of
+    DrawMode_t _mode   = BLACK_ON_WHITE;
+};
@@ -0,0 +1,88 @@
+/*
+ * Copyright (c) 2024 zahical. All rights reserved.
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+/**
+ * @file EPD waveform implementation.
+ */
+
+#include "epd_waveform.h"
+#include "config.h"
+
+// clang-format off
+int32_t const contrast_cycles_4[LutFrameCount]       = {30, 30, 20, 20, 30, 30, 30, 40, 40, 50, 50, 50, 100, 200, 300};
+int32_t const contrast_cycles_4_white[LutFrameCount] = {10, 10, 8, 8, 8, 8, 8, 10, 10, 15, 15, 20, 20, 100, 300};
+// clang-format on
+
+namespace
+{
+int32_t const *frame_times(DrawMode_t mode)
+{
+    return mode == WHITE_ON_BLACK ? contrast_cycles_4_white : contrast_cycles_4;
+}
+} // namespace
+
+uint8_t level_done(uint8_t k, DrawMode_t mode) { return mode == WHITE_ON_BLACK ? k : 15 - k; }
+
+uint16_t used_levels(uint8_t const *data, size_t bytes)
+{
+    // by byte value first, it's cheaper than splitting every byte
+    bool seen[256] = {};
+    for (size_t i = 0; i < bytes; i++)
+        seen[data[i]] = true;
+
+    uint16_t levels = 0;
+    for (unsigned b = 0; b < 256; b++)
+        if (seen[b]) levels |= 1 << (b & 0x0F) | 1 << (b >> 4);
+    return levels;
+}
+
+Waveform full_waveform(DrawMode_t mode)
+{
+    Waveform w{LutFrameCount, {}};
+    for (uint8_t k = 0; k < LutFrameCount; k++)
+        w.steps[k] = {k, frame_times(mode)[k]};
+    return w;
+}
+
+Waveform plan_waveform(uint16_t levels, DrawMode_t mode, int32_t max_time)
+{
+    Waveform w{0, {}};
+    uint16_t driven      = levels; // the levels present that frame k drives
+    uint16_t step_driven = 0;      // ... and that the last step drives
+
+    for (uint8_t k = 0; k < LutFrameCount; k++)
+    {
+        driven &= ~(1 << level_done(k, mode));
+        if (!driven) break; // and so are all the next ones
+
+        int32_t const time = frame_times(mode)[k];
+        if (w.count > 0 && driven == step_driven && w.steps[w.count - 1].time + time <= max_time)
+        {
+            w.steps[w.count - 1].frame = k;
+            w.steps[w.count - 1].time += time;
+        }
+        else
+        {
+            // a frame longer than max_time is driven in equal parts, with the same table
+            int32_t const parts = (time + max_time - 1) / max_time;
+            for (int32_t p = 0; p < parts; p++)
+                w.steps[w.count++] = {k, time / parts + (p < time % parts ? 1 : 0)};
+        }
+
+        step_driven = driven;
+    }
+    return w;
+}
+
+Waveform mono_waveform() { return plan_waveform(1 << 0 | 1 << 15, BLACK_ON_WHITE, DriverMaxStepTime); }
+
+Waveform image_waveform(Rect_t const& area, uint8_t const *data, DrawMode_t mode)
+{
+    // only the output tasks can draw a planned one
+    if (!cfg::AdaptiveWaveform || !cfg::EpdOutputTasks) return full_waveform(mode);
+
+    size_t const bytes = size_t(area.width / 2 + area.width % 2) * area.height;
+    return plan_waveform(used_levels(data, bytes), mode);
+}
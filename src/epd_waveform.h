@@ -0,0 +1,70 @@
+/*
+ * Copyright (c) 2024 zahical. All rights reserved.
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+/**
+ * @file The sequence of frames an image is drawn to the EPD in.
+ *
+ * The driver draws every image in 15 frames, each driving the pixels that haven't reached their grey level yet for the
+ * frame's row output time (see epd_lut.h). A level's shade comes from the total time it's driven for; with only some
+ * levels in the image, consecutive frames often drive the very same pixels, and the last ones may drive none. Such
+ * frames can be merged into a single, longer step and the empty ones dropped: every level present gets the same total
+ * drive time, in fewer passes over the panel. A black and white image takes 4 steps.
+ */
+
+#pragma once
+#include "epd_lut.h"
+
+#include <cstddef>
+#include <cstdint>
+
+/// Row output time of every frame (1/10 us), darkest first; the driver's.
+extern int32_t const contrast_cycles_4[LutFrameCount];
+/// Row output time of every frame (1/10 us) of a WHITE_ON_BLACK image; the driver's.
+extern int32_t const contrast_cycles_4_white[LutFrameCount];
+
+/// Steps aren't merged beyond the longest frame time of the driver's.
+constexpr int32_t MaxStepTime = 300;
+/// The longest step the driver's own frame functions can take: they latch the row before skipped ones with an 8-bit
+/// time. A frame longer than this is driven in several steps.
+constexpr int32_t DriverMaxStepTime = 255;
+
+/// The level that stops being driven with frame `k`; see update_lut().
+uint8_t level_done(uint8_t k, DrawMode_t mode);
+
+/// The grey levels in a packed 4bpp image, bit n set for level n.
+uint16_t used_levels(uint8_t const *data, size_t bytes);
+
+struct Waveform
+{
+    struct Step
+    {
+        uint8_t frame; // whose conversion table it uses
+        int32_t time;  // row output time, 1/10 us
+    };
+
+    uint8_t count;
+    Step steps[LutFrameCount + 1]; // the 300 frame takes two steps under DriverMaxStepTime
+};
+
+/// The driver's waveform, all 15 frames.
+Waveform full_waveform(DrawMode_t mode);
+
+/**
+ * @brief The shortest waveform that draws the `levels` (see used_levels()) as the full one does, in steps of at most
+ * `max_time` (MaxStepTime or DriverMaxStepTime).
+ */
+Waveform plan_waveform(uint16_t levels, DrawMode_t mode, int32_t max_time = MaxStepTime);
+
+/**
+ * @brief The waveform of a 1-bit image (see epd_output_draw_1bit()): black driven for as long as by the full waveform,
+ * in steps the driver can take.
+ */
+Waveform mono_waveform();
+
+/**
+ * @brief The waveform a packed image of `area` is drawn in: the planned one with cfg::AdaptiveWaveform (and
+ * cfg::EpdOutputTasks), else the full one.
+ */
+Waveform image_waveform(Rect_t const& area, uint8_t const *data, DrawMode_t mode);
@@ -0,0 +1,318 @@
+/*
+ * Copyright (c) 2024 zahical. All rights reserved.
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+/**
+ * @file EPD image output implementation.
+ *
+ * The per-frame work (the conversion table, the row conversion and the row timing) is the same as the driver's; only
+ * the tasks are long-lived, the frames are pipelined (the conversion table of the next frame is prepared, and its first
+ * rows queued, while the current frame is still being sent to the panel), and with cfg::AdaptiveWaveform the frames
+ * are those of plan_waveform().
+ */
+
+#include "epd_output.h"
+#include "config.h"
+#include "epd_lut.h"
+#include "epd_waveform.h"
+
+// convert_row() lays the bytes out like the driver's row conversion, by `#if USER_I2S_REG`; the driver's epd_driver.c
+// (v1.0.1, see host/libs/README.md) doesn't define it, so these are all the headers it includes: the macro, defined by
+// one of them or not at all, comes out the same here as there
+#include <esp_assert.h>
+#include <esp_attr.h>
+#include <esp_heap_caps.h>
+#include <esp_log.h>
+#include <esp_types.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/queue.h>
+#include <freertos/semphr.h>
+#include <freertos/task.h>
+#include <xtensa/core-macros.h>
+
+extern "C"
+{
+#include <ed047tc1.h> // the panel interface of the EPD driver; a LilyGo-EPD47 header
+}
+
+#include <algorithm>
+#include <cstring>
+
+namespace
+{
+/// Bytes of panel data per row, 2 bits per pixel.
+constexpr int32_t LineBytes = EPD_WIDTH / 4;
+
+/// The image the output tasks are working on.
+struct Job
+{
+    Rect_t area;
+    uint8_t const *data;
+    DrawMode_t mode;
+    Waveform waveform;
+};
+
+Job job;
+
+/// The conversion tables of the current and of the next step, while an image is being drawn.
+LutPair *luts = nullptr;
+
+/// Image rows, from the provider to the feeder.
+QueueHandle_t line_queue = nullptr;
+
+TaskHandle_t provider = nullptr;
+TaskHandle_t feeder   = nullptr;
+
+/// Given by the feeder when it's done with a step, so its conversion table can be reused.
+SemaphoreHandle_t frame_done = nullptr;
+
+/// Given by the provider when the whole image is out.
+SemaphoreHandle_t image_done = nullptr;
+
+/// Row skipping state, see skip_row().
+uint32_t skipping = 0;
+
+void IRAM_ATTR convert_row(uint8_t const *conversion_lut, uint8_t const *line, uint8_t *epd_input)
+{
+    uint32_t *wide_epd_input = (uint32_t *)epd_input;
+    uint16_t const *line_16  = (uint16_t const *)line;
+
+    // reversed for little-endian, compensated for by the output peripheral
+    for (uint32_t j = 0; j < EPD_WIDTH / 16; j++)
+    {
+        uint16_t const v1 = *line_16++;
+        uint16_t const v2 = *line_16++;
+        uint16_t const v3 = *line_16++;
+        uint16_t const v4 = *line_16++;
+#if USER_I2S_REG
+        wide_epd_input[j] =
+            conversion_lut[v1] << 16 | conversion_lut[v2] << 24 | conversion_lut[v3] | conversion_lut[v4] << 8;
+#else
+        wide_epd_input[j] =
+            conversion_lut[v1] | conversion_lut[v2] << 8 | conversion_lut[v3] << 16 | conversion_lut[v4] << 24;
+#endif
+    }
+}
+
+void write_row(uint32_t output_time_dus)
+{
+    skipping = 0;
+    epd_output_row(output_time_dus);
+}
+
+/// Like the driver's, but with the full row time: a merged step may be longer than 255.
+void skip_row(int32_t pipeline_finish_time)
+{
+    // output the previously loaded row, fill the buffer with no-ops
+    if (skipping == 0)
+    {
+        epd_switch_buffer();
+        memset(epd_get_current_buffer(), 0, LineBytes);
+        epd_switch_buffer();
+        memset(epd_get_current_buffer(), 0, LineBytes);
+        epd_output_row(pipeline_finish_time);
+    }
+    else if (skipping < 2)
+        epd_output_row(10);
+    else
+        epd_skip();
+
+    skipping++;
+}
+
+/// Queues the rows of the image for step `step`, padded to the full screen width, once its conversion table is ready.
+void IRAM_ATTR provide_step(uint8_t step)
+{
+    uint8_t line[EPD_WIDTH / 2];
+
+    Rect_t const area  = job.area;
+    uint8_t const *ptr = job.data;
+
+    // the table of step - 2 gets overwritten
+    if (step >= 2) xSemaphoreTake(frame_done, portMAX_DELAY);
+    luts->prepare(step, job.waveform.steps[step].frame);
+
+    int32_t const row_bytes = area.width / 2 + area.width % 2;
+    if (area.x < 0) ptr += -area.x / 2;
+    if (area.y < 0) ptr += row_bytes * -area.y;
+
+    memset(line, 0xFF, sizeof(line));
+
+    for (int32_t i = std::max<int32_t>(area.y, 0); i < std::min<int32_t>(area.y + area.height, EPD_HEIGHT); i++)
+    {
+        uint8_t const *lp;
+        bool shifted = false;
+
+        if (area.width == EPD_WIDTH && area.x == 0)
+        {
+            lp = ptr;
+            ptr += EPD_WIDTH / 2;
+        }
+        else
+        {
+            uint8_t *buf_start  = line;
+            uint32_t line_bytes = row_bytes;
+            if (area.x >= 0)
+                buf_start += area.x / 2;
+            else
+                line_bytes += area.x / 2; // just the bytes on the screen
+
+            line_bytes = std::min<uint32_t>(line_bytes, EPD_WIDTH / 2 - (buf_start - line));
+            memcpy(buf_start, ptr, line_bytes);
+            ptr += row_bytes;
+
+            // mask the last nibble of uneven widths
+            if (area.width % 2 == 1 && area.x / 2 + area.width / 2 + 1 < EPD_WIDTH)
+                buf_start[line_bytes - 1] |= 0xF0;
+
+            if (area.x % 2 == 1 && area.x < EPD_WIDTH)
+            {
+                // shift one nibble to the right
+                shifted       = true;
+                uint8_t carry = 0xF;
+                uint32_t len  = std::min<uint32_t>(line_bytes + 1, line + EPD_WIDTH / 2 - buf_start);
+                for (uint32_t b = 0; b < len; b++)
+                {
+                    uint8_t const val = buf_start[b];
+                    buf_start[b]      = (val << 4) | carry;
+                    carry             = (val & 0xF0) >> 4;
+                }
+            }
+            lp = line;
+        }
+
+        xQueueSendToBack(line_queue, lp, portMAX_DELAY);
+        if (shifted) memset(line, 0xFF, sizeof(line));
+    }
+}
+
+/// Queues the rows of every step of the image; on core 0.
+void IRAM_ATTR provide_rows(void *)
+{
+    for (;;)
+    {
+        ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+
+        uint8_t const count = job.waveform.count;
+        luts->begin(job.mode);
+        for (uint8_t s = 0; s < count; s++)
+            provide_step(s);
+
+        // the last two steps
+        for (uint8_t s = count < 2 ? 0 : count - 2; s < count; s++)
+            xSemaphoreTake(frame_done, portMAX_DELAY);
+        xSemaphoreGive(image_done);
+    }
+}
+
+/// Sends the queued rows of every step of the image to the panel; on core 1.
+void IRAM_ATTR feed_display(void *)
+{
+    uint8_t output[EPD_WIDTH / 2];
+
+    for (;;)
+    {
+        ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+
+        Rect_t const area        = job.area;
+        Waveform const& waveform = job.waveform;
+
+        for (uint8_t s = 0; s < waveform.count; s++)
+        {
+            int32_t const time = waveform.steps[s].time;
+
+            epd_start_frame();
+            for (int32_t i = 0; i < EPD_HEIGHT; i++)
+            {
+                if (i < area.y || i >= area.y + area.height)
+                {
+                    skip_row(time);
+                    continue;
+                }
+
+                // the table is ready by the time the step's first row is queued
+                xQueueReceive(line_queue, output, portMAX_DELAY);
+                convert_row(luts->table(s), output, epd_get_current_buffer());
+                write_row(time);
+            }
+            // rows are pipelined, the last one still has to be latched out
+            if (!skipping) write_row(time);
+            epd_end_frame();
+
+            xSemaphoreGive(frame_done);
+        }
+    }
+}
+
+} // namespace
+
+bool epd_output_init()
+{
+    if (!cfg::EpdOutputTasks) return false;
+    if (provider && feeder) return true;
+
+    line_queue = xQueueCreate(64, EPD_WIDTH / 2);
+    frame_done = xSemaphoreCreateCounting(LutFrameCount, 0);
+    image_done = xSemaphoreCreateBinary();
+    if (!line_queue || !frame_done || !image_done) return false;
+
+#if CONFIG_FREERTOS_UNICORE
+    BaseType_t const provider_core = 0, feeder_core = 0;
+#else
+    BaseType_t const provider_core = 0, feeder_core = 1;
+#endif
+
+    // the same priority as the driver's tasks
+    if (xTaskCreatePinnedToCore(provide_rows, "epd_provide", 4096, nullptr, 10, &provider, provider_core) != pdPASS)
+        provider = nullptr;
+    if (xTaskCreatePinnedToCore(feed_display, "epd_feed", 4096, nullptr, 10, &feeder, feeder_core) != pdPASS)
+        feeder = nullptr;
+
+    return provider && feeder;
+}
+
+void epd_output_draw_image(Rect_t const& area, uint8_t const *data, DrawMode_t mode)
+{
+    if (!provider || !feeder)
+    {
+        epd_draw_image(area, const_cast<uint8_t *>(data), mode);
+        return;
+    }
+
+    Waveform const waveform = image_waveform(area, data, mode);
+    if (waveform.count == 0) return; // nothing to drive, e.g. all white
+
+    // in internal RAM, for the row conversion's random access; like the driver's table, only for the length of the
+    // image, so that the 128 KiB are not held through the network phase (the TLS handshakes need much of it)
+    auto *lut0 = (uint8_t *)heap_caps_malloc(LutSize, MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT);
+    auto *lut1 = (uint8_t *)heap_caps_malloc(LutSize, MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT);
+    if (!lut0 || !lut1)
+    {
+        // the driver needs only one
+        heap_caps_free(lut0);
+        heap_caps_free(lut1);
+        epd_draw_image(area, const_cast<uint8_t *>(data), mode);
+        return;
+    }
+
+    LutPair pair{lut0, lut1};
+    luts = &pair;
+    job  = {area, data, mode, waveform};
+
+    xTaskNotifyGive(provider);
+    xTaskNotifyGive(feeder);
+
+    xSemaphoreTake(image_done, portMAX_DELAY);
+
+    luts = nullptr;
+    heap_caps_free(lut0);
+    heap_caps_free(lut1);
+}
+
+void epd_output_draw_1bit(Rect_t const& area, uint8_t const *data)
+{
+    Waveform const waveform = mono_waveform();
+    for (uint8_t s = 0; s < waveform.count; s++)
+        epd_draw_frame_1bit(area, const_cast<uint8_t *>(data), BLACK_ON_WHITE, waveform.steps[s].time);
+}
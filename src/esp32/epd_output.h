@@ -0,0 +1,43 @@
+/*
+ * Copyright (c) 2024 zahical. All rights reserved.
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+/**
+ * @file Sending 4bpp images to the screen; a replacement for the EPD driver's epd_draw_image().
+ *
+ * The driver draws an image in 15 frames, each one darkening the pixels that are still lighter than they should be.
+ * Every frame is produced by two tasks, one on each core: one converts the image rows for the frame and queues them,
+ * the other sends them to the panel. The driver creates both tasks anew for every frame, deletes them afterwards and
+ * sleeps 5 ms between frames (and 10 ms before the first one). Here the two tasks are created once and are handed one
+ * frame after another.
+ */
+
+#pragma once
+#include <epd_driver.h>
+
+#include <cstdint>
+
+/**
+ * @brief Starts the output tasks, if cfg::EpdOutputTasks is set. Call once, after epd_init().
+ *
+ * Returns false if they weren't started; epd_output_draw_image() falls back to the driver then.
+ */
+bool epd_output_init();
+
+/**
+ * @brief Same as the driver's epd_draw_image().
+ *
+ * The two conversion tables (128 KiB of internal RAM) are allocated for the length of the call; if they can't be, the
+ * image is drawn by the driver.
+ */
+void epd_output_draw_image(Rect_t const& area, uint8_t const *data, DrawMode_t mode);
+
+/**
+ * @brief Darkens the pixels of `area` whose bits are set in the 1bpp image `data` (see nibble_ops::pack_1bit()), over
+ * a white screen.
+ *
+ * Takes the few steps of mono_waveform(), with the driver's epd_draw_frame_1bit(): there's no conversion table to
+ * prepare, and a row of the image is an eighth of the size of a 4bpp one.
+ */
+void epd_output_draw_1bit(Rect_t const& area, uint8_t const *data);
@@ -13,8 +13,10 @@
 #include "config.h"
 #include "data_cycle.h"
 #include "display.h"
+#include "energy.h"
 #include "schedule.h"
 #include "shared_data.h"
+#include "timing_history.h"
 #include "timings.h"
 
 #include <AceTime.h>   // AceTime TZ library
@@ -41,9 +43,11 @@ void BeginSleep(std::chrono::seconds planned_sleep)
     StopWiFi();
 
     auto powered_time = get_event_duration(TimeEvent::PowerCycle);
+    record_timing_history();
 
     OPT_LOG(Log_Lifecycle, Serial.println("Refresh cycle completed."));
-    OPT_LOG(Log_Timings, dump_timings());
+    OPT_LOG(Log_Timings, dump_timings(); dump_timing_history());
+    OPT_LOG(Log_Lifecycle, log_energy());
 
     if (Log_Lifecycle)
     {
@@ -218,6 +222,7 @@ void loop()
 void setup()
 {
     InitializeSystem();
+    StartScreenClear(); // while the data is being fetched
 
     std::chrono::seconds planned_sleep{cfg::RefreshPeriod};
 
@@ -243,7 +248,8 @@ void setup()
         Scheduler{cfg::OnTime, cfg::OffTime, cfg::RefreshPeriod, cfg::MaxDrift}.plan_sleep(shared::CycleStart);
 
     {
-        auto data_ok = do_data_cycle();
+        BeginWeatherDraw(); // while the data is being fetched
+        auto data_ok = do_data_cycle(WeatherDataReady);
         StopWiFi(); // Reduces power consumption
 
         if (data_ok)
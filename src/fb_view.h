@@ -0,0 +1,538 @@
+/*
+ * Copyright (c) 2024 zahical. All rights reserved.
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+/**
+ * @file A clipped view of a 4bpp framebuffer.
+ *
+ * The EPD driver's primitives are all built on epd_draw_pixel(), which bounds-checks and recomputes the byte address of
+ * every single pixel. Here, each primitive clips its extent against the clip rectangle once and then runs its inner
+ * loop without any checks. The framebuffer geometry is a compile-time constant, so all the address arithmetic folds into
+ * shifts and constant strides.
+ *
+ * The pixel format is the one of the EPD driver: two pixels per byte, the even x in the low nibble. Colors are passed
+ * as 8-bit values, only their upper nibble is used (0x00 is black, 0xFF is white).
+ *
+ * The drawing algorithms (lines, circles, triangles) are the same as the driver's, so is the output.
+ *
+ * The view may also be backed by a buffer holding just a horizontal band of the framebuffer (see set_band()). All
+ * coordinates are still framebuffer coordinates and anything outside the band is clipped away; that allows drawing a
+ * full screen in several passes with a fraction of the memory.
+ */
+
+#pragma once
+#include <epd_driver.h>
+
+#include "nibble_ops.h"
+
+#include <algorithm>
+#include <cassert>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <utility>
+
+template <int32_t W, int32_t H>
+class FbView
+{
+    static_assert(W > 0 && H > 0 && W % 2 == 0, "width must be even");
+
+  public:
+    static constexpr int32_t Width  = W;
+    static constexpr int32_t Height = H;
+    static constexpr int32_t Stride = W / 2;
+
+    constexpr explicit FbView(uint8_t *buffer = nullptr)
+        : _buf(buffer), _band_y(0), _band_rows(H), _x0(0), _y0(0), _x1(W), _y1(H)
+    {
+    }
+
+    uint8_t *buffer() const { return _buf; }
+
+    /// Uses `buffer` (of W * H / 2 bytes) as the whole framebuffer.
+    void set_buffer(uint8_t *buffer) { set_band(buffer, 0, H); }
+
+    /// Uses `buffer` (of `rows` * W / 2 bytes) as the framebuffer rows [y, y + rows). Resets the clip rect to them.
+    void set_band(uint8_t *buffer, int32_t y, int32_t rows)
+    {
+        _buf       = buffer;
+        _band_y    = y;
+        _band_rows = rows;
+        reset_clip();
+    }
+
+    /// Restricts all drawing to `rect` (which is itself clipped to the framebuffer, or its band).
+    void set_clip(Rect_t const& rect)
+    {
+        _x0 = std::max<int32_t>(0, rect.x);
+        _y0 = std::max<int32_t>(std::max<int32_t>(0, _band_y), rect.y);
+        _x1 = std::min<int32_t>(W, rect.x + rect.width);
+        _y1 = std::min<int32_t>(std::min<int32_t>(H, _band_y + _band_rows), rect.y + rect.height);
+    }
+
+    void reset_clip() { set_clip({0, 0, W, H}); }
+
+    Rect_t clip() const { return {_x0, _y0, _x1 - _x0, _y1 - _y0}; }
+
+    bool contains(int32_t x, int32_t y) const { return x >= _x0 && x < _x1 && y >= _y0 && y < _y1; }
+
+    void pixel(int32_t x, int32_t y, uint8_t color)
+    {
+        if (contains(x, y)) put(x, y, color >> 4);
+    }
+
+    void hline(int32_t x, int32_t y, int32_t length, uint8_t color)
+    {
+        if (y < _y0 || y >= _y1) return;
+
+        int32_t x1 = std::min(x + length, _x1);
+        x          = std::max(x, _x0);
+        if (x >= x1) return;
+
+        span(row(y), x, x1 - x, color >> 4);
+    }
+
+    void vline(int32_t x, int32_t y, int32_t length, uint8_t color)
+    {
+        if (x < _x0 || x >= _x1) return;
+
+        int32_t y1 = std::min(y + length, _y1);
+        y          = std::max(y, _y0);
+        if (y >= y1) return;
+
+        uint8_t *p          = &row(y)[x / 2];
+        uint8_t const keep  = x % 2 ? 0x0F : 0xF0;
+        uint8_t const value = x % 2 ? color & 0xF0 : color >> 4;
+
+        for (int32_t n = y1 - y; n > 0; n--, p += Stride)
+            *p = (*p & keep) | value;
+    }
+
+    void rect(int32_t x, int32_t y, int32_t w, int32_t h, uint8_t color)
+    {
+        hline(x, y, w, color);
+        hline(x, y + h - 1, w, color);
+        vline(x, y, h, color);
+        vline(x + w - 1, y, h, color);
+    }
+
+    void fill_rect(int32_t x, int32_t y, int32_t w, int32_t h, uint8_t color)
+    {
+        if (w <= 0) return;
+
+        int32_t x1 = std::min(x + w, _x1);
+        int32_t y1 = std::min(y + h, _y1);
+        x          = std::max(x, _x0);
+        y          = std::max(y, _y0);
+        if (x >= x1 || y >= y1) return;
+
+        for (; y < y1; y++)
+            span(row(y), x, x1 - x, color >> 4);
+    }
+
+    /// Bresenham line, same as epd_write_line().
+    void line(int32_t x0, int32_t y0, int32_t x1, int32_t y1, uint8_t color)
+    {
+        bool const steep = std::abs(y1 - y0) > std::abs(x1 - x0);
+        if (steep)
+        {
+            std::swap(x0, y0);
+            std::swap(x1, y1);
+        }
+
+        if (x0 > x1)
+        {
+            std::swap(x0, x1);
+            std::swap(y0, y1);
+        }
+
+        // the endpoints are the extremes, if both are visible so is the whole line
+        bool const visible = steep ? contains(y0, x0) && contains(y1, x1) : contains(x0, y0) && contains(x1, y1);
+
+        uint8_t const c    = color >> 4;
+
+        if (steep)
+            visible ? line_loop<true, false>(x0, y0, x1, y1, c) : line_loop<true, true>(x0, y0, x1, y1, c);
+        else
+            visible ? line_loop<false, false>(x0, y0, x1, y1, c) : line_loop<false, true>(x0, y0, x1, y1, c);
+    }
+
+    /**
+     * @brief Midpoint circle outline, the same pixels as epd_draw_circle().
+     *
+     * Consecutive points on the same row (or, in the side octants, the same column) are drawn as a single span.
+     */
+    void circle(int32_t x0, int32_t y0, int32_t r, uint8_t color)
+    {
+        // points [xa, xb] x {yy} of the first octant, mirrored into all eight
+        auto run = [&](int32_t xa, int32_t xb, int32_t yy) {
+            int32_t const len = xb - xa + 1;
+            hline(x0 + xa, y0 + yy, len, color);
+            hline(x0 - xb, y0 + yy, len, color);
+            hline(x0 + xa, y0 - yy, len, color);
+            hline(x0 - xb, y0 - yy, len, color);
+            vline(x0 + yy, y0 + xa, len, color);
+            vline(x0 + yy, y0 - xb, len, color);
+            vline(x0 - yy, y0 + xa, len, color);
+            vline(x0 - yy, y0 - xb, len, color);
+        };
+
+        int32_t f         = 1 - r;
+        int32_t ddF_x     = 1;
+        int32_t ddF_y     = -2 * r;
+        int32_t x         = 0;
+        int32_t y         = r;
+        int32_t run_start = 0;
+
+        while (x < y)
+        {
+            if (f >= 0)
+            {
+                run(run_start, x, y);
+                run_start = x + 1;
+
+                y--;
+                ddF_y += 2;
+                f += ddF_y;
+            }
+            x++;
+            ddF_x += 2;
+            f += ddF_x;
+        }
+
+        run(run_start, x, y);
+    }
+
+    /// Filled circle, the same pixels as epd_fill_circle(), drawn as horizontal spans.
+    void fill_circle(int32_t x0, int32_t y0, int32_t r, uint8_t color)
+    {
+        if (r < 0 || x0 + r < _x0 || x0 - r >= _x1 || y0 + r < _y0 || y0 - r >= _y1) return;
+
+        circle_spans(r, [&](int32_t d, int32_t w) {
+            hline(x0 - w, y0 + d, 2 * w + 1, color);
+            if (d != 0) hline(x0 - w, y0 - d, 2 * w + 1, color);
+        });
+    }
+
+    /// Ring radii are limited, so that its row tables fit on the stack.
+    static constexpr int32_t MaxRingRadius = 255;
+
+    /**
+     * @brief Fills the pixels of fill_circle(x0, y0, r_outer) that are not in fill_circle(x0, y0, r_inner).
+     *
+     * Same as a fill_circle() of `color` followed by a fill_circle() of the background inside, without touching the
+     * inside. `r_outer` must not exceed MaxRingRadius.
+     */
+    void fill_ring(int32_t x0, int32_t y0, int32_t r_outer, int32_t r_inner, uint8_t color)
+    {
+        if (r_inner < 0) return fill_circle(x0, y0, r_outer, color);
+        if (r_outer <= r_inner || x0 + r_outer < _x0 || x0 - r_outer >= _x1 || y0 + r_outer < _y0 ||
+            y0 - r_outer >= _y1)
+            return;
+
+        assert(r_outer <= MaxRingRadius);
+        if (r_outer > MaxRingRadius) return;
+
+        int16_t outer[MaxRingRadius + 1], inner[MaxRingRadius + 1];
+        circle_half_widths(r_outer, outer);
+        circle_half_widths(r_inner, inner);
+
+        for (int32_t d = -r_outer; d <= r_outer; d++)
+        {
+            int32_t const y  = y0 + d;
+            int32_t const ad = std::abs(d);
+            if (y < _y0 || y >= _y1) continue;
+
+            int32_t const wo = outer[ad];
+            int32_t const wi = ad <= r_inner ? inner[ad] : -1;
+
+            if (wi < 0)
+                hline(x0 - wo, y, 2 * wo + 1, color);
+            else
+            {
+                hline(x0 - wo, y, wo - wi, color);
+                hline(x0 + wi + 1, y, wo - wi, color);
+            }
+        }
+    }
+
+    /// Scanline triangle fill, same as epd_fill_triangle().
+    void fill_triangle(int32_t x0, int32_t y0, int32_t x1, int32_t y1, int32_t x2, int32_t y2, uint8_t color)
+    {
+        // Sort coordinates by Y order (y2 >= y1 >= y0)
+        if (y0 > y1)
+        {
+            std::swap(y0, y1);
+            std::swap(x0, x1);
+        }
+        if (y1 > y2)
+        {
+            std::swap(y2, y1);
+            std::swap(x2, x1);
+        }
+        if (y0 > y1)
+        {
+            std::swap(y0, y1);
+            std::swap(x0, x1);
+        }
+
+        if (y0 == y2)
+        { // all on the same line
+            int32_t a = std::min({x0, x1, x2});
+            int32_t b = std::max({x0, x1, x2});
+            hline(a, y0, b - a + 1, color);
+            return;
+        }
+
+        int32_t const dx01 = x1 - x0, dy01 = y1 - y0;
+        int32_t const dx02 = x2 - x0, dy02 = y2 - y0;
+        int32_t const dx12 = x2 - x1, dy12 = y2 - y1;
+        int32_t sa = 0, sb = 0;
+
+        // upper part: include the y1 scanline only for a flat-bottomed triangle (avoids /0 in either loop)
+        int32_t const last = y1 == y2 ? y1 : y1 - 1;
+
+        int32_t y = y0;
+        for (; y <= last; y++)
+        {
+            int32_t a = x0 + sa / dy01;
+            int32_t b = x0 + sb / dy02;
+            sa += dx01;
+            sb += dx02;
+            if (a > b) std::swap(a, b);
+            hline(a, y, b - a + 1, color);
+        }
+
+        // lower part, skipped if y1 == y2
+        sa = dx12 * (y - y1);
+        sb = dx02 * (y - y0);
+        for (; y <= y2; y++)
+        {
+            int32_t a = x1 + sa / dy12;
+            int32_t b = x0 + sb / dy02;
+            sa += dx12;
+            sb += dx02;
+            if (a > b) std::swap(a, b);
+            hline(a, y, b - a + 1, color);
+        }
+    }
+
+    /**
+     * @brief Copies a 4bpp image (in the framebuffer's format, rows of odd width end on a whole byte) into the
+     * framebuffer. Same as epd_copy_to_framebuffer().
+     */
+    void blit(Rect_t const& area, uint8_t const *data)
+    {
+        int32_t const x0 = std::max(area.x, _x0), x1 = std::min(area.x + area.width, _x1);
+        int32_t const y0 = std::max(area.y, _y0), y1 = std::min(area.y + area.height, _y1);
+        if (x0 >= x1 || y0 >= y1) return;
+
+        int32_t const src_stride = area.width / 2 + area.width % 2;
+
+        for (int32_t y = y0; y < y1; y++)
+        {
+            uint8_t const *src = &data[(y - area.y) * src_stride];
+            uint8_t *dst       = row(y);
+
+            for (int32_t x = x0, sx = x0 - area.x; x < x1; x++, sx++)
+            {
+                uint8_t v = sx % 2 ? src[sx / 2] >> 4 : src[sx / 2] & 0x0F;
+                put(x, dst, v);
+            }
+        }
+    }
+
+    /**
+     * @brief Executes the provided `FCall` callback for all (visible) pixels in `rect` passing it the current pixel
+     * color and then replacing the pixel color with the value returned by the callback.
+     *
+     * @tparam FCall a callable with `uint8_t(uint8_t)` sig.
+     * @param rect framebuffer rect to modify
+     * @param mod the callback; color is passed and returned as 8-bit
+     */
+    template <typename FCall>
+    void modify_rect(Rect_t const& rect, FCall&& mod)
+    {
+        modify_rect_bytes(rect, mod, [&](uint8_t *p, size_t n) {
+            for (; n > 0; n--, p++)
+            {
+                uint8_t lo = *p & 0x0F;
+                uint8_t hi = *p & 0xF0;
+                lo         = mod(lo | lo << 4);
+                hi         = mod(hi | hi >> 4);
+                *p         = (hi & 0xF0) | (lo >> 4);
+            }
+        });
+    }
+
+    /// Inverts the colors in `rect`; same as modify_rect() with `255 - c`.
+    void invert_rect(Rect_t const& rect)
+    {
+        modify_rect_bytes(rect, [](uint8_t c) { return 255 - c; }, nibble_ops::invert);
+    }
+
+    /**
+     * @brief Adds `delta` gray levels (of the 16) to the colors in `rect`, saturating at black and white.
+     *
+     * @param delta -15..15, negative darkens
+     */
+    void add_rect(Rect_t const& rect, int8_t delta)
+    {
+        delta = std::max<int8_t>(-15, std::min<int8_t>(delta, 15));
+        modify_rect_bytes(
+            rect, [delta](uint8_t c) { return std::max(0, std::min((c >> 4) + delta, 15)) << 4; },
+            [delta](uint8_t *p, size_t n) { nibble_ops::add(p, n, delta); });
+    }
+
+    /// Colors in `rect` at or above `level` become white, the rest black.
+    void threshold_rect(Rect_t const& rect, uint8_t level)
+    {
+        modify_rect_bytes(
+            rect, [level](uint8_t c) { return c >> 4 >= level >> 4 ? 0xFF : 0x00; },
+            [level](uint8_t *p, size_t n) { nibble_ops::threshold(p, n, level >> 4); });
+    }
+
+    /// The start of framebuffer row `y`; no checks, y must be within the clip rect.
+    uint8_t *row(int32_t y) const { return &_buf[(y - _band_y) * Stride]; }
+
+    /// Sets pixel `x` of a row to the 4-bit color `nibble`; no checks.
+    static void put(int32_t x, uint8_t *row, uint8_t nibble)
+    {
+        uint8_t& b = row[x / 2];
+        b          = x % 2 ? (b & 0x0F) | (nibble << 4) : (b & 0xF0) | nibble;
+    }
+
+  private:
+    /// The Bresenham loop of line(), for x0 <= x1; coordinates are swapped if `Steep`.
+    template <bool Steep, bool Checked>
+    void line_loop(int32_t x0, int32_t y0, int32_t x1, int32_t y1, uint8_t nibble)
+    {
+        int32_t const dx    = x1 - x0;
+        int32_t const dy    = std::abs(y1 - y0);
+        int32_t const ystep = y0 < y1 ? 1 : -1;
+        int32_t err         = dx / 2;
+
+        for (; x0 <= x1; x0++)
+        {
+            int32_t const px = Steep ? y0 : x0, py = Steep ? x0 : y0;
+            if (!Checked || contains(px, py)) put(px, py, nibble);
+
+            err -= dy;
+            if (err < 0)
+            {
+                y0 += ystep;
+                err += dx;
+            }
+        }
+    }
+
+    /// Sets a pixel, `nibble` is the 4-bit color; no checks.
+    void put(int32_t x, int32_t y, uint8_t nibble) { put(x, row(y), nibble); }
+
+    /**
+     * @brief Calls `span(d, w)` for the rows of a filled circle of radius r (>= 0): rows d and -d (relative to the
+     * center) are filled from -w to w. A row may be reported more than once.
+     *
+     * The driver's fill draws vertical lines, with the same midpoint iteration; the set of pixels is symmetric along
+     * the diagonal, so its columns transposed are its rows.
+     */
+    template <typename FSpan>
+    static void circle_spans(int32_t r, FSpan&& span)
+    {
+        span(0, r);
+
+        int32_t f     = 1 - r;
+        int32_t ddF_x = 1;
+        int32_t ddF_y = -2 * r;
+        int32_t x     = 0;
+        int32_t y     = r;
+        int32_t px    = x;
+        int32_t py    = y;
+
+        while (x < y)
+        {
+            if (f >= 0)
+            {
+                y--;
+                ddF_y += 2;
+                f += ddF_y;
+            }
+            x++;
+            ddF_x += 2;
+            f += ddF_x;
+
+            if (x < (y + 1)) span(x, y);
+            if (y != py)
+            {
+                span(py, px);
+                py = y;
+            }
+            px = x;
+        }
+    }
+
+    /// Half-widths of the rows 0..r of a filled circle (see circle_spans()).
+    static void circle_half_widths(int32_t r, int16_t *hw)
+    {
+        std::fill(hw, hw + r + 1, -1);
+        circle_spans(r, [&](int32_t d, int32_t w) { hw[d] = std::max<int16_t>(hw[d], w); });
+    }
+
+    /**
+     * @brief The iteration of modify_rect() and friends: `bytes(p, n)` transforms the `n` whole bytes (pixel pairs)
+     * at `p` of every row, while `mod` is called for a lone pixel at either end.
+     */
+    template <typename FCall, typename FBytes>
+    void modify_rect_bytes(Rect_t const& rect, FCall&& mod, FBytes&& bytes)
+    {
+        int32_t const x0 = std::max(rect.x, _x0), x1 = std::min(rect.x + rect.width, _x1);
+        int32_t const y0 = std::max(rect.y, _y0), y1 = std::min(rect.y + rect.height, _y1);
+        if (x0 >= x1 || y0 >= y1) return;
+
+        for (int32_t y = y0; y < y1; y++)
+        {
+            uint8_t *p    = &row(y)[x0 / 2];
+            int32_t width = x1 - x0;
+
+            if (x0 % 2)
+            {
+                uint8_t hi = *p & 0xF0;
+                *p         = (*p & 0x0F) | (mod(hi | hi >> 4) & 0xF0);
+                p++;
+                width--;
+            }
+
+            bytes(p, width / 2);
+            p += width / 2;
+
+            if (width % 2)
+            {
+                uint8_t lo = *p & 0x0F;
+                *p         = (*p & 0xF0) | (mod(lo | lo << 4) >> 4);
+            }
+        }
+    }
+
+    /// Fills `length` (> 0) pixels of a row starting at x; no checks.
+    static void span(uint8_t *row, int32_t x, int32_t length, uint8_t nibble)
+    {
+        if (x % 2)
+        {
+            put(x, row, nibble);
+            x++;
+            length--;
+        }
+
+        memset(&row[x / 2], nibble | (nibble << 4), length / 2);
+
+        if (length % 2) put(x + length - 1, row, nibble);
+    }
+
+    uint8_t *_buf;
+    int32_t _band_y, _band_rows; // the rows _buf holds
+    int32_t _x0, _y0, _x1, _y1;  // clip rect, [x0, x1) x [y0, y1)
+};
+
+/// A view of the whole (or a band of the) screen.
+using ScreenView = FbView<EPD_WIDTH, EPD_HEIGHT>;
\ No newline at end of file
@@ -0,0 +1,380 @@
+/*
+ * Copyright (c) 2024 zahical. All rights reserved.
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+/**
+ * @file Screen frame store implementation.
+ */
+
+#include "frame_store.h"
+
+#include <Arduino.h>
+#include <epd_driver.h>
+#include <esp_attr.h>
+
+#ifndef HOST_BUILD
+#include <LittleFS.h>
+#endif
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+namespace
+{
+constexpr size_t Stride    = EPD_WIDTH / 2;
+constexpr size_t FrameSize = Stride * EPD_HEIGHT;
+
+/// Shorter runs would take more space than literals, with the token byte and the value.
+constexpr size_t MinRun = FrameMinRun;
+
+constexpr uint32_t Magic = 0x31465045; // "EPF1"
+
+/// Precedes the compressed frame wherever it's stored.
+struct Header
+{
+    uint32_t magic;
+    uint32_t size;  // of the compressed frame
+    uint32_t check; // FNV-1a of the compressed frame
+    uint64_t key;   // see save_frame(); 0 for the screen frame
+};
+
+uint32_t fnv1a(uint8_t const *p, size_t n)
+{
+    uint32_t h = 2166136261u;
+    for (size_t i = 0; i < n; i++)
+        h = (h ^ p[i]) * 16777619u;
+    return h;
+}
+
+/// Returns the end of the varint, or null if it doesn't fit before `end`.
+uint8_t *put_varint(uint8_t *out, uint8_t *end, size_t v)
+{
+    for (; out != end; v >>= 7)
+    {
+        if (v < 0x80)
+        {
+            *out++ = v;
+            return out;
+        }
+        *out++ = (v & 0x7F) | 0x80;
+    }
+    return nullptr;
+}
+
+bool get_varint(uint8_t const *& in, uint8_t const *end, size_t& v)
+{
+    v = 0;
+    for (int shift = 0; in != end && shift < 32; shift += 7)
+    {
+        uint8_t const b = *in++;
+        v |= size_t(b & 0x7F) << shift;
+        if (b < 0x80) return true;
+    }
+    return false;
+}
+
+uint8_t *alloc_buffer(size_t size)
+{
+#ifndef HOST_BUILD
+    return (uint8_t *)ps_malloc(size);
+#else
+    return (uint8_t *)malloc(size);
+#endif
+}
+
+bool is_valid(Header const& header, uint64_t key, uint8_t const *data, size_t capacity)
+{
+    return header.magic == Magic && header.key == key && header.size <= capacity &&
+           fnv1a(data, header.size) == header.check;
+}
+
+/// The stored frames are called ScreenFrame, or else what's passed to save_frame().
+char const *const ScreenFrame = "screen_frame";
+
+struct Path
+{
+    char str[40];
+
+    explicit Path(char const *name)
+    {
+#ifndef HOST_BUILD
+        snprintf(str, sizeof(str), "/%s.bin", name);
+#else
+        snprintf(str, sizeof(str), "%s.bin", name);
+#endif
+    }
+};
+
+#ifndef HOST_BUILD
+
+/// Screen frames that compress to at most this much are kept in RTC memory.
+constexpr size_t RtcSlotSize = 4096;
+
+RTC_DATA_ATTR Header rtc_header;
+RTC_DATA_ATTR uint8_t rtc_data[RtcSlotSize - sizeof(Header)];
+
+bool mount()
+{
+    // formats the partition the first time
+    static bool const mounted = LittleFS.begin(true);
+    return mounted;
+}
+
+bool write_file(char const *name, Header const& header, uint8_t const *data)
+{
+    if (!mount()) return false;
+
+    Path const path{name};
+    File f = LittleFS.open(path.str, "w");
+    if (!f) return false;
+
+    bool const ok = f.write((uint8_t const *)&header, sizeof(header)) == sizeof(header) &&
+                    f.write(data, header.size) == header.size;
+    f.close();
+
+    if (!ok) LittleFS.remove(path.str);
+    return ok;
+}
+
+/// Returns the compressed frame, to be freed by the caller, or null.
+uint8_t *read_file(char const *name, Header& header)
+{
+    Path const path{name};
+    if (!mount() || !LittleFS.exists(path.str)) return nullptr;
+
+    File f = LittleFS.open(path.str, "r");
+    if (!f) return nullptr;
+
+    uint8_t *data = nullptr;
+    if (f.read((uint8_t *)&header, sizeof(header)) == sizeof(header) && header.size <= FrameSize)
+    {
+        data = alloc_buffer(header.size);
+        if (data && f.read(data, header.size) != header.size)
+        {
+            free(data);
+            data = nullptr;
+        }
+    }
+
+    f.close();
+    return data;
+}
+
+void remove_file(char const *name)
+{
+    Path const path{name};
+    if (mount() && LittleFS.exists(path.str)) LittleFS.remove(path.str);
+}
+
+#else
+
+bool write_file(char const *name, Header const& header, uint8_t const *data)
+{
+    Path const path{name};
+    FILE *f = fopen(path.str, "wb");
+    if (!f) return false;
+
+    bool const ok = fwrite(&header, sizeof(header), 1, f) == 1 && fwrite(data, 1, header.size, f) == header.size;
+    fclose(f);
+
+    if (!ok) remove(path.str);
+    return ok;
+}
+
+uint8_t *read_file(char const *name, Header& header)
+{
+    Path const path{name};
+    FILE *f = fopen(path.str, "rb");
+    if (!f) return nullptr;
+
+    uint8_t *data = nullptr;
+    if (fread(&header, sizeof(header), 1, f) == 1 && header.size <= FrameSize)
+    {
+        data = alloc_buffer(header.size);
+        if (data && fread(data, 1, header.size, f) != header.size)
+        {
+            free(data);
+            data = nullptr;
+        }
+    }
+
+    fclose(f);
+    return data;
+}
+
+void remove_file(char const *name) { remove(Path{name}.str); }
+
+#endif
+
+/// Compresses `frame` into a new buffer, to be freed by the caller; null if it doesn't compress.
+uint8_t *compress(uint8_t const *frame, uint64_t key, Header& header)
+{
+    // a frame that doesn't compress at all isn't worth keeping
+    uint8_t *buffer = alloc_buffer(FrameSize);
+    if (!buffer) return nullptr;
+
+    header.magic = Magic;
+    header.key   = key;
+    header.size  = compress_frame(frame, buffer, FrameSize);
+    header.check = fnv1a(buffer, header.size);
+
+    if (header.size == 0)
+    {
+        free(buffer);
+        return nullptr;
+    }
+    return buffer;
+}
+
+bool load_file(char const *name, uint64_t key, uint8_t *frame)
+{
+    Header header;
+    uint8_t *data = read_file(name, header);
+    if (!data) return false;
+
+    bool const ok = is_valid(header, key, data, FrameSize) && decompress_frame(data, header.size, frame);
+    free(data);
+    return ok;
+}
+
+} // namespace
+
+size_t compress_frame(uint8_t const *frame, uint8_t *out, size_t out_size)
+{
+    auto delta = [frame](size_t i) -> uint8_t { return i < Stride ? frame[i] : frame[i] ^ frame[i - Stride]; };
+
+    uint8_t *o         = out;
+    uint8_t *const end = out + out_size;
+    size_t literals    = 0; // the start of the bytes not yet written
+
+    auto put_literals = [&](size_t to) {
+        if (to == literals) return true;
+        o = put_varint(o, end, (to - literals) << 1);
+        if (!o || size_t(end - o) < to - literals) return false;
+        for (; literals < to; literals++)
+            *o++ = delta(literals);
+        return true;
+    };
+
+    for (size_t i = 0; i < FrameSize;)
+    {
+        uint8_t const v = delta(i);
+        size_t j        = i + 1;
+        while (j < FrameSize && delta(j) == v)
+            j++;
+
+        if (j - i >= MinRun)
+        {
+            if (!put_literals(i)) return 0;
+            o = put_varint(o, end, (j - i - MinRun) << 1 | 1);
+            if (!o || o == end) return 0;
+            *o++     = v;
+            literals = j;
+        }
+        i = j;
+    }
+
+    if (!put_literals(FrameSize)) return 0;
+    return o - out;
+}
+
+bool decompress_frame(uint8_t const *in, size_t size, uint8_t *frame)
+{
+    uint8_t const *const end = in + size;
+
+    for (size_t i = 0; i < FrameSize;)
+    {
+        size_t token;
+        if (!get_varint(in, end, token)) return false;
+
+        bool const run = token & 1;
+        size_t const n = run ? (token >> 1) + MinRun : token >> 1;
+        if (n == 0 || n > FrameSize - i || size_t(end - in) < (run ? 1 : n)) return false;
+
+        if (run)
+            memset(frame + i, *in++, n);
+        else
+        {
+            memcpy(frame + i, in, n);
+            in += n;
+        }
+        i += n;
+    }
+
+    if (in != end) return false;
+
+    // undo the row deltas top to bottom, each row from the already restored one above it, a word at a time
+    for (size_t i = Stride; i < FrameSize; i += sizeof(uint32_t))
+    {
+        uint32_t a, b;
+        memcpy(&a, frame + i, sizeof(a));
+        memcpy(&b, frame + i - Stride, sizeof(b));
+        a ^= b;
+        memcpy(frame + i, &a, sizeof(a));
+    }
+
+    return true;
+}
+
+size_t save_screen_frame(uint8_t const *frame)
+{
+    Header header;
+    uint8_t *buffer = compress(frame, 0, header);
+    bool ok         = buffer != nullptr;
+
+#ifndef HOST_BUILD
+    if (ok && header.size <= sizeof(rtc_data))
+    {
+        memcpy(rtc_data, buffer, header.size);
+        rtc_header = header;
+        remove_file(ScreenFrame);
+    }
+    else
+    {
+        rtc_header.magic = 0;
+        ok               = ok && write_file(ScreenFrame, header, buffer);
+    }
+#else
+    ok = ok && write_file(ScreenFrame, header, buffer);
+#endif
+
+    free(buffer);
+
+    if (!ok)
+    {
+        forget_screen_frame();
+        return 0;
+    }
+    return header.size;
+}
+
+bool load_screen_frame(uint8_t *frame)
+{
+#ifndef HOST_BUILD
+    if (is_valid(rtc_header, 0, rtc_data, sizeof(rtc_data))) return decompress_frame(rtc_data, rtc_header.size, frame);
+#endif
+
+    return load_file(ScreenFrame, 0, frame);
+}
+
+void forget_screen_frame()
+{
+#ifndef HOST_BUILD
+    rtc_header.magic = 0;
+#endif
+    remove_file(ScreenFrame);
+}
+
+size_t save_frame(char const *name, uint64_t key, uint8_t const *frame)
+{
+    Header header;
+    uint8_t *buffer = compress(frame, key, header);
+    bool const ok   = buffer != nullptr && write_file(name, header, buffer);
+
+    free(buffer);
+    return ok ? header.size : 0;
+}
+
+bool load_frame(char const *name, uint64_t key, uint8_t *frame) { return load_file(name, key, frame); }
@@ -0,0 +1,56 @@
+/*
+ * Copyright (c) 2024 zahical. All rights reserved.
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+/**
+ * @file Keeping the frame last sent to the screen across deep sleep, for partial refreshes.
+ *
+ * The frame is stored compressed: every row is XOR-ed with the one above it (most of a row is either background or
+ * continues the shape above, so most bytes become 0), and the result is run-length encoded. The weather UI compresses
+ * to about a fifth of its 259200 bytes, an error screen to a couple of KB.
+ *
+ * A frame that compresses small enough is kept in RTC memory, which survives deep sleep but not a power loss; larger
+ * ones in a LittleFS file (on the host, in a file next to output.png). Only one of the two holds a frame at any time.
+ *
+ * Other full-screen images (e.g. the cached background layer of the UI) can be stored in files of their own, in the same
+ * compressed form.
+ */
+
+#pragma once
+#include <cstddef>
+#include <cstdint>
+
+/// Runs of the same byte shorter than this are stored as literals, see compress_frame().
+constexpr size_t FrameMinRun = 3;
+
+/**
+ * @brief Compresses the full-screen framebuffer `frame` into `out`.
+ *
+ * The output is a sequence of tokens, each starting with a varint (7 bits per byte, low bits first): `n << 1` is
+ * followed by n literal bytes, `(n - FrameMinRun) << 1 | 1` by a single byte repeated n times.
+ *
+ * Returns the compressed size, or 0 if it doesn't fit in `out_size` bytes.
+ */
+size_t compress_frame(uint8_t const *frame, uint8_t *out, size_t out_size);
+
+/// Decompresses the output of compress_frame() into the full-screen framebuffer `frame`. Returns false if it's corrupt.
+bool decompress_frame(uint8_t const *in, size_t size, uint8_t *frame);
+
+/// Stores `frame` (a full-screen framebuffer), replacing the stored one. Returns the compressed size, 0 on failure.
+size_t save_screen_frame(uint8_t const *frame);
+
+/// Restores the stored frame into `frame`. Returns false if there is none (or it's unreadable).
+bool load_screen_frame(uint8_t *frame);
+
+/// Discards the stored frame, for when what's on the screen is no longer known.
+void forget_screen_frame();
+
+/**
+ * @brief Stores the full-screen image `frame` in a file of its own, `name` (a plain file name, without an extension),
+ * tagged with `key`. Returns the compressed size, 0 on failure.
+ */
+size_t save_frame(char const *name, uint64_t key, uint8_t const *frame);
+
+/// Restores the image stored by save_frame() into `frame`. Returns false if there is none, or it's tagged differently.
+bool load_frame(char const *name, uint64_t key, uint8_t *frame);
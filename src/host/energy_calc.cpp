@@ -0,0 +1,74 @@
+/*
+ * Copyright (c) 2024 zahical. All rights reserved.
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+/**
+ * @file Energy calculator implementation.
+ */
+
+#include "energy_calc.h"
+#include "config.h"
+#include "display.h"
+#include "energy.h"
+#include "epd_model.h"
+#include "epd_waveform.h"
+#include "schedule.h"
+
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+
+namespace
+{
+/// The time the panel is powered for a full refresh of the weather UI, by the EPD model.
+double full_refresh_s()
+{
+    uint8_t *fb = Framebuffer();
+    memset(fb, 0xFF, EPD_WIDTH * EPD_HEIGHT / 2);
+    DrawWeather();
+
+    PanelCost cost = poweron_cost();
+    cost += clear_cost(epd_full_screen());
+    cost += draw_cost(epd_full_screen(), image_waveform(epd_full_screen(), fb, BLACK_ON_WHITE));
+    return cost.us / 1e6;
+}
+
+void report(char const *name, Scheduler const& scheduler, WakePhases const& wake)
+{
+    DayEnergy const day = day_energy(scheduler, wake);
+    printf("%-24s %3u wakes/day, %6.3f mAh/wake, %5.2f mAh asleep, %6.2f mAh/day, %5.0f days\n", name, day.wakes,
+           wake_mah(wake), day.sleep_mah, day.mah(), battery_days(0, day.mah()));
+}
+} // namespace
+
+void calculate_energy(double radio_s, double other_s)
+{
+    using namespace std::chrono;
+
+    WakePhases wake;
+    wake.radio_s = radio_s;
+    wake.epd_s   = full_refresh_s();
+    wake.awake_s = radio_s + wake.epd_s + other_s;
+
+    printf("Wake: WiFi %.1f s, EPD %.2f s, awake %.1f s; %.0f mA awake, +%.0f mA WiFi, +%.0f mA EPD, %.2f mA asleep; "
+           "%.0f mAh battery\n",
+           wake.radio_s, wake.epd_s, wake.awake_s, cfg::AwakeMa, cfg::RadioMa, cfg::EpdMa, cfg::SleepMa,
+           cfg::BatteryMah);
+
+    report("configured", Scheduler{cfg::OnTime, cfg::OffTime, cfg::RefreshPeriod, cfg::MaxDrift}, wake);
+
+    for (minutes period : {minutes{30}, minutes{60}, minutes{120}, minutes{180}})
+    {
+        char name[32];
+        snprintf(name, sizeof(name), "on hours, every %d min", int(period.count()));
+        report(name, Scheduler{cfg::OnTime, cfg::OffTime, period, cfg::MaxDrift}, wake);
+    }
+
+    for (minutes period : {minutes{30}, minutes{60}})
+    {
+        char name[32];
+        snprintf(name, sizeof(name), "always, every %d min", int(period.count()));
+        report(name, Scheduler{DailyTime{0}, DailyTime{0}, period, cfg::MaxDrift}, wake);
+    }
+}
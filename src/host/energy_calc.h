@@ -0,0 +1,20 @@
+/*
+ * Copyright (c) 2024 zahical. All rights reserved.
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+/**
+ * @file A calculator of the charge drawn and the battery life over different schedules.
+ */
+
+#pragma once
+
+/**
+ * @brief Reports the charge drawn per wake and per day, and how long a full battery lasts (see energy.h), for the
+ * configured schedule and for other refresh periods, with every wake fully refreshing the screen.
+ *
+ * The WiFi is on for `radio_s` seconds and the CPU is busy for another `other_s` (boot, drawing); the time the panel is
+ * powered comes from the EPD model (see epd_model.h) for the weather UI. The shared data must be populated. Results are
+ * printed to stdout.
+ */
+void calculate_energy(double radio_s, double other_s);
@@ -0,0 +1,231 @@
+/*
+ * Copyright (c) 2024 zahical. All rights reserved.
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+/**
+ * @file EPD timing and charge model implementation.
+ *
+ * Also the host build's definitions of the panel functions of the EPD driver and of esp32/epd_output.h.
+ */
+
+#include "epd_model.h"
+#include "esp32/epd_output.h"
+
+#include <algorithm>
+#include <cstdio>
+
+namespace
+{
+// Assumed figures, see the file comment of epd_model.h.
+constexpr double LineOutUs = 12;   // shifting a row's data out to the panel, overlapped with the previous row's output
+constexpr double CkvLowUs  = 5;    // the gap after a row's output pulse, the driver's 50 ticks
+constexpr double SkipUs    = 1;    // epd_skip(), a clock pulse without data
+constexpr double FrameUs   = 50;   // epd_start_frame() and epd_end_frame()
+constexpr double PowerOnUs = 1000; // the settling delays of epd_poweron()
+constexpr double PoweredMa = 100;  // the board, with the panel supplies on
+constexpr double DrivingMa = 150;  // on top of that, while a row's output pulse drives its pixels
+
+/// Goes through the frames and rows the way the driver sends them, adding up their cost.
+class Panel
+{
+  public:
+    explicit Panel(bool skip_rows) : _skip_rows(skip_rows) {}
+
+    PanelCost const& cost() const { return _cost; }
+
+    bool skipping() const { return _skipping != 0; }
+
+    void start_frame()
+    {
+        _cost.frames++;
+        add(FrameUs, 0);
+    }
+
+    /// The driver's write_row().
+    void write_row(uint32_t output_time_dus)
+    {
+        _skipping = 0;
+        _cost.rows++;
+        output_row(output_time_dus, true);
+    }
+
+    /// The driver's skip_row(); without row skipping, a row of no-ops sent for `row_time_dus` instead.
+    void skip_row(uint8_t pipeline_finish_time, uint32_t row_time_dus)
+    {
+        _cost.skipped++;
+        if (!_skip_rows)
+        {
+            output_row(row_time_dus, false);
+            return;
+        }
+
+        // the first one still outputs the previously loaded row
+        if (_skipping == 0)
+            output_row(pipeline_finish_time, true);
+        else if (_skipping < 2)
+            output_row(10, false);
+        else
+            add(SkipUs, 0);
+
+        _skipping++;
+    }
+
+  private:
+    /// epd_output_row(): the output pulse and the gap after it, unless shifting the next row out takes longer.
+    void output_row(uint32_t output_time_dus, bool drives)
+    {
+        double const pulse_us = output_time_dus / 10.0;
+        add(std::max(LineOutUs, pulse_us + CkvLowUs), drives ? pulse_us : 0);
+    }
+
+    void add(double us, double driving_us)
+    {
+        _cost.us += us;
+        _cost.uc += (us * PoweredMa + driving_us * DrivingMa) / 1000;
+    }
+
+    bool const _skip_rows;
+    uint32_t _skipping = 0;
+    PanelCost _cost;
+};
+
+/// The driver's epd_push_pixels(), without the row data.
+void push_pixels(Panel& panel, Rect_t const& area, int16_t time)
+{
+    panel.start_frame();
+    for (int32_t i = 0; i < EPD_HEIGHT; i++)
+    {
+        if (i < area.y || i >= area.y + area.height)
+            panel.skip_row(time, time * 10);
+        else
+            panel.write_row(time * 10);
+    }
+    // the driver latches the last row out even after skipping
+    panel.write_row(time * 10);
+}
+
+/// The costs of the calls since epd_init(), by phase.
+PanelCost power_on_cost, clear_screen_cost, update_screen_cost;
+
+PanelCost *phase_cost(TimeEvent e)
+{
+    switch (e)
+    {
+    case TimeEvent::PowerOnScreen:
+        return &power_on_cost;
+    case TimeEvent::ClearScreen:
+        return &clear_screen_cost;
+    case TimeEvent::UpdateScreen:
+        return &update_screen_cost;
+    default:
+        return nullptr;
+    }
+}
+
+void print_cost(char const *name, PanelCost const& c)
+{
+    printf("%-16s %3u frames, %6u rows, %6u skipped; %7.1f ms, %6.1f mC\n", name, c.frames, c.rows, c.skipped,
+           c.us / 1000, c.uc / 1000);
+}
+} // namespace
+
+PanelCost& PanelCost::operator+=(PanelCost const& other)
+{
+    frames += other.frames;
+    rows += other.rows;
+    skipped += other.skipped;
+    us += other.us;
+    uc += other.uc;
+    return *this;
+}
+
+PanelCost poweron_cost()
+{
+    PanelCost cost;
+    cost.us = PowerOnUs;
+    cost.uc = PowerOnUs * PoweredMa / 1000;
+    return cost;
+}
+
+PanelCost clear_cost(Rect_t const& area, bool skip_rows)
+{
+    // epd_clear_area_cycles(area, 4, 50)
+    Panel panel{skip_rows};
+    for (int c = 0; c < 4; c++)
+    {
+        for (int i = 0; i < 4; i++)
+            push_pixels(panel, area, 50); // darken
+        for (int i = 0; i < 4; i++)
+            push_pixels(panel, area, 50); // lighten
+    }
+    return panel.cost();
+}
+
+PanelCost draw_cost(Rect_t const& area, Waveform const& waveform, bool skip_rows)
+{
+    // as esp32/epd_output.cpp sends the steps
+    Panel panel{skip_rows};
+    for (uint8_t s = 0; s < waveform.count; s++)
+    {
+        int32_t const time = waveform.steps[s].time;
+
+        panel.start_frame();
+        for (int32_t i = 0; i < EPD_HEIGHT; i++)
+        {
+            if (i < area.y || i >= area.y + area.height)
+                panel.skip_row(time, time);
+            else
+                panel.write_row(time);
+        }
+        if (!panel.skipping()) panel.write_row(time);
+    }
+    return panel.cost();
+}
+
+PanelCost panel_cost(TimeEvent e)
+{
+    PanelCost const *cost = phase_cost(e);
+    return cost ? *cost : PanelCost{};
+}
+
+void print_panel_costs()
+{
+    PanelCost total;
+    for (PanelCost const *c : {&power_on_cost, &clear_screen_cost, &update_screen_cost})
+        total += *c;
+
+    printf("EPD model, estimated:\n");
+    print_cost("power-on screen", power_on_cost);
+    print_cost("clear screen", clear_screen_cost);
+    print_cost("update screen", update_screen_cost);
+    print_cost("total", total);
+}
+
+// the panel functions of the host build
+
+void epd_init() { power_on_cost = clear_screen_cost = update_screen_cost = {}; }
+
+void epd_poweron() { power_on_cost += poweron_cost(); }
+
+void epd_poweroff() {}
+
+void epd_poweroff_all() {}
+
+void epd_clear() { epd_clear_area(epd_full_screen()); }
+
+void epd_clear_area(Rect_t area) { clear_screen_cost += clear_cost(area); }
+
+Rect_t epd_full_screen() { return {.x = 0, .y = 0, .width = EPD_WIDTH, .height = EPD_HEIGHT}; }
+
+bool epd_output_init() { return true; }
+
+void epd_output_draw_image(Rect_t const& area, uint8_t const *data, DrawMode_t mode)
+{
+    update_screen_cost += draw_cost(area, image_waveform(area, data, mode));
+}
+
+void epd_output_draw_1bit(Rect_t const& area, uint8_t const *)
+{
+    update_screen_cost += draw_cost(area, mono_waveform());
+}
@@ -0,0 +1,55 @@
+/*
+ * Copyright (c) 2024 zahical. All rights reserved.
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+/**
+ * @file A timing and charge model of the EPD, standing in for the panel in the host build.
+ *
+ * The host build has no panel to drive, so here the panel functions display.cpp calls (epd_poweron(), epd_clear(),
+ * epd_clear_area(), epd_output_draw_image(), ...) go through the same frames and rows the EPD driver and
+ * esp32/epd_output.cpp send to the panel, the same row output times, row skipping and clear cycles, and add up how long
+ * that would take and how much charge it would draw. Screen updates can then be compared without the device: full vs.
+ * partial refreshes, the full vs. the adaptive waveform, rows skipped or not.
+ *
+ * The per-row figures (see epd_model.cpp) are assumed, not measured: the results are for comparing ways of driving the
+ * panel, not absolute numbers.
+ */
+
+#pragma once
+#include "epd_waveform.h"
+#include "timings.h"
+
+#include <epd_driver.h>
+
+#include <cstdint>
+
+/// The estimated cost of driving the panel.
+struct PanelCost
+{
+    uint32_t frames  = 0; // passes over the panel
+    uint32_t rows    = 0; // rows sent with image data
+    uint32_t skipped = 0; // rows outside of the area
+    double us        = 0; // duration, microseconds
+    double uc        = 0; // charge drawn, microcoulombs
+
+    PanelCost& operator+=(PanelCost const& other);
+};
+
+/// The cost of epd_poweron().
+PanelCost poweron_cost();
+
+/// The cost of epd_clear_area(`area`); with `skip_rows` false, as if the rows outside of it were sent too.
+PanelCost clear_cost(Rect_t const& area, bool skip_rows = true);
+
+/// The cost of drawing an image of `area` in `waveform`, see epd_output_draw_image().
+PanelCost draw_cost(Rect_t const& area, Waveform const& waveform, bool skip_rows = true);
+
+/**
+ * @brief The total cost of the panel calls made since epd_init() in phase `e`: TimeEvent::PowerOnScreen,
+ * ClearScreen or UpdateScreen.
+ */
+PanelCost panel_cost(TimeEvent e);
+
+/// Prints the cost of each phase to stdout.
+void print_panel_costs();
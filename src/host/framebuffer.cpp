@@ -9,6 +9,7 @@
 
 #include "framebuffer.h"
 #include "display.h"
+#include "timings.h"
 
 #include "libs/rpng/rpng.h"
 #include <epd_driver.h>
@@ -36,6 +37,8 @@ void checkers()
 
 void save_fb()
 {
+    TIMING_SPAN("Save PNG");
+
     uint8_t *png_buf = (uint8_t *)calloc(sizeof(uint8_t), EPD_WIDTH * EPD_HEIGHT);
     uint8_t *in      = Framebuffer();
     uint8_t *out     = png_buf;
@@ -0,0 +1,263 @@
+/*
+ * Copyright (c) 2024 zahical. All rights reserved.
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+/**
+ * @file Generator for the pre-rendered weather condition icon sprites.
+ *
+ * Each icon is drawn twice with the regular drawing primitives: once over a white and once over a black framebuffer.
+ * Pixels that come out the same in both are the ones the icon actually paints; the rest are left transparent.
+ * The painted pixels are stored as horizontal runs of the same color, row by row:
+ *
+ *   row:  <run count> { <skip> <length> <color> }...
+ *
+ * where `skip` is the number of transparent pixels since the end of the previous run (or the sprite's left edge).
+ */
+
+#include "icon_sprites.h"
+#include "display.h"
+
+#include <epd_driver.h>
+
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <vector>
+
+namespace
+{
+constexpr int fb_size = EPD_WIDTH * EPD_HEIGHT / 2;
+
+// Icon codes, see https://openweathermap.org/weather-conditions
+char const *const icon_codes[] = {"01", "02", "03", "04", "09", "10", "11", "13", "50"};
+
+// Most icons are translation invariant and a single sprite is good for any position. Some however, use the absolute
+// y coordinate in their geometry; for these, a sprite is made for every y the UI layout places them at:
+// DisplayForecastSection() for the small ones and DisplayWeatherIconAndTextSection() (one or two text lines) for the
+// large one.
+int const small_layout_y[] = {305};
+int const large_layout_y[] = {102, 120};
+
+// a spot where even the largest icon is fully on-screen
+constexpr int probe_x = 480;
+constexpr int probe_y = 240;
+
+struct Capture
+{
+    std::vector<uint8_t> on_white;
+    std::vector<uint8_t> on_black;
+
+    bool opaque(int x, int y) const { return nibble(on_white, x, y) == nibble(on_black, x, y); }
+
+    uint8_t color(int x, int y) const { return nibble(on_white, x, y); }
+
+    static uint8_t nibble(std::vector<uint8_t> const& fb, int x, int y)
+    {
+        uint8_t b = fb[y * EPD_WIDTH / 2 + x / 2];
+        return x % 2 ? b >> 4 : b & 0x0F;
+    }
+};
+
+Capture capture(int x, int y, std::string const& icon, bool large)
+{
+    Capture c;
+    uint8_t *fb = Framebuffer();
+
+    memset(fb, 0xFF, fb_size);
+    DrawConditionsIcon(x, y, icon.c_str(), large);
+    c.on_white.assign(fb, fb + fb_size);
+
+    memset(fb, 0x00, fb_size);
+    DrawConditionsIcon(x, y, icon.c_str(), large);
+    c.on_black.assign(fb, fb + fb_size);
+
+    return c;
+}
+
+/// true if `b` is `a` shifted by (dx, dy)
+bool same_shifted(Capture const& a, Capture const& b, int dx, int dy)
+{
+    for (int y = 0; y < EPD_HEIGHT - dy; y++)
+        for (int x = 0; x < EPD_WIDTH - dx; x++)
+        {
+            bool op = a.opaque(x, y);
+            if (op != b.opaque(x + dx, y + dy)) return false;
+            if (op && a.color(x, y) != b.color(x + dx, y + dy)) return false;
+        }
+
+    return true;
+}
+
+/// true if the icon looks the same (just shifted) when drawn a few pixels away in the given direction
+bool invariant(Capture const& base, std::string const& icon, bool large, int step_x, int step_y)
+{
+    // a single step is not enough, scaled coordinates may round the same way for some shifts but not for others
+    for (int n : {1, 2, 3, 5, 8, 13})
+        if (!same_shifted(base, capture(probe_x + n * step_x, probe_y + n * step_y, icon, large), n * step_x, n * step_y))
+            return false;
+
+    return true;
+}
+
+struct Sprite
+{
+    std::string icon;
+    bool large;
+    bool y_locked;
+    int anchor_y;
+    int dx, dy, width, height;
+    std::vector<uint8_t> runs;
+};
+
+bool encode(Capture const& c, int x, int y, Sprite& spr)
+{
+    int min_x = EPD_WIDTH, min_y = EPD_HEIGHT, max_x = -1, max_y = -1;
+    for (int yy = 0; yy < EPD_HEIGHT; yy++)
+        for (int xx = 0; xx < EPD_WIDTH; xx++)
+        {
+            if (!c.opaque(xx, yy)) continue;
+            if (xx < min_x) min_x = xx;
+            if (xx > max_x) max_x = xx;
+            if (yy < min_y) min_y = yy;
+            if (yy > max_y) max_y = yy;
+        }
+
+    if (max_x < 0) return false; // nothing drawn
+
+    spr.dx     = min_x - x;
+    spr.dy     = min_y - y;
+    spr.width  = max_x - min_x + 1;
+    spr.height = max_y - min_y + 1;
+
+    for (int yy = min_y; yy <= max_y; yy++)
+    {
+        std::vector<uint8_t> row;
+        int count = 0, pos = min_x, xx = min_x;
+        while (xx <= max_x)
+        {
+            if (!c.opaque(xx, yy))
+            {
+                xx++;
+                continue;
+            }
+
+            uint8_t col = c.color(xx, yy);
+            int start   = xx;
+            while (xx <= max_x && c.opaque(xx, yy) && c.color(xx, yy) == col && xx - start < 255)
+                xx++;
+
+            // the skip must fit in a byte too; split long gaps with empty runs
+            while (start - pos > 255)
+            {
+                row.insert(row.end(), {255, 0, 0});
+                pos += 255;
+                count++;
+            }
+
+            row.insert(row.end(), {(uint8_t)(start - pos), (uint8_t)(xx - start), (uint8_t)(col | (col << 4))});
+            pos = xx;
+            count++;
+        }
+
+        if (count > 255) return false;
+
+        spr.runs.push_back(count);
+        spr.runs.insert(spr.runs.end(), row.begin(), row.end());
+    }
+
+    return true;
+}
+
+std::string sprite_name(Sprite const& s)
+{
+    return "IconSprite_" + s.icon + (s.large ? "_L" : "_S") + (s.y_locked ? "_y" + std::to_string(s.anchor_y) : "");
+}
+
+} // namespace
+
+bool generate_icon_sprites(char const *path)
+{
+    std::vector<Sprite> sprites;
+
+    for (char const *code : icon_codes)
+    {
+        for (char const *suffix : {"d", "n"})
+        {
+            std::string icon = std::string(code) + suffix;
+
+            for (bool large : {true, false})
+            {
+                Capture base = capture(probe_x, probe_y, icon, large);
+
+                if (!invariant(base, icon, large, 1, 0))
+                {
+                    printf("%s (%s): x-position dependent, no sprite\n", icon.c_str(), large ? "large" : "small");
+                    continue;
+                }
+
+                bool y_locked = !invariant(base, icon, large, 0, 1);
+
+                std::vector<int> ys;
+                if (y_locked)
+                    for (int y : large ? std::vector<int>(std::begin(large_layout_y), std::end(large_layout_y))
+                                       : std::vector<int>(std::begin(small_layout_y), std::end(small_layout_y)))
+                        ys.push_back(y);
+                else
+                    ys.push_back(probe_y);
+
+                for (int y : ys)
+                {
+                    Sprite spr{icon, large, y_locked, y_locked ? y : 0, 0, 0, 0, 0, {}};
+                    if (!encode(y_locked ? capture(probe_x, y, icon, large) : base, probe_x, y, spr))
+                    {
+                        printf("%s (%s): can't encode, no sprite\n", icon.c_str(), large ? "large" : "small");
+                        continue;
+                    }
+                    sprites.push_back(std::move(spr));
+                }
+            }
+        }
+    }
+
+    memset(Framebuffer(), 0xFF, fb_size);
+
+    FILE *f = fopen(path, "w");
+    if (!f) return false;
+
+    size_t total = 0;
+
+    fprintf(f, "// This file was generated by the host emulator (program --gen-icons). Do not edit.\n");
+    fprintf(f, "#pragma once\n");
+    fprintf(f, "#include <cstdint>\n\n");
+    fprintf(f, "struct IconSpriteSpec\n{\n");
+    fprintf(f, "    char const *icon;    // OWM icon code, e.g. \"10d\"\n");
+    fprintf(f, "    bool large;          // LargeIcon or SmallIcon\n");
+    fprintf(f, "    bool y_locked;       // only valid when drawn at anchor_y\n");
+    fprintf(f, "    int16_t anchor_y;\n");
+    fprintf(f, "    int16_t dx, dy;      // top-left corner, relative to the icon's (x, y)\n");
+    fprintf(f, "    int16_t width, height;\n");
+    fprintf(f, "    uint8_t const *runs; // per row: <count> {<skip> <length> <color>}...\n");
+    fprintf(f, "};\n\n");
+
+    for (Sprite const& s : sprites)
+    {
+        fprintf(f, "constexpr uint8_t %s_runs[] = {", sprite_name(s).c_str());
+        for (size_t i = 0; i < s.runs.size(); i++)
+            fprintf(f, "%s0x%02X,", i % 16 == 0 ? "\n\t" : " ", s.runs[i]);
+        fprintf(f, "\n};\n");
+        total += s.runs.size();
+    }
+
+    fprintf(f, "\nconstexpr IconSpriteSpec IconSprites[] = {\n");
+    for (Sprite const& s : sprites)
+        fprintf(f, "    {\"%s\", %s, %s, %d, %d, %d, %d, %d, %s_runs},\n", s.icon.c_str(), s.large ? "true" : "false",
+                s.y_locked ? "true" : "false", s.anchor_y, s.dx, s.dy, s.width, s.height, sprite_name(s).c_str());
+    fprintf(f, "};\n");
+
+    fclose(f);
+
+    printf("%zu icon sprites, %zu bytes of run data written to %s\n", sprites.size(), total, path);
+    return true;
+}
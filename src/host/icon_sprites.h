@@ -0,0 +1,20 @@
+/*
+ * Copyright (c) 2024 zahical. All rights reserved.
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+/**
+ * @file Generator for the pre-rendered weather condition icon sprites.
+ */
+
+#pragma once
+
+/**
+ * @brief Renders every weather condition icon, in both sizes, with the drawing primitives and writes the result as
+ * run-length encoded 4bpp sprites to a header file (normally src/imgs/icons.h).
+ *
+ * Uses (and afterwards clears) the framebuffer, so it must be called after InitGraphics() and before drawing the UI.
+ *
+ * @return false if the file could not be written.
+ */
+bool generate_icon_sprites(char const *path);
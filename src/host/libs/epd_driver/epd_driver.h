@@ -83,7 +83,9 @@ typedef struct
 /******************************************************************************/
 /***        exported functions                                              ***/
 /******************************************************************************/
-#ifdef PORT_HACKS
+
+// Provided by the EPD model of the host build, see host/epd_model.h.
+
 /**
  * @brief Initialize the ePaper display
  */
@@ -113,6 +115,8 @@ void epd_poweroff_all();
  */
 void epd_clear_area(Rect_t area);
 
+#ifdef PORT_HACKS
+
 /**
  * @brief Clear an area by flashing it.
  *
@@ -160,13 +164,13 @@ void IRAM_ATTR epd_draw_grayscale_image(Rect_t area, uint8_t *data);
 void IRAM_ATTR epd_draw_image(Rect_t area, uint8_t *data, DrawMode_t mode);
 
 void IRAM_ATTR epd_draw_frame_1bit(Rect_t area, uint8_t *ptr, DrawMode_t mode, int32_t time);
+#endif
 
 
 /**
  * @brief Rectancle representing the whole screen area.
  */
 Rect_t epd_full_screen();
-#endif
 
 /**
  * @brief Draw a picture to a given framebuffer.
@@ -0,0 +1,192 @@
+/*
+ * Copyright (c) 2024 zahical. All rights reserved.
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+/**
+ * @file Check of the EPD conversion tables implementation.
+ */
+
+#include "lut_check.h"
+#include "epd_lut.h"
+#include "epd_waveform.h"
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <random>
+#include <vector>
+
+namespace
+{
+// the EPD driver's, from epd_driver.c, as the reference
+
+void driver_reset_lut(uint8_t *lut_mem, DrawMode_t mode)
+{
+    switch (mode)
+    {
+    case BLACK_ON_WHITE:
+        memset(lut_mem, 0x55, (1 << 16));
+        break;
+    case WHITE_ON_BLACK:
+    case WHITE_ON_WHITE:
+        memset(lut_mem, 0xAA, (1 << 16));
+        break;
+    default:
+        break;
+    }
+}
+
+void driver_update_LUT(uint8_t *lut_mem, uint8_t k, DrawMode_t mode)
+{
+    if (mode == BLACK_ON_WHITE || mode == WHITE_ON_WHITE)
+    {
+        k = 15 - k;
+    }
+
+    // reset the pixels which are not to be lightened / darkened
+    // any longer in the current frame
+    for (uint32_t l = k; l < (1 << 16); l += 16)
+    {
+        lut_mem[l] &= 0xFC;
+    }
+
+    for (uint32_t l = (k << 4); l < (1 << 16); l += (1 << 8))
+    {
+        for (uint32_t p = 0; p < 16; p++)
+        {
+            lut_mem[l + p] &= 0xF3;
+        }
+    }
+    for (uint32_t l = (k << 8); l < (1 << 16); l += (1 << 12))
+    {
+        for (uint32_t p = 0; p < (1 << 8); p++)
+        {
+            lut_mem[l + p] &= 0xCF;
+        }
+    }
+    for (uint32_t p = (k << 12); p < (uint32_t(k + 1) << 12); p++)
+    {
+        lut_mem[p] &= 0x3F;
+    }
+}
+
+double us_since(std::chrono::steady_clock::time_point t0)
+{
+    return std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - t0).count();
+}
+
+char const *mode_name(DrawMode_t mode)
+{
+    return mode == BLACK_ON_WHITE ? "black on white" : mode == WHITE_ON_WHITE ? "white on white" : "white on black";
+}
+
+/// How long each of the 16 levels is driven for with `waveform`, going by the conversion tables.
+std::array<int32_t, 16> drive_times(Waveform const& waveform, DrawMode_t mode, LutPair& pair)
+{
+    std::array<int32_t, 16> times{};
+    pair.begin(mode);
+    for (uint8_t s = 0; s < waveform.count; s++)
+    {
+        pair.prepare(s, waveform.steps[s].frame);
+        for (uint8_t n = 0; n < 16; n++)
+            if (pair.table(s)[n * 0x1111] != 0) times[n] += waveform.steps[s].time;
+    }
+    return times;
+}
+
+/// Checks that the planned waveforms drive every level present for as long as the full one does.
+bool check_waveforms(LutPair& pair)
+{
+    std::vector<uint16_t> sets;
+    for (unsigned a = 0; a < 16; a++)
+        for (unsigned b = a; b < 16; b++)
+            sets.push_back(1 << a | 1 << b);
+    std::mt19937 rng(7);
+    for (int i = 0; i < 200; i++)
+        sets.push_back(uint16_t(rng()));
+    sets.push_back(0xFFFF);
+
+    bool ok = true;
+    for (DrawMode_t mode : {BLACK_ON_WHITE, WHITE_ON_WHITE, WHITE_ON_BLACK})
+    {
+        auto const full = drive_times(full_waveform(mode), mode, pair);
+        int bad = 0, steps = 0;
+
+        for (uint16_t levels : sets)
+        {
+            Waveform const planned = plan_waveform(levels, mode);
+            auto const times       = drive_times(planned, mode, pair);
+            steps += planned.count;
+
+            for (uint8_t n = 0; n < 16; n++)
+                if ((levels & 1 << n) && times[n] != full[n]) bad++;
+            for (uint8_t s = 0; s < planned.count; s++)
+                if (planned.steps[s].time > MaxStepTime) bad++;
+        }
+
+        auto const count = [mode](uint16_t levels) { return plan_waveform(levels, mode).count; };
+        printf("%-15s waveforms %s; steps for black and white %d, with 3 greys %d, all levels %d, %.1f on average\n",
+               mode_name(mode), bad ? "WRONG" : "ok", count(0x8001), count(0x8001 | 1 << 5 | 1 << 8 | 1 << 11),
+               count(0xFFFF), double(steps) / sets.size());
+        ok = ok && bad == 0;
+    }
+    return ok;
+}
+} // namespace
+
+bool check_epd_luts()
+{
+    std::vector<uint8_t> reference(LutSize), buffer0(LutSize), buffer1(LutSize);
+    LutPair pair(buffer0.data(), buffer1.data());
+
+    // single runs vary a lot on a busy host, so the times are the best of several images
+    constexpr int Images = 9;
+    bool ok              = true;
+
+    for (DrawMode_t mode : {BLACK_ON_WHITE, WHITE_ON_WHITE, WHITE_ON_BLACK})
+    {
+        double best_driver_us = 1e9, best_pair_us = 1e9;
+        std::array<double, LutFrameCount> best_frame_us;
+        best_frame_us.fill(1e9);
+        int bad_frames = 0;
+
+        for (int image = 0; image < Images; image++)
+        {
+            double driver_us = 0, pair_us = 0;
+            pair.begin(mode);
+            for (uint8_t k = 0; k < LutFrameCount; k++)
+            {
+                auto t0 = std::chrono::steady_clock::now();
+                if (k == 0) driver_reset_lut(reference.data(), mode);
+                driver_update_LUT(reference.data(), k, mode);
+                driver_us += us_since(t0);
+
+                t0 = std::chrono::steady_clock::now();
+                pair.prepare(k, k);
+                double const frame_us = us_since(t0);
+                pair_us += frame_us;
+                best_frame_us[k] = std::min(best_frame_us[k], frame_us);
+
+                if (memcmp(pair.table(k), reference.data(), LutSize) != 0) bad_frames++;
+            }
+            best_driver_us = std::min(best_driver_us, driver_us);
+            best_pair_us   = std::min(best_pair_us, pair_us);
+        }
+        double const worst_frame_us = *std::max_element(best_frame_us.begin() + 2, best_frame_us.end());
+
+        printf("%-15s %s, driver %6.0f us/image, pair %6.0f us/image (%4.0f us per frame past the first two, "
+               "overlapped with the previous frame's output)\n",
+               mode_name(mode), bad_frames ? "DIFFERENT" : "same", best_driver_us, best_pair_us, worst_frame_us);
+        if (bad_frames)
+        {
+            printf("  %d of %d tables differ\n", bad_frames, Images * LutFrameCount);
+            ok = false;
+        }
+    }
+
+    return check_waveforms(pair) && ok;
+}
@@ -0,0 +1,19 @@
+/*
+ * Copyright (c) 2024 zahical. All rights reserved.
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+/**
+ * @file Check of the EPD conversion tables.
+ */
+
+#pragma once
+
+/**
+ * @brief Checks that the conversion tables LutPair prepares for every frame are byte for byte the same as the ones the
+ * EPD driver builds, in every draw mode and over several images in a row, and times the two. Also checks that the
+ * waveforms of plan_waveform() drive every grey level present for as long as the driver's full waveform does.
+ *
+ * Results are printed to stdout. Returns false if any table differs.
+ */
+bool check_epd_luts();
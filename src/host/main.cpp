@@ -10,17 +10,33 @@
 #include "config.h"
 #include "data_cycle.h"
 #include "display.h"
+#include "display_list.h"
 #include "shared_data.h"
 
+#include "energy_calc.h"
+#include "epd_model.h"
 #include "framebuffer.h"
+#include "icon_sprites.h"
+#include "lut_check.h"
+#include "nibble_bench.h"
+#include "refresh_bench.h"
+#include "refresh_sim.h"
+#include "sections.h"
+#include "text_bench.h"
+#include "tile_render.h"
+#include "timing_history.h"
 #include "timings.h"
+#include "trace_export.h"
 
+#include <algorithm>
 #include <cassert>
 #include <chrono>
 
+#include <cstdio>
 #include <cstdlib>
 #include <cstring>
 #include <ctime>
+#include <thread>
 
 // provided by host data_fetcher
 void http_use_mock_data();
@@ -64,8 +80,81 @@ void run_with_mock_data()
     http_use_mock_data();
 }
 
-int main()
+// the unit tests have their own
+#ifndef PIO_UNIT_TESTING
+int main(int argc, char **argv)
 {
+    // program --gen-icons [path]: re-generate the weather icon sprites and exit.
+    if (argc > 1 && strcmp(argv[1], "--gen-icons") == 0)
+    {
+        InitGraphics();
+        return generate_icon_sprites(argc > 2 ? argv[2] : "src/imgs/icons.h") ? EXIT_SUCCESS : EXIT_FAILURE;
+    }
+
+    // program --bench-text: glyph lookup microbenchmark.
+    if (argc > 1 && strcmp(argv[1], "--bench-text") == 0)
+    {
+        bench_text_lookup();
+        return EXIT_SUCCESS;
+    }
+
+    // program --bench-nibbles: pixel transform kernels microbenchmark.
+    if (argc > 1 && strcmp(argv[1], "--bench-nibbles") == 0)
+    {
+        return bench_nibble_ops() ? EXIT_SUCCESS : EXIT_FAILURE;
+    }
+
+    // program --check-luts: check the EPD conversion tables against the driver's, see epd_lut.h.
+    if (argc > 1 && strcmp(argv[1], "--check-luts") == 0)
+    {
+        return check_epd_luts() ? EXIT_SUCCESS : EXIT_FAILURE;
+    }
+
+    // program --bench-error: show the error screen and report how long it takes, see cfg::MonoErrorScreen.
+    if (argc > 1 && strcmp(argv[1], "--bench-error") == 0)
+    {
+        InitGraphics();
+        bench_error_screen();
+        save_fb();
+        return EXIT_SUCCESS;
+    }
+
+    // program --threads N: render the UI with N threads, see tile_render.h.
+    // program --bench-tiles [N]: time the multi-threaded render with 1..N threads.
+    // program --check-sections: check the UI section boxes of display.cpp; also times the dual-core render.
+    // program --dump-list [path]: write the UI's recorded drawing calls as text, see DisplayList::serialize().
+    // program --bench-partial: report the areas a partial refresh would update, see dirty_rects.h, and the size of the
+    // last frame as kept across deep sleep, see frame_store.h.
+    // program --bench-waveform: report the frames the adaptive waveform draws the UI in, see epd_waveform.h.
+    // program --sim-refresh [days]: simulate the screen refreshes over a week (or `days`), see refresh_policy.h.
+    // program --energy [radio_s [other_s]]: report the charge drawn and the battery life over different schedules, with
+    // the WiFi on for `radio_s` seconds a wake (4.5 by default) and `other_s` more awake (1), see energy.h.
+    // program --timings: print the timings of the run, and their history over the runs, see timing_history.h.
+    // program ... --trace path: also write the timing spans of the run as a Chrome trace, see trace_export.h.
+    // program ... --timings-csv path: also write a summary of the timing spans of the run as CSV.
+    unsigned render_threads = 0;
+    unsigned bench_threads  = 0;
+    bool check_sections     = argc > 1 && strcmp(argv[1], "--check-sections") == 0;
+    bool dump_list          = argc > 1 && strcmp(argv[1], "--dump-list") == 0;
+    bool bench_partial      = argc > 1 && strcmp(argv[1], "--bench-partial") == 0;
+    bool bench_waves        = argc > 1 && strcmp(argv[1], "--bench-waveform") == 0;
+    bool show_timings       = argc > 1 && strcmp(argv[1], "--timings") == 0;
+    bool calc_energy        = argc > 1 && strcmp(argv[1], "--energy") == 0;
+    int sim_days            = 0;
+    if (argc > 2 && strcmp(argv[1], "--threads") == 0) render_threads = std::max(1, atoi(argv[2]));
+    if (argc > 1 && strcmp(argv[1], "--bench-tiles") == 0)
+        bench_threads = argc > 2 ? std::max(1, atoi(argv[2])) : std::max(1u, std::thread::hardware_concurrency());
+    if (argc > 1 && strcmp(argv[1], "--sim-refresh") == 0) sim_days = argc > 2 ? std::max(1, atoi(argv[2])) : 7;
+
+    char const *trace_path = nullptr;
+    char const *csv_path   = nullptr;
+    for (int i = 1; i + 1 < argc; i++)
+    {
+        if (strcmp(argv[i], "--trace") == 0) trace_path = argv[i + 1];
+        if (strcmp(argv[i], "--timings-csv") == 0) csv_path = argv[i + 1];
+    }
+    if (trace_path || csv_path) start_trace();
+
     // if false, mock data from test_data.cpp is used;
     // if true, data is fetched by actually calling the OWM API.
     bool do_live = false;
@@ -83,12 +172,76 @@ int main()
 
     auto r = do_data_cycle();
 
-    if (r)
+    if (r && check_sections)
+    {
+        bool ok = check_weather_sections();
+        bench_dual_core_render();
+        return ok ? EXIT_SUCCESS : EXIT_FAILURE;
+    }
+
+    if (r && dump_list)
+    {
+        DisplayList list;
+        RecordWeather(list);
+
+        char const *path = argc > 2 ? argv[2] : "display_list.txt";
+        FILE *f          = fopen(path, "w");
+        if (!f) return EXIT_FAILURE;
+        fputs(list.serialize().c_str(), f);
+        fclose(f);
+        printf("%zu operations written to %s\n", list.size(), path);
+        return EXIT_SUCCESS;
+    }
+
+    if (r && bench_partial)
+    {
+        bench_partial_refresh();
+        return bench_frame_store() ? EXIT_SUCCESS : EXIT_FAILURE;
+    }
+
+    if (r && bench_waves)
+    {
+        bench_waveform();
+        return EXIT_SUCCESS;
+    }
+
+    if (r && sim_days)
+    {
+        simulate_refreshes(sim_days);
+        return EXIT_SUCCESS;
+    }
+
+    if (r && calc_energy)
+    {
+        calculate_energy(argc > 2 ? atof(argv[2]) : 4.5, argc > 3 ? atof(argv[3]) : 1.0);
+        return EXIT_SUCCESS;
+    }
+
+    if (r && bench_threads)
+    {
+        bench_tile_render(bench_threads);
+        return EXIT_SUCCESS;
+    }
+
+    if (r && render_threads)
+        render_weather_tiled(render_threads);
+    else if (r)
         DisplayWeather();
     else
         DisplayError(r.error());
 
     save_fb();
-
-    if (do_live) dump_timings();
-}
\ No newline at end of file
+    print_panel_costs();
+
+    // a run is a refresh cycle
+    record_timing_history();
+    if (do_live || show_timings)
+    {
+        dump_timings();
+        dump_timing_history();
+    }
+
+    if (trace_path && !write_trace(trace_path)) return EXIT_FAILURE;
+    if (csv_path && !write_timings_csv(csv_path)) return EXIT_FAILURE;
+}
+#endif
\ No newline at end of file
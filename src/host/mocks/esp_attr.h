@@ -1,2 +1,3 @@
 #pragma once
-#define IRAM_ATTR
\ No newline at end of file
+#define IRAM_ATTR
+#define RTC_DATA_ATTR
\ No newline at end of file
@@ -0,0 +1,157 @@
+/*
+ * Copyright (c) 2024 zahical. All rights reserved.
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+/**
+ * @file Pixel transform kernels microbenchmark implementation.
+ */
+
+#include "nibble_bench.h"
+#include "fb_view.h"
+#include "nibble_ops.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <functional>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace
+{
+constexpr int fb_size = EPD_WIDTH * EPD_HEIGHT / 2;
+
+/// Runs `f` `rounds` times, returns the best time in microseconds.
+template <typename F>
+double best_us(int rounds, F&& f)
+{
+    double best = 1e18;
+    for (int r = 0; r < rounds; r++)
+    {
+        auto t0 = std::chrono::steady_clock::now();
+        f();
+        auto t1 = std::chrono::steady_clock::now();
+        best    = std::min(best, std::chrono::duration<double, std::micro>(t1 - t0).count());
+    }
+    return best;
+}
+
+struct Kernel
+{
+    std::string name;
+    std::function<uint8_t(uint8_t)> mod;                  // the 8-bit callback for modify_rect()
+    std::function<void(ScreenView&, Rect_t const&)> fast; // the FbView method
+    std::function<void(uint8_t *, size_t)> swar;          // the word-at-a-time kernel alone
+};
+
+std::vector<Kernel> kernels()
+{
+    std::vector<Kernel> v;
+
+    v.push_back({"invert", [](uint8_t c) { return 255 - c; }, [](ScreenView& s, Rect_t const& r) { s.invert_rect(r); },
+                 [](uint8_t *p, size_t n) { nibble_ops::swar::invert(p, n); }});
+
+    for (int8_t delta : {-6, -15, 3, 15})
+    {
+        v.push_back({"add " + std::to_string(delta), [delta](uint8_t c) { return std::clamp((c >> 4) + delta, 0, 15) << 4; },
+                     [delta](ScreenView& s, Rect_t const& r) { s.add_rect(r, delta); },
+                     [delta](uint8_t *p, size_t n) { nibble_ops::swar::add(p, n, delta); }});
+    }
+
+    for (uint8_t level : {0x00, 0x80, 0xF0})
+    {
+        v.push_back({"threshold " + std::to_string(level >> 4), [level](uint8_t c) { return c >> 4 >= level >> 4 ? 0xFF : 0x00; },
+                     [level](ScreenView& s, Rect_t const& r) { s.threshold_rect(r, level); },
+                     [level](uint8_t *p, size_t n) { nibble_ops::swar::threshold(p, n, level >> 4); }});
+    }
+
+    return v;
+}
+
+} // namespace
+
+bool bench_nibble_ops()
+{
+    constexpr int rounds = 50;
+    bool ok              = true;
+
+    std::vector<uint8_t> noise(fb_size), a(fb_size), b(fb_size);
+    std::mt19937 rng{42};
+    for (uint8_t& byte : noise)
+        byte = rng();
+
+    ScreenView va{a.data()}, vb{b.data()};
+
+    Rect_t const screen{0, 0, EPD_WIDTH, EPD_HEIGHT};
+    // odd offsets and widths, so that both edge cases and all the tail lengths are covered
+    std::vector<Rect_t> checks{screen};
+    for (int32_t x = 0; x < 4; x++)
+        for (int32_t w = 0; w < 80; w++)
+            checks.push_back({101 + x, 7 + w % 5, w, 3});
+
+    printf("%-14s %14s %14s %14s %14s %10s\n", "kernel", "callback us", "swar us", "rect us", "90px x 90 us", "output");
+
+    for (Kernel const& k : kernels())
+    {
+        bool same = true;
+        for (Rect_t const& r : checks)
+        {
+            a = noise, b = noise;
+            va.modify_rect(r, k.mod);
+            k.fast(vb, r);
+            same = same && a == b;
+        }
+
+        a = noise, b = noise;
+        va.modify_rect(screen, k.mod);
+        k.swar(b.data(), fb_size);
+        same = same && a == b;
+        ok   = ok && same;
+
+        a            = noise;
+        double slow  = best_us(rounds, [&] { va.modify_rect(screen, k.mod); });
+        double swar  = best_us(rounds, [&] { k.swar(a.data(), fb_size); });
+        double fast  = best_us(rounds, [&] { k.fast(va, screen); });
+        double lines = best_us(rounds, [&] {
+            for (int32_t y = 100; y < 190; y++)
+                k.fast(va, {333, y, 90, 1});
+        });
+
+        printf("%-14s %14.1f %14.1f %14.1f %14.2f %10s\n", k.name.c_str(), slow, swar, fast, lines,
+               same ? "identical" : "DIFFERENT");
+    }
+
+    // the 1-bit packing, against a pixel at a time
+    {
+        std::vector<uint8_t> packed(fb_size / 4 + 1), expected(fb_size / 4 + 1);
+        bool same = true;
+        for (size_t pixels : {size_t(EPD_WIDTH * EPD_HEIGHT), size_t(2), size_t(6), size_t(10), size_t(798)})
+        {
+            std::fill(expected.begin(), expected.end(), 0);
+            for (size_t i = 0; i < pixels; i++)
+            {
+                uint8_t const nibble = i % 2 ? noise[i / 2] >> 4 : noise[i / 2] & 0x0F;
+                if (nibble < 8) expected[i / 8] |= 1 << i % 8;
+            }
+            std::fill(packed.begin(), packed.end(), 0);
+            nibble_ops::pack_1bit(noise.data(), packed.data(), pixels, 8);
+            same = same && packed == expected;
+        }
+        ok = ok && same;
+
+        double const pack = best_us(rounds, [&] { nibble_ops::pack_1bit(noise.data(), packed.data(), fb_size * 2, 8); });
+        printf("%-14s %14s %14s %14.1f %14s %10s\n", "pack 1-bit", "", "", pack, "", same ? "identical" : "DIFFERENT");
+    }
+
+#if NIBBLE_OPS_SIMD
+    printf("(rect: SIMD with a SWAR tail; full screen is %d bytes)\n", fb_size);
+#else
+    printf("(rect: SWAR, no SIMD on this host; full screen is %d bytes)\n", fb_size);
+#endif
+
+    return ok;
+}
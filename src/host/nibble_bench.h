@@ -0,0 +1,20 @@
+/*
+ * Copyright (c) 2024 zahical. All rights reserved.
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+/**
+ * @file Pixel transform kernels microbenchmark.
+ */
+
+#pragma once
+
+/**
+ * @brief Checks and times the nibble_ops.h kernels behind FbView::invert_rect(), add_rect() and threshold_rect()
+ * against the generic, per-pixel callback of FbView::modify_rect() doing the same: the full screen and short, odd
+ * aligned spans like the moon shading's, the word-at-a-time (SWAR) versions and the SIMD ones where available. Also
+ * checks and times nibble_ops::pack_1bit() against packing a pixel at a time.
+ *
+ * Results are printed to stdout. Returns false if any kernel's output differs from the callback's.
+ */
+bool bench_nibble_ops();
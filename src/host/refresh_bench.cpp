@@ -0,0 +1,199 @@
+/*
+ * Copyright (c) 2024 zahical. All rights reserved.
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+/**
+ * @file Partial refresh estimates implementation.
+ */
+
+#include "refresh_bench.h"
+#include "config.h"
+#include "dirty_rects.h"
+#include "display.h"
+#include "epd_model.h"
+#include "epd_waveform.h"
+#include "frame_store.h"
+#include "nibble_ops.h"
+#include "shared_data.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <vector>
+
+namespace
+{
+constexpr int fb_size = EPD_WIDTH * EPD_HEIGHT / 2;
+
+std::vector<uint8_t> draw()
+{
+    uint8_t *fb = Framebuffer();
+    memset(fb, 0xFF, fb_size);
+    DrawWeather();
+    return {fb, fb + fb_size};
+}
+
+/// Runs `f` `rounds` times, returns the best time in microseconds.
+template <typename F>
+double best_us(int rounds, F&& f)
+{
+    double best = 1e18;
+    for (int r = 0; r < rounds; r++)
+    {
+        auto t0 = std::chrono::steady_clock::now();
+        f();
+        auto t1 = std::chrono::steady_clock::now();
+        best    = std::min(best, std::chrono::duration<double, std::micro>(t1 - t0).count());
+    }
+    return best;
+}
+
+void report(char const *name, std::vector<uint8_t> const& prev, std::vector<uint8_t> const& next)
+{
+    DirtyRects dirty{};
+    double const best = best_us(50, [&] { dirty = find_dirty_rects(prev.data(), next.data()); });
+
+    int32_t area = 0;
+    for (size_t i = 0; i < dirty.count; i++)
+        area += dirty.rects[i].width * dirty.rects[i].height;
+
+    printf("%s: %zu areas, %d of %d rows (%.0f%%), %.0f%% of the pixels; found in %.1f us\n", name, dirty.count,
+           dirty.rows, EPD_HEIGHT, 100.0 * dirty.rows / EPD_HEIGHT, 100.0 * area / (EPD_WIDTH * EPD_HEIGHT), best);
+    for (size_t i = 0; i < dirty.count; i++)
+        printf("    %d, %d, %d, %d\n", dirty.rects[i].x, dirty.rects[i].y, dirty.rects[i].width,
+               dirty.rects[i].height);
+}
+
+/// The levels in `area` of a framebuffer.
+uint16_t area_levels(std::vector<uint8_t> const& fb, Rect_t const& area)
+{
+    uint16_t levels = 0;
+    for (int32_t y = area.y; y < area.y + area.height; y++)
+        for (int32_t x = area.x; x < area.x + area.width; x++)
+        {
+            uint8_t const b = fb[y * EPD_WIDTH / 2 + x / 2];
+            levels |= 1 << (x % 2 ? b >> 4 : b & 0x0F);
+        }
+    return levels;
+}
+
+/// The estimated clear and update of some areas of the screen, see epd_model.h.
+struct Estimate
+{
+    PanelCost clear, full, adaptive;
+};
+
+void add_area(Estimate& e, Rect_t const& area, uint16_t levels, bool skip_rows = true)
+{
+    e.clear += clear_cost(area, skip_rows);
+    e.full += draw_cost(area, full_waveform(BLACK_ON_WHITE), skip_rows);
+    e.adaptive += draw_cost(area, plan_waveform(levels, BLACK_ON_WHITE), skip_rows);
+}
+
+void report(char const *name, Estimate const& e)
+{
+    printf("%-28s clear %3u frames, %6.1f ms, %5.1f mC; update: full %3u frames, %6.1f ms, %5.1f mC; adaptive %3u "
+           "steps, %6.1f ms, %5.1f mC\n",
+           name, e.clear.frames, e.clear.us / 1000, e.clear.uc / 1000, e.full.frames, e.full.us / 1000,
+           e.full.uc / 1000, e.adaptive.frames, e.adaptive.us / 1000, e.adaptive.uc / 1000);
+}
+
+} // namespace
+
+void bench_partial_refresh()
+{
+    auto const first = draw();
+    report("same data", first, draw());
+
+    // the next cycle, with nothing but the time changed
+    shared::CycleStart.tm_min += 30;
+    mktime(&shared::CycleStart);
+    auto const clock_only = draw();
+    report("time only", first, clock_only);
+
+    // and with the current conditions, too
+    shared::WxConditions.Temperature += 0.6f;
+    shared::WxConditions.FeelsLike += 0.8f;
+    shared::WxConditions.Humidity += 3;
+    shared::WxConditions.Pressure -= 1;
+    shared::WxConditions.Windspeed += 1.5f;
+    shared::WxConditions.Winddir += 20;
+    shared::voltage -= 0.02f;
+    shared::wifi_signal -= 10;
+    report("time and conditions", first, draw());
+}
+
+bool bench_frame_store()
+{
+    auto const frame = draw();
+
+    std::vector<uint8_t> compressed(fb_size);
+    size_t size          = 0;
+    double const packing = best_us(20, [&] { size = compress_frame(frame.data(), compressed.data(), fb_size); });
+
+    std::vector<uint8_t> restored(fb_size);
+    bool ok                = true;
+    double const unpacking = best_us(20, [&] { ok = decompress_frame(compressed.data(), size, restored.data()); });
+    ok                     = ok && size != 0 && restored == frame;
+
+    printf("stored frame: %zu of %d bytes (%.1f%%); compressed in %.1f us, restored in %.1f us: %s\n", size, fb_size,
+           100.0 * size / fb_size, packing, unpacking, ok ? "ok" : "MISMATCH");
+    return ok;
+}
+
+void bench_waveform()
+{
+    auto const frame     = draw();
+    uint16_t levels      = 0;
+    double const prepass = best_us(20, [&] { levels = used_levels(frame.data(), frame.size()); });
+
+    printf("levels used: %d (", __builtin_popcount(levels));
+    for (int n = 0; n < 16; n++)
+        if (levels & 1 << n) printf(" %d", n);
+    printf(" ); found in %.1f us\n", prepass);
+
+    Estimate full_screen;
+    add_area(full_screen, epd_full_screen(), levels);
+    report("full screen", full_screen);
+
+    // the same, without antialiasing: the 1-bit case
+    auto mono = frame;
+    nibble_ops::threshold(mono.data(), mono.size(), 8);
+    Estimate mono_screen;
+    add_area(mono_screen, epd_full_screen(), used_levels(mono.data(), mono.size()));
+    report("full screen, 1-bit", mono_screen);
+
+    // a partial refresh of the areas that change with the time alone
+    shared::CycleStart.tm_min += 30;
+    mktime(&shared::CycleStart);
+    auto const next        = draw();
+    DirtyRects const dirty = find_dirty_rects(frame.data(), next.data());
+    Estimate partial, unskipped;
+    for (size_t i = 0; i < dirty.count; i++)
+    {
+        Rect_t const& r = dirty.rects[i];
+        add_area(partial, r, area_levels(next, r));
+        add_area(unskipped, r, area_levels(next, r), false);
+    }
+    report("partial, time only", partial);
+    report("partial, time only, no skip", unskipped);
+}
+
+void bench_error_screen()
+{
+    auto const t0 = std::chrono::steady_clock::now();
+    DisplayError("Connection failed\nThe weather data couldn't be fetched, see the log for the details.");
+    double const ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - t0).count();
+
+    PanelCost const clear  = panel_cost(TimeEvent::ClearScreen);
+    PanelCost const update = panel_cost(TimeEvent::UpdateScreen);
+    PanelCost const greys  = draw_cost(epd_full_screen(), full_waveform(BLACK_ON_WHITE));
+
+    printf("error screen, %s: drawn and sent in %.1f ms on the host\n", cfg::MonoErrorScreen ? "1-bit" : "greys", ms);
+    printf("    clear  %3u frames, %6.1f ms, %5.1f mC\n", clear.frames, clear.us / 1000, clear.uc / 1000);
+    printf("    update %3u frames, %6.1f ms, %5.1f mC\n", update.frames, update.us / 1000, update.uc / 1000);
+    printf("    total  %6.1f ms, %5.1f mC; in greys, the update alone would be %6.1f ms, %5.1f mC\n",
+           (clear.us + update.us) / 1000, (clear.uc + update.uc) / 1000, greys.us / 1000, greys.uc / 1000);
+}
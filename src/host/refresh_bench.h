@@ -0,0 +1,45 @@
+/*
+ * Copyright (c) 2024 zahical. All rights reserved.
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+/**
+ * @file Partial refresh estimates, the cost of keeping the last frame, the adaptive waveform and error screen
+ * estimates.
+ */
+
+#pragma once
+
+/**
+ * @brief Draws the weather UI, then again with the data changed the way it typically does from one refresh cycle to the
+ * next, and reports the areas a partial refresh would update (see dirty_rects.h) and the time it takes to find them.
+ *
+ * The shared data must be populated; it's modified. Results are printed to stdout.
+ */
+void bench_partial_refresh();
+
+/**
+ * @brief Compresses the weather UI the way it's kept across deep sleep (see frame_store.h), and reports the compressed
+ * size and the time it takes to compress and to restore.
+ *
+ * The shared data must be populated. Results are printed to stdout.
+ */
+bool bench_frame_store();
+
+/**
+ * @brief Reports the grey levels the weather UI uses, the time it takes to find them, and the number of frames (steps)
+ * the full and the adaptive waveforms (see epd_waveform.h) draw it in, for the full screen and for a partial refresh,
+ * with the time and charge the clear and the update would take by the EPD model (see epd_model.h); the partial one
+ * also without row skipping.
+ *
+ * The shared data must be populated; it's modified. Results are printed to stdout.
+ */
+void bench_waveform();
+
+/**
+ * @brief Shows the error screen and reports the time it takes on the host, and the time and charge of its clear and
+ * update by the EPD model (see epd_model.h), along with those of the update in greys, with the full waveform.
+ *
+ * Call right after InitGraphics(). Results are printed to stdout.
+ */
+void bench_error_screen();
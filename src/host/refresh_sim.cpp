@@ -0,0 +1,199 @@
+/*
+ * Copyright (c) 2024 zahical. All rights reserved.
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+/**
+ * @file Refresh simulation implementation.
+ */
+
+#include "refresh_sim.h"
+#include "config.h"
+#include "dirty_rects.h"
+#include "display.h"
+#include "epd_model.h"
+#include "epd_waveform.h"
+#include "refresh_policy.h"
+#include "schedule.h"
+#include "shared_data.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <ctime>
+#include <map>
+#include <random>
+#include <string>
+#include <tuple>
+#include <vector>
+
+namespace
+{
+constexpr int fb_size = EPD_WIDTH * EPD_HEIGHT / 2;
+
+using Frame = std::vector<uint8_t>;
+
+Frame draw()
+{
+    uint8_t *fb = Framebuffer();
+    memset(fb, 0xFF, fb_size);
+    DrawWeather();
+    return {fb, fb + fb_size};
+}
+
+/// Changes the data the way it typically does from one cycle to the next; the forecast moves on every 3 hours.
+void drift(std::mt19937& rng, struct tm const& now, time_t t)
+{
+    std::normal_distribution<float> noise{0, 1};
+    auto& wx = shared::WxConditions;
+
+    float const dt = 0.7f * noise(rng);
+    wx.Temperature += dt;
+    wx.FeelsLike += dt + 0.3f * noise(rng);
+    wx.Humidity  = std::clamp(std::round(wx.Humidity + 3 * noise(rng)), 0.0f, 100.0f);
+    wx.Pressure  = std::round(wx.Pressure + noise(rng));
+    wx.Windspeed = std::fabs(wx.Windspeed + noise(rng));
+    wx.Winddir   = std::fmod(wx.Winddir + 30 * noise(rng) + 360, 360.0f);
+    wx.Dt        = t;
+
+    for (auto& f : shared::WxForecast)
+        f.Temperature += 0.3f * noise(rng);
+
+    if (now.tm_hour % 3 == 0)
+    {
+        auto& last = shared::WxForecast[max_readings - 1];
+        std::move(&shared::WxForecast[1], &shared::WxForecast[max_readings], &shared::WxForecast[0]);
+        last.Dt += 3 * 60 * 60;
+        last.Temperature += 2 * noise(rng);
+    }
+
+    shared::voltage -= 0.002f;
+    shared::wifi_signal = -45 + int(5 * noise(rng));
+}
+
+/// The refreshes one way of choosing them makes, and their cost by the EPD model.
+struct Tally
+{
+    char const *name;
+    unsigned none = 0, partial = 0, full = 0;
+    PanelCost cost{};
+    Frame prev{};
+
+    void add_full(Frame const& next)
+    {
+        full++;
+        cost += poweron_cost();
+        cost += clear_cost(epd_full_screen());
+        cost += draw_cost(epd_full_screen(), image_waveform(epd_full_screen(), next.data(), BLACK_ON_WHITE));
+        prev = next;
+    }
+
+    void add_partial(Frame const& next, DirtyRects const& dirty)
+    {
+        if (dirty.count == 0)
+        {
+            none++;
+            return;
+        }
+
+        partial++;
+        cost += poweron_cost();
+        for (size_t i = 0; i < dirty.count; i++)
+        {
+            Rect_t const& r = dirty.rects[i];
+
+            // as flush_changes_and_power_off() sends it
+            Frame staging(r.width / 2 * r.height);
+            for (int32_t y = 0; y < r.height; y++)
+                memcpy(&staging[y * r.width / 2], &next[(r.y + y) * EPD_WIDTH / 2 + r.x / 2], r.width / 2);
+
+            cost += clear_cost(r);
+            cost += draw_cost(r, image_waveform(r, staging.data(), BLACK_ON_WHITE));
+        }
+        prev = next;
+    }
+
+    void report(unsigned cycles) const
+    {
+        printf("%-16s %4u full, %4u partial, %4u none; panel on %7.1f s, %6.1f C; %6.1f ms per cycle\n", name, full,
+               partial, none, cost.us / 1e6, cost.uc / 1e6, cost.us / 1000 / cycles);
+    }
+};
+} // namespace
+
+void simulate_refreshes(int days)
+{
+    Scheduler scheduler{cfg::OnTime, cfg::OffTime, cfg::RefreshPeriod, cfg::MaxDrift};
+    std::mt19937 rng{2024};
+
+    Tally always{"always full"}, every_nth{"every Nth full"}, policy{"refresh policy"};
+    unsigned partials_in_row = 0;
+    RefreshState state{};
+    std::map<std::string, unsigned> reasons;
+
+    // from the midnight of the mock day
+    struct tm now = shared::CycleStart;
+    now.tm_hour = now.tm_min = now.tm_sec = 0;
+    now.tm_isdst                          = -1;
+    time_t const start                    = mktime(&now);
+    unsigned cycles                       = 0;
+
+    for (;;)
+    {
+        now.tm_sec += std::get<0>(scheduler.plan_sleep(DailyTime{now})).count();
+        time_t const t = mktime(&now);
+        if (t - start >= days * 24 * 60 * 60) break;
+
+        shared::CycleStart  = now;
+        shared::ActiveHours = std::get<1>(scheduler.plan_sleep(DailyTime{now}));
+        drift(rng, now, t);
+        Frame const next = draw();
+        cycles++;
+
+        always.add_full(next);
+
+        // what display.cpp did before the refresh policy
+        if (every_nth.prev.empty() || partials_in_row + 1 >= cfg::FullRefreshEvery)
+        {
+            every_nth.add_full(next);
+            partials_in_row = 0;
+        }
+        else
+        {
+            DirtyRects const dirty = find_dirty_rects(every_nth.prev.data(), next.data());
+            if (dirty.rows > EPD_HEIGHT * 2 / 3)
+            {
+                every_nth.add_full(next);
+                partials_in_row = 0;
+            }
+            else
+            {
+                every_nth.add_partial(next, dirty);
+                partials_in_row++;
+            }
+        }
+
+        init_refresh_state(state);
+        RefreshPlan const plan = plan_refresh(state, policy.prev.empty() ? nullptr : policy.prev.data(), next.data(), t);
+        if (plan.kind == Refresh::Full)
+        {
+            reasons[plan.reason]++;
+            policy.add_full(next);
+            record_full_refresh(state, t);
+        }
+        else
+        {
+            policy.add_partial(next, plan.dirty);
+            record_partial_refresh(state, plan);
+        }
+    }
+
+    printf("%d days, %u refresh cycles:\n", days, cycles);
+    always.report(cycles);
+    every_nth.report(cycles);
+    policy.report(cycles);
+    for (auto const& [reason, count] : reasons)
+        printf("    %4u full: %s\n", count, reason.c_str());
+}
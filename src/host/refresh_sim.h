@@ -0,0 +1,22 @@
+/*
+ * Copyright (c) 2024 zahical. All rights reserved.
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+/**
+ * @file A simulation of the screen refreshes over a number of days.
+ */
+
+#pragma once
+
+/**
+ * @brief Steps through `days` days of refresh cycles, as the Scheduler plans them (see cfg::OnTime, cfg::OffTime and
+ * cfg::RefreshPeriod), drawing the weather UI with the data drifting from cycle to cycle, and reports how many full,
+ * partial and no refreshes there would be, with the time the panel is on and the charge it draws by the EPD model (see
+ * epd_model.h): refreshing fully every time, every cfg::FullRefreshEvery-th time, and by the refresh policy (see
+ * refresh_policy.h).
+ *
+ * The shared data must be populated; it's modified. The data changes are pseudo-random, but the same from run to run.
+ * Results are printed to stdout.
+ */
+void simulate_refreshes(int days);
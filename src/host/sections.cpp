@@ -0,0 +1,151 @@
+/*
+ * Copyright (c) 2024 zahical. All rights reserved.
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+/**
+ * @file Checks and benchmarks of the weather UI's sections implementation.
+ */
+
+#include "sections.h"
+#include "display.h"
+
+#include <epd_driver.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <thread>
+#include <vector>
+
+namespace
+{
+constexpr int fb_size = EPD_WIDTH * EPD_HEIGHT / 2;
+
+uint8_t nibble(std::vector<uint8_t> const& fb, int x, int y)
+{
+    uint8_t b = fb[y * EPD_WIDTH / 2 + x / 2];
+    return x % 2 ? b >> 4 : b & 0x0F;
+}
+
+std::vector<uint8_t> draw_section_over(size_t index, uint8_t background, Rect_t& box)
+{
+    uint8_t *fb = Framebuffer();
+    memset(fb, background, fb_size);
+    box = DrawWeatherSection(index);
+    return {fb, fb + fb_size};
+}
+
+/// Runs `f` `rounds` times, returns the best time in microseconds.
+template <typename F>
+double best_us(int rounds, F&& f)
+{
+    double best = 1e18;
+    for (int r = 0; r < rounds; r++)
+    {
+        auto t0 = std::chrono::steady_clock::now();
+        f();
+        auto t1 = std::chrono::steady_clock::now();
+        best    = std::min(best, std::chrono::duration<double, std::micro>(t1 - t0).count());
+    }
+    return best;
+}
+
+} // namespace
+
+bool check_weather_sections()
+{
+    bool ok = true;
+
+    printf("%-14s %-24s %-24s %10s %s\n", "section", "drawn (x, y, w, h)", "box (x, y, w, h)", "time us", "result");
+
+    for (size_t i = 0; i < WeatherSectionCount(); i++)
+    {
+        Rect_t box;
+        auto on_white = draw_section_over(i, 0xFF, box);
+        auto on_black = draw_section_over(i, 0x00, box);
+
+        int min_x = EPD_WIDTH, min_y = EPD_HEIGHT, max_x = -1, max_y = -1;
+        for (int y = 0; y < EPD_HEIGHT; y++)
+            for (int x = 0; x < EPD_WIDTH; x++)
+                if (nibble(on_white, x, y) != 0x0F || nibble(on_black, x, y) != 0x00)
+                {
+                    min_x = std::min(min_x, x), max_x = std::max(max_x, x);
+                    min_y = std::min(min_y, y), max_y = std::max(max_y, y);
+                }
+
+        bool inside = max_x < 0 || (min_x >= box.x && max_x < box.x + box.width && min_y >= box.y &&
+                                    max_y < box.y + box.height);
+        ok          = ok && inside;
+
+        char drawn[32], declared[32];
+        snprintf(drawn, sizeof(drawn), "%d, %d, %d, %d", min_x, min_y, max_x - min_x + 1, max_y - min_y + 1);
+        snprintf(declared, sizeof(declared), "%d, %d, %d, %d", box.x, box.y, box.width, box.height);
+        double time = best_us(20, [&] { DrawWeatherSection(i); });
+        printf("%-14s %-24s %-24s %10.1f %s\n", WeatherSectionName(i), drawn, declared, time,
+               inside ? "ok" : "OUTSIDE THE BOX");
+    }
+
+    uint8_t *fb = Framebuffer();
+
+    memset(fb, 0xFF, fb_size);
+    DrawWeather();
+    std::vector<uint8_t> serial(fb, fb + fb_size);
+
+    memset(fb, 0xFF, fb_size);
+    DrawWeatherDualCore();
+    bool same = memcmp(fb, serial.data(), fb_size) == 0;
+    ok        = ok && same;
+
+    printf("dual-core render: %s\n", same ? "identical to the serial one" : "DIFFERENT from the serial one");
+
+    memset(fb, 0xFF, fb_size);
+    bool const layered = DrawWeatherOverBackground();
+    same               = memcmp(fb, serial.data(), fb_size) == 0;
+    ok                 = ok && same;
+
+    printf("over the background layer: %s\n", !layered ? "no layer, skipped"
+                                               : same   ? "identical to the full render"
+                                                        : "DIFFERENT from the full render");
+
+    memset(fb, 0xFF, fb_size);
+    size_t drawn[4] = {};
+    DrawWeatherProgressively(drawn);
+    same = memcmp(fb, serial.data(), fb_size) == 0;
+    ok   = ok && same;
+
+    printf("progressive render: %s; sections drawn before any data %zu, with the weather %zu, the forecast %zu, the AQI "
+           "%zu, of %zu\n",
+           same ? "identical to the serial one" : "DIFFERENT from the serial one", drawn[0], drawn[1], drawn[2],
+           drawn[3], WeatherSectionCount());
+
+    double const full = best_us(20, [&] {
+        memset(fb, 0xFF, fb_size);
+        DrawWeather();
+    });
+    double const over = best_us(20, [&] { DrawWeatherOverBackground(); });
+    printf("DrawUI full: %.1f us, over the background layer: %.1f us (%.2fx)\n", full, over, full / over);
+
+    return ok;
+}
+
+void bench_dual_core_render()
+{
+    constexpr int rounds = 50;
+    uint8_t *fb          = Framebuffer();
+
+    double serial = best_us(rounds, [&] {
+        memset(fb, 0xFF, fb_size);
+        DrawWeather();
+    });
+
+    double dual = best_us(rounds, [&] {
+        memset(fb, 0xFF, fb_size);
+        DrawWeatherDualCore();
+    });
+
+    printf("DrawUI serial: %.1f us, dual-core: %.1f us (%.2fx); %u hardware threads\n", serial, dual, serial / dual,
+           std::thread::hardware_concurrency());
+}
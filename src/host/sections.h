@@ -0,0 +1,26 @@
+/*
+ * Copyright (c) 2024 zahical. All rights reserved.
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+/**
+ * @file Checks and benchmarks of the weather UI's sections.
+ */
+
+#pragma once
+
+/**
+ * @brief Checks that every section of the weather UI draws only within its declared box, and that the dual-core
+ * render, the one over the background layer and the progressive one produce the same output as the serial one.
+ *
+ * Each section is drawn alone over a white and over a black framebuffer; a pixel is drawn by the section if it's not
+ * white in the first or not black in the second. The actual extent of every section, along with the time it takes to
+ * draw, is printed to stdout, so that the boxes in display.cpp can be updated when the layout changes; so are the times
+ * of the full render and of the one over the background layer.
+ *
+ * The shared data must be populated. Returns false if any of the checks fails.
+ */
+bool check_weather_sections();
+
+/// Times the serial vs. the dual-core drawing of the weather UI. Results are printed to stdout.
+void bench_dual_core_render();
@@ -0,0 +1,168 @@
+/*
+ * Copyright (c) 2024 zahical. All rights reserved.
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+/**
+ * @file Glyph lookup microbenchmark implementation.
+ */
+
+#include "text_bench.h"
+#include "display.h"
+#include "lang/lang.h"
+#include "text.h"
+
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <vector>
+
+namespace
+{
+
+/// Keeps the timed loops from being optimized away.
+volatile uintptr_t keep;
+
+std::vector<char const *> lang_strings()
+{
+    std::vector<char const *> v = {
+        TXT_TEMPERATURE_C,
+        TXT_TEMPERATURE_F,
+        TXT_HUMIDITY_PERCENT,
+        TXT_PRESSURE_IN,
+        TXT_PRESSURE_HPA,
+        TXT_MOON_NEW,
+        TXT_MOON_WAXING_CRESCENT,
+        TXT_MOON_FIRST_QUARTER,
+        TXT_MOON_WAXING_GIBBOUS,
+        TXT_MOON_FULL,
+        TXT_MOON_WANING_GIBBOUS,
+        TXT_MOON_THIRD_QUARTER,
+        TXT_MOON_WANING_CRESCENT,
+        TXT_RAINFALL_MM,
+        TXT_RAINFALL_IN,
+        TXT_SNOWFALL_MM,
+        TXT_SNOWFALL_IN,
+        TXT_N,
+        TXT_NNE,
+        TXT_NE,
+        TXT_ENE,
+        TXT_E,
+        TXT_ESE,
+        TXT_SE,
+        TXT_SSE,
+        TXT_S,
+        TXT_SSW,
+        TXT_SW,
+        TXT_WSW,
+        TXT_W,
+        TXT_WNW,
+        TXT_NW,
+        TXT_NNW,
+    };
+    v.insert(v.end(), std::begin(weekday_D), std::end(weekday_D));
+    v.insert(v.end(), std::begin(month_M), std::end(month_M));
+    return v;
+}
+
+/// Decodes (well-formed) UTF-8.
+std::vector<uint32_t> code_points(std::vector<char const *> const& strings)
+{
+    std::vector<uint32_t> cps;
+    for (char const *s : strings)
+        for (uint8_t const *p = (uint8_t const *)s; *p;)
+        {
+            int len     = *p < 0x80 ? 1 : (*p & 0xE0) == 0xC0 ? 2 : (*p & 0xF0) == 0xE0 ? 3 : 4;
+            uint32_t cp  = len == 1 ? *p : *p & (0x7F >> len);
+            for (int i = 1; i < len; i++)
+                cp = (cp << 6) | (p[i] & 0x3F);
+            cps.push_back(cp);
+            p += len;
+        }
+    return cps;
+}
+
+/// The lookup of the EPD driver's font.c (v1.0.1).
+GFXglyph const *linear_lookup(GFXfont const *font, uint32_t cp)
+{
+    for (uint32_t i = 0; i < font->interval_count; i++)
+    {
+        UnicodeInterval const& iv = font->intervals[i];
+        if (cp >= iv.first && cp <= iv.last) return &font->glyph[iv.offset + (cp - iv.first)];
+        if (cp < iv.first) return nullptr;
+    }
+    return nullptr;
+}
+
+template <typename F>
+double ns_per_op(size_t ops, F&& f)
+{
+    constexpr int rounds = 2000;
+    auto t0              = std::chrono::steady_clock::now();
+    for (int r = 0; r < rounds; r++)
+        f();
+    auto t1 = std::chrono::steady_clock::now();
+    return std::chrono::duration<double, std::nano>(t1 - t0).count() / rounds / ops;
+}
+
+} // namespace
+
+void bench_text_lookup()
+{
+    auto const strings = lang_strings();
+    auto const cps     = code_points(strings);
+
+    printf("%zu strings, %zu characters\n", strings.size(), cps.size());
+    printf("%-22s %12s %12s %12s %16s %16s\n", "font", "linear ns", "direct ns", "found", "driver bounds ns",
+           "text.h bounds ns");
+
+    size_t count;
+    UiFont const *const fonts = UiFonts(count);
+    for (size_t f = 0; f < count; f++)
+    {
+        UiFont const& nf = fonts[f];
+        uintptr_t sink = 0;
+        size_t found   = 0;
+
+        for (uint32_t cp : cps)
+        {
+            GFXglyph const *g = find_glyph(nf.face, cp);
+            if (g != linear_lookup(nf.face.font, cp)) printf("  mismatch for U+%04X!\n", cp);
+            found += g != nullptr;
+        }
+
+        double linear = ns_per_op(cps.size(), [&] {
+            for (uint32_t cp : cps)
+                sink += (uintptr_t)linear_lookup(nf.face.font, cp);
+        });
+
+        double direct = ns_per_op(cps.size(), [&] {
+            for (uint32_t cp : cps)
+                sink += (uintptr_t)find_glyph(nf.face, cp);
+        });
+
+        int32_t x1, y1, w, h;
+        double driver_bounds = ns_per_op(strings.size(), [&] {
+            for (char const *s : strings)
+            {
+                int32_t x = 0, y = 0;
+                get_text_bounds(nf.face.font, s, &x, &y, &x1, &y1, &w, &h, nullptr);
+                sink += w;
+            }
+        });
+
+        double own_bounds = ns_per_op(strings.size(), [&] {
+            for (char const *s : strings)
+            {
+                int32_t x = 0, y = 0;
+                text_bounds(nf.face, s, &x, &y, &x1, &y1, &w, &h, nullptr);
+                sink += w;
+            }
+        });
+
+        printf("%-22s %12.2f %12.2f %8zu/%-3zu %16.1f %16.1f\n", nf.name, linear, direct, found, cps.size(),
+               driver_bounds, own_bounds);
+
+        keep = sink;
+    }
+}
@@ -0,0 +1,18 @@
+/*
+ * Copyright (c) 2024 zahical. All rights reserved.
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+/**
+ * @file Glyph lookup microbenchmark.
+ */
+
+#pragma once
+
+/**
+ * @brief Times glyph lookup and text measuring over all the localized strings from lang.cpp, in every UI font: the
+ * EPD driver's linear interval scan, and its get_text_bounds(), vs. the direct Latin-1 index of text.h.
+ *
+ * Results are printed to stdout.
+ */
+void bench_text_lookup();
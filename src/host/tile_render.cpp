@@ -0,0 +1,119 @@
+/*
+ * Copyright (c) 2024 zahical. All rights reserved.
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+/**
+ * @file Multi-threaded rendering of the weather UI implementation.
+ */
+
+#include "tile_render.h"
+#include "display.h"
+#include "display_list.h"
+#include "timings.h"
+
+#include <epd_driver.h>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <thread>
+#include <vector>
+
+namespace
+{
+constexpr int fb_size = EPD_WIDTH * EPD_HEIGHT / 2;
+
+/// Runs `f` `rounds` times, returns the best time in microseconds.
+template <typename F>
+double best_us(int rounds, F&& f)
+{
+    double best = 1e18;
+    for (int r = 0; r < rounds; r++)
+    {
+        auto t0 = std::chrono::steady_clock::now();
+        f();
+        auto t1 = std::chrono::steady_clock::now();
+        best    = std::min(best, std::chrono::duration<double, std::micro>(t1 - t0).count());
+    }
+    return best;
+}
+
+} // namespace
+
+void replay_in_bands(DisplayList const& list, uint8_t *framebuffer, int band_rows, unsigned threads)
+{
+    int const band_count = (EPD_HEIGHT + band_rows - 1) / band_rows;
+    std::atomic<int> next_band{0};
+
+    auto worker = [&] {
+        ScreenView view{framebuffer};
+
+        for (int band = next_band++; band < band_count; band = next_band++)
+        {
+            int32_t const y    = band * band_rows;
+            int32_t const rows = std::min<int32_t>(band_rows, EPD_HEIGHT - y);
+            TIMING_SPAN("Replay band");
+
+            memset(&framebuffer[y * EPD_WIDTH / 2], 0xFF, rows * EPD_WIDTH / 2);
+            view.set_clip({0, y, EPD_WIDTH, rows});
+            list.replay(view);
+        }
+    };
+
+    std::vector<std::thread> pool;
+    for (unsigned i = 1; i < threads; i++)
+        pool.emplace_back(worker);
+
+    worker();
+
+    for (std::thread& t : pool)
+        t.join();
+}
+
+void render_weather_tiled(unsigned threads, int band_rows)
+{
+    DisplayList list;
+    RecordWeather(list);
+    replay_in_bands(list, Framebuffer(), band_rows, threads);
+}
+
+void bench_tile_render(unsigned max_threads)
+{
+    constexpr int rounds    = 50;
+    constexpr int band_rows = 30;
+
+    uint8_t *fb = Framebuffer();
+
+    double serial = best_us(rounds, [&] {
+        memset(fb, 0xFF, fb_size);
+        DrawWeather();
+    });
+    std::vector<uint8_t> reference(fb, fb + fb_size);
+
+    DisplayList list;
+    double record = best_us(rounds, [&] { RecordWeather(list); });
+
+    DisplayList again;
+    RecordWeather(again);
+    size_t areas = 0;
+    double diff  = best_us(rounds, [&] { areas = again.diff(list).size(); });
+
+    printf("serial render: %.1f us; recording: %.1f us (%zu ops, %zu bytes); bands of %d rows\n", serial, record,
+           list.size(), list.bytes(), band_rows);
+    printf("diff of two recordings: %.1f us, %zu changed areas\n", diff, areas);
+    printf("%8s %12s %12s %10s %10s\n", "threads", "replay us", "total us", "speedup", "output");
+
+    for (unsigned threads = 1; threads <= max_threads; threads++)
+    {
+        double replay = best_us(rounds, [&] { replay_in_bands(list, fb, band_rows, threads); });
+        bool same     = memcmp(fb, reference.data(), fb_size) == 0;
+
+        printf("%8u %12.1f %12.1f %9.2fx %10s\n", threads, replay, record + replay, serial / (record + replay),
+               same ? "identical" : "DIFFERENT");
+    }
+
+    printf("(%u hardware threads)\n", std::thread::hardware_concurrency());
+}
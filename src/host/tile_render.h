@@ -0,0 +1,36 @@
+/*
+ * Copyright (c) 2024 zahical. All rights reserved.
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+/**
+ * @file Multi-threaded rendering of the weather UI.
+ *
+ * The UI's drawing calls are recorded once into a DisplayList, then the framebuffer is split into horizontal bands and
+ * the list is replayed for each band, clipped to its rows, on a pool of threads. Bands don't share framebuffer bytes,
+ * so the threads never write to the same memory and the result is identical to the serial DisplayWeather().
+ */
+
+#pragma once
+#include <cstdint>
+
+class DisplayList;
+
+/**
+ * @brief Clears `framebuffer` to white and replays `list` into it in bands of `band_rows` rows, on `threads` threads.
+ *
+ * The calling thread is one of them; bands are handed out to the threads as they become free.
+ */
+void replay_in_bands(DisplayList const& list, uint8_t *framebuffer, int band_rows, unsigned threads);
+
+/// Records the weather UI and renders it into the framebuffer with replay_in_bands().
+void render_weather_tiled(unsigned threads, int band_rows = 30);
+
+/**
+ * @brief Times the serial render of the weather UI vs. recording it once and replaying it with 1..`max_threads`
+ * threads, checking that every render is pixel-identical to the serial one. Also reports the size of the recording
+ * and the time to DisplayList::diff() two of them.
+ *
+ * The shared data must be populated. Results are printed to stdout.
+ */
+void bench_tile_render(unsigned max_threads);
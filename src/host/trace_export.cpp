@@ -0,0 +1,157 @@
+/*
+ * Copyright (c) 2024 zahical. All rights reserved.
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+/**
+ * @file Timing export implementation.
+ */
+
+#include "trace_export.h"
+#include "timings.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <cstdio>
+#include <map>
+#include <mutex>
+#include <vector>
+
+namespace
+{
+struct Occurrence
+{
+    SpanId span;
+    unsigned tid;
+    int64_t begin_us, end_us;
+};
+
+std::vector<Occurrence> occurrences;
+std::mutex occurrences_lock;
+
+/// Small, stable thread ids, in the order the threads first end a span; 1 is the main thread.
+std::atomic<unsigned> thread_count{0};
+thread_local unsigned thread_id = 0;
+
+unsigned this_thread_id()
+{
+    if (thread_id == 0) thread_id = ++thread_count;
+    return thread_id;
+}
+
+void keep(SpanId s, int64_t begin_us, int64_t end_us)
+{
+    unsigned const tid = this_thread_id();
+
+    std::lock_guard<std::mutex> lock{occurrences_lock};
+    occurrences.push_back({s, tid, begin_us, end_us});
+}
+
+/// Writes `s` as a JSON string; span names are plain text, but may have quotes.
+void write_json_string(FILE *f, char const *s)
+{
+    fputc('"', f);
+    for (; *s; s++)
+    {
+        if (*s == '"' || *s == '\\') fputc('\\', f);
+        if (static_cast<unsigned char>(*s) >= 0x20) fputc(*s, f);
+    }
+    fputc('"', f);
+}
+
+void write_csv_string(FILE *f, char const *s)
+{
+    fputc('"', f);
+    for (; *s; s++)
+    {
+        if (*s == '"') fputc('"', f);
+        fputc(*s, f);
+    }
+    fputc('"', f);
+}
+} // namespace
+
+void start_trace()
+{
+    this_thread_id();
+    observe_spans(keep);
+}
+
+bool write_trace(char const *path)
+{
+    FILE *f = fopen(path, "w");
+    if (!f) return false;
+
+    std::lock_guard<std::mutex> lock{occurrences_lock};
+
+    // the viewers start the timeline at 0
+    int64_t start = INT64_MAX;
+    for (Occurrence const& o : occurrences)
+        start = std::min(start, o.begin_us);
+
+    // one event per line, the separators before them
+    char const *separator = "\n";
+    fputs("{\"displayTimeUnit\":\"ms\",\"traceEvents\":[", f);
+    unsigned const threads = thread_count.load();
+    for (unsigned tid = 1; tid <= threads; tid++)
+    {
+        char name[24] = "main";
+        if (tid > 1) snprintf(name, sizeof(name), "thread %u", tid);
+        fprintf(f, "%s{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":%u,\"args\":{\"name\":\"%s\"}}",
+                separator, tid, name);
+        separator = ",\n";
+    }
+
+    for (Occurrence const& o : occurrences)
+    {
+        fprintf(f, "%s{\"name\":", separator);
+        write_json_string(f, span_name(o.span));
+        fprintf(f, ",\"cat\":\"timing\",\"ph\":\"X\",\"ts\":%lld,\"dur\":%lld,\"pid\":1,\"tid\":%u}",
+                static_cast<long long>(o.begin_us - start), static_cast<long long>(o.end_us - o.begin_us), o.tid);
+        separator = ",\n";
+    }
+    fputs("\n]}\n", f);
+
+    return fclose(f) == 0;
+}
+
+bool write_timings_csv(char const *path)
+{
+    FILE *f = fopen(path, "w");
+    if (!f) return false;
+
+    struct Summary
+    {
+        uint32_t count   = 0;
+        int64_t total_us = 0;
+        int64_t min_us   = INT64_MAX;
+        int64_t max_us   = 0;
+    };
+
+    // by span id: the TimeEvent phases first, in their order
+    std::map<SpanId, Summary> spans;
+    {
+        std::lock_guard<std::mutex> lock{occurrences_lock};
+        for (Occurrence const& o : occurrences)
+        {
+            Summary& s        = spans[o.span];
+            int64_t const dur = o.end_us - o.begin_us;
+            s.count++;
+            s.total_us += dur;
+            s.min_us = std::min(s.min_us, dur);
+            s.max_us = std::max(s.max_us, dur);
+        }
+    }
+
+    fputs("span,count,total_us,mean_us,min_us,max_us\n", f);
+    for (auto const& [span, s] : spans)
+    {
+        write_csv_string(f, span_name(span));
+        fprintf(f, ",%u,%lld,%lld,%lld,%lld\n", s.count, static_cast<long long>(s.total_us),
+                static_cast<long long>(s.total_us / s.count), static_cast<long long>(s.min_us),
+                static_cast<long long>(s.max_us));
+    }
+
+    return fclose(f) == 0;
+}
@@ -0,0 +1,23 @@
+/*
+ * Copyright (c) 2024 zahical. All rights reserved.
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+/**
+ * @file Exporting the timing spans of a host run (see timings.h), for a trace viewer or for scripts.
+ *
+ * The trace is a Chrome Trace Event JSON file, which chrome://tracing and https://ui.perfetto.dev open: every
+ * occurrence of every span, on the thread it ran on, so that concurrent fetches and parallel rendering can be seen
+ * side by side. The CSV summary has one line per span, to compare runs, e.g. before and after a change.
+ */
+
+#pragma once
+
+/// Starts keeping every span occurrence, from now on; the calling thread is the "main" one.
+void start_trace();
+
+/// Writes the span occurrences kept as a Chrome Trace Event JSON file at `path`.
+bool write_trace(char const *path);
+
+/// Writes the count, total, mean, min and max of each span kept, in microseconds, as a CSV file at `path`.
+bool write_timings_csv(char const *path);
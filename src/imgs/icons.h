@@ -0,0 +1,3557 @@
+// This file was generated by the host emulator (program --gen-icons). Do not edit.
+#pragma once
+#include <cstdint>
+
+struct IconSpriteSpec
+{
+    char const *icon;    // OWM icon code, e.g. "10d"
+    bool large;          // LargeIcon or SmallIcon
+    bool y_locked;       // only valid when drawn at anchor_y
+    int16_t anchor_y;
+    int16_t dx, dy;      // top-left corner, relative to the icon's (x, y)
+    int16_t width, height;
+    uint8_t const *runs; // per row: <count> {<skip> <length> <color>}...
+};
+
+constexpr uint8_t IconSprite_01d_L_runs[] = {
+	0x01, 0x44, 0x05, 0x00, 0x01, 0x44, 0x05, 0x00, 0x01, 0x44, 0x05, 0x00, 0x01, 0x44, 0x05, 0x00,
+	0x01, 0x44, 0x05, 0x00, 0x01, 0x44, 0x05, 0x00, 0x01, 0x44, 0x05, 0x00, 0x01, 0x44, 0x05, 0x00,
+	0x01, 0x44, 0x05, 0x00, 0x01, 0x44, 0x05, 0x00, 0x01, 0x44, 0x05, 0x00, 0x01, 0x44, 0x05, 0x00,
+	0x01, 0x44, 0x05, 0x00, 0x01, 0x44, 0x05, 0x00, 0x01, 0x44, 0x05, 0x00, 0x01, 0x44, 0x05, 0x00,
+	0x01, 0x44, 0x05, 0x00, 0x01, 0x44, 0x05, 0x00, 0x03, 0x16, 0x01, 0x00, 0x2D, 0x05, 0x00, 0x28,
+	0x01, 0x00, 0x03, 0x15, 0x03, 0x00, 0x2C, 0x05, 0x00, 0x27, 0x03, 0x00, 0x03, 0x14, 0x05, 0x00,
+	0x2B, 0x05, 0x00, 0x26, 0x05, 0x00, 0x03, 0x13, 0x07, 0x00, 0x2A, 0x05, 0x00, 0x25, 0x07, 0x00,
+	0x03, 0x12, 0x09, 0x00, 0x29, 0x05, 0x00, 0x24, 0x09, 0x00, 0x03, 0x13, 0x09, 0x00, 0x28, 0x05,
+	0x00, 0x23, 0x09, 0x00, 0x03, 0x14, 0x09, 0x00, 0x21, 0x0D, 0xFF, 0x20, 0x09, 0x00, 0x03, 0x15,
+	0x09, 0x00, 0x1B, 0x17, 0xFF, 0x1A, 0x09, 0x00, 0x03, 0x16, 0x09, 0x00, 0x17, 0x1D, 0xFF, 0x16,
+	0x09, 0x00, 0x03, 0x17, 0x09, 0x00, 0x13, 0x23, 0xFF, 0x12, 0x09, 0x00, 0x03, 0x18, 0x09, 0x00,
+	0x10, 0x27, 0xFF, 0x0F, 0x09, 0x00, 0x03, 0x19, 0x09, 0x00, 0x0D, 0x2B, 0xFF, 0x0C, 0x09, 0x00,
+	0x03, 0x1A, 0x09, 0x00, 0x0A, 0x2F, 0xFF, 0x09, 0x09, 0x00, 0x03, 0x1B, 0x09, 0x00, 0x08, 0x31,
+	0xFF, 0x07, 0x09, 0x00, 0x03, 0x1C, 0x09, 0x00, 0x06, 0x33, 0xFF, 0x05, 0x09, 0x00, 0x03, 0x1D,
+	0x09, 0x00, 0x03, 0x37, 0xFF, 0x02, 0x09, 0x00, 0x05, 0x1E, 0x09, 0x00, 0x01, 0x17, 0xFF, 0x00,
+	0x0B, 0x00, 0x00, 0x17, 0xFF, 0x00, 0x09, 0x00, 0x05, 0x1F, 0x08, 0x00, 0x00, 0x14, 0xFF, 0x00,
+	0x13, 0x00, 0x00, 0x14, 0xFF, 0x00, 0x07, 0x00, 0x05, 0x20, 0x06, 0x00, 0x00, 0x12, 0xFF, 0x00,
+	0x19, 0x00, 0x00, 0x12, 0xFF, 0x00, 0x05, 0x00, 0x05, 0x21, 0x04, 0x00, 0x00, 0x10, 0xFF, 0x00,
+	0x1F, 0x00, 0x00, 0x10, 0xFF, 0x00, 0x03, 0x00, 0x05, 0x22, 0x02, 0x00, 0x00, 0x10, 0xFF, 0x00,
+	0x21, 0x00, 0x00, 0x10, 0xFF, 0x00, 0x01, 0x00, 0x05, 0x23, 0x0F, 0xFF, 0x00, 0x0D, 0x00, 0x00,
+	0x0B, 0xFF, 0x00, 0x0D, 0x00, 0x00, 0x0F, 0xFF, 0x05, 0x22, 0x0F, 0xFF, 0x00, 0x0A, 0x00, 0x00,
+	0x13, 0xFF, 0x00, 0x0A, 0x00, 0x00, 0x0F, 0xFF, 0x05, 0x21, 0x0E, 0xFF, 0x00, 0x0A, 0x00, 0x00,
+	0x17, 0xFF, 0x00, 0x0A, 0x00, 0x00, 0x0E, 0xFF, 0x05, 0x21, 0x0D, 0xFF, 0x00, 0x09, 0x00, 0x00,
+	0x1B, 0xFF, 0x00, 0x09, 0x00, 0x00, 0x0D, 0xFF, 0x05, 0x20, 0x0D, 0xFF, 0x00, 0x08, 0x00, 0x00,
+	0x1F, 0xFF, 0x00, 0x08, 0x00, 0x00, 0x0D, 0xFF, 0x05, 0x1F, 0x0D, 0xFF, 0x00, 0x08, 0x00, 0x00,
+	0x21, 0xFF, 0x00, 0x08, 0x00, 0x00, 0x0D, 0xFF, 0x05, 0x1E, 0x0D, 0xFF, 0x00, 0x07, 0x00, 0x00,
+	0x25, 0xFF, 0x00, 0x07, 0x00, 0x00, 0x0D, 0xFF, 0x05, 0x1E, 0x0C, 0xFF, 0x00, 0x07, 0x00, 0x00,
+	0x27, 0xFF, 0x00, 0x07, 0x00, 0x00, 0x0C, 0xFF, 0x05, 0x1D, 0x0C, 0xFF, 0x00, 0x07, 0x00, 0x00,
+	0x29, 0xFF, 0x00, 0x07, 0x00, 0x00, 0x0C, 0xFF, 0x05, 0x1D, 0x0C, 0xFF, 0x00, 0x06, 0x00, 0x00,
+	0x2B, 0xFF, 0x00, 0x06, 0x00, 0x00, 0x0C, 0xFF, 0x05, 0x1C, 0x0C, 0xFF, 0x00, 0x06, 0x00, 0x00,
+	0x2D, 0xFF, 0x00, 0x06, 0x00, 0x00, 0x0C, 0xFF, 0x05, 0x1C, 0x0B, 0xFF, 0x00, 0x06, 0x00, 0x00,
+	0x2F, 0xFF, 0x00, 0x06, 0x00, 0x00, 0x0B, 0xFF, 0x05, 0x1B, 0x0C, 0xFF, 0x00, 0x06, 0x00, 0x00,
+	0x2F, 0xFF, 0x00, 0x06, 0x00, 0x00, 0x0C, 0xFF, 0x05, 0x1B, 0x0B, 0xFF, 0x00, 0x06, 0x00, 0x00,
+	0x31, 0xFF, 0x00, 0x06, 0x00, 0x00, 0x0B, 0xFF, 0x05, 0x1B, 0x0A, 0xFF, 0x00, 0x06, 0x00, 0x00,
+	0x33, 0xFF, 0x00, 0x06, 0x00, 0x00, 0x0A, 0xFF, 0x05, 0x1A, 0x0B, 0xFF, 0x00, 0x06, 0x00, 0x00,
+	0x33, 0xFF, 0x00, 0x06, 0x00, 0x00, 0x0B, 0xFF, 0x05, 0x1A, 0x0B, 0xFF, 0x00, 0x05, 0x00, 0x00,
+	0x35, 0xFF, 0x00, 0x05, 0x00, 0x00, 0x0B, 0xFF, 0x05, 0x1A, 0x0A, 0xFF, 0x00, 0x06, 0x00, 0x00,
+	0x35, 0xFF, 0x00, 0x06, 0x00, 0x00, 0x0A, 0xFF, 0x05, 0x19, 0x0B, 0xFF, 0x00, 0x05, 0x00, 0x00,
+	0x37, 0xFF, 0x00, 0x05, 0x00, 0x00, 0x0B, 0xFF, 0x05, 0x19, 0x0B, 0xFF, 0x00, 0x05, 0x00, 0x00,
+	0x37, 0xFF, 0x00, 0x05, 0x00, 0x00, 0x0B, 0xFF, 0x05, 0x19, 0x0A, 0xFF, 0x00, 0x05, 0x00, 0x00,
+	0x39, 0xFF, 0x00, 0x05, 0x00, 0x00, 0x0A, 0xFF, 0x05, 0x19, 0x0A, 0xFF, 0x00, 0x05, 0x00, 0x00,
+	0x39, 0xFF, 0x00, 0x05, 0x00, 0x00, 0x0A, 0xFF, 0x05, 0x19, 0x0A, 0xFF, 0x00, 0x05, 0x00, 0x00,
+	0x39, 0xFF, 0x00, 0x05, 0x00, 0x00, 0x0A, 0xFF, 0x05, 0x18, 0x0B, 0xFF, 0x00, 0x05, 0x00, 0x00,
+	0x39, 0xFF, 0x00, 0x05, 0x00, 0x00, 0x0B, 0xFF, 0x05, 0x18, 0x0A, 0xFF, 0x00, 0x05, 0x00, 0x00,
+	0x3B, 0xFF, 0x00, 0x05, 0x00, 0x00, 0x0A, 0xFF, 0x05, 0x18, 0x0A, 0xFF, 0x00, 0x05, 0x00, 0x00,
+	0x3B, 0xFF, 0x00, 0x05, 0x00, 0x00, 0x0A, 0xFF, 0x05, 0x18, 0x0A, 0xFF, 0x00, 0x05, 0x00, 0x00,
+	0x3B, 0xFF, 0x00, 0x05, 0x00, 0x00, 0x0A, 0xFF, 0x05, 0x18, 0x0A, 0xFF, 0x00, 0x05, 0x00, 0x00,
+	0x3B, 0xFF, 0x00, 0x05, 0x00, 0x00, 0x0A, 0xFF, 0x05, 0x18, 0x0A, 0xFF, 0x00, 0x05, 0x00, 0x00,
+	0x3B, 0xFF, 0x00, 0x05, 0x00, 0x00, 0x0A, 0xFF, 0x07, 0x00, 0x18, 0x00, 0x00, 0x0A, 0xFF, 0x00,
+	0x05, 0x00, 0x00, 0x3B, 0xFF, 0x00, 0x05, 0x00, 0x00, 0x0A, 0xFF, 0x00, 0x17, 0x00, 0x07, 0x00,
+	0x18, 0x00, 0x00, 0x0A, 0xFF, 0x00, 0x05, 0x00, 0x00, 0x3B, 0xFF, 0x00, 0x05, 0x00, 0x00, 0x0A,
+	0xFF, 0x00, 0x17, 0x00, 0x07, 0x00, 0x18, 0x00, 0x00, 0x0A, 0xFF, 0x00, 0x05, 0x00, 0x00, 0x3B,
+	0xFF, 0x00, 0x05, 0x00, 0x00, 0x0A, 0xFF, 0x00, 0x17, 0x00, 0x07, 0x00, 0x18, 0x00, 0x00, 0x0A,
+	0xFF, 0x00, 0x05, 0x00, 0x00, 0x3B, 0xFF, 0x00, 0x05, 0x00, 0x00, 0x0A, 0xFF, 0x00, 0x17, 0x00,
+	0x07, 0x00, 0x18, 0x00, 0x00, 0x0A, 0xFF, 0x00, 0x05, 0x00, 0x00, 0x3B, 0xFF, 0x00, 0x05, 0x00,
+	0x00, 0x0A, 0xFF, 0x00, 0x17, 0x00, 0x05, 0x18, 0x0A, 0xFF, 0x00, 0x05, 0x00, 0x00, 0x3B, 0xFF,
+	0x00, 0x05, 0x00, 0x00, 0x0A, 0xFF, 0x05, 0x18, 0x0B, 0xFF, 0x00, 0x05, 0x00, 0x00, 0x39, 0xFF,
+	0x00, 0x05, 0x00, 0x00, 0x0B, 0xFF, 0x05, 0x19, 0x0A, 0xFF, 0x00, 0x05, 0x00, 0x00, 0x39, 0xFF,
+	0x00, 0x05, 0x00, 0x00, 0x0A, 0xFF, 0x05, 0x19, 0x0A, 0xFF, 0x00, 0x05, 0x00, 0x00, 0x39, 0xFF,
+	0x00, 0x05, 0x00, 0x00, 0x0A, 0xFF, 0x05, 0x19, 0x0A, 0xFF, 0x00, 0x05, 0x00, 0x00, 0x39, 0xFF,
+	0x00, 0x05, 0x00, 0x00, 0x0A, 0xFF, 0x05, 0x19, 0x0B, 0xFF, 0x00, 0x05, 0x00, 0x00, 0x37, 0xFF,
+	0x00, 0x05, 0x00, 0x00, 0x0B, 0xFF, 0x05, 0x19, 0x0B, 0xFF, 0x00, 0x05, 0x00, 0x00, 0x37, 0xFF,
+	0x00, 0x05, 0x00, 0x00, 0x0B, 0xFF, 0x05, 0x1A, 0x0A, 0xFF, 0x00, 0x06, 0x00, 0x00, 0x35, 0xFF,
+	0x00, 0x06, 0x00, 0x00, 0x0A, 0xFF, 0x05, 0x1A, 0x0B, 0xFF, 0x00, 0x05, 0x00, 0x00, 0x35, 0xFF,
+	0x00, 0x05, 0x00, 0x00, 0x0B, 0xFF, 0x05, 0x1A, 0x0B, 0xFF, 0x00, 0x06, 0x00, 0x00, 0x33, 0xFF,
+	0x00, 0x06, 0x00, 0x00, 0x0B, 0xFF, 0x05, 0x1B, 0x0A, 0xFF, 0x00, 0x06, 0x00, 0x00, 0x33, 0xFF,
+	0x00, 0x06, 0x00, 0x00, 0x0A, 0xFF, 0x05, 0x1B, 0x0B, 0xFF, 0x00, 0x06, 0x00, 0x00, 0x31, 0xFF,
+	0x00, 0x06, 0x00, 0x00, 0x0B, 0xFF, 0x05, 0x1B, 0x0C, 0xFF, 0x00, 0x06, 0x00, 0x00, 0x2F, 0xFF,
+	0x00, 0x06, 0x00, 0x00, 0x0C, 0xFF, 0x05, 0x1C, 0x0B, 0xFF, 0x00, 0x06, 0x00, 0x00, 0x2F, 0xFF,
+	0x00, 0x06, 0x00, 0x00, 0x0B, 0xFF, 0x05, 0x1C, 0x0C, 0xFF, 0x00, 0x06, 0x00, 0x00, 0x2D, 0xFF,
+	0x00, 0x06, 0x00, 0x00, 0x0C, 0xFF, 0x05, 0x1D, 0x0C, 0xFF, 0x00, 0x06, 0x00, 0x00, 0x2B, 0xFF,
+	0x00, 0x06, 0x00, 0x00, 0x0C, 0xFF, 0x05, 0x1D, 0x0C, 0xFF, 0x00, 0x07, 0x00, 0x00, 0x29, 0xFF,
+	0x00, 0x07, 0x00, 0x00, 0x0C, 0xFF, 0x05, 0x1E, 0x0C, 0xFF, 0x00, 0x07, 0x00, 0x00, 0x27, 0xFF,
+	0x00, 0x07, 0x00, 0x00, 0x0C, 0xFF, 0x05, 0x1E, 0x0D, 0xFF, 0x00, 0x07, 0x00, 0x00, 0x25, 0xFF,
+	0x00, 0x07, 0x00, 0x00, 0x0D, 0xFF, 0x05, 0x1F, 0x0D, 0xFF, 0x00, 0x08, 0x00, 0x00, 0x21, 0xFF,
+	0x00, 0x08, 0x00, 0x00, 0x0D, 0xFF, 0x05, 0x20, 0x0D, 0xFF, 0x00, 0x08, 0x00, 0x00, 0x1F, 0xFF,
+	0x00, 0x08, 0x00, 0x00, 0x0D, 0xFF, 0x05, 0x21, 0x0D, 0xFF, 0x00, 0x09, 0x00, 0x00, 0x1B, 0xFF,
+	0x00, 0x09, 0x00, 0x00, 0x0D, 0xFF, 0x05, 0x21, 0x0E, 0xFF, 0x00, 0x0A, 0x00, 0x00, 0x17, 0xFF,
+	0x00, 0x0A, 0x00, 0x00, 0x0E, 0xFF, 0x05, 0x22, 0x0F, 0xFF, 0x00, 0x0A, 0x00, 0x00, 0x13, 0xFF,
+	0x00, 0x0A, 0x00, 0x00, 0x0F, 0xFF, 0x06, 0x22, 0x01, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x0D, 0x00,
+	0x00, 0x0B, 0xFF, 0x00, 0x0D, 0x00, 0x00, 0x0F, 0xFF, 0x05, 0x21, 0x03, 0x00, 0x00, 0x10, 0xFF,
+	0x00, 0x21, 0x00, 0x00, 0x10, 0xFF, 0x00, 0x02, 0x00, 0x05, 0x20, 0x05, 0x00, 0x00, 0x10, 0xFF,
+	0x00, 0x1F, 0x00, 0x00, 0x10, 0xFF, 0x00, 0x04, 0x00, 0x05, 0x1F, 0x07, 0x00, 0x00, 0x12, 0xFF,
+	0x00, 0x19, 0x00, 0x00, 0x12, 0xFF, 0x00, 0x06, 0x00, 0x05, 0x1E, 0x09, 0x00, 0x00, 0x14, 0xFF,
+	0x00, 0x13, 0x00, 0x00, 0x14, 0xFF, 0x00, 0x08, 0x00, 0x05, 0x1D, 0x09, 0x00, 0x02, 0x17, 0xFF,
+	0x00, 0x0B, 0x00, 0x00, 0x17, 0xFF, 0x01, 0x09, 0x00, 0x03, 0x1C, 0x09, 0x00, 0x04, 0x37, 0xFF,
+	0x03, 0x09, 0x00, 0x03, 0x1B, 0x09, 0x00, 0x07, 0x33, 0xFF, 0x06, 0x09, 0x00, 0x03, 0x1A, 0x09,
+	0x00, 0x09, 0x31, 0xFF, 0x08, 0x09, 0x00, 0x03, 0x19, 0x09, 0x00, 0x0B, 0x2F, 0xFF, 0x0A, 0x09,
+	0x00, 0x03, 0x18, 0x09, 0x00, 0x0E, 0x2B, 0xFF, 0x0D, 0x09, 0x00, 0x03, 0x17, 0x09, 0x00, 0x11,
+	0x27, 0xFF, 0x10, 0x09, 0x00, 0x03, 0x16, 0x09, 0x00, 0x14, 0x23, 0xFF, 0x13, 0x09, 0x00, 0x03,
+	0x15, 0x09, 0x00, 0x18, 0x1D, 0xFF, 0x17, 0x09, 0x00, 0x03, 0x14, 0x09, 0x00, 0x1C, 0x17, 0xFF,
+	0x1B, 0x09, 0x00, 0x03, 0x13, 0x09, 0x00, 0x22, 0x0D, 0xFF, 0x21, 0x09, 0x00, 0x03, 0x12, 0x09,
+	0x00, 0x29, 0x05, 0x00, 0x24, 0x09, 0x00, 0x03, 0x13, 0x07, 0x00, 0x2A, 0x05, 0x00, 0x25, 0x07,
+	0x00, 0x03, 0x14, 0x05, 0x00, 0x2B, 0x05, 0x00, 0x26, 0x05, 0x00, 0x03, 0x15, 0x03, 0x00, 0x2C,
+	0x05, 0x00, 0x27, 0x03, 0x00, 0x03, 0x16, 0x01, 0x00, 0x2D, 0x05, 0x00, 0x28, 0x01, 0x00, 0x01,
+	0x44, 0x05, 0x00, 0x01, 0x44, 0x05, 0x00, 0x01, 0x44, 0x05, 0x00, 0x01, 0x44, 0x05, 0x00, 0x01,
+	0x44, 0x05, 0x00, 0x01, 0x44, 0x05, 0x00, 0x01, 0x44, 0x05, 0x00, 0x01, 0x44, 0x05, 0x00, 0x01,
+	0x44, 0x05, 0x00, 0x01, 0x44, 0x05, 0x00, 0x01, 0x44, 0x05, 0x00, 0x01, 0x44, 0x05, 0x00, 0x01,
+	0x44, 0x05, 0x00, 0x01, 0x44, 0x05, 0x00, 0x01, 0x44, 0x05, 0x00, 0x01, 0x44, 0x05, 0x00, 0x01,
+	0x44, 0x05, 0x00, 0x01, 0x44, 0x05, 0x00,
+};
+constexpr uint8_t IconSprite_01d_S_runs[] = {
+	0x01, 0x18, 0x05, 0x00, 0x01, 0x18, 0x05, 0x00, 0x01, 0x18, 0x05, 0x00, 0x01, 0x18, 0x05, 0x00,
+	0x01, 0x18, 0x05, 0x00, 0x03, 0x09, 0x01, 0x00, 0x0E, 0x05, 0x00, 0x09, 0x01, 0x00, 0x03, 0x08,
+	0x03, 0x00, 0x0D, 0x05, 0x00, 0x08, 0x03, 0x00, 0x03, 0x07, 0x05, 0x00, 0x0C, 0x05, 0x00, 0x07,
+	0x05, 0x00, 0x03, 0x06, 0x07, 0x00, 0x0B, 0x05, 0x00, 0x06, 0x07, 0x00, 0x04, 0x05, 0x09, 0x00,
+	0x07, 0x07, 0xFF, 0x00, 0x01, 0x00, 0x05, 0x09, 0x00, 0x03, 0x06, 0x09, 0x00, 0x03, 0x0D, 0xFF,
+	0x02, 0x09, 0x00, 0x03, 0x07, 0x09, 0x00, 0x00, 0x11, 0xFF, 0x00, 0x08, 0x00, 0x05, 0x08, 0x07,
+	0x00, 0x00, 0x06, 0xFF, 0x00, 0x07, 0x00, 0x00, 0x06, 0xFF, 0x00, 0x06, 0x00, 0x05, 0x09, 0x05,
+	0x00, 0x00, 0x05, 0xFF, 0x00, 0x0B, 0x00, 0x00, 0x05, 0xFF, 0x00, 0x04, 0x00, 0x05, 0x0A, 0x03,
+	0x00, 0x00, 0x04, 0xFF, 0x00, 0x0F, 0x00, 0x00, 0x04, 0xFF, 0x00, 0x02, 0x00, 0x04, 0x0B, 0x01,
+	0x00, 0x00, 0x04, 0xFF, 0x00, 0x11, 0x00, 0x00, 0x04, 0xFF, 0x03, 0x0B, 0x04, 0xFF, 0x00, 0x13,
+	0x00, 0x00, 0x04, 0xFF, 0x05, 0x0B, 0x03, 0xFF, 0x00, 0x08, 0x00, 0x00, 0x05, 0xFF, 0x00, 0x08,
+	0x00, 0x00, 0x03, 0xFF, 0x05, 0x0A, 0x04, 0xFF, 0x00, 0x06, 0x00, 0x00, 0x09, 0xFF, 0x00, 0x06,
+	0x00, 0x00, 0x04, 0xFF, 0x05, 0x0A, 0x03, 0xFF, 0x00, 0x06, 0x00, 0x00, 0x0B, 0xFF, 0x00, 0x06,
+	0x00, 0x00, 0x03, 0xFF, 0x05, 0x0A, 0x03, 0xFF, 0x00, 0x05, 0x00, 0x00, 0x0D, 0xFF, 0x00, 0x05,
+	0x00, 0x00, 0x03, 0xFF, 0x05, 0x09, 0x03, 0xFF, 0x00, 0x06, 0x00, 0x00, 0x0D, 0xFF, 0x00, 0x06,
+	0x00, 0x00, 0x03, 0xFF, 0x05, 0x09, 0x03, 0xFF, 0x00, 0x05, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x05,
+	0x00, 0x00, 0x03, 0xFF, 0x05, 0x09, 0x03, 0xFF, 0x00, 0x05, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x05,
+	0x00, 0x00, 0x03, 0xFF, 0x07, 0x00, 0x09, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x05, 0x00, 0x00, 0x0F,
+	0xFF, 0x00, 0x05, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x08, 0x00, 0x07, 0x00, 0x09, 0x00, 0x00, 0x03,
+	0xFF, 0x00, 0x05, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x05, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x08, 0x00,
+	0x07, 0x00, 0x09, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x05, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x05, 0x00,
+	0x00, 0x03, 0xFF, 0x00, 0x08, 0x00, 0x07, 0x00, 0x09, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x06, 0x00,
+	0x00, 0x0D, 0xFF, 0x00, 0x06, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x08, 0x00, 0x07, 0x00, 0x0A, 0x00,
+	0x00, 0x03, 0xFF, 0x00, 0x05, 0x00, 0x00, 0x0D, 0xFF, 0x00, 0x05, 0x00, 0x00, 0x03, 0xFF, 0x00,
+	0x09, 0x00, 0x05, 0x0A, 0x03, 0xFF, 0x00, 0x06, 0x00, 0x00, 0x0B, 0xFF, 0x00, 0x06, 0x00, 0x00,
+	0x03, 0xFF, 0x05, 0x0A, 0x04, 0xFF, 0x00, 0x06, 0x00, 0x00, 0x09, 0xFF, 0x00, 0x06, 0x00, 0x00,
+	0x04, 0xFF, 0x05, 0x0B, 0x03, 0xFF, 0x00, 0x08, 0x00, 0x00, 0x05, 0xFF, 0x00, 0x08, 0x00, 0x00,
+	0x03, 0xFF, 0x03, 0x0B, 0x04, 0xFF, 0x00, 0x13, 0x00, 0x00, 0x04, 0xFF, 0x05, 0x0A, 0x02, 0x00,
+	0x00, 0x04, 0xFF, 0x00, 0x11, 0x00, 0x00, 0x04, 0xFF, 0x00, 0x01, 0x00, 0x05, 0x09, 0x04, 0x00,
+	0x00, 0x04, 0xFF, 0x00, 0x0F, 0x00, 0x00, 0x04, 0xFF, 0x00, 0x03, 0x00, 0x05, 0x08, 0x06, 0x00,
+	0x00, 0x05, 0xFF, 0x00, 0x0B, 0x00, 0x00, 0x05, 0xFF, 0x00, 0x05, 0x00, 0x05, 0x07, 0x08, 0x00,
+	0x00, 0x06, 0xFF, 0x00, 0x07, 0x00, 0x00, 0x06, 0xFF, 0x00, 0x07, 0x00, 0x03, 0x06, 0x09, 0x00,
+	0x01, 0x11, 0xFF, 0x00, 0x09, 0x00, 0x03, 0x05, 0x09, 0x00, 0x04, 0x0D, 0xFF, 0x03, 0x09, 0x00,
+	0x04, 0x06, 0x07, 0x00, 0x08, 0x07, 0xFF, 0x00, 0x01, 0x00, 0x06, 0x07, 0x00, 0x03, 0x07, 0x05,
+	0x00, 0x0C, 0x05, 0x00, 0x07, 0x05, 0x00, 0x03, 0x08, 0x03, 0x00, 0x0D, 0x05, 0x00, 0x08, 0x03,
+	0x00, 0x03, 0x09, 0x01, 0x00, 0x0E, 0x05, 0x00, 0x09, 0x01, 0x00, 0x01, 0x18, 0x05, 0x00, 0x01,
+	0x18, 0x05, 0x00, 0x01, 0x18, 0x05, 0x00, 0x01, 0x18, 0x05, 0x00, 0x01, 0x18, 0x05, 0x00,
+};
+constexpr uint8_t IconSprite_01n_L_runs[] = {
+	0x01, 0x44, 0x05, 0x00, 0x01, 0x44, 0x05, 0x00, 0x01, 0x44, 0x05, 0x00, 0x01, 0x44, 0x05, 0x00,
+	0x01, 0x44, 0x05, 0x00, 0x02, 0x44, 0x05, 0x00, 0x6A, 0x07, 0xFF, 0x02, 0x44, 0x05, 0x00, 0x67,
+	0x0D, 0xFF, 0x02, 0x44, 0x05, 0x00, 0x65, 0x11, 0xFF, 0x02, 0x44, 0x05, 0x00, 0x64, 0x13, 0xFF,
+	0x02, 0x44, 0x05, 0x00, 0x62, 0x17, 0xFF, 0x02, 0x44, 0x05, 0x00, 0x61, 0x19, 0xFF, 0x03, 0x44,
+	0x05, 0x00, 0x5E, 0x03, 0x00, 0x00, 0x19, 0xFF, 0x03, 0x44, 0x05, 0x00, 0x5C, 0x04, 0x00, 0x00,
+	0x1B, 0xFF, 0x03, 0x44, 0x05, 0x00, 0x5B, 0x04, 0x00, 0x00, 0x1D, 0xFF, 0x03, 0x44, 0x05, 0x00,
+	0x5A, 0x05, 0x00, 0x00, 0x1D, 0xFF, 0x03, 0x44, 0x05, 0x00, 0x59, 0x05, 0x00, 0x00, 0x1F, 0xFF,
+	0x03, 0x44, 0x05, 0x00, 0x58, 0x06, 0x00, 0x00, 0x1F, 0xFF, 0x03, 0x44, 0x05, 0x00, 0x58, 0x06,
+	0x00, 0x00, 0x1F, 0xFF, 0x05, 0x16, 0x01, 0x00, 0x2D, 0x05, 0x00, 0x28, 0x01, 0x00, 0x2E, 0x06,
+	0x00, 0x00, 0x21, 0xFF, 0x05, 0x15, 0x03, 0x00, 0x2C, 0x05, 0x00, 0x27, 0x03, 0x00, 0x2D, 0x06,
+	0x00, 0x00, 0x21, 0xFF, 0x05, 0x14, 0x05, 0x00, 0x2B, 0x05, 0x00, 0x26, 0x05, 0x00, 0x2C, 0x06,
+	0x00, 0x00, 0x21, 0xFF, 0x05, 0x13, 0x07, 0x00, 0x2A, 0x05, 0x00, 0x25, 0x07, 0x00, 0x2B, 0x06,
+	0x00, 0x00, 0x21, 0xFF, 0x05, 0x12, 0x09, 0x00, 0x29, 0x05, 0x00, 0x24, 0x09, 0x00, 0x2A, 0x06,
+	0x00, 0x00, 0x21, 0xFF, 0x05, 0x13, 0x09, 0x00, 0x28, 0x05, 0x00, 0x23, 0x09, 0x00, 0x2B, 0x06,
+	0x00, 0x00, 0x21, 0xFF, 0x05, 0x14, 0x09, 0x00, 0x21, 0x0D, 0xFF, 0x20, 0x09, 0x00, 0x2C, 0x06,
+	0x00, 0x00, 0x21, 0xFF, 0x05, 0x15, 0x09, 0x00, 0x1B, 0x17, 0xFF, 0x1A, 0x09, 0x00, 0x2E, 0x06,
+	0x00, 0x00, 0x1F, 0xFF, 0x05, 0x16, 0x09, 0x00, 0x17, 0x1D, 0xFF, 0x16, 0x09, 0x00, 0x2F, 0x06,
+	0x00, 0x00, 0x1F, 0xFF, 0x05, 0x17, 0x09, 0x00, 0x13, 0x23, 0xFF, 0x12, 0x09, 0x00, 0x31, 0x05,
+	0x00, 0x00, 0x1F, 0xFF, 0x05, 0x18, 0x09, 0x00, 0x10, 0x27, 0xFF, 0x0F, 0x09, 0x00, 0x33, 0x05,
+	0x00, 0x00, 0x1D, 0xFF, 0x05, 0x19, 0x09, 0x00, 0x0D, 0x2B, 0xFF, 0x0C, 0x09, 0x00, 0x35, 0x04,
+	0x00, 0x00, 0x1D, 0xFF, 0x05, 0x1A, 0x09, 0x00, 0x0A, 0x2F, 0xFF, 0x09, 0x09, 0x00, 0x37, 0x04,
+	0x00, 0x00, 0x1B, 0xFF, 0x05, 0x1B, 0x09, 0x00, 0x08, 0x31, 0xFF, 0x07, 0x09, 0x00, 0x3A, 0x03,
+	0x00, 0x00, 0x19, 0xFF, 0x04, 0x1C, 0x09, 0x00, 0x06, 0x33, 0xFF, 0x05, 0x09, 0x00, 0x3E, 0x19,
+	0xFF, 0x04, 0x1D, 0x09, 0x00, 0x03, 0x37, 0xFF, 0x02, 0x09, 0x00, 0x40, 0x17, 0xFF, 0x06, 0x1E,
+	0x09, 0x00, 0x01, 0x17, 0xFF, 0x00, 0x0B, 0x00, 0x00, 0x17, 0xFF, 0x00, 0x09, 0x00, 0x43, 0x13,
+	0xFF, 0x06, 0x1F, 0x08, 0x00, 0x00, 0x14, 0xFF, 0x00, 0x13, 0x00, 0x00, 0x14, 0xFF, 0x00, 0x07,
+	0x00, 0x45, 0x11, 0xFF, 0x06, 0x20, 0x06, 0x00, 0x00, 0x12, 0xFF, 0x00, 0x19, 0x00, 0x00, 0x12,
+	0xFF, 0x00, 0x05, 0x00, 0x48, 0x0D, 0xFF, 0x06, 0x21, 0x04, 0x00, 0x00, 0x10, 0xFF, 0x00, 0x1F,
+	0x00, 0x00, 0x10, 0xFF, 0x00, 0x03, 0x00, 0x4C, 0x07, 0xFF, 0x05, 0x22, 0x02, 0x00, 0x00, 0x10,
+	0xFF, 0x00, 0x21, 0x00, 0x00, 0x10, 0xFF, 0x00, 0x01, 0x00, 0x05, 0x23, 0x0F, 0xFF, 0x00, 0x0D,
+	0x00, 0x00, 0x0B, 0xFF, 0x00, 0x0D, 0x00, 0x00, 0x0F, 0xFF, 0x05, 0x22, 0x0F, 0xFF, 0x00, 0x0A,
+	0x00, 0x00, 0x13, 0xFF, 0x00, 0x0A, 0x00, 0x00, 0x0F, 0xFF, 0x05, 0x21, 0x0E, 0xFF, 0x00, 0x0A,
+	0x00, 0x00, 0x17, 0xFF, 0x00, 0x0A, 0x00, 0x00, 0x0E, 0xFF, 0x05, 0x21, 0x0D, 0xFF, 0x00, 0x09,
+	0x00, 0x00, 0x1B, 0xFF, 0x00, 0x09, 0x00, 0x00, 0x0D, 0xFF, 0x05, 0x20, 0x0D, 0xFF, 0x00, 0x08,
+	0x00, 0x00, 0x1F, 0xFF, 0x00, 0x08, 0x00, 0x00, 0x0D, 0xFF, 0x05, 0x1F, 0x0D, 0xFF, 0x00, 0x08,
+	0x00, 0x00, 0x21, 0xFF, 0x00, 0x08, 0x00, 0x00, 0x0D, 0xFF, 0x05, 0x1E, 0x0D, 0xFF, 0x00, 0x07,
+	0x00, 0x00, 0x25, 0xFF, 0x00, 0x07, 0x00, 0x00, 0x0D, 0xFF, 0x05, 0x1E, 0x0C, 0xFF, 0x00, 0x07,
+	0x00, 0x00, 0x27, 0xFF, 0x00, 0x07, 0x00, 0x00, 0x0C, 0xFF, 0x05, 0x1D, 0x0C, 0xFF, 0x00, 0x07,
+	0x00, 0x00, 0x29, 0xFF, 0x00, 0x07, 0x00, 0x00, 0x0C, 0xFF, 0x05, 0x1D, 0x0C, 0xFF, 0x00, 0x06,
+	0x00, 0x00, 0x2B, 0xFF, 0x00, 0x06, 0x00, 0x00, 0x0C, 0xFF, 0x05, 0x1C, 0x0C, 0xFF, 0x00, 0x06,
+	0x00, 0x00, 0x2D, 0xFF, 0x00, 0x06, 0x00, 0x00, 0x0C, 0xFF, 0x05, 0x1C, 0x0B, 0xFF, 0x00, 0x06,
+	0x00, 0x00, 0x2F, 0xFF, 0x00, 0x06, 0x00, 0x00, 0x0B, 0xFF, 0x05, 0x1B, 0x0C, 0xFF, 0x00, 0x06,
+	0x00, 0x00, 0x2F, 0xFF, 0x00, 0x06, 0x00, 0x00, 0x0C, 0xFF, 0x05, 0x1B, 0x0B, 0xFF, 0x00, 0x06,
+	0x00, 0x00, 0x31, 0xFF, 0x00, 0x06, 0x00, 0x00, 0x0B, 0xFF, 0x05, 0x1B, 0x0A, 0xFF, 0x00, 0x06,
+	0x00, 0x00, 0x33, 0xFF, 0x00, 0x06, 0x00, 0x00, 0x0A, 0xFF, 0x05, 0x1A, 0x0B, 0xFF, 0x00, 0x06,
+	0x00, 0x00, 0x33, 0xFF, 0x00, 0x06, 0x00, 0x00, 0x0B, 0xFF, 0x05, 0x1A, 0x0B, 0xFF, 0x00, 0x05,
+	0x00, 0x00, 0x35, 0xFF, 0x00, 0x05, 0x00, 0x00, 0x0B, 0xFF, 0x05, 0x1A, 0x0A, 0xFF, 0x00, 0x06,
+	0x00, 0x00, 0x35, 0xFF, 0x00, 0x06, 0x00, 0x00, 0x0A, 0xFF, 0x05, 0x19, 0x0B, 0xFF, 0x00, 0x05,
+	0x00, 0x00, 0x37, 0xFF, 0x00, 0x05, 0x00, 0x00, 0x0B, 0xFF, 0x05, 0x19, 0x0B, 0xFF, 0x00, 0x05,
+	0x00, 0x00, 0x37, 0xFF, 0x00, 0x05, 0x00, 0x00, 0x0B, 0xFF, 0x05, 0x19, 0x0A, 0xFF, 0x00, 0x05,
+	0x00, 0x00, 0x39, 0xFF, 0x00, 0x05, 0x00, 0x00, 0x0A, 0xFF, 0x05, 0x19, 0x0A, 0xFF, 0x00, 0x05,
+	0x00, 0x00, 0x39, 0xFF, 0x00, 0x05, 0x00, 0x00, 0x0A, 0xFF, 0x05, 0x19, 0x0A, 0xFF, 0x00, 0x05,
+	0x00, 0x00, 0x39, 0xFF, 0x00, 0x05, 0x00, 0x00, 0x0A, 0xFF, 0x05, 0x18, 0x0B, 0xFF, 0x00, 0x05,
+	0x00, 0x00, 0x39, 0xFF, 0x00, 0x05, 0x00, 0x00, 0x0B, 0xFF, 0x05, 0x18, 0x0A, 0xFF, 0x00, 0x05,
+	0x00, 0x00, 0x3B, 0xFF, 0x00, 0x05, 0x00, 0x00, 0x0A, 0xFF, 0x05, 0x18, 0x0A, 0xFF, 0x00, 0x05,
+	0x00, 0x00, 0x3B, 0xFF, 0x00, 0x05, 0x00, 0x00, 0x0A, 0xFF, 0x05, 0x18, 0x0A, 0xFF, 0x00, 0x05,
+	0x00, 0x00, 0x3B, 0xFF, 0x00, 0x05, 0x00, 0x00, 0x0A, 0xFF, 0x05, 0x18, 0x0A, 0xFF, 0x00, 0x05,
+	0x00, 0x00, 0x3B, 0xFF, 0x00, 0x05, 0x00, 0x00, 0x0A, 0xFF, 0x05, 0x18, 0x0A, 0xFF, 0x00, 0x05,
+	0x00, 0x00, 0x3B, 0xFF, 0x00, 0x05, 0x00, 0x00, 0x0A, 0xFF, 0x07, 0x00, 0x18, 0x00, 0x00, 0x0A,
+	0xFF, 0x00, 0x05, 0x00, 0x00, 0x3B, 0xFF, 0x00, 0x05, 0x00, 0x00, 0x0A, 0xFF, 0x00, 0x17, 0x00,
+	0x07, 0x00, 0x18, 0x00, 0x00, 0x0A, 0xFF, 0x00, 0x05, 0x00, 0x00, 0x3B, 0xFF, 0x00, 0x05, 0x00,
+	0x00, 0x0A, 0xFF, 0x00, 0x17, 0x00, 0x07, 0x00, 0x18, 0x00, 0x00, 0x0A, 0xFF, 0x00, 0x05, 0x00,
+	0x00, 0x3B, 0xFF, 0x00, 0x05, 0x00, 0x00, 0x0A, 0xFF, 0x00, 0x17, 0x00, 0x07, 0x00, 0x18, 0x00,
+	0x00, 0x0A, 0xFF, 0x00, 0x05, 0x00, 0x00, 0x3B, 0xFF, 0x00, 0x05, 0x00, 0x00, 0x0A, 0xFF, 0x00,
+	0x17, 0x00, 0x07, 0x00, 0x18, 0x00, 0x00, 0x0A, 0xFF, 0x00, 0x05, 0x00, 0x00, 0x3B, 0xFF, 0x00,
+	0x05, 0x00, 0x00, 0x0A, 0xFF, 0x00, 0x17, 0x00, 0x05, 0x18, 0x0A, 0xFF, 0x00, 0x05, 0x00, 0x00,
+	0x3B, 0xFF, 0x00, 0x05, 0x00, 0x00, 0x0A, 0xFF, 0x05, 0x18, 0x0B, 0xFF, 0x00, 0x05, 0x00, 0x00,
+	0x39, 0xFF, 0x00, 0x05, 0x00, 0x00, 0x0B, 0xFF, 0x05, 0x19, 0x0A, 0xFF, 0x00, 0x05, 0x00, 0x00,
+	0x39, 0xFF, 0x00, 0x05, 0x00, 0x00, 0x0A, 0xFF, 0x05, 0x19, 0x0A, 0xFF, 0x00, 0x05, 0x00, 0x00,
+	0x39, 0xFF, 0x00, 0x05, 0x00, 0x00, 0x0A, 0xFF, 0x05, 0x19, 0x0A, 0xFF, 0x00, 0x05, 0x00, 0x00,
+	0x39, 0xFF, 0x00, 0x05, 0x00, 0x00, 0x0A, 0xFF, 0x05, 0x19, 0x0B, 0xFF, 0x00, 0x05, 0x00, 0x00,
+	0x37, 0xFF, 0x00, 0x05, 0x00, 0x00, 0x0B, 0xFF, 0x05, 0x19, 0x0B, 0xFF, 0x00, 0x05, 0x00, 0x00,
+	0x37, 0xFF, 0x00, 0x05, 0x00, 0x00, 0x0B, 0xFF, 0x05, 0x1A, 0x0A, 0xFF, 0x00, 0x06, 0x00, 0x00,
+	0x35, 0xFF, 0x00, 0x06, 0x00, 0x00, 0x0A, 0xFF, 0x05, 0x1A, 0x0B, 0xFF, 0x00, 0x05, 0x00, 0x00,
+	0x35, 0xFF, 0x00, 0x05, 0x00, 0x00, 0x0B, 0xFF, 0x05, 0x1A, 0x0B, 0xFF, 0x00, 0x06, 0x00, 0x00,
+	0x33, 0xFF, 0x00, 0x06, 0x00, 0x00, 0x0B, 0xFF, 0x05, 0x1B, 0x0A, 0xFF, 0x00, 0x06, 0x00, 0x00,
+	0x33, 0xFF, 0x00, 0x06, 0x00, 0x00, 0x0A, 0xFF, 0x05, 0x1B, 0x0B, 0xFF, 0x00, 0x06, 0x00, 0x00,
+	0x31, 0xFF, 0x00, 0x06, 0x00, 0x00, 0x0B, 0xFF, 0x05, 0x1B, 0x0C, 0xFF, 0x00, 0x06, 0x00, 0x00,
+	0x2F, 0xFF, 0x00, 0x06, 0x00, 0x00, 0x0C, 0xFF, 0x05, 0x1C, 0x0B, 0xFF, 0x00, 0x06, 0x00, 0x00,
+	0x2F, 0xFF, 0x00, 0x06, 0x00, 0x00, 0x0B, 0xFF, 0x05, 0x1C, 0x0C, 0xFF, 0x00, 0x06, 0x00, 0x00,
+	0x2D, 0xFF, 0x00, 0x06, 0x00, 0x00, 0x0C, 0xFF, 0x05, 0x1D, 0x0C, 0xFF, 0x00, 0x06, 0x00, 0x00,
+	0x2B, 0xFF, 0x00, 0x06, 0x00, 0x00, 0x0C, 0xFF, 0x05, 0x1D, 0x0C, 0xFF, 0x00, 0x07, 0x00, 0x00,
+	0x29, 0xFF, 0x00, 0x07, 0x00, 0x00, 0x0C, 0xFF, 0x05, 0x1E, 0x0C, 0xFF, 0x00, 0x07, 0x00, 0x00,
+	0x27, 0xFF, 0x00, 0x07, 0x00, 0x00, 0x0C, 0xFF, 0x05, 0x1E, 0x0D, 0xFF, 0x00, 0x07, 0x00, 0x00,
+	0x25, 0xFF, 0x00, 0x07, 0x00, 0x00, 0x0D, 0xFF, 0x05, 0x1F, 0x0D, 0xFF, 0x00, 0x08, 0x00, 0x00,
+	0x21, 0xFF, 0x00, 0x08, 0x00, 0x00, 0x0D, 0xFF, 0x05, 0x20, 0x0D, 0xFF, 0x00, 0x08, 0x00, 0x00,
+	0x1F, 0xFF, 0x00, 0x08, 0x00, 0x00, 0x0D, 0xFF, 0x05, 0x21, 0x0D, 0xFF, 0x00, 0x09, 0x00, 0x00,
+	0x1B, 0xFF, 0x00, 0x09, 0x00, 0x00, 0x0D, 0xFF, 0x05, 0x21, 0x0E, 0xFF, 0x00, 0x0A, 0x00, 0x00,
+	0x17, 0xFF, 0x00, 0x0A, 0x00, 0x00, 0x0E, 0xFF, 0x05, 0x22, 0x0F, 0xFF, 0x00, 0x0A, 0x00, 0x00,
+	0x13, 0xFF, 0x00, 0x0A, 0x00, 0x00, 0x0F, 0xFF, 0x06, 0x22, 0x01, 0x00, 0x00, 0x0F, 0xFF, 0x00,
+	0x0D, 0x00, 0x00, 0x0B, 0xFF, 0x00, 0x0D, 0x00, 0x00, 0x0F, 0xFF, 0x05, 0x21, 0x03, 0x00, 0x00,
+	0x10, 0xFF, 0x00, 0x21, 0x00, 0x00, 0x10, 0xFF, 0x00, 0x02, 0x00, 0x05, 0x20, 0x05, 0x00, 0x00,
+	0x10, 0xFF, 0x00, 0x1F, 0x00, 0x00, 0x10, 0xFF, 0x00, 0x04, 0x00, 0x05, 0x1F, 0x07, 0x00, 0x00,
+	0x12, 0xFF, 0x00, 0x19, 0x00, 0x00, 0x12, 0xFF, 0x00, 0x06, 0x00, 0x05, 0x1E, 0x09, 0x00, 0x00,
+	0x14, 0xFF, 0x00, 0x13, 0x00, 0x00, 0x14, 0xFF, 0x00, 0x08, 0x00, 0x05, 0x1D, 0x09, 0x00, 0x02,
+	0x17, 0xFF, 0x00, 0x0B, 0x00, 0x00, 0x17, 0xFF, 0x01, 0x09, 0x00, 0x03, 0x1C, 0x09, 0x00, 0x04,
+	0x37, 0xFF, 0x03, 0x09, 0x00, 0x03, 0x1B, 0x09, 0x00, 0x07, 0x33, 0xFF, 0x06, 0x09, 0x00, 0x03,
+	0x1A, 0x09, 0x00, 0x09, 0x31, 0xFF, 0x08, 0x09, 0x00, 0x03, 0x19, 0x09, 0x00, 0x0B, 0x2F, 0xFF,
+	0x0A, 0x09, 0x00, 0x03, 0x18, 0x09, 0x00, 0x0E, 0x2B, 0xFF, 0x0D, 0x09, 0x00, 0x03, 0x17, 0x09,
+	0x00, 0x11, 0x27, 0xFF, 0x10, 0x09, 0x00, 0x03, 0x16, 0x09, 0x00, 0x14, 0x23, 0xFF, 0x13, 0x09,
+	0x00, 0x03, 0x15, 0x09, 0x00, 0x18, 0x1D, 0xFF, 0x17, 0x09, 0x00, 0x03, 0x14, 0x09, 0x00, 0x1C,
+	0x17, 0xFF, 0x1B, 0x09, 0x00, 0x03, 0x13, 0x09, 0x00, 0x22, 0x0D, 0xFF, 0x21, 0x09, 0x00, 0x03,
+	0x12, 0x09, 0x00, 0x29, 0x05, 0x00, 0x24, 0x09, 0x00, 0x03, 0x13, 0x07, 0x00, 0x2A, 0x05, 0x00,
+	0x25, 0x07, 0x00, 0x03, 0x14, 0x05, 0x00, 0x2B, 0x05, 0x00, 0x26, 0x05, 0x00, 0x03, 0x15, 0x03,
+	0x00, 0x2C, 0x05, 0x00, 0x27, 0x03, 0x00, 0x03, 0x16, 0x01, 0x00, 0x2D, 0x05, 0x00, 0x28, 0x01,
+	0x00, 0x01, 0x44, 0x05, 0x00, 0x01, 0x44, 0x05, 0x00, 0x01, 0x44, 0x05, 0x00, 0x01, 0x44, 0x05,
+	0x00, 0x01, 0x44, 0x05, 0x00, 0x01, 0x44, 0x05, 0x00, 0x01, 0x44, 0x05, 0x00, 0x01, 0x44, 0x05,
+	0x00, 0x01, 0x44, 0x05, 0x00, 0x01, 0x44, 0x05, 0x00, 0x01, 0x44, 0x05, 0x00, 0x01, 0x44, 0x05,
+	0x00, 0x01, 0x44, 0x05, 0x00, 0x01, 0x44, 0x05, 0x00, 0x01, 0x44, 0x05, 0x00, 0x01, 0x44, 0x05,
+	0x00, 0x01, 0x44, 0x05, 0x00, 0x01, 0x44, 0x05, 0x00,
+};
+constexpr uint8_t IconSprite_01n_S_runs[] = {
+	0x01, 0x46, 0x07, 0xFF, 0x01, 0x43, 0x0D, 0xFF, 0x01, 0x41, 0x11, 0xFF, 0x01, 0x40, 0x13, 0xFF,
+	0x01, 0x3E, 0x17, 0xFF, 0x01, 0x3D, 0x19, 0xFF, 0x02, 0x3A, 0x03, 0x00, 0x00, 0x19, 0xFF, 0x02,
+	0x38, 0x04, 0x00, 0x00, 0x1B, 0xFF, 0x02, 0x37, 0x04, 0x00, 0x00, 0x1D, 0xFF, 0x02, 0x36, 0x05,
+	0x00, 0x00, 0x1D, 0xFF, 0x02, 0x35, 0x05, 0x00, 0x00, 0x1F, 0xFF, 0x02, 0x34, 0x06, 0x00, 0x00,
+	0x1F, 0xFF, 0x02, 0x34, 0x06, 0x00, 0x00, 0x1F, 0xFF, 0x02, 0x33, 0x06, 0x00, 0x00, 0x21, 0xFF,
+	0x02, 0x33, 0x06, 0x00, 0x00, 0x21, 0xFF, 0x02, 0x33, 0x06, 0x00, 0x00, 0x21, 0xFF, 0x02, 0x33,
+	0x06, 0x00, 0x00, 0x21, 0xFF, 0x02, 0x33, 0x06, 0x00, 0x00, 0x21, 0xFF, 0x02, 0x33, 0x06, 0x00,
+	0x00, 0x21, 0xFF, 0x02, 0x33, 0x06, 0x00, 0x00, 0x21, 0xFF, 0x02, 0x34, 0x06, 0x00, 0x00, 0x1F,
+	0xFF, 0x02, 0x34, 0x06, 0x00, 0x00, 0x1F, 0xFF, 0x02, 0x35, 0x05, 0x00, 0x00, 0x1F, 0xFF, 0x02,
+	0x36, 0x05, 0x00, 0x00, 0x1D, 0xFF, 0x02, 0x37, 0x04, 0x00, 0x00, 0x1D, 0xFF, 0x02, 0x38, 0x04,
+	0x00, 0x00, 0x1B, 0xFF, 0x02, 0x3A, 0x03, 0x00, 0x00, 0x19, 0xFF, 0x02, 0x18, 0x05, 0x00, 0x20,
+	0x19, 0xFF, 0x02, 0x18, 0x05, 0x00, 0x21, 0x17, 0xFF, 0x02, 0x18, 0x05, 0x00, 0x23, 0x13, 0xFF,
+	0x02, 0x18, 0x05, 0x00, 0x24, 0x11, 0xFF, 0x02, 0x18, 0x05, 0x00, 0x26, 0x0D, 0xFF, 0x04, 0x09,
+	0x01, 0x00, 0x0E, 0x05, 0x00, 0x09, 0x01, 0x00, 0x1F, 0x07, 0xFF, 0x03, 0x08, 0x03, 0x00, 0x0D,
+	0x05, 0x00, 0x08, 0x03, 0x00, 0x03, 0x07, 0x05, 0x00, 0x0C, 0x05, 0x00, 0x07, 0x05, 0x00, 0x03,
+	0x06, 0x07, 0x00, 0x0B, 0x05, 0x00, 0x06, 0x07, 0x00, 0x04, 0x05, 0x09, 0x00, 0x07, 0x07, 0xFF,
+	0x00, 0x01, 0x00, 0x05, 0x09, 0x00, 0x03, 0x06, 0x09, 0x00, 0x03, 0x0D, 0xFF, 0x02, 0x09, 0x00,
+	0x03, 0x07, 0x09, 0x00, 0x00, 0x11, 0xFF, 0x00, 0x08, 0x00, 0x05, 0x08, 0x07, 0x00, 0x00, 0x06,
+	0xFF, 0x00, 0x07, 0x00, 0x00, 0x06, 0xFF, 0x00, 0x06, 0x00, 0x05, 0x09, 0x05, 0x00, 0x00, 0x05,
+	0xFF, 0x00, 0x0B, 0x00, 0x00, 0x05, 0xFF, 0x00, 0x04, 0x00, 0x05, 0x0A, 0x03, 0x00, 0x00, 0x04,
+	0xFF, 0x00, 0x0F, 0x00, 0x00, 0x04, 0xFF, 0x00, 0x02, 0x00, 0x04, 0x0B, 0x01, 0x00, 0x00, 0x04,
+	0xFF, 0x00, 0x11, 0x00, 0x00, 0x04, 0xFF, 0x03, 0x0B, 0x04, 0xFF, 0x00, 0x13, 0x00, 0x00, 0x04,
+	0xFF, 0x05, 0x0B, 0x03, 0xFF, 0x00, 0x08, 0x00, 0x00, 0x05, 0xFF, 0x00, 0x08, 0x00, 0x00, 0x03,
+	0xFF, 0x05, 0x0A, 0x04, 0xFF, 0x00, 0x06, 0x00, 0x00, 0x09, 0xFF, 0x00, 0x06, 0x00, 0x00, 0x04,
+	0xFF, 0x05, 0x0A, 0x03, 0xFF, 0x00, 0x06, 0x00, 0x00, 0x0B, 0xFF, 0x00, 0x06, 0x00, 0x00, 0x03,
+	0xFF, 0x05, 0x0A, 0x03, 0xFF, 0x00, 0x05, 0x00, 0x00, 0x0D, 0xFF, 0x00, 0x05, 0x00, 0x00, 0x03,
+	0xFF, 0x05, 0x09, 0x03, 0xFF, 0x00, 0x06, 0x00, 0x00, 0x0D, 0xFF, 0x00, 0x06, 0x00, 0x00, 0x03,
+	0xFF, 0x05, 0x09, 0x03, 0xFF, 0x00, 0x05, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x05, 0x00, 0x00, 0x03,
+	0xFF, 0x05, 0x09, 0x03, 0xFF, 0x00, 0x05, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x05, 0x00, 0x00, 0x03,
+	0xFF, 0x07, 0x00, 0x09, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x05, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x05,
+	0x00, 0x00, 0x03, 0xFF, 0x00, 0x08, 0x00, 0x07, 0x00, 0x09, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x05,
+	0x00, 0x00, 0x0F, 0xFF, 0x00, 0x05, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x08, 0x00, 0x07, 0x00, 0x09,
+	0x00, 0x00, 0x03, 0xFF, 0x00, 0x05, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x05, 0x00, 0x00, 0x03, 0xFF,
+	0x00, 0x08, 0x00, 0x07, 0x00, 0x09, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x06, 0x00, 0x00, 0x0D, 0xFF,
+	0x00, 0x06, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x08, 0x00, 0x07, 0x00, 0x0A, 0x00, 0x00, 0x03, 0xFF,
+	0x00, 0x05, 0x00, 0x00, 0x0D, 0xFF, 0x00, 0x05, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x09, 0x00, 0x05,
+	0x0A, 0x03, 0xFF, 0x00, 0x06, 0x00, 0x00, 0x0B, 0xFF, 0x00, 0x06, 0x00, 0x00, 0x03, 0xFF, 0x05,
+	0x0A, 0x04, 0xFF, 0x00, 0x06, 0x00, 0x00, 0x09, 0xFF, 0x00, 0x06, 0x00, 0x00, 0x04, 0xFF, 0x05,
+	0x0B, 0x03, 0xFF, 0x00, 0x08, 0x00, 0x00, 0x05, 0xFF, 0x00, 0x08, 0x00, 0x00, 0x03, 0xFF, 0x03,
+	0x0B, 0x04, 0xFF, 0x00, 0x13, 0x00, 0x00, 0x04, 0xFF, 0x05, 0x0A, 0x02, 0x00, 0x00, 0x04, 0xFF,
+	0x00, 0x11, 0x00, 0x00, 0x04, 0xFF, 0x00, 0x01, 0x00, 0x05, 0x09, 0x04, 0x00, 0x00, 0x04, 0xFF,
+	0x00, 0x0F, 0x00, 0x00, 0x04, 0xFF, 0x00, 0x03, 0x00, 0x05, 0x08, 0x06, 0x00, 0x00, 0x05, 0xFF,
+	0x00, 0x0B, 0x00, 0x00, 0x05, 0xFF, 0x00, 0x05, 0x00, 0x05, 0x07, 0x08, 0x00, 0x00, 0x06, 0xFF,
+	0x00, 0x07, 0x00, 0x00, 0x06, 0xFF, 0x00, 0x07, 0x00, 0x03, 0x06, 0x09, 0x00, 0x01, 0x11, 0xFF,
+	0x00, 0x09, 0x00, 0x03, 0x05, 0x09, 0x00, 0x04, 0x0D, 0xFF, 0x03, 0x09, 0x00, 0x04, 0x06, 0x07,
+	0x00, 0x08, 0x07, 0xFF, 0x00, 0x01, 0x00, 0x06, 0x07, 0x00, 0x03, 0x07, 0x05, 0x00, 0x0C, 0x05,
+	0x00, 0x07, 0x05, 0x00, 0x03, 0x08, 0x03, 0x00, 0x0D, 0x05, 0x00, 0x08, 0x03, 0x00, 0x03, 0x09,
+	0x01, 0x00, 0x0E, 0x05, 0x00, 0x09, 0x01, 0x00, 0x01, 0x18, 0x05, 0x00, 0x01, 0x18, 0x05, 0x00,
+	0x01, 0x18, 0x05, 0x00, 0x01, 0x18, 0x05, 0x00, 0x01, 0x18, 0x05, 0x00,
+};
+constexpr uint8_t IconSprite_02d_L_runs[] = {
+	0x01, 0x28, 0x05, 0x00, 0x01, 0x28, 0x05, 0x00, 0x01, 0x28, 0x05, 0x00, 0x01, 0x28, 0x05, 0x00,
+	0x01, 0x28, 0x05, 0x00, 0x01, 0x28, 0x05, 0x00, 0x01, 0x28, 0x05, 0x00, 0x01, 0x28, 0x05, 0x00,
+	0x01, 0x28, 0x05, 0x00, 0x01, 0x28, 0x05, 0x00, 0x03, 0x0E, 0x01, 0x00, 0x19, 0x05, 0x00, 0x15,
+	0x01, 0x00, 0x03, 0x0D, 0x03, 0x00, 0x18, 0x05, 0x00, 0x14, 0x03, 0x00, 0x03, 0x0C, 0x05, 0x00,
+	0x17, 0x05, 0x00, 0x13, 0x05, 0x00, 0x03, 0x0B, 0x07, 0x00, 0x16, 0x05, 0x00, 0x12, 0x07, 0x00,
+	0x03, 0x0A, 0x09, 0x00, 0x10, 0x0B, 0xFF, 0x10, 0x09, 0x00, 0x03, 0x0B, 0x09, 0x00, 0x0C, 0x11,
+	0xFF, 0x0C, 0x09, 0x00, 0x03, 0x0C, 0x09, 0x00, 0x08, 0x17, 0xFF, 0x08, 0x09, 0x00, 0x04, 0x0D,
+	0x09, 0x00, 0x05, 0x1B, 0xFF, 0x05, 0x09, 0x00, 0x1E, 0x0B, 0x00, 0x04, 0x0E, 0x09, 0x00, 0x03,
+	0x1D, 0xFF, 0x03, 0x09, 0x00, 0x1B, 0x13, 0x00, 0x04, 0x0F, 0x09, 0x00, 0x01, 0x1F, 0xFF, 0x01,
+	0x09, 0x00, 0x19, 0x19, 0x00, 0x06, 0x10, 0x07, 0x00, 0x00, 0x0D, 0xFF, 0x00, 0x09, 0x00, 0x00,
+	0x0D, 0xFF, 0x00, 0x07, 0x00, 0x18, 0x1D, 0x00, 0x06, 0x11, 0x05, 0x00, 0x00, 0x0B, 0xFF, 0x00,
+	0x0F, 0x00, 0x00, 0x0B, 0xFF, 0x00, 0x05, 0x00, 0x17, 0x21, 0x00, 0x08, 0x12, 0x03, 0x00, 0x00,
+	0x0A, 0xFF, 0x00, 0x13, 0x00, 0x00, 0x0A, 0xFF, 0x00, 0x03, 0x00, 0x17, 0x0C, 0x00, 0x00, 0x0B,
+	0xFF, 0x00, 0x0C, 0x00, 0x08, 0x13, 0x01, 0x00, 0x00, 0x09, 0xFF, 0x00, 0x17, 0x00, 0x00, 0x09,
+	0xFF, 0x00, 0x01, 0x00, 0x17, 0x0A, 0x00, 0x00, 0x11, 0xFF, 0x00, 0x0A, 0x00, 0x06, 0x14, 0x08,
+	0xFF, 0x00, 0x19, 0x00, 0x00, 0x08, 0xFF, 0x16, 0x09, 0x00, 0x00, 0x17, 0xFF, 0x00, 0x09, 0x00,
+	0x08, 0x13, 0x08, 0xFF, 0x00, 0x0A, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x0A, 0x00, 0x00, 0x08, 0xFF,
+	0x14, 0x08, 0x00, 0x00, 0x1B, 0xFF, 0x00, 0x08, 0x00, 0x08, 0x12, 0x08, 0xFF, 0x00, 0x08, 0x00,
+	0x00, 0x0D, 0xFF, 0x00, 0x08, 0x00, 0x00, 0x08, 0xFF, 0x12, 0x08, 0x00, 0x00, 0x1D, 0xFF, 0x00,
+	0x08, 0x00, 0x08, 0x11, 0x08, 0xFF, 0x00, 0x07, 0x00, 0x00, 0x11, 0xFF, 0x00, 0x07, 0x00, 0x00,
+	0x08, 0xFF, 0x10, 0x08, 0x00, 0x00, 0x1F, 0xFF, 0x00, 0x08, 0x00, 0x08, 0x11, 0x07, 0xFF, 0x00,
+	0x07, 0x00, 0x00, 0x13, 0xFF, 0x00, 0x07, 0x00, 0x00, 0x07, 0xFF, 0x0F, 0x07, 0x00, 0x00, 0x23,
+	0xFF, 0x00, 0x07, 0x00, 0x08, 0x10, 0x07, 0xFF, 0x00, 0x07, 0x00, 0x00, 0x15, 0xFF, 0x00, 0x07,
+	0x00, 0x00, 0x07, 0xFF, 0x0E, 0x06, 0x00, 0x00, 0x25, 0xFF, 0x00, 0x06, 0x00, 0x09, 0x10, 0x07,
+	0xFF, 0x00, 0x06, 0x00, 0x00, 0x17, 0xFF, 0x00, 0x06, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x02, 0x00,
+	0x0B, 0x06, 0x00, 0x00, 0x27, 0xFF, 0x00, 0x06, 0x00, 0x09, 0x10, 0x06, 0xFF, 0x00, 0x06, 0x00,
+	0x00, 0x19, 0xFF, 0x00, 0x06, 0x00, 0x00, 0x06, 0xFF, 0x00, 0x04, 0x00, 0x08, 0x06, 0x00, 0x00,
+	0x29, 0xFF, 0x00, 0x06, 0x00, 0x09, 0x0F, 0x07, 0xFF, 0x00, 0x05, 0x00, 0x00, 0x1B, 0xFF, 0x00,
+	0x05, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x05, 0x00, 0x05, 0x07, 0x00, 0x00, 0x29, 0xFF, 0x00, 0x07,
+	0x00, 0x09, 0x0F, 0x06, 0xFF, 0x00, 0x06, 0x00, 0x00, 0x1B, 0xFF, 0x00, 0x06, 0x00, 0x00, 0x06,
+	0xFF, 0x00, 0x07, 0x00, 0x03, 0x06, 0x00, 0x00, 0x2B, 0xFF, 0x00, 0x06, 0x00, 0x09, 0x0F, 0x06,
+	0xFF, 0x00, 0x05, 0x00, 0x00, 0x1D, 0xFF, 0x00, 0x05, 0x00, 0x00, 0x06, 0xFF, 0x00, 0x08, 0x00,
+	0x01, 0x06, 0x00, 0x00, 0x2D, 0xFF, 0x00, 0x06, 0x00, 0x08, 0x0E, 0x07, 0xFF, 0x00, 0x05, 0x00,
+	0x00, 0x1D, 0xFF, 0x00, 0x05, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x0D, 0x00, 0x00, 0x2F, 0xFF, 0x00,
+	0x05, 0x00, 0x08, 0x0E, 0x06, 0xFF, 0x00, 0x06, 0x00, 0x00, 0x1D, 0xFF, 0x00, 0x06, 0x00, 0x00,
+	0x07, 0xFF, 0x00, 0x0C, 0x00, 0x00, 0x2F, 0xFF, 0x00, 0x06, 0x00, 0x08, 0x0E, 0x06, 0xFF, 0x00,
+	0x05, 0x00, 0x00, 0x1F, 0xFF, 0x00, 0x05, 0x00, 0x00, 0x09, 0xFF, 0x00, 0x09, 0x00, 0x00, 0x31,
+	0xFF, 0x00, 0x05, 0x00, 0x08, 0x0E, 0x06, 0xFF, 0x00, 0x05, 0x00, 0x00, 0x1F, 0xFF, 0x00, 0x05,
+	0x00, 0x00, 0x0A, 0xFF, 0x00, 0x08, 0x00, 0x00, 0x31, 0xFF, 0x00, 0x05, 0x00, 0x08, 0x0E, 0x06,
+	0xFF, 0x00, 0x05, 0x00, 0x00, 0x1F, 0xFF, 0x00, 0x05, 0x00, 0x00, 0x0B, 0xFF, 0x00, 0x07, 0x00,
+	0x00, 0x31, 0xFF, 0x00, 0x06, 0x00, 0x09, 0x00, 0x0E, 0x00, 0x00, 0x06, 0xFF, 0x00, 0x05, 0x00,
+	0x00, 0x1F, 0xFF, 0x00, 0x05, 0x00, 0x00, 0x06, 0xFF, 0x00, 0x0D, 0x00, 0x00, 0x31, 0xFF, 0x00,
+	0x05, 0x00, 0x09, 0x00, 0x0E, 0x00, 0x00, 0x06, 0xFF, 0x00, 0x05, 0x00, 0x00, 0x1F, 0xFF, 0x00,
+	0x05, 0x00, 0x00, 0x06, 0xFF, 0x00, 0x0D, 0x00, 0x00, 0x31, 0xFF, 0x00, 0x05, 0x00, 0x09, 0x00,
+	0x0E, 0x00, 0x00, 0x06, 0xFF, 0x00, 0x05, 0x00, 0x00, 0x1F, 0xFF, 0x00, 0x05, 0x00, 0x00, 0x06,
+	0xFF, 0x00, 0x0D, 0x00, 0x00, 0x31, 0xFF, 0x00, 0x05, 0x00, 0x09, 0x00, 0x0E, 0x00, 0x00, 0x06,
+	0xFF, 0x00, 0x05, 0x00, 0x00, 0x1F, 0xFF, 0x00, 0x05, 0x00, 0x00, 0x06, 0xFF, 0x00, 0x0D, 0x00,
+	0x00, 0x32, 0xFF, 0x00, 0x05, 0x00, 0x09, 0x00, 0x0E, 0x00, 0x00, 0x06, 0xFF, 0x00, 0x06, 0x00,
+	0x00, 0x1D, 0xFF, 0x00, 0x06, 0x00, 0x00, 0x06, 0xFF, 0x00, 0x0D, 0x00, 0x00, 0x32, 0xFF, 0x00,
+	0x05, 0x00, 0x06, 0x0E, 0x07, 0xFF, 0x00, 0x05, 0x00, 0x00, 0x1D, 0xFF, 0x00, 0x05, 0x00, 0x00,
+	0x46, 0xFF, 0x00, 0x05, 0x00, 0x06, 0x0F, 0x06, 0xFF, 0x00, 0x05, 0x00, 0x00, 0x1D, 0xFF, 0x00,
+	0x05, 0x00, 0x00, 0x46, 0xFF, 0x00, 0x05, 0x00, 0x06, 0x0F, 0x06, 0xFF, 0x00, 0x06, 0x00, 0x00,
+	0x1B, 0xFF, 0x00, 0x06, 0x00, 0x00, 0x46, 0xFF, 0x00, 0x05, 0x00, 0x06, 0x0F, 0x07, 0xFF, 0x00,
+	0x05, 0x00, 0x00, 0x1B, 0xFF, 0x00, 0x05, 0x00, 0x00, 0x47, 0xFF, 0x00, 0x05, 0x00, 0x06, 0x10,
+	0x06, 0xFF, 0x00, 0x06, 0x00, 0x00, 0x19, 0xFF, 0x00, 0x06, 0x00, 0x00, 0x47, 0xFF, 0x00, 0x05,
+	0x00, 0x06, 0x10, 0x07, 0xFF, 0x00, 0x06, 0x00, 0x00, 0x17, 0xFF, 0x00, 0x06, 0x00, 0x00, 0x48,
+	0xFF, 0x00, 0x05, 0x00, 0x06, 0x10, 0x07, 0xFF, 0x00, 0x07, 0x00, 0x00, 0x15, 0xFF, 0x00, 0x07,
+	0x00, 0x00, 0x48, 0xFF, 0x00, 0x05, 0x00, 0x06, 0x11, 0x07, 0xFF, 0x00, 0x07, 0x00, 0x00, 0x13,
+	0xFF, 0x00, 0x07, 0x00, 0x00, 0x49, 0xFF, 0x00, 0x05, 0x00, 0x06, 0x11, 0x08, 0xFF, 0x00, 0x07,
+	0x00, 0x00, 0x11, 0xFF, 0x00, 0x07, 0x00, 0x00, 0x4A, 0xFF, 0x00, 0x05, 0x00, 0x06, 0x12, 0x08,
+	0xFF, 0x00, 0x08, 0x00, 0x00, 0x0D, 0xFF, 0x00, 0x08, 0x00, 0x00, 0x4A, 0xFF, 0x00, 0x06, 0x00,
+	0x07, 0x0F, 0x04, 0x00, 0x00, 0x08, 0xFF, 0x00, 0x0A, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x0A, 0x00,
+	0x00, 0x4B, 0xFF, 0x00, 0x09, 0x00, 0x05, 0x0D, 0x07, 0x00, 0x00, 0x08, 0xFF, 0x00, 0x19, 0x00,
+	0x00, 0x4C, 0xFF, 0x00, 0x0B, 0x00, 0x07, 0x0C, 0x08, 0x00, 0x00, 0x09, 0xFF, 0x00, 0x17, 0x00,
+	0x00, 0x09, 0xFF, 0x00, 0x01, 0x00, 0x00, 0x42, 0xFF, 0x00, 0x0D, 0x00, 0x07, 0x0B, 0x0A, 0x00,
+	0x00, 0x0A, 0xFF, 0x00, 0x13, 0x00, 0x00, 0x0A, 0xFF, 0x00, 0x03, 0x00, 0x00, 0x43, 0xFF, 0x00,
+	0x0C, 0x00, 0x07, 0x0A, 0x0C, 0x00, 0x00, 0x0B, 0xFF, 0x00, 0x0F, 0x00, 0x00, 0x0B, 0xFF, 0x00,
+	0x05, 0x00, 0x00, 0x46, 0xFF, 0x00, 0x09, 0x00, 0x07, 0x09, 0x0E, 0x00, 0x00, 0x0D, 0xFF, 0x00,
+	0x09, 0x00, 0x00, 0x0D, 0xFF, 0x00, 0x07, 0x00, 0x00, 0x48, 0xFF, 0x00, 0x07, 0x00, 0x05, 0x08,
+	0x10, 0x00, 0x00, 0x21, 0xFF, 0x00, 0x09, 0x00, 0x00, 0x48, 0xFF, 0x00, 0x07, 0x00, 0x05, 0x07,
+	0x10, 0x00, 0x00, 0x23, 0xFF, 0x00, 0x09, 0x00, 0x00, 0x48, 0xFF, 0x00, 0x07, 0x00, 0x05, 0x06,
+	0x10, 0x00, 0x00, 0x25, 0xFF, 0x00, 0x09, 0x00, 0x00, 0x48, 0xFF, 0x00, 0x07, 0x00, 0x05, 0x06,
+	0x0F, 0x00, 0x00, 0x27, 0xFF, 0x00, 0x09, 0x00, 0x00, 0x48, 0xFF, 0x00, 0x06, 0x00, 0x05, 0x05,
+	0x0F, 0x00, 0x00, 0x29, 0xFF, 0x00, 0x09, 0x00, 0x00, 0x48, 0xFF, 0x00, 0x06, 0x00, 0x05, 0x05,
+	0x0E, 0x00, 0x00, 0x2B, 0xFF, 0x00, 0x09, 0x00, 0x00, 0x48, 0xFF, 0x00, 0x05, 0x00, 0x09, 0x05,
+	0x05, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x07, 0x00, 0x00, 0x16, 0xFF, 0x00, 0x05, 0x00, 0x00, 0x12,
+	0xFF, 0x00, 0x07, 0x00, 0x00, 0x49, 0xFF, 0x00, 0x05, 0x00, 0x09, 0x04, 0x06, 0x00, 0x00, 0x02,
+	0xFF, 0x00, 0x05, 0x00, 0x00, 0x17, 0xFF, 0x00, 0x05, 0x00, 0x00, 0x13, 0xFF, 0x00, 0x05, 0x00,
+	0x00, 0x4A, 0xFF, 0x00, 0x06, 0x00, 0x09, 0x04, 0x05, 0x00, 0x00, 0x04, 0xFF, 0x00, 0x03, 0x00,
+	0x00, 0x18, 0xFF, 0x00, 0x05, 0x00, 0x00, 0x14, 0xFF, 0x00, 0x03, 0x00, 0x00, 0x4C, 0xFF, 0x00,
+	0x05, 0x00, 0x09, 0x04, 0x05, 0x00, 0x00, 0x05, 0xFF, 0x00, 0x01, 0x00, 0x00, 0x19, 0xFF, 0x00,
+	0x05, 0x00, 0x00, 0x15, 0xFF, 0x00, 0x01, 0x00, 0x00, 0x4D, 0xFF, 0x00, 0x05, 0x00, 0x05, 0x04,
+	0x05, 0x00, 0x00, 0x1F, 0xFF, 0x00, 0x05, 0x00, 0x00, 0x63, 0xFF, 0x00, 0x05, 0x00, 0x05, 0x04,
+	0x05, 0x00, 0x00, 0x1F, 0xFF, 0x00, 0x05, 0x00, 0x00, 0x63, 0xFF, 0x00, 0x05, 0x00, 0x05, 0x04,
+	0x05, 0x00, 0x00, 0x1F, 0xFF, 0x00, 0x05, 0x00, 0x00, 0x63, 0xFF, 0x00, 0x05, 0x00, 0x05, 0x04,
+	0x05, 0x00, 0x00, 0x1F, 0xFF, 0x00, 0x05, 0x00, 0x00, 0x63, 0xFF, 0x00, 0x05, 0x00, 0x05, 0x04,
+	0x05, 0x00, 0x00, 0x1F, 0xFF, 0x00, 0x05, 0x00, 0x00, 0x63, 0xFF, 0x00, 0x05, 0x00, 0x05, 0x04,
+	0x06, 0x00, 0x00, 0x1E, 0xFF, 0x00, 0x05, 0x00, 0x00, 0x62, 0xFF, 0x00, 0x06, 0x00, 0x05, 0x05,
+	0x05, 0x00, 0x00, 0x1E, 0xFF, 0x00, 0x05, 0x00, 0x00, 0x62, 0xFF, 0x00, 0x05, 0x00, 0x05, 0x05,
+	0x05, 0x00, 0x00, 0x1E, 0xFF, 0x00, 0x05, 0x00, 0x00, 0x62, 0xFF, 0x00, 0x05, 0x00, 0x05, 0x05,
+	0x06, 0x00, 0x00, 0x1D, 0xFF, 0x00, 0x05, 0x00, 0x00, 0x61, 0xFF, 0x00, 0x06, 0x00, 0x03, 0x06,
+	0x06, 0x00, 0x00, 0x81, 0xFF, 0x00, 0x06, 0x00, 0x03, 0x06, 0x07, 0x00, 0x00, 0x7F, 0xFF, 0x00,
+	0x07, 0x00, 0x03, 0x07, 0x07, 0x00, 0x00, 0x7D, 0xFF, 0x00, 0x07, 0x00, 0x03, 0x08, 0x07, 0x00,
+	0x00, 0x7B, 0xFF, 0x00, 0x07, 0x00, 0x03, 0x09, 0x07, 0x00, 0x00, 0x79, 0xFF, 0x00, 0x07, 0x00,
+	0x03, 0x0A, 0x09, 0x00, 0x00, 0x73, 0xFF, 0x00, 0x09, 0x00, 0x01, 0x0B, 0x83, 0x00, 0x01, 0x0C,
+	0x81, 0x00, 0x01, 0x0D, 0x7F, 0x00, 0x01, 0x0F, 0x7B, 0x00, 0x01, 0x12, 0x75, 0x00,
+};
+constexpr uint8_t IconSprite_02d_S_runs[] = {
+	0x01, 0x14, 0x05, 0x00, 0x01, 0x14, 0x05, 0x00, 0x01, 0x14, 0x05, 0x00, 0x01, 0x14, 0x05, 0x00,
+	0x03, 0x08, 0x01, 0x00, 0x0B, 0x05, 0x00, 0x07, 0x01, 0x00, 0x03, 0x07, 0x03, 0x00, 0x0A, 0x05,
+	0x00, 0x06, 0x03, 0x00, 0x03, 0x06, 0x05, 0x00, 0x09, 0x05, 0x00, 0x05, 0x05, 0x00, 0x04, 0x05,
+	0x07, 0x00, 0x05, 0x07, 0xFF, 0x00, 0x01, 0x00, 0x04, 0x07, 0x00, 0x03, 0x04, 0x09, 0x00, 0x01,
+	0x0D, 0xFF, 0x01, 0x09, 0x00, 0x03, 0x05, 0x08, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x08, 0x00, 0x05,
+	0x06, 0x06, 0x00, 0x00, 0x05, 0xFF, 0x00, 0x07, 0x00, 0x00, 0x05, 0xFF, 0x00, 0x06, 0x00, 0x06,
+	0x07, 0x04, 0x00, 0x00, 0x04, 0xFF, 0x00, 0x0B, 0x00, 0x00, 0x04, 0xFF, 0x00, 0x04, 0x00, 0x0D,
+	0x07, 0x00, 0x06, 0x08, 0x02, 0x00, 0x00, 0x04, 0xFF, 0x00, 0x0D, 0x00, 0x00, 0x04, 0xFF, 0x00,
+	0x02, 0x00, 0x0B, 0x0D, 0x00, 0x04, 0x09, 0x04, 0xFF, 0x00, 0x0F, 0x00, 0x00, 0x04, 0xFF, 0x0B,
+	0x0F, 0x00, 0x04, 0x08, 0x04, 0xFF, 0x00, 0x11, 0x00, 0x00, 0x04, 0xFF, 0x08, 0x13, 0x00, 0x06,
+	0x08, 0x03, 0xFF, 0x00, 0x07, 0x00, 0x00, 0x05, 0xFF, 0x00, 0x07, 0x00, 0x00, 0x03, 0xFF, 0x07,
+	0x15, 0x00, 0x08, 0x08, 0x03, 0xFF, 0x00, 0x06, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x06, 0x00, 0x00,
+	0x03, 0xFF, 0x06, 0x09, 0x00, 0x00, 0x05, 0xFF, 0x00, 0x09, 0x00, 0x08, 0x07, 0x03, 0xFF, 0x00,
+	0x06, 0x00, 0x00, 0x09, 0xFF, 0x00, 0x06, 0x00, 0x00, 0x03, 0xFF, 0x05, 0x07, 0x00, 0x00, 0x09,
+	0xFF, 0x00, 0x07, 0x00, 0x09, 0x07, 0x03, 0xFF, 0x00, 0x05, 0x00, 0x00, 0x0B, 0xFF, 0x00, 0x05,
+	0x00, 0x00, 0x03, 0xFF, 0x00, 0x02, 0x00, 0x02, 0x06, 0x00, 0x00, 0x0D, 0xFF, 0x00, 0x06, 0x00,
+	0x08, 0x07, 0x03, 0xFF, 0x00, 0x05, 0x00, 0x00, 0x0B, 0xFF, 0x00, 0x05, 0x00, 0x00, 0x03, 0xFF,
+	0x00, 0x09, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x06, 0x00, 0x09, 0x00, 0x07, 0x00, 0x00, 0x03, 0xFF,
+	0x00, 0x05, 0x00, 0x00, 0x0B, 0xFF, 0x00, 0x05, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x09, 0x00, 0x00,
+	0x0F, 0xFF, 0x00, 0x06, 0x00, 0x09, 0x00, 0x07, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x05, 0x00, 0x00,
+	0x0B, 0xFF, 0x00, 0x05, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x08, 0x00, 0x00, 0x11, 0xFF, 0x00, 0x05,
+	0x00, 0x09, 0x00, 0x07, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x05, 0x00, 0x00, 0x0B, 0xFF, 0x00, 0x05,
+	0x00, 0x00, 0x03, 0xFF, 0x00, 0x08, 0x00, 0x00, 0x11, 0xFF, 0x00, 0x06, 0x00, 0x09, 0x00, 0x07,
+	0x00, 0x00, 0x03, 0xFF, 0x00, 0x06, 0x00, 0x00, 0x09, 0xFF, 0x00, 0x06, 0x00, 0x00, 0x03, 0xFF,
+	0x00, 0x07, 0x00, 0x00, 0x13, 0xFF, 0x00, 0x05, 0x00, 0x09, 0x00, 0x08, 0x00, 0x00, 0x03, 0xFF,
+	0x00, 0x06, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x06, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x08, 0x00, 0x00,
+	0x13, 0xFF, 0x00, 0x05, 0x00, 0x08, 0x08, 0x03, 0xFF, 0x00, 0x07, 0x00, 0x00, 0x05, 0xFF, 0x00,
+	0x07, 0x00, 0x00, 0x06, 0xFF, 0x00, 0x05, 0x00, 0x00, 0x13, 0xFF, 0x00, 0x05, 0x00, 0x06, 0x08,
+	0x04, 0xFF, 0x00, 0x11, 0x00, 0x00, 0x08, 0xFF, 0x00, 0x04, 0x00, 0x00, 0x13, 0xFF, 0x00, 0x05,
+	0x00, 0x06, 0x09, 0x04, 0xFF, 0x00, 0x0F, 0x00, 0x00, 0x09, 0xFF, 0x00, 0x04, 0x00, 0x00, 0x13,
+	0xFF, 0x00, 0x05, 0x00, 0x09, 0x08, 0x02, 0x00, 0x00, 0x04, 0xFF, 0x00, 0x0D, 0x00, 0x00, 0x04,
+	0xFF, 0x00, 0x02, 0x00, 0x00, 0x04, 0xFF, 0x00, 0x05, 0x00, 0x00, 0x11, 0xFF, 0x00, 0x06, 0x00,
+	0x09, 0x07, 0x04, 0x00, 0x00, 0x04, 0xFF, 0x00, 0x0B, 0x00, 0x00, 0x04, 0xFF, 0x00, 0x04, 0x00,
+	0x00, 0x03, 0xFF, 0x00, 0x05, 0x00, 0x00, 0x11, 0xFF, 0x00, 0x08, 0x00, 0x09, 0x06, 0x06, 0x00,
+	0x00, 0x05, 0xFF, 0x00, 0x07, 0x00, 0x00, 0x05, 0xFF, 0x00, 0x06, 0x00, 0x00, 0x02, 0xFF, 0x00,
+	0x06, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x0A, 0x00, 0x05, 0x05, 0x08, 0x00, 0x00, 0x0F, 0xFF, 0x00,
+	0x0F, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x0B, 0x00, 0x05, 0x04, 0x0A, 0x00, 0x00, 0x0E, 0xFF, 0x00,
+	0x09, 0x00, 0x00, 0x1A, 0xFF, 0x00, 0x07, 0x00, 0x07, 0x05, 0x08, 0x00, 0x00, 0x0B, 0xFF, 0x00,
+	0x01, 0x00, 0x00, 0x04, 0xFF, 0x00, 0x07, 0x00, 0x00, 0x1C, 0xFF, 0x00, 0x06, 0x00, 0x07, 0x06,
+	0x06, 0x00, 0x00, 0x08, 0xFF, 0x00, 0x05, 0x00, 0x00, 0x05, 0xFF, 0x00, 0x05, 0x00, 0x00, 0x1E,
+	0xFF, 0x00, 0x06, 0x00, 0x07, 0x06, 0x05, 0x00, 0x00, 0x09, 0xFF, 0x00, 0x05, 0x00, 0x00, 0x06,
+	0xFF, 0x00, 0x03, 0x00, 0x00, 0x20, 0xFF, 0x00, 0x05, 0x00, 0x07, 0x06, 0x05, 0x00, 0x00, 0x09,
+	0xFF, 0x00, 0x05, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x01, 0x00, 0x00, 0x21, 0xFF, 0x00, 0x05, 0x00,
+	0x05, 0x06, 0x05, 0x00, 0x00, 0x09, 0xFF, 0x00, 0x05, 0x00, 0x00, 0x29, 0xFF, 0x00, 0x05, 0x00,
+	0x05, 0x06, 0x06, 0x00, 0x00, 0x08, 0xFF, 0x00, 0x05, 0x00, 0x00, 0x28, 0xFF, 0x00, 0x06, 0x00,
+	0x05, 0x07, 0x06, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x05, 0x00, 0x00, 0x27, 0xFF, 0x00, 0x06, 0x00,
+	0x01, 0x07, 0x3F, 0x00, 0x01, 0x08, 0x3D, 0x00, 0x01, 0x09, 0x3B, 0x00, 0x01, 0x0A, 0x39, 0x00,
+	0x01, 0x0C, 0x35, 0x00,
+};
+constexpr uint8_t IconSprite_02n_L_runs[] = {
+	0x01, 0xB1, 0x07, 0xFF, 0x01, 0xAE, 0x0D, 0xFF, 0x01, 0xAC, 0x11, 0xFF, 0x01, 0xAB, 0x13, 0xFF,
+	0x01, 0xA9, 0x17, 0xFF, 0x01, 0xA8, 0x19, 0xFF, 0x03, 0x28, 0x05, 0x00, 0x78, 0x03, 0x00, 0x00,
+	0x19, 0xFF, 0x03, 0x28, 0x05, 0x00, 0x76, 0x04, 0x00, 0x00, 0x1B, 0xFF, 0x03, 0x28, 0x05, 0x00,
+	0x75, 0x04, 0x00, 0x00, 0x1D, 0xFF, 0x03, 0x28, 0x05, 0x00, 0x74, 0x05, 0x00, 0x00, 0x1D, 0xFF,
+	0x03, 0x28, 0x05, 0x00, 0x73, 0x05, 0x00, 0x00, 0x1F, 0xFF, 0x03, 0x28, 0x05, 0x00, 0x72, 0x06,
+	0x00, 0x00, 0x1F, 0xFF, 0x03, 0x28, 0x05, 0x00, 0x72, 0x06, 0x00, 0x00, 0x1F, 0xFF, 0x03, 0x28,
+	0x05, 0x00, 0x71, 0x06, 0x00, 0x00, 0x21, 0xFF, 0x03, 0x28, 0x05, 0x00, 0x71, 0x06, 0x00, 0x00,
+	0x21, 0xFF, 0x03, 0x28, 0x05, 0x00, 0x71, 0x06, 0x00, 0x00, 0x21, 0xFF, 0x05, 0x0E, 0x01, 0x00,
+	0x19, 0x05, 0x00, 0x15, 0x01, 0x00, 0x5B, 0x06, 0x00, 0x00, 0x21, 0xFF, 0x05, 0x0D, 0x03, 0x00,
+	0x18, 0x05, 0x00, 0x14, 0x03, 0x00, 0x5A, 0x06, 0x00, 0x00, 0x21, 0xFF, 0x05, 0x0C, 0x05, 0x00,
+	0x17, 0x05, 0x00, 0x13, 0x05, 0x00, 0x59, 0x06, 0x00, 0x00, 0x21, 0xFF, 0x05, 0x0B, 0x07, 0x00,
+	0x16, 0x05, 0x00, 0x12, 0x07, 0x00, 0x58, 0x06, 0x00, 0x00, 0x21, 0xFF, 0x05, 0x0A, 0x09, 0x00,
+	0x10, 0x0B, 0xFF, 0x10, 0x09, 0x00, 0x58, 0x06, 0x00, 0x00, 0x1F, 0xFF, 0x05, 0x0B, 0x09, 0x00,
+	0x0C, 0x11, 0xFF, 0x0C, 0x09, 0x00, 0x59, 0x06, 0x00, 0x00, 0x1F, 0xFF, 0x05, 0x0C, 0x09, 0x00,
+	0x08, 0x17, 0xFF, 0x08, 0x09, 0x00, 0x5B, 0x05, 0x00, 0x00, 0x1F, 0xFF, 0x06, 0x0D, 0x09, 0x00,
+	0x05, 0x1B, 0xFF, 0x05, 0x09, 0x00, 0x1E, 0x0B, 0x00, 0x34, 0x05, 0x00, 0x00, 0x1D, 0xFF, 0x06,
+	0x0E, 0x09, 0x00, 0x03, 0x1D, 0xFF, 0x03, 0x09, 0x00, 0x1B, 0x13, 0x00, 0x31, 0x04, 0x00, 0x00,
+	0x1D, 0xFF, 0x06, 0x0F, 0x09, 0x00, 0x01, 0x1F, 0xFF, 0x01, 0x09, 0x00, 0x19, 0x19, 0x00, 0x2F,
+	0x04, 0x00, 0x00, 0x1B, 0xFF, 0x08, 0x10, 0x07, 0x00, 0x00, 0x0D, 0xFF, 0x00, 0x09, 0x00, 0x00,
+	0x0D, 0xFF, 0x00, 0x07, 0x00, 0x18, 0x1D, 0x00, 0x2F, 0x03, 0x00, 0x00, 0x19, 0xFF, 0x07, 0x11,
+	0x05, 0x00, 0x00, 0x0B, 0xFF, 0x00, 0x0F, 0x00, 0x00, 0x0B, 0xFF, 0x00, 0x05, 0x00, 0x17, 0x21,
+	0x00, 0x30, 0x19, 0xFF, 0x09, 0x12, 0x03, 0x00, 0x00, 0x0A, 0xFF, 0x00, 0x13, 0x00, 0x00, 0x0A,
+	0xFF, 0x00, 0x03, 0x00, 0x17, 0x0C, 0x00, 0x00, 0x0B, 0xFF, 0x00, 0x0C, 0x00, 0x30, 0x17, 0xFF,
+	0x09, 0x13, 0x01, 0x00, 0x00, 0x09, 0xFF, 0x00, 0x17, 0x00, 0x00, 0x09, 0xFF, 0x00, 0x01, 0x00,
+	0x17, 0x0A, 0x00, 0x00, 0x11, 0xFF, 0x00, 0x0A, 0x00, 0x31, 0x13, 0xFF, 0x07, 0x14, 0x08, 0xFF,
+	0x00, 0x19, 0x00, 0x00, 0x08, 0xFF, 0x16, 0x09, 0x00, 0x00, 0x17, 0xFF, 0x00, 0x09, 0x00, 0x30,
+	0x11, 0xFF, 0x09, 0x13, 0x08, 0xFF, 0x00, 0x0A, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x0A, 0x00, 0x00,
+	0x08, 0xFF, 0x14, 0x08, 0x00, 0x00, 0x1B, 0xFF, 0x00, 0x08, 0x00, 0x31, 0x0D, 0xFF, 0x09, 0x12,
+	0x08, 0xFF, 0x00, 0x08, 0x00, 0x00, 0x0D, 0xFF, 0x00, 0x08, 0x00, 0x00, 0x08, 0xFF, 0x12, 0x08,
+	0x00, 0x00, 0x1D, 0xFF, 0x00, 0x08, 0x00, 0x33, 0x07, 0xFF, 0x08, 0x11, 0x08, 0xFF, 0x00, 0x07,
+	0x00, 0x00, 0x11, 0xFF, 0x00, 0x07, 0x00, 0x00, 0x08, 0xFF, 0x10, 0x08, 0x00, 0x00, 0x1F, 0xFF,
+	0x00, 0x08, 0x00, 0x08, 0x11, 0x07, 0xFF, 0x00, 0x07, 0x00, 0x00, 0x13, 0xFF, 0x00, 0x07, 0x00,
+	0x00, 0x07, 0xFF, 0x0F, 0x07, 0x00, 0x00, 0x23, 0xFF, 0x00, 0x07, 0x00, 0x08, 0x10, 0x07, 0xFF,
+	0x00, 0x07, 0x00, 0x00, 0x15, 0xFF, 0x00, 0x07, 0x00, 0x00, 0x07, 0xFF, 0x0E, 0x06, 0x00, 0x00,
+	0x25, 0xFF, 0x00, 0x06, 0x00, 0x09, 0x10, 0x07, 0xFF, 0x00, 0x06, 0x00, 0x00, 0x17, 0xFF, 0x00,
+	0x06, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x02, 0x00, 0x0B, 0x06, 0x00, 0x00, 0x27, 0xFF, 0x00, 0x06,
+	0x00, 0x09, 0x10, 0x06, 0xFF, 0x00, 0x06, 0x00, 0x00, 0x19, 0xFF, 0x00, 0x06, 0x00, 0x00, 0x06,
+	0xFF, 0x00, 0x04, 0x00, 0x08, 0x06, 0x00, 0x00, 0x29, 0xFF, 0x00, 0x06, 0x00, 0x09, 0x0F, 0x07,
+	0xFF, 0x00, 0x05, 0x00, 0x00, 0x1B, 0xFF, 0x00, 0x05, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x05, 0x00,
+	0x05, 0x07, 0x00, 0x00, 0x29, 0xFF, 0x00, 0x07, 0x00, 0x09, 0x0F, 0x06, 0xFF, 0x00, 0x06, 0x00,
+	0x00, 0x1B, 0xFF, 0x00, 0x06, 0x00, 0x00, 0x06, 0xFF, 0x00, 0x07, 0x00, 0x03, 0x06, 0x00, 0x00,
+	0x2B, 0xFF, 0x00, 0x06, 0x00, 0x09, 0x0F, 0x06, 0xFF, 0x00, 0x05, 0x00, 0x00, 0x1D, 0xFF, 0x00,
+	0x05, 0x00, 0x00, 0x06, 0xFF, 0x00, 0x08, 0x00, 0x01, 0x06, 0x00, 0x00, 0x2D, 0xFF, 0x00, 0x06,
+	0x00, 0x08, 0x0E, 0x07, 0xFF, 0x00, 0x05, 0x00, 0x00, 0x1D, 0xFF, 0x00, 0x05, 0x00, 0x00, 0x07,
+	0xFF, 0x00, 0x0D, 0x00, 0x00, 0x2F, 0xFF, 0x00, 0x05, 0x00, 0x08, 0x0E, 0x06, 0xFF, 0x00, 0x06,
+	0x00, 0x00, 0x1D, 0xFF, 0x00, 0x06, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x0C, 0x00, 0x00, 0x2F, 0xFF,
+	0x00, 0x06, 0x00, 0x08, 0x0E, 0x06, 0xFF, 0x00, 0x05, 0x00, 0x00, 0x1F, 0xFF, 0x00, 0x05, 0x00,
+	0x00, 0x09, 0xFF, 0x00, 0x09, 0x00, 0x00, 0x31, 0xFF, 0x00, 0x05, 0x00, 0x08, 0x0E, 0x06, 0xFF,
+	0x00, 0x05, 0x00, 0x00, 0x1F, 0xFF, 0x00, 0x05, 0x00, 0x00, 0x0A, 0xFF, 0x00, 0x08, 0x00, 0x00,
+	0x31, 0xFF, 0x00, 0x05, 0x00, 0x08, 0x0E, 0x06, 0xFF, 0x00, 0x05, 0x00, 0x00, 0x1F, 0xFF, 0x00,
+	0x05, 0x00, 0x00, 0x0B, 0xFF, 0x00, 0x07, 0x00, 0x00, 0x31, 0xFF, 0x00, 0x06, 0x00, 0x09, 0x00,
+	0x0E, 0x00, 0x00, 0x06, 0xFF, 0x00, 0x05, 0x00, 0x00, 0x1F, 0xFF, 0x00, 0x05, 0x00, 0x00, 0x06,
+	0xFF, 0x00, 0x0D, 0x00, 0x00, 0x31, 0xFF, 0x00, 0x05, 0x00, 0x09, 0x00, 0x0E, 0x00, 0x00, 0x06,
+	0xFF, 0x00, 0x05, 0x00, 0x00, 0x1F, 0xFF, 0x00, 0x05, 0x00, 0x00, 0x06, 0xFF, 0x00, 0x0D, 0x00,
+	0x00, 0x31, 0xFF, 0x00, 0x05, 0x00, 0x09, 0x00, 0x0E, 0x00, 0x00, 0x06, 0xFF, 0x00, 0x05, 0x00,
+	0x00, 0x1F, 0xFF, 0x00, 0x05, 0x00, 0x00, 0x06, 0xFF, 0x00, 0x0D, 0x00, 0x00, 0x31, 0xFF, 0x00,
+	0x05, 0x00, 0x09, 0x00, 0x0E, 0x00, 0x00, 0x06, 0xFF, 0x00, 0x05, 0x00, 0x00, 0x1F, 0xFF, 0x00,
+	0x05, 0x00, 0x00, 0x06, 0xFF, 0x00, 0x0D, 0x00, 0x00, 0x32, 0xFF, 0x00, 0x05, 0x00, 0x09, 0x00,
+	0x0E, 0x00, 0x00, 0x06, 0xFF, 0x00, 0x06, 0x00, 0x00, 0x1D, 0xFF, 0x00, 0x06, 0x00, 0x00, 0x06,
+	0xFF, 0x00, 0x0D, 0x00, 0x00, 0x32, 0xFF, 0x00, 0x05, 0x00, 0x06, 0x0E, 0x07, 0xFF, 0x00, 0x05,
+	0x00, 0x00, 0x1D, 0xFF, 0x00, 0x05, 0x00, 0x00, 0x46, 0xFF, 0x00, 0x05, 0x00, 0x06, 0x0F, 0x06,
+	0xFF, 0x00, 0x05, 0x00, 0x00, 0x1D, 0xFF, 0x00, 0x05, 0x00, 0x00, 0x46, 0xFF, 0x00, 0x05, 0x00,
+	0x06, 0x0F, 0x06, 0xFF, 0x00, 0x06, 0x00, 0x00, 0x1B, 0xFF, 0x00, 0x06, 0x00, 0x00, 0x46, 0xFF,
+	0x00, 0x05, 0x00, 0x06, 0x0F, 0x07, 0xFF, 0x00, 0x05, 0x00, 0x00, 0x1B, 0xFF, 0x00, 0x05, 0x00,
+	0x00, 0x47, 0xFF, 0x00, 0x05, 0x00, 0x06, 0x10, 0x06, 0xFF, 0x00, 0x06, 0x00, 0x00, 0x19, 0xFF,
+	0x00, 0x06, 0x00, 0x00, 0x47, 0xFF, 0x00, 0x05, 0x00, 0x06, 0x10, 0x07, 0xFF, 0x00, 0x06, 0x00,
+	0x00, 0x17, 0xFF, 0x00, 0x06, 0x00, 0x00, 0x48, 0xFF, 0x00, 0x05, 0x00, 0x06, 0x10, 0x07, 0xFF,
+	0x00, 0x07, 0x00, 0x00, 0x15, 0xFF, 0x00, 0x07, 0x00, 0x00, 0x48, 0xFF, 0x00, 0x05, 0x00, 0x06,
+	0x11, 0x07, 0xFF, 0x00, 0x07, 0x00, 0x00, 0x13, 0xFF, 0x00, 0x07, 0x00, 0x00, 0x49, 0xFF, 0x00,
+	0x05, 0x00, 0x06, 0x11, 0x08, 0xFF, 0x00, 0x07, 0x00, 0x00, 0x11, 0xFF, 0x00, 0x07, 0x00, 0x00,
+	0x4A, 0xFF, 0x00, 0x05, 0x00, 0x06, 0x12, 0x08, 0xFF, 0x00, 0x08, 0x00, 0x00, 0x0D, 0xFF, 0x00,
+	0x08, 0x00, 0x00, 0x4A, 0xFF, 0x00, 0x06, 0x00, 0x07, 0x0F, 0x04, 0x00, 0x00, 0x08, 0xFF, 0x00,
+	0x0A, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x0A, 0x00, 0x00, 0x4B, 0xFF, 0x00, 0x09, 0x00, 0x05, 0x0D,
+	0x07, 0x00, 0x00, 0x08, 0xFF, 0x00, 0x19, 0x00, 0x00, 0x4C, 0xFF, 0x00, 0x0B, 0x00, 0x07, 0x0C,
+	0x08, 0x00, 0x00, 0x09, 0xFF, 0x00, 0x17, 0x00, 0x00, 0x09, 0xFF, 0x00, 0x01, 0x00, 0x00, 0x42,
+	0xFF, 0x00, 0x0D, 0x00, 0x07, 0x0B, 0x0A, 0x00, 0x00, 0x0A, 0xFF, 0x00, 0x13, 0x00, 0x00, 0x0A,
+	0xFF, 0x00, 0x03, 0x00, 0x00, 0x43, 0xFF, 0x00, 0x0C, 0x00, 0x07, 0x0A, 0x0C, 0x00, 0x00, 0x0B,
+	0xFF, 0x00, 0x0F, 0x00, 0x00, 0x0B, 0xFF, 0x00, 0x05, 0x00, 0x00, 0x46, 0xFF, 0x00, 0x09, 0x00,
+	0x07, 0x09, 0x0E, 0x00, 0x00, 0x0D, 0xFF, 0x00, 0x09, 0x00, 0x00, 0x0D, 0xFF, 0x00, 0x07, 0x00,
+	0x00, 0x48, 0xFF, 0x00, 0x07, 0x00, 0x05, 0x08, 0x10, 0x00, 0x00, 0x21, 0xFF, 0x00, 0x09, 0x00,
+	0x00, 0x48, 0xFF, 0x00, 0x07, 0x00, 0x05, 0x07, 0x10, 0x00, 0x00, 0x23, 0xFF, 0x00, 0x09, 0x00,
+	0x00, 0x48, 0xFF, 0x00, 0x07, 0x00, 0x05, 0x06, 0x10, 0x00, 0x00, 0x25, 0xFF, 0x00, 0x09, 0x00,
+	0x00, 0x48, 0xFF, 0x00, 0x07, 0x00, 0x05, 0x06, 0x0F, 0x00, 0x00, 0x27, 0xFF, 0x00, 0x09, 0x00,
+	0x00, 0x48, 0xFF, 0x00, 0x06, 0x00, 0x05, 0x05, 0x0F, 0x00, 0x00, 0x29, 0xFF, 0x00, 0x09, 0x00,
+	0x00, 0x48, 0xFF, 0x00, 0x06, 0x00, 0x05, 0x05, 0x0E, 0x00, 0x00, 0x2B, 0xFF, 0x00, 0x09, 0x00,
+	0x00, 0x48, 0xFF, 0x00, 0x05, 0x00, 0x09, 0x05, 0x05, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x07, 0x00,
+	0x00, 0x16, 0xFF, 0x00, 0x05, 0x00, 0x00, 0x12, 0xFF, 0x00, 0x07, 0x00, 0x00, 0x49, 0xFF, 0x00,
+	0x05, 0x00, 0x09, 0x04, 0x06, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x05, 0x00, 0x00, 0x17, 0xFF, 0x00,
+	0x05, 0x00, 0x00, 0x13, 0xFF, 0x00, 0x05, 0x00, 0x00, 0x4A, 0xFF, 0x00, 0x06, 0x00, 0x09, 0x04,
+	0x05, 0x00, 0x00, 0x04, 0xFF, 0x00, 0x03, 0x00, 0x00, 0x18, 0xFF, 0x00, 0x05, 0x00, 0x00, 0x14,
+	0xFF, 0x00, 0x03, 0x00, 0x00, 0x4C, 0xFF, 0x00, 0x05, 0x00, 0x09, 0x04, 0x05, 0x00, 0x00, 0x05,
+	0xFF, 0x00, 0x01, 0x00, 0x00, 0x19, 0xFF, 0x00, 0x05, 0x00, 0x00, 0x15, 0xFF, 0x00, 0x01, 0x00,
+	0x00, 0x4D, 0xFF, 0x00, 0x05, 0x00, 0x05, 0x04, 0x05, 0x00, 0x00, 0x1F, 0xFF, 0x00, 0x05, 0x00,
+	0x00, 0x63, 0xFF, 0x00, 0x05, 0x00, 0x05, 0x04, 0x05, 0x00, 0x00, 0x1F, 0xFF, 0x00, 0x05, 0x00,
+	0x00, 0x63, 0xFF, 0x00, 0x05, 0x00, 0x05, 0x04, 0x05, 0x00, 0x00, 0x1F, 0xFF, 0x00, 0x05, 0x00,
+	0x00, 0x63, 0xFF, 0x00, 0x05, 0x00, 0x05, 0x04, 0x05, 0x00, 0x00, 0x1F, 0xFF, 0x00, 0x05, 0x00,
+	0x00, 0x63, 0xFF, 0x00, 0x05, 0x00, 0x05, 0x04, 0x05, 0x00, 0x00, 0x1F, 0xFF, 0x00, 0x05, 0x00,
+	0x00, 0x63, 0xFF, 0x00, 0x05, 0x00, 0x05, 0x04, 0x06, 0x00, 0x00, 0x1E, 0xFF, 0x00, 0x05, 0x00,
+	0x00, 0x62, 0xFF, 0x00, 0x06, 0x00, 0x05, 0x05, 0x05, 0x00, 0x00, 0x1E, 0xFF, 0x00, 0x05, 0x00,
+	0x00, 0x62, 0xFF, 0x00, 0x05, 0x00, 0x05, 0x05, 0x05, 0x00, 0x00, 0x1E, 0xFF, 0x00, 0x05, 0x00,
+	0x00, 0x62, 0xFF, 0x00, 0x05, 0x00, 0x05, 0x05, 0x06, 0x00, 0x00, 0x1D, 0xFF, 0x00, 0x05, 0x00,
+	0x00, 0x61, 0xFF, 0x00, 0x06, 0x00, 0x03, 0x06, 0x06, 0x00, 0x00, 0x81, 0xFF, 0x00, 0x06, 0x00,
+	0x03, 0x06, 0x07, 0x00, 0x00, 0x7F, 0xFF, 0x00, 0x07, 0x00, 0x03, 0x07, 0x07, 0x00, 0x00, 0x7D,
+	0xFF, 0x00, 0x07, 0x00, 0x03, 0x08, 0x07, 0x00, 0x00, 0x7B, 0xFF, 0x00, 0x07, 0x00, 0x03, 0x09,
+	0x07, 0x00, 0x00, 0x79, 0xFF, 0x00, 0x07, 0x00, 0x03, 0x0A, 0x09, 0x00, 0x00, 0x73, 0xFF, 0x00,
+	0x09, 0x00, 0x01, 0x0B, 0x83, 0x00, 0x01, 0x0C, 0x81, 0x00, 0x01, 0x0D, 0x7F, 0x00, 0x01, 0x0F,
+	0x7B, 0x00, 0x01, 0x12, 0x75, 0x00,
+};
+constexpr uint8_t IconSprite_02n_S_runs[] = {
+	0x01, 0x54, 0x07, 0xFF, 0x01, 0x51, 0x0D, 0xFF, 0x01, 0x4F, 0x11, 0xFF, 0x01, 0x4E, 0x13, 0xFF,
+	0x01, 0x4C, 0x17, 0xFF, 0x01, 0x4B, 0x19, 0xFF, 0x02, 0x48, 0x03, 0x00, 0x00, 0x19, 0xFF, 0x02,
+	0x46, 0x04, 0x00, 0x00, 0x1B, 0xFF, 0x02, 0x45, 0x04, 0x00, 0x00, 0x1D, 0xFF, 0x02, 0x44, 0x05,
+	0x00, 0x00, 0x1D, 0xFF, 0x02, 0x43, 0x05, 0x00, 0x00, 0x1F, 0xFF, 0x02, 0x42, 0x06, 0x00, 0x00,
+	0x1F, 0xFF, 0x02, 0x42, 0x06, 0x00, 0x00, 0x1F, 0xFF, 0x02, 0x41, 0x06, 0x00, 0x00, 0x21, 0xFF,
+	0x02, 0x41, 0x06, 0x00, 0x00, 0x21, 0xFF, 0x02, 0x41, 0x06, 0x00, 0x00, 0x21, 0xFF, 0x02, 0x41,
+	0x06, 0x00, 0x00, 0x21, 0xFF, 0x02, 0x41, 0x06, 0x00, 0x00, 0x21, 0xFF, 0x02, 0x41, 0x06, 0x00,
+	0x00, 0x21, 0xFF, 0x02, 0x41, 0x06, 0x00, 0x00, 0x21, 0xFF, 0x03, 0x14, 0x05, 0x00, 0x29, 0x06,
+	0x00, 0x00, 0x1F, 0xFF, 0x03, 0x14, 0x05, 0x00, 0x29, 0x06, 0x00, 0x00, 0x1F, 0xFF, 0x03, 0x14,
+	0x05, 0x00, 0x2A, 0x05, 0x00, 0x00, 0x1F, 0xFF, 0x03, 0x14, 0x05, 0x00, 0x2B, 0x05, 0x00, 0x00,
+	0x1D, 0xFF, 0x05, 0x08, 0x01, 0x00, 0x0B, 0x05, 0x00, 0x07, 0x01, 0x00, 0x24, 0x04, 0x00, 0x00,
+	0x1D, 0xFF, 0x05, 0x07, 0x03, 0x00, 0x0A, 0x05, 0x00, 0x06, 0x03, 0x00, 0x24, 0x04, 0x00, 0x00,
+	0x1B, 0xFF, 0x05, 0x06, 0x05, 0x00, 0x09, 0x05, 0x00, 0x05, 0x05, 0x00, 0x25, 0x03, 0x00, 0x00,
+	0x19, 0xFF, 0x05, 0x05, 0x07, 0x00, 0x05, 0x07, 0xFF, 0x00, 0x01, 0x00, 0x04, 0x07, 0x00, 0x27,
+	0x19, 0xFF, 0x04, 0x04, 0x09, 0x00, 0x01, 0x0D, 0xFF, 0x01, 0x09, 0x00, 0x27, 0x17, 0xFF, 0x04,
+	0x05, 0x08, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x08, 0x00, 0x2A, 0x13, 0xFF, 0x06, 0x06, 0x06, 0x00,
+	0x00, 0x05, 0xFF, 0x00, 0x07, 0x00, 0x00, 0x05, 0xFF, 0x00, 0x06, 0x00, 0x2C, 0x11, 0xFF, 0x07,
+	0x07, 0x04, 0x00, 0x00, 0x04, 0xFF, 0x00, 0x0B, 0x00, 0x00, 0x04, 0xFF, 0x00, 0x04, 0x00, 0x0D,
+	0x07, 0x00, 0x1B, 0x0D, 0xFF, 0x07, 0x08, 0x02, 0x00, 0x00, 0x04, 0xFF, 0x00, 0x0D, 0x00, 0x00,
+	0x04, 0xFF, 0x00, 0x02, 0x00, 0x0B, 0x0D, 0x00, 0x1B, 0x07, 0xFF, 0x04, 0x09, 0x04, 0xFF, 0x00,
+	0x0F, 0x00, 0x00, 0x04, 0xFF, 0x0B, 0x0F, 0x00, 0x04, 0x08, 0x04, 0xFF, 0x00, 0x11, 0x00, 0x00,
+	0x04, 0xFF, 0x08, 0x13, 0x00, 0x06, 0x08, 0x03, 0xFF, 0x00, 0x07, 0x00, 0x00, 0x05, 0xFF, 0x00,
+	0x07, 0x00, 0x00, 0x03, 0xFF, 0x07, 0x15, 0x00, 0x08, 0x08, 0x03, 0xFF, 0x00, 0x06, 0x00, 0x00,
+	0x07, 0xFF, 0x00, 0x06, 0x00, 0x00, 0x03, 0xFF, 0x06, 0x09, 0x00, 0x00, 0x05, 0xFF, 0x00, 0x09,
+	0x00, 0x08, 0x07, 0x03, 0xFF, 0x00, 0x06, 0x00, 0x00, 0x09, 0xFF, 0x00, 0x06, 0x00, 0x00, 0x03,
+	0xFF, 0x05, 0x07, 0x00, 0x00, 0x09, 0xFF, 0x00, 0x07, 0x00, 0x09, 0x07, 0x03, 0xFF, 0x00, 0x05,
+	0x00, 0x00, 0x0B, 0xFF, 0x00, 0x05, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x02, 0x00, 0x02, 0x06, 0x00,
+	0x00, 0x0D, 0xFF, 0x00, 0x06, 0x00, 0x08, 0x07, 0x03, 0xFF, 0x00, 0x05, 0x00, 0x00, 0x0B, 0xFF,
+	0x00, 0x05, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x09, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x06, 0x00, 0x09,
+	0x00, 0x07, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x05, 0x00, 0x00, 0x0B, 0xFF, 0x00, 0x05, 0x00, 0x00,
+	0x03, 0xFF, 0x00, 0x09, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x06, 0x00, 0x09, 0x00, 0x07, 0x00, 0x00,
+	0x03, 0xFF, 0x00, 0x05, 0x00, 0x00, 0x0B, 0xFF, 0x00, 0x05, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x08,
+	0x00, 0x00, 0x11, 0xFF, 0x00, 0x05, 0x00, 0x09, 0x00, 0x07, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x05,
+	0x00, 0x00, 0x0B, 0xFF, 0x00, 0x05, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x08, 0x00, 0x00, 0x11, 0xFF,
+	0x00, 0x06, 0x00, 0x09, 0x00, 0x07, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x06, 0x00, 0x00, 0x09, 0xFF,
+	0x00, 0x06, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x07, 0x00, 0x00, 0x13, 0xFF, 0x00, 0x05, 0x00, 0x09,
+	0x00, 0x08, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x06, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x06, 0x00, 0x00,
+	0x03, 0xFF, 0x00, 0x08, 0x00, 0x00, 0x13, 0xFF, 0x00, 0x05, 0x00, 0x08, 0x08, 0x03, 0xFF, 0x00,
+	0x07, 0x00, 0x00, 0x05, 0xFF, 0x00, 0x07, 0x00, 0x00, 0x06, 0xFF, 0x00, 0x05, 0x00, 0x00, 0x13,
+	0xFF, 0x00, 0x05, 0x00, 0x06, 0x08, 0x04, 0xFF, 0x00, 0x11, 0x00, 0x00, 0x08, 0xFF, 0x00, 0x04,
+	0x00, 0x00, 0x13, 0xFF, 0x00, 0x05, 0x00, 0x06, 0x09, 0x04, 0xFF, 0x00, 0x0F, 0x00, 0x00, 0x09,
+	0xFF, 0x00, 0x04, 0x00, 0x00, 0x13, 0xFF, 0x00, 0x05, 0x00, 0x09, 0x08, 0x02, 0x00, 0x00, 0x04,
+	0xFF, 0x00, 0x0D, 0x00, 0x00, 0x04, 0xFF, 0x00, 0x02, 0x00, 0x00, 0x04, 0xFF, 0x00, 0x05, 0x00,
+	0x00, 0x11, 0xFF, 0x00, 0x06, 0x00, 0x09, 0x07, 0x04, 0x00, 0x00, 0x04, 0xFF, 0x00, 0x0B, 0x00,
+	0x00, 0x04, 0xFF, 0x00, 0x04, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x05, 0x00, 0x00, 0x11, 0xFF, 0x00,
+	0x08, 0x00, 0x09, 0x06, 0x06, 0x00, 0x00, 0x05, 0xFF, 0x00, 0x07, 0x00, 0x00, 0x05, 0xFF, 0x00,
+	0x06, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x06, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x0A, 0x00, 0x05, 0x05,
+	0x08, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x0B, 0x00, 0x05, 0x04,
+	0x0A, 0x00, 0x00, 0x0E, 0xFF, 0x00, 0x09, 0x00, 0x00, 0x1A, 0xFF, 0x00, 0x07, 0x00, 0x07, 0x05,
+	0x08, 0x00, 0x00, 0x0B, 0xFF, 0x00, 0x01, 0x00, 0x00, 0x04, 0xFF, 0x00, 0x07, 0x00, 0x00, 0x1C,
+	0xFF, 0x00, 0x06, 0x00, 0x07, 0x06, 0x06, 0x00, 0x00, 0x08, 0xFF, 0x00, 0x05, 0x00, 0x00, 0x05,
+	0xFF, 0x00, 0x05, 0x00, 0x00, 0x1E, 0xFF, 0x00, 0x06, 0x00, 0x07, 0x06, 0x05, 0x00, 0x00, 0x09,
+	0xFF, 0x00, 0x05, 0x00, 0x00, 0x06, 0xFF, 0x00, 0x03, 0x00, 0x00, 0x20, 0xFF, 0x00, 0x05, 0x00,
+	0x07, 0x06, 0x05, 0x00, 0x00, 0x09, 0xFF, 0x00, 0x05, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x01, 0x00,
+	0x00, 0x21, 0xFF, 0x00, 0x05, 0x00, 0x05, 0x06, 0x05, 0x00, 0x00, 0x09, 0xFF, 0x00, 0x05, 0x00,
+	0x00, 0x29, 0xFF, 0x00, 0x05, 0x00, 0x05, 0x06, 0x06, 0x00, 0x00, 0x08, 0xFF, 0x00, 0x05, 0x00,
+	0x00, 0x28, 0xFF, 0x00, 0x06, 0x00, 0x05, 0x07, 0x06, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x05, 0x00,
+	0x00, 0x27, 0xFF, 0x00, 0x06, 0x00, 0x01, 0x07, 0x3F, 0x00, 0x01, 0x08, 0x3D, 0x00, 0x01, 0x09,
+	0x3B, 0x00, 0x01, 0x0A, 0x39, 0x00, 0x01, 0x0C, 0x35, 0x00,
+};
+constexpr uint8_t IconSprite_03d_L_y102_runs[] = {
+	0x01, 0x33, 0x09, 0x00, 0x01, 0x31, 0x0D, 0x00, 0x01, 0x2F, 0x11, 0x00, 0x01, 0x2D, 0x15, 0x00,
+	0x01, 0x2C, 0x17, 0x00, 0x04, 0x2B, 0x09, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x09, 0x00, 0x1D, 0x0B,
+	0x00, 0x05, 0x1B, 0x07, 0x00, 0x08, 0x08, 0x00, 0x00, 0x0B, 0xFF, 0x00, 0x08, 0x00, 0x18, 0x13,
+	0x00, 0x05, 0x18, 0x0D, 0x00, 0x04, 0x07, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x07, 0x00, 0x14, 0x19,
+	0x00, 0x05, 0x17, 0x0F, 0x00, 0x03, 0x06, 0x00, 0x00, 0x11, 0xFF, 0x00, 0x06, 0x00, 0x12, 0x1D,
+	0x00, 0x04, 0x15, 0x19, 0x00, 0x00, 0x13, 0xFF, 0x00, 0x06, 0x00, 0x0F, 0x21, 0x00, 0x06, 0x14,
+	0x19, 0x00, 0x00, 0x15, 0xFF, 0x00, 0x05, 0x00, 0x0E, 0x0C, 0x00, 0x00, 0x0B, 0xFF, 0x00, 0x0C,
+	0x00, 0x08, 0x13, 0x09, 0x00, 0x00, 0x05, 0xFF, 0x00, 0x0C, 0x00, 0x00, 0x15, 0xFF, 0x00, 0x06,
+	0x00, 0x0C, 0x0A, 0x00, 0x00, 0x11, 0xFF, 0x00, 0x0A, 0x00, 0x08, 0x13, 0x07, 0x00, 0x00, 0x09,
+	0xFF, 0x00, 0x09, 0x00, 0x00, 0x17, 0xFF, 0x00, 0x05, 0x00, 0x0A, 0x09, 0x00, 0x00, 0x17, 0xFF,
+	0x00, 0x09, 0x00, 0x08, 0x12, 0x06, 0x00, 0x00, 0x0D, 0xFF, 0x00, 0x07, 0x00, 0x00, 0x17, 0xFF,
+	0x00, 0x06, 0x00, 0x08, 0x08, 0x00, 0x00, 0x1B, 0xFF, 0x00, 0x08, 0x00, 0x08, 0x11, 0x06, 0x00,
+	0x00, 0x0F, 0xFF, 0x00, 0x05, 0x00, 0x00, 0x19, 0xFF, 0x00, 0x05, 0x00, 0x07, 0x08, 0x00, 0x00,
+	0x1D, 0xFF, 0x00, 0x08, 0x00, 0x08, 0x11, 0x06, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x05, 0x00, 0x00,
+	0x19, 0xFF, 0x00, 0x05, 0x00, 0x06, 0x08, 0x00, 0x00, 0x1F, 0xFF, 0x00, 0x08, 0x00, 0x08, 0x11,
+	0x05, 0x00, 0x00, 0x11, 0xFF, 0x00, 0x04, 0x00, 0x00, 0x19, 0xFF, 0x00, 0x05, 0x00, 0x05, 0x07,
+	0x00, 0x00, 0x23, 0xFF, 0x00, 0x07, 0x00, 0x0A, 0x10, 0x06, 0x00, 0x00, 0x11, 0xFF, 0x00, 0x04,
+	0x00, 0x00, 0x0A, 0xFF, 0x00, 0x09, 0x00, 0x00, 0x06, 0xFF, 0x00, 0x05, 0x00, 0x05, 0x06, 0x00,
+	0x00, 0x25, 0xFF, 0x00, 0x06, 0x00, 0x0A, 0x10, 0x05, 0x00, 0x00, 0x13, 0xFF, 0x00, 0x03, 0x00,
+	0x00, 0x06, 0xFF, 0x00, 0x11, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x05, 0x00, 0x04, 0x06, 0x00, 0x00,
+	0x27, 0xFF, 0x00, 0x06, 0x00, 0x08, 0x10, 0x05, 0x00, 0x00, 0x13, 0xFF, 0x00, 0x03, 0x00, 0x00,
+	0x04, 0xFF, 0x00, 0x1A, 0x00, 0x03, 0x06, 0x00, 0x00, 0x29, 0xFF, 0x00, 0x06, 0x00, 0x08, 0x07,
+	0x0E, 0x00, 0x00, 0x13, 0xFF, 0x00, 0x03, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x1D, 0x00, 0x01, 0x07,
+	0x00, 0x00, 0x29, 0xFF, 0x00, 0x07, 0x00, 0x05, 0x05, 0x10, 0x00, 0x00, 0x13, 0xFF, 0x00, 0x29,
+	0x00, 0x00, 0x2B, 0xFF, 0x00, 0x06, 0x00, 0x07, 0x04, 0x11, 0x00, 0x00, 0x13, 0xFF, 0x00, 0x0D,
+	0x00, 0x00, 0x09, 0xFF, 0x00, 0x12, 0x00, 0x00, 0x2D, 0xFF, 0x00, 0x06, 0x00, 0x07, 0x03, 0x13,
+	0x00, 0x00, 0x11, 0xFF, 0x00, 0x0B, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x0E, 0x00, 0x00, 0x2F, 0xFF,
+	0x00, 0x05, 0x00, 0x07, 0x02, 0x0A, 0x00, 0x00, 0x1C, 0xFF, 0x00, 0x08, 0x00, 0x00, 0x13, 0xFF,
+	0x00, 0x0C, 0x00, 0x00, 0x2F, 0xFF, 0x00, 0x06, 0x00, 0x07, 0x01, 0x07, 0x00, 0x00, 0x1F, 0xFF,
+	0x00, 0x07, 0x00, 0x00, 0x17, 0xFF, 0x00, 0x09, 0x00, 0x00, 0x31, 0xFF, 0x00, 0x05, 0x00, 0x07,
+	0x01, 0x06, 0x00, 0x00, 0x1F, 0xFF, 0x00, 0x07, 0x00, 0x00, 0x19, 0xFF, 0x00, 0x08, 0x00, 0x00,
+	0x31, 0xFF, 0x00, 0x05, 0x00, 0x07, 0x00, 0x06, 0x00, 0x00, 0x1F, 0xFF, 0x00, 0x07, 0x00, 0x00,
+	0x1B, 0xFF, 0x00, 0x07, 0x00, 0x00, 0x31, 0xFF, 0x00, 0x06, 0x00, 0x07, 0x00, 0x05, 0x00, 0x00,
+	0x1F, 0xFF, 0x00, 0x07, 0x00, 0x00, 0x1D, 0xFF, 0x00, 0x05, 0x00, 0x00, 0x33, 0xFF, 0x00, 0x05,
+	0x00, 0x07, 0x00, 0x05, 0x00, 0x00, 0x1F, 0xFF, 0x00, 0x06, 0x00, 0x00, 0x1F, 0xFF, 0x00, 0x04,
+	0x00, 0x00, 0x33, 0xFF, 0x00, 0x05, 0x00, 0x07, 0x00, 0x05, 0x00, 0x00, 0x1E, 0xFF, 0x00, 0x06,
+	0x00, 0x00, 0x21, 0xFF, 0x00, 0x03, 0x00, 0x00, 0x33, 0xFF, 0x00, 0x05, 0x00, 0x07, 0x00, 0x05,
+	0x00, 0x00, 0x1E, 0xFF, 0x00, 0x05, 0x00, 0x00, 0x23, 0xFF, 0x00, 0x01, 0x00, 0x00, 0x35, 0xFF,
+	0x00, 0x05, 0x00, 0x07, 0x00, 0x05, 0x00, 0x00, 0x1D, 0xFF, 0x00, 0x06, 0x00, 0x00, 0x23, 0xFF,
+	0x00, 0x01, 0x00, 0x00, 0x35, 0xFF, 0x00, 0x05, 0x00, 0x05, 0x00, 0x06, 0x00, 0x00, 0x1C, 0xFF,
+	0x00, 0x05, 0x00, 0x00, 0x5A, 0xFF, 0x00, 0x05, 0x00, 0x05, 0x01, 0x06, 0x00, 0x00, 0x1A, 0xFF,
+	0x00, 0x06, 0x00, 0x00, 0x5A, 0xFF, 0x00, 0x05, 0x00, 0x05, 0x01, 0x07, 0x00, 0x00, 0x19, 0xFF,
+	0x00, 0x05, 0x00, 0x00, 0x5B, 0xFF, 0x00, 0x05, 0x00, 0x03, 0x02, 0x24, 0x00, 0x00, 0x5B, 0xFF,
+	0x00, 0x05, 0x00, 0x03, 0x03, 0x23, 0x00, 0x00, 0x5B, 0xFF, 0x00, 0x05, 0x00, 0x03, 0x04, 0x21,
+	0x00, 0x00, 0x5C, 0xFF, 0x00, 0x05, 0x00, 0x03, 0x05, 0x20, 0x00, 0x00, 0x5C, 0xFF, 0x00, 0x05,
+	0x00, 0x03, 0x07, 0x1E, 0x00, 0x00, 0x5C, 0xFF, 0x00, 0x05, 0x00, 0x03, 0x20, 0x05, 0x00, 0x00,
+	0x5C, 0xFF, 0x00, 0x05, 0x00, 0x03, 0x11, 0x14, 0x00, 0x00, 0x5B, 0xFF, 0x00, 0x06, 0x00, 0x03,
+	0x0E, 0x17, 0x00, 0x00, 0x5B, 0xFF, 0x00, 0x09, 0x00, 0x03, 0x0C, 0x19, 0x00, 0x00, 0x5B, 0xFF,
+	0x00, 0x0B, 0x00, 0x03, 0x0B, 0x1A, 0x00, 0x00, 0x5A, 0xFF, 0x00, 0x0D, 0x00, 0x03, 0x0A, 0x0D,
+	0x00, 0x00, 0x6A, 0xFF, 0x00, 0x0C, 0x00, 0x03, 0x09, 0x09, 0x00, 0x00, 0x73, 0xFF, 0x00, 0x09,
+	0x00, 0x03, 0x08, 0x07, 0x00, 0x00, 0x79, 0xFF, 0x00, 0x07, 0x00, 0x03, 0x07, 0x07, 0x00, 0x00,
+	0x7B, 0xFF, 0x00, 0x07, 0x00, 0x03, 0x06, 0x07, 0x00, 0x00, 0x7D, 0xFF, 0x00, 0x07, 0x00, 0x03,
+	0x05, 0x07, 0x00, 0x00, 0x7F, 0xFF, 0x00, 0x07, 0x00, 0x03, 0x05, 0x06, 0x00, 0x00, 0x81, 0xFF,
+	0x00, 0x06, 0x00, 0x03, 0x04, 0x06, 0x00, 0x00, 0x83, 0xFF, 0x00, 0x06, 0x00, 0x03, 0x04, 0x05,
+	0x00, 0x00, 0x85, 0xFF, 0x00, 0x05, 0x00, 0x03, 0x04, 0x05, 0x00, 0x00, 0x85, 0xFF, 0x00, 0x05,
+	0x00, 0x03, 0x03, 0x06, 0x00, 0x00, 0x85, 0xFF, 0x00, 0x06, 0x00, 0x03, 0x03, 0x05, 0x00, 0x00,
+	0x87, 0xFF, 0x00, 0x05, 0x00, 0x03, 0x03, 0x05, 0x00, 0x00, 0x87, 0xFF, 0x00, 0x05, 0x00, 0x03,
+	0x03, 0x05, 0x00, 0x00, 0x87, 0xFF, 0x00, 0x05, 0x00, 0x03, 0x03, 0x05, 0x00, 0x00, 0x87, 0xFF,
+	0x00, 0x05, 0x00, 0x03, 0x03, 0x05, 0x00, 0x00, 0x87, 0xFF, 0x00, 0x05, 0x00, 0x03, 0x03, 0x05,
+	0x00, 0x00, 0x87, 0xFF, 0x00, 0x05, 0x00, 0x03, 0x03, 0x05, 0x00, 0x00, 0x87, 0xFF, 0x00, 0x05,
+	0x00, 0x03, 0x03, 0x06, 0x00, 0x00, 0x85, 0xFF, 0x00, 0x06, 0x00, 0x03, 0x04, 0x05, 0x00, 0x00,
+	0x85, 0xFF, 0x00, 0x05, 0x00, 0x03, 0x04, 0x05, 0x00, 0x00, 0x85, 0xFF, 0x00, 0x05, 0x00, 0x03,
+	0x04, 0x06, 0x00, 0x00, 0x83, 0xFF, 0x00, 0x06, 0x00, 0x03, 0x05, 0x06, 0x00, 0x00, 0x81, 0xFF,
+	0x00, 0x06, 0x00, 0x03, 0x05, 0x07, 0x00, 0x00, 0x7F, 0xFF, 0x00, 0x07, 0x00, 0x03, 0x06, 0x07,
+	0x00, 0x00, 0x7D, 0xFF, 0x00, 0x07, 0x00, 0x03, 0x07, 0x07, 0x00, 0x00, 0x7B, 0xFF, 0x00, 0x07,
+	0x00, 0x03, 0x08, 0x07, 0x00, 0x00, 0x79, 0xFF, 0x00, 0x07, 0x00, 0x03, 0x09, 0x09, 0x00, 0x00,
+	0x73, 0xFF, 0x00, 0x09, 0x00, 0x01, 0x0A, 0x83, 0x00, 0x01, 0x0B, 0x81, 0x00, 0x01, 0x0C, 0x7F,
+	0x00, 0x01, 0x0E, 0x7B, 0x00, 0x01, 0x11, 0x75, 0x00,
+};
+constexpr uint8_t IconSprite_03d_L_y120_runs[] = {
+	0x01, 0x33, 0x09, 0x00, 0x01, 0x31, 0x0D, 0x00, 0x01, 0x2F, 0x11, 0x00, 0x01, 0x2D, 0x15, 0x00,
+	0x01, 0x2C, 0x17, 0x00, 0x03, 0x2B, 0x09, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x09, 0x00, 0x04, 0x1B,
+	0x07, 0x00, 0x08, 0x08, 0x00, 0x00, 0x0B, 0xFF, 0x00, 0x08, 0x00, 0x04, 0x18, 0x0D, 0x00, 0x04,
+	0x07, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x07, 0x00, 0x04, 0x17, 0x0F, 0x00, 0x03, 0x06, 0x00, 0x00,
+	0x11, 0xFF, 0x00, 0x06, 0x00, 0x04, 0x15, 0x19, 0x00, 0x00, 0x13, 0xFF, 0x00, 0x06, 0x00, 0x1A,
+	0x0B, 0x00, 0x04, 0x14, 0x19, 0x00, 0x00, 0x15, 0xFF, 0x00, 0x05, 0x00, 0x16, 0x13, 0x00, 0x06,
+	0x13, 0x09, 0x00, 0x00, 0x05, 0xFF, 0x00, 0x0C, 0x00, 0x00, 0x15, 0xFF, 0x00, 0x06, 0x00, 0x12,
+	0x19, 0x00, 0x06, 0x13, 0x07, 0x00, 0x00, 0x09, 0xFF, 0x00, 0x09, 0x00, 0x00, 0x17, 0xFF, 0x00,
+	0x05, 0x00, 0x10, 0x1D, 0x00, 0x06, 0x12, 0x06, 0x00, 0x00, 0x0D, 0xFF, 0x00, 0x07, 0x00, 0x00,
+	0x17, 0xFF, 0x00, 0x06, 0x00, 0x0D, 0x21, 0x00, 0x08, 0x11, 0x06, 0x00, 0x00, 0x0F, 0xFF, 0x00,
+	0x05, 0x00, 0x00, 0x19, 0xFF, 0x00, 0x05, 0x00, 0x0C, 0x0C, 0x00, 0x00, 0x0B, 0xFF, 0x00, 0x0C,
+	0x00, 0x08, 0x11, 0x06, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x05, 0x00, 0x00, 0x19, 0xFF, 0x00, 0x05,
+	0x00, 0x0B, 0x0A, 0x00, 0x00, 0x11, 0xFF, 0x00, 0x0A, 0x00, 0x08, 0x11, 0x05, 0x00, 0x00, 0x11,
+	0xFF, 0x00, 0x04, 0x00, 0x00, 0x19, 0xFF, 0x00, 0x05, 0x00, 0x09, 0x09, 0x00, 0x00, 0x17, 0xFF,
+	0x00, 0x09, 0x00, 0x08, 0x10, 0x06, 0x00, 0x00, 0x11, 0xFF, 0x00, 0x04, 0x00, 0x00, 0x19, 0xFF,
+	0x00, 0x05, 0x00, 0x08, 0x08, 0x00, 0x00, 0x1B, 0xFF, 0x00, 0x08, 0x00, 0x08, 0x10, 0x05, 0x00,
+	0x00, 0x13, 0xFF, 0x00, 0x03, 0x00, 0x00, 0x19, 0xFF, 0x00, 0x05, 0x00, 0x07, 0x08, 0x00, 0x00,
+	0x1D, 0xFF, 0x00, 0x08, 0x00, 0x08, 0x10, 0x05, 0x00, 0x00, 0x13, 0xFF, 0x00, 0x03, 0x00, 0x00,
+	0x19, 0xFF, 0x00, 0x05, 0x00, 0x06, 0x08, 0x00, 0x00, 0x1F, 0xFF, 0x00, 0x08, 0x00, 0x08, 0x07,
+	0x0E, 0x00, 0x00, 0x13, 0xFF, 0x00, 0x03, 0x00, 0x00, 0x19, 0xFF, 0x00, 0x06, 0x00, 0x04, 0x07,
+	0x00, 0x00, 0x23, 0xFF, 0x00, 0x07, 0x00, 0x0A, 0x05, 0x10, 0x00, 0x00, 0x13, 0xFF, 0x00, 0x04,
+	0x00, 0x00, 0x09, 0xFF, 0x00, 0x09, 0x00, 0x00, 0x05, 0xFF, 0x00, 0x09, 0x00, 0x02, 0x06, 0x00,
+	0x00, 0x25, 0xFF, 0x00, 0x06, 0x00, 0x09, 0x04, 0x11, 0x00, 0x00, 0x13, 0xFF, 0x00, 0x04, 0x00,
+	0x00, 0x05, 0xFF, 0x00, 0x11, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x10, 0x00, 0x00, 0x27, 0xFF, 0x00,
+	0x06, 0x00, 0x07, 0x03, 0x13, 0x00, 0x00, 0x11, 0xFF, 0x00, 0x06, 0x00, 0x00, 0x02, 0xFF, 0x00,
+	0x23, 0x00, 0x00, 0x29, 0xFF, 0x00, 0x06, 0x00, 0x07, 0x02, 0x0A, 0x00, 0x00, 0x21, 0xFF, 0x00,
+	0x19, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x0B, 0x00, 0x00, 0x29, 0xFF, 0x00, 0x07, 0x00, 0x07, 0x01,
+	0x07, 0x00, 0x00, 0x23, 0xFF, 0x00, 0x1D, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x08, 0x00, 0x00, 0x2B,
+	0xFF, 0x00, 0x06, 0x00, 0x09, 0x01, 0x06, 0x00, 0x00, 0x23, 0xFF, 0x00, 0x0B, 0x00, 0x00, 0x09,
+	0xFF, 0x00, 0x0B, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x06, 0x00, 0x00, 0x2D, 0xFF, 0x00, 0x06, 0x00,
+	0x07, 0x00, 0x06, 0x00, 0x00, 0x23, 0xFF, 0x00, 0x09, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x0E, 0x00,
+	0x00, 0x2F, 0xFF, 0x00, 0x05, 0x00, 0x07, 0x00, 0x05, 0x00, 0x00, 0x23, 0xFF, 0x00, 0x08, 0x00,
+	0x00, 0x13, 0xFF, 0x00, 0x0C, 0x00, 0x00, 0x2F, 0xFF, 0x00, 0x06, 0x00, 0x07, 0x00, 0x05, 0x00,
+	0x00, 0x22, 0xFF, 0x00, 0x07, 0x00, 0x00, 0x17, 0xFF, 0x00, 0x09, 0x00, 0x00, 0x31, 0xFF, 0x00,
+	0x05, 0x00, 0x07, 0x00, 0x05, 0x00, 0x00, 0x21, 0xFF, 0x00, 0x07, 0x00, 0x00, 0x19, 0xFF, 0x00,
+	0x08, 0x00, 0x00, 0x31, 0xFF, 0x00, 0x05, 0x00, 0x07, 0x00, 0x05, 0x00, 0x00, 0x20, 0xFF, 0x00,
+	0x07, 0x00, 0x00, 0x1B, 0xFF, 0x00, 0x07, 0x00, 0x00, 0x31, 0xFF, 0x00, 0x06, 0x00, 0x07, 0x00,
+	0x05, 0x00, 0x00, 0x1F, 0xFF, 0x00, 0x07, 0x00, 0x00, 0x1D, 0xFF, 0x00, 0x05, 0x00, 0x00, 0x33,
+	0xFF, 0x00, 0x05, 0x00, 0x07, 0x00, 0x06, 0x00, 0x00, 0x1E, 0xFF, 0x00, 0x06, 0x00, 0x00, 0x1F,
+	0xFF, 0x00, 0x04, 0x00, 0x00, 0x33, 0xFF, 0x00, 0x05, 0x00, 0x07, 0x01, 0x06, 0x00, 0x00, 0x1C,
+	0xFF, 0x00, 0x06, 0x00, 0x00, 0x21, 0xFF, 0x00, 0x03, 0x00, 0x00, 0x33, 0xFF, 0x00, 0x05, 0x00,
+	0x07, 0x01, 0x07, 0x00, 0x00, 0x1B, 0xFF, 0x00, 0x05, 0x00, 0x00, 0x23, 0xFF, 0x00, 0x01, 0x00,
+	0x00, 0x35, 0xFF, 0x00, 0x05, 0x00, 0x05, 0x02, 0x26, 0x00, 0x00, 0x23, 0xFF, 0x00, 0x01, 0x00,
+	0x00, 0x35, 0xFF, 0x00, 0x05, 0x00, 0x03, 0x03, 0x24, 0x00, 0x00, 0x5A, 0xFF, 0x00, 0x05, 0x00,
+	0x03, 0x04, 0x23, 0x00, 0x00, 0x5A, 0xFF, 0x00, 0x05, 0x00, 0x03, 0x05, 0x21, 0x00, 0x00, 0x5B,
+	0xFF, 0x00, 0x05, 0x00, 0x03, 0x07, 0x1F, 0x00, 0x00, 0x5B, 0xFF, 0x00, 0x05, 0x00, 0x03, 0x21,
+	0x05, 0x00, 0x00, 0x5B, 0xFF, 0x00, 0x05, 0x00, 0x03, 0x20, 0x05, 0x00, 0x00, 0x5C, 0xFF, 0x00,
+	0x05, 0x00, 0x03, 0x20, 0x05, 0x00, 0x00, 0x5C, 0xFF, 0x00, 0x05, 0x00, 0x03, 0x20, 0x05, 0x00,
+	0x00, 0x5C, 0xFF, 0x00, 0x05, 0x00, 0x03, 0x20, 0x05, 0x00, 0x00, 0x5C, 0xFF, 0x00, 0x05, 0x00,
+	0x03, 0x11, 0x14, 0x00, 0x00, 0x5B, 0xFF, 0x00, 0x06, 0x00, 0x03, 0x0E, 0x17, 0x00, 0x00, 0x5B,
+	0xFF, 0x00, 0x09, 0x00, 0x03, 0x0C, 0x19, 0x00, 0x00, 0x5B, 0xFF, 0x00, 0x0B, 0x00, 0x03, 0x0B,
+	0x1A, 0x00, 0x00, 0x5A, 0xFF, 0x00, 0x0D, 0x00, 0x03, 0x0A, 0x0D, 0x00, 0x00, 0x6A, 0xFF, 0x00,
+	0x0C, 0x00, 0x03, 0x09, 0x09, 0x00, 0x00, 0x73, 0xFF, 0x00, 0x09, 0x00, 0x03, 0x08, 0x07, 0x00,
+	0x00, 0x79, 0xFF, 0x00, 0x07, 0x00, 0x03, 0x07, 0x07, 0x00, 0x00, 0x7B, 0xFF, 0x00, 0x07, 0x00,
+	0x03, 0x06, 0x07, 0x00, 0x00, 0x7D, 0xFF, 0x00, 0x07, 0x00, 0x03, 0x05, 0x07, 0x00, 0x00, 0x7F,
+	0xFF, 0x00, 0x07, 0x00, 0x03, 0x05, 0x06, 0x00, 0x00, 0x81, 0xFF, 0x00, 0x06, 0x00, 0x03, 0x04,
+	0x06, 0x00, 0x00, 0x83, 0xFF, 0x00, 0x06, 0x00, 0x03, 0x04, 0x05, 0x00, 0x00, 0x85, 0xFF, 0x00,
+	0x05, 0x00, 0x03, 0x04, 0x05, 0x00, 0x00, 0x85, 0xFF, 0x00, 0x05, 0x00, 0x03, 0x03, 0x06, 0x00,
+	0x00, 0x85, 0xFF, 0x00, 0x06, 0x00, 0x03, 0x03, 0x05, 0x00, 0x00, 0x87, 0xFF, 0x00, 0x05, 0x00,
+	0x03, 0x03, 0x05, 0x00, 0x00, 0x87, 0xFF, 0x00, 0x05, 0x00, 0x03, 0x03, 0x05, 0x00, 0x00, 0x87,
+	0xFF, 0x00, 0x05, 0x00, 0x03, 0x03, 0x05, 0x00, 0x00, 0x87, 0xFF, 0x00, 0x05, 0x00, 0x03, 0x03,
+	0x05, 0x00, 0x00, 0x87, 0xFF, 0x00, 0x05, 0x00, 0x03, 0x03, 0x05, 0x00, 0x00, 0x87, 0xFF, 0x00,
+	0x05, 0x00, 0x03, 0x03, 0x05, 0x00, 0x00, 0x87, 0xFF, 0x00, 0x05, 0x00, 0x03, 0x03, 0x06, 0x00,
+	0x00, 0x85, 0xFF, 0x00, 0x06, 0x00, 0x03, 0x04, 0x05, 0x00, 0x00, 0x85, 0xFF, 0x00, 0x05, 0x00,
+	0x03, 0x04, 0x05, 0x00, 0x00, 0x85, 0xFF, 0x00, 0x05, 0x00, 0x03, 0x04, 0x06, 0x00, 0x00, 0x83,
+	0xFF, 0x00, 0x06, 0x00, 0x03, 0x05, 0x06, 0x00, 0x00, 0x81, 0xFF, 0x00, 0x06, 0x00, 0x03, 0x05,
+	0x07, 0x00, 0x00, 0x7F, 0xFF, 0x00, 0x07, 0x00, 0x03, 0x06, 0x07, 0x00, 0x00, 0x7D, 0xFF, 0x00,
+	0x07, 0x00, 0x03, 0x07, 0x07, 0x00, 0x00, 0x7B, 0xFF, 0x00, 0x07, 0x00, 0x03, 0x08, 0x07, 0x00,
+	0x00, 0x79, 0xFF, 0x00, 0x07, 0x00, 0x03, 0x09, 0x09, 0x00, 0x00, 0x73, 0xFF, 0x00, 0x09, 0x00,
+	0x01, 0x0A, 0x83, 0x00, 0x01, 0x0B, 0x81, 0x00, 0x01, 0x0C, 0x7F, 0x00, 0x01, 0x0E, 0x7B, 0x00,
+	0x01, 0x11, 0x75, 0x00,
+};
+constexpr uint8_t IconSprite_03d_S_y305_runs[] = {
+	0x01, 0x29, 0x05, 0x00, 0x01, 0x27, 0x09, 0x00, 0x01, 0x26, 0x0B, 0x00, 0x02, 0x1D, 0x05, 0x00,
+	0x03, 0x0D, 0x00, 0x01, 0x1B, 0x18, 0x00, 0x03, 0x1A, 0x10, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x06,
+	0x00, 0x03, 0x19, 0x10, 0x00, 0x00, 0x05, 0xFF, 0x00, 0x06, 0x00, 0x03, 0x19, 0x0F, 0x00, 0x00,
+	0x07, 0xFF, 0x00, 0x05, 0x00, 0x05, 0x18, 0x06, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x07, 0x00, 0x00,
+	0x07, 0xFF, 0x00, 0x05, 0x00, 0x05, 0x18, 0x05, 0x00, 0x00, 0x05, 0xFF, 0x00, 0x06, 0x00, 0x00,
+	0x07, 0xFF, 0x00, 0x05, 0x00, 0x05, 0x13, 0x0A, 0x00, 0x00, 0x05, 0xFF, 0x00, 0x07, 0x00, 0x00,
+	0x05, 0xFF, 0x00, 0x08, 0x00, 0x05, 0x12, 0x0B, 0x00, 0x00, 0x05, 0xFF, 0x00, 0x08, 0x00, 0x00,
+	0x03, 0xFF, 0x00, 0x0A, 0x00, 0x03, 0x11, 0x0D, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x17, 0x00, 0x01,
+	0x10, 0x2A, 0x00, 0x03, 0x10, 0x07, 0x00, 0x00, 0x11, 0xFF, 0x00, 0x13, 0x00, 0x05, 0x10, 0x05,
+	0x00, 0x00, 0x01, 0xFF, 0x00, 0x01, 0x00, 0x00, 0x10, 0xFF, 0x00, 0x15, 0x00, 0x03, 0x10, 0x1E,
+	0x00, 0x00, 0x07, 0xFF, 0x00, 0x08, 0x00, 0x03, 0x10, 0x1C, 0x00, 0x00, 0x0B, 0xFF, 0x00, 0x07,
+	0x00, 0x03, 0x11, 0x1A, 0x00, 0x00, 0x0D, 0xFF, 0x00, 0x07, 0x00, 0x03, 0x12, 0x18, 0x00, 0x00,
+	0x0F, 0xFF, 0x00, 0x06, 0x00, 0x03, 0x13, 0x16, 0x00, 0x00, 0x11, 0xFF, 0x00, 0x06, 0x00, 0x03,
+	0x12, 0x16, 0x00, 0x00, 0x13, 0xFF, 0x00, 0x05, 0x00, 0x05, 0x11, 0x08, 0x00, 0x00, 0x05, 0xFF,
+	0x00, 0x0A, 0x00, 0x00, 0x13, 0xFF, 0x00, 0x05, 0x00, 0x05, 0x11, 0x06, 0x00, 0x00, 0x09, 0xFF,
+	0x00, 0x07, 0x00, 0x00, 0x15, 0xFF, 0x00, 0x05, 0x00, 0x05, 0x10, 0x06, 0x00, 0x00, 0x0B, 0xFF,
+	0x00, 0x06, 0x00, 0x00, 0x15, 0xFF, 0x00, 0x05, 0x00, 0x05, 0x10, 0x05, 0x00, 0x00, 0x0D, 0xFF,
+	0x00, 0x05, 0x00, 0x00, 0x15, 0xFF, 0x00, 0x05, 0x00, 0x05, 0x0F, 0x06, 0x00, 0x00, 0x0D, 0xFF,
+	0x00, 0x05, 0x00, 0x00, 0x15, 0xFF, 0x00, 0x05, 0x00, 0x05, 0x0F, 0x05, 0x00, 0x00, 0x0F, 0xFF,
+	0x00, 0x04, 0x00, 0x00, 0x15, 0xFF, 0x00, 0x05, 0x00, 0x05, 0x0F, 0x05, 0x00, 0x00, 0x0F, 0xFF,
+	0x00, 0x04, 0x00, 0x00, 0x15, 0xFF, 0x00, 0x05, 0x00, 0x05, 0x07, 0x0D, 0x00, 0x00, 0x0F, 0xFF,
+	0x00, 0x04, 0x00, 0x00, 0x15, 0xFF, 0x00, 0x06, 0x00, 0x05, 0x05, 0x0F, 0x00, 0x00, 0x0F, 0xFF,
+	0x00, 0x05, 0x00, 0x00, 0x13, 0xFF, 0x00, 0x09, 0x00, 0x05, 0x03, 0x11, 0x00, 0x00, 0x0F, 0xFF,
+	0x00, 0x05, 0x00, 0x00, 0x13, 0xFF, 0x00, 0x0B, 0x00, 0x05, 0x02, 0x13, 0x00, 0x00, 0x0D, 0xFF,
+	0x00, 0x07, 0x00, 0x00, 0x11, 0xFF, 0x00, 0x0D, 0x00, 0x03, 0x02, 0x09, 0x00, 0x00, 0x35, 0xFF,
+	0x00, 0x07, 0x00, 0x03, 0x01, 0x07, 0x00, 0x00, 0x39, 0xFF, 0x00, 0x07, 0x00, 0x03, 0x01, 0x05,
+	0x00, 0x00, 0x3D, 0xFF, 0x00, 0x05, 0x00, 0x03, 0x00, 0x06, 0x00, 0x00, 0x3D, 0xFF, 0x00, 0x06,
+	0x00, 0x03, 0x00, 0x05, 0x00, 0x00, 0x3F, 0xFF, 0x00, 0x05, 0x00, 0x03, 0x00, 0x05, 0x00, 0x00,
+	0x3F, 0xFF, 0x00, 0x05, 0x00, 0x03, 0x00, 0x05, 0x00, 0x00, 0x3F, 0xFF, 0x00, 0x05, 0x00, 0x03,
+	0x00, 0x06, 0x00, 0x00, 0x3D, 0xFF, 0x00, 0x06, 0x00, 0x03, 0x01, 0x05, 0x00, 0x00, 0x3D, 0xFF,
+	0x00, 0x05, 0x00, 0x03, 0x01, 0x07, 0x00, 0x00, 0x39, 0xFF, 0x00, 0x07, 0x00, 0x01, 0x02, 0x45,
+	0x00, 0x01, 0x02, 0x45, 0x00, 0x01, 0x03, 0x43, 0x00, 0x01, 0x05, 0x3F, 0x00, 0x01, 0x07, 0x3B,
+	0x00,
+};
+constexpr uint8_t IconSprite_03n_L_y102_runs[] = {
+	0x01, 0xBA, 0x07, 0xFF, 0x01, 0xB7, 0x0D, 0xFF, 0x01, 0xB5, 0x11, 0xFF, 0x01, 0xB4, 0x13, 0xFF,
+	0x01, 0xB2, 0x17, 0xFF, 0x01, 0xB1, 0x19, 0xFF, 0x02, 0xAE, 0x03, 0x00, 0x00, 0x19, 0xFF, 0x02,
+	0xAC, 0x04, 0x00, 0x00, 0x1B, 0xFF, 0x02, 0xAB, 0x04, 0x00, 0x00, 0x1D, 0xFF, 0x02, 0xAA, 0x05,
+	0x00, 0x00, 0x1D, 0xFF, 0x02, 0xA9, 0x05, 0x00, 0x00, 0x1F, 0xFF, 0x02, 0xA8, 0x06, 0x00, 0x00,
+	0x1F, 0xFF, 0x02, 0xA8, 0x06, 0x00, 0x00, 0x1F, 0xFF, 0x02, 0xA7, 0x06, 0x00, 0x00, 0x21, 0xFF,
+	0x02, 0xA7, 0x06, 0x00, 0x00, 0x21, 0xFF, 0x02, 0xA7, 0x06, 0x00, 0x00, 0x21, 0xFF, 0x02, 0xA7,
+	0x06, 0x00, 0x00, 0x21, 0xFF, 0x02, 0xA7, 0x06, 0x00, 0x00, 0x21, 0xFF, 0x03, 0x33, 0x09, 0x00,
+	0x6B, 0x06, 0x00, 0x00, 0x21, 0xFF, 0x03, 0x31, 0x0D, 0x00, 0x69, 0x06, 0x00, 0x00, 0x21, 0xFF,
+	0x03, 0x2F, 0x11, 0x00, 0x68, 0x06, 0x00, 0x00, 0x1F, 0xFF, 0x03, 0x2D, 0x15, 0x00, 0x66, 0x06,
+	0x00, 0x00, 0x1F, 0xFF, 0x03, 0x2C, 0x17, 0x00, 0x66, 0x05, 0x00, 0x00, 0x1F, 0xFF, 0x06, 0x2B,
+	0x09, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x09, 0x00, 0x1D, 0x0B, 0x00, 0x3E, 0x05, 0x00, 0x00, 0x1D,
+	0xFF, 0x07, 0x1B, 0x07, 0x00, 0x08, 0x08, 0x00, 0x00, 0x0B, 0xFF, 0x00, 0x08, 0x00, 0x18, 0x13,
+	0x00, 0x3B, 0x04, 0x00, 0x00, 0x1D, 0xFF, 0x07, 0x18, 0x0D, 0x00, 0x04, 0x07, 0x00, 0x00, 0x0F,
+	0xFF, 0x00, 0x07, 0x00, 0x14, 0x19, 0x00, 0x39, 0x04, 0x00, 0x00, 0x1B, 0xFF, 0x07, 0x17, 0x0F,
+	0x00, 0x03, 0x06, 0x00, 0x00, 0x11, 0xFF, 0x00, 0x06, 0x00, 0x12, 0x1D, 0x00, 0x39, 0x03, 0x00,
+	0x00, 0x19, 0xFF, 0x05, 0x15, 0x19, 0x00, 0x00, 0x13, 0xFF, 0x00, 0x06, 0x00, 0x0F, 0x21, 0x00,
+	0x3A, 0x19, 0xFF, 0x07, 0x14, 0x19, 0x00, 0x00, 0x15, 0xFF, 0x00, 0x05, 0x00, 0x0E, 0x0C, 0x00,
+	0x00, 0x0B, 0xFF, 0x00, 0x0C, 0x00, 0x3A, 0x17, 0xFF, 0x09, 0x13, 0x09, 0x00, 0x00, 0x05, 0xFF,
+	0x00, 0x0C, 0x00, 0x00, 0x15, 0xFF, 0x00, 0x06, 0x00, 0x0C, 0x0A, 0x00, 0x00, 0x11, 0xFF, 0x00,
+	0x0A, 0x00, 0x3B, 0x13, 0xFF, 0x09, 0x13, 0x07, 0x00, 0x00, 0x09, 0xFF, 0x00, 0x09, 0x00, 0x00,
+	0x17, 0xFF, 0x00, 0x05, 0x00, 0x0A, 0x09, 0x00, 0x00, 0x17, 0xFF, 0x00, 0x09, 0x00, 0x3A, 0x11,
+	0xFF, 0x09, 0x12, 0x06, 0x00, 0x00, 0x0D, 0xFF, 0x00, 0x07, 0x00, 0x00, 0x17, 0xFF, 0x00, 0x06,
+	0x00, 0x08, 0x08, 0x00, 0x00, 0x1B, 0xFF, 0x00, 0x08, 0x00, 0x3B, 0x0D, 0xFF, 0x09, 0x11, 0x06,
+	0x00, 0x00, 0x0F, 0xFF, 0x00, 0x05, 0x00, 0x00, 0x19, 0xFF, 0x00, 0x05, 0x00, 0x07, 0x08, 0x00,
+	0x00, 0x1D, 0xFF, 0x00, 0x08, 0x00, 0x3D, 0x07, 0xFF, 0x08, 0x11, 0x06, 0x00, 0x00, 0x0F, 0xFF,
+	0x00, 0x05, 0x00, 0x00, 0x19, 0xFF, 0x00, 0x05, 0x00, 0x06, 0x08, 0x00, 0x00, 0x1F, 0xFF, 0x00,
+	0x08, 0x00, 0x08, 0x11, 0x05, 0x00, 0x00, 0x11, 0xFF, 0x00, 0x04, 0x00, 0x00, 0x19, 0xFF, 0x00,
+	0x05, 0x00, 0x05, 0x07, 0x00, 0x00, 0x23, 0xFF, 0x00, 0x07, 0x00, 0x0A, 0x10, 0x06, 0x00, 0x00,
+	0x11, 0xFF, 0x00, 0x04, 0x00, 0x00, 0x0A, 0xFF, 0x00, 0x09, 0x00, 0x00, 0x06, 0xFF, 0x00, 0x05,
+	0x00, 0x05, 0x06, 0x00, 0x00, 0x25, 0xFF, 0x00, 0x06, 0x00, 0x0A, 0x10, 0x05, 0x00, 0x00, 0x13,
+	0xFF, 0x00, 0x03, 0x00, 0x00, 0x06, 0xFF, 0x00, 0x11, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x05, 0x00,
+	0x04, 0x06, 0x00, 0x00, 0x27, 0xFF, 0x00, 0x06, 0x00, 0x08, 0x10, 0x05, 0x00, 0x00, 0x13, 0xFF,
+	0x00, 0x03, 0x00, 0x00, 0x04, 0xFF, 0x00, 0x1A, 0x00, 0x03, 0x06, 0x00, 0x00, 0x29, 0xFF, 0x00,
+	0x06, 0x00, 0x08, 0x07, 0x0E, 0x00, 0x00, 0x13, 0xFF, 0x00, 0x03, 0x00, 0x00, 0x02, 0xFF, 0x00,
+	0x1D, 0x00, 0x01, 0x07, 0x00, 0x00, 0x29, 0xFF, 0x00, 0x07, 0x00, 0x05, 0x05, 0x10, 0x00, 0x00,
+	0x13, 0xFF, 0x00, 0x29, 0x00, 0x00, 0x2B, 0xFF, 0x00, 0x06, 0x00, 0x07, 0x04, 0x11, 0x00, 0x00,
+	0x13, 0xFF, 0x00, 0x0D, 0x00, 0x00, 0x09, 0xFF, 0x00, 0x12, 0x00, 0x00, 0x2D, 0xFF, 0x00, 0x06,
+	0x00, 0x07, 0x03, 0x13, 0x00, 0x00, 0x11, 0xFF, 0x00, 0x0B, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x0E,
+	0x00, 0x00, 0x2F, 0xFF, 0x00, 0x05, 0x00, 0x07, 0x02, 0x0A, 0x00, 0x00, 0x1C, 0xFF, 0x00, 0x08,
+	0x00, 0x00, 0x13, 0xFF, 0x00, 0x0C, 0x00, 0x00, 0x2F, 0xFF, 0x00, 0x06, 0x00, 0x07, 0x01, 0x07,
+	0x00, 0x00, 0x1F, 0xFF, 0x00, 0x07, 0x00, 0x00, 0x17, 0xFF, 0x00, 0x09, 0x00, 0x00, 0x31, 0xFF,
+	0x00, 0x05, 0x00, 0x07, 0x01, 0x06, 0x00, 0x00, 0x1F, 0xFF, 0x00, 0x07, 0x00, 0x00, 0x19, 0xFF,
+	0x00, 0x08, 0x00, 0x00, 0x31, 0xFF, 0x00, 0x05, 0x00, 0x07, 0x00, 0x06, 0x00, 0x00, 0x1F, 0xFF,
+	0x00, 0x07, 0x00, 0x00, 0x1B, 0xFF, 0x00, 0x07, 0x00, 0x00, 0x31, 0xFF, 0x00, 0x06, 0x00, 0x07,
+	0x00, 0x05, 0x00, 0x00, 0x1F, 0xFF, 0x00, 0x07, 0x00, 0x00, 0x1D, 0xFF, 0x00, 0x05, 0x00, 0x00,
+	0x33, 0xFF, 0x00, 0x05, 0x00, 0x07, 0x00, 0x05, 0x00, 0x00, 0x1F, 0xFF, 0x00, 0x06, 0x00, 0x00,
+	0x1F, 0xFF, 0x00, 0x04, 0x00, 0x00, 0x33, 0xFF, 0x00, 0x05, 0x00, 0x07, 0x00, 0x05, 0x00, 0x00,
+	0x1E, 0xFF, 0x00, 0x06, 0x00, 0x00, 0x21, 0xFF, 0x00, 0x03, 0x00, 0x00, 0x33, 0xFF, 0x00, 0x05,
+	0x00, 0x07, 0x00, 0x05, 0x00, 0x00, 0x1E, 0xFF, 0x00, 0x05, 0x00, 0x00, 0x23, 0xFF, 0x00, 0x01,
+	0x00, 0x00, 0x35, 0xFF, 0x00, 0x05, 0x00, 0x07, 0x00, 0x05, 0x00, 0x00, 0x1D, 0xFF, 0x00, 0x06,
+	0x00, 0x00, 0x23, 0xFF, 0x00, 0x01, 0x00, 0x00, 0x35, 0xFF, 0x00, 0x05, 0x00, 0x05, 0x00, 0x06,
+	0x00, 0x00, 0x1C, 0xFF, 0x00, 0x05, 0x00, 0x00, 0x5A, 0xFF, 0x00, 0x05, 0x00, 0x05, 0x01, 0x06,
+	0x00, 0x00, 0x1A, 0xFF, 0x00, 0x06, 0x00, 0x00, 0x5A, 0xFF, 0x00, 0x05, 0x00, 0x05, 0x01, 0x07,
+	0x00, 0x00, 0x19, 0xFF, 0x00, 0x05, 0x00, 0x00, 0x5B, 0xFF, 0x00, 0x05, 0x00, 0x03, 0x02, 0x24,
+	0x00, 0x00, 0x5B, 0xFF, 0x00, 0x05, 0x00, 0x03, 0x03, 0x23, 0x00, 0x00, 0x5B, 0xFF, 0x00, 0x05,
+	0x00, 0x03, 0x04, 0x21, 0x00, 0x00, 0x5C, 0xFF, 0x00, 0x05, 0x00, 0x03, 0x05, 0x20, 0x00, 0x00,
+	0x5C, 0xFF, 0x00, 0x05, 0x00, 0x03, 0x07, 0x1E, 0x00, 0x00, 0x5C, 0xFF, 0x00, 0x05, 0x00, 0x03,
+	0x20, 0x05, 0x00, 0x00, 0x5C, 0xFF, 0x00, 0x05, 0x00, 0x03, 0x11, 0x14, 0x00, 0x00, 0x5B, 0xFF,
+	0x00, 0x06, 0x00, 0x03, 0x0E, 0x17, 0x00, 0x00, 0x5B, 0xFF, 0x00, 0x09, 0x00, 0x03, 0x0C, 0x19,
+	0x00, 0x00, 0x5B, 0xFF, 0x00, 0x0B, 0x00, 0x03, 0x0B, 0x1A, 0x00, 0x00, 0x5A, 0xFF, 0x00, 0x0D,
+	0x00, 0x03, 0x0A, 0x0D, 0x00, 0x00, 0x6A, 0xFF, 0x00, 0x0C, 0x00, 0x03, 0x09, 0x09, 0x00, 0x00,
+	0x73, 0xFF, 0x00, 0x09, 0x00, 0x03, 0x08, 0x07, 0x00, 0x00, 0x79, 0xFF, 0x00, 0x07, 0x00, 0x03,
+	0x07, 0x07, 0x00, 0x00, 0x7B, 0xFF, 0x00, 0x07, 0x00, 0x03, 0x06, 0x07, 0x00, 0x00, 0x7D, 0xFF,
+	0x00, 0x07, 0x00, 0x03, 0x05, 0x07, 0x00, 0x00, 0x7F, 0xFF, 0x00, 0x07, 0x00, 0x03, 0x05, 0x06,
+	0x00, 0x00, 0x81, 0xFF, 0x00, 0x06, 0x00, 0x03, 0x04, 0x06, 0x00, 0x00, 0x83, 0xFF, 0x00, 0x06,
+	0x00, 0x03, 0x04, 0x05, 0x00, 0x00, 0x85, 0xFF, 0x00, 0x05, 0x00, 0x03, 0x04, 0x05, 0x00, 0x00,
+	0x85, 0xFF, 0x00, 0x05, 0x00, 0x03, 0x03, 0x06, 0x00, 0x00, 0x85, 0xFF, 0x00, 0x06, 0x00, 0x03,
+	0x03, 0x05, 0x00, 0x00, 0x87, 0xFF, 0x00, 0x05, 0x00, 0x03, 0x03, 0x05, 0x00, 0x00, 0x87, 0xFF,
+	0x00, 0x05, 0x00, 0x03, 0x03, 0x05, 0x00, 0x00, 0x87, 0xFF, 0x00, 0x05, 0x00, 0x03, 0x03, 0x05,
+	0x00, 0x00, 0x87, 0xFF, 0x00, 0x05, 0x00, 0x03, 0x03, 0x05, 0x00, 0x00, 0x87, 0xFF, 0x00, 0x05,
+	0x00, 0x03, 0x03, 0x05, 0x00, 0x00, 0x87, 0xFF, 0x00, 0x05, 0x00, 0x03, 0x03, 0x05, 0x00, 0x00,
+	0x87, 0xFF, 0x00, 0x05, 0x00, 0x03, 0x03, 0x06, 0x00, 0x00, 0x85, 0xFF, 0x00, 0x06, 0x00, 0x03,
+	0x04, 0x05, 0x00, 0x00, 0x85, 0xFF, 0x00, 0x05, 0x00, 0x03, 0x04, 0x05, 0x00, 0x00, 0x85, 0xFF,
+	0x00, 0x05, 0x00, 0x03, 0x04, 0x06, 0x00, 0x00, 0x83, 0xFF, 0x00, 0x06, 0x00, 0x03, 0x05, 0x06,
+	0x00, 0x00, 0x81, 0xFF, 0x00, 0x06, 0x00, 0x03, 0x05, 0x07, 0x00, 0x00, 0x7F, 0xFF, 0x00, 0x07,
+	0x00, 0x03, 0x06, 0x07, 0x00, 0x00, 0x7D, 0xFF, 0x00, 0x07, 0x00, 0x03, 0x07, 0x07, 0x00, 0x00,
+	0x7B, 0xFF, 0x00, 0x07, 0x00, 0x03, 0x08, 0x07, 0x00, 0x00, 0x79, 0xFF, 0x00, 0x07, 0x00, 0x03,
+	0x09, 0x09, 0x00, 0x00, 0x73, 0xFF, 0x00, 0x09, 0x00, 0x01, 0x0A, 0x83, 0x00, 0x01, 0x0B, 0x81,
+	0x00, 0x01, 0x0C, 0x7F, 0x00, 0x01, 0x0E, 0x7B, 0x00, 0x01, 0x11, 0x75, 0x00,
+};
+constexpr uint8_t IconSprite_03n_L_y120_runs[] = {
+	0x01, 0xBA, 0x07, 0xFF, 0x01, 0xB7, 0x0D, 0xFF, 0x01, 0xB5, 0x11, 0xFF, 0x01, 0xB4, 0x13, 0xFF,
+	0x01, 0xB2, 0x17, 0xFF, 0x01, 0xB1, 0x19, 0xFF, 0x02, 0xAE, 0x03, 0x00, 0x00, 0x19, 0xFF, 0x02,
+	0xAC, 0x04, 0x00, 0x00, 0x1B, 0xFF, 0x02, 0xAB, 0x04, 0x00, 0x00, 0x1D, 0xFF, 0x02, 0xAA, 0x05,
+	0x00, 0x00, 0x1D, 0xFF, 0x02, 0xA9, 0x05, 0x00, 0x00, 0x1F, 0xFF, 0x02, 0xA8, 0x06, 0x00, 0x00,
+	0x1F, 0xFF, 0x02, 0xA8, 0x06, 0x00, 0x00, 0x1F, 0xFF, 0x02, 0xA7, 0x06, 0x00, 0x00, 0x21, 0xFF,
+	0x03, 0x33, 0x09, 0x00, 0x6B, 0x06, 0x00, 0x00, 0x21, 0xFF, 0x03, 0x31, 0x0D, 0x00, 0x69, 0x06,
+	0x00, 0x00, 0x21, 0xFF, 0x03, 0x2F, 0x11, 0x00, 0x67, 0x06, 0x00, 0x00, 0x21, 0xFF, 0x03, 0x2D,
+	0x15, 0x00, 0x65, 0x06, 0x00, 0x00, 0x21, 0xFF, 0x03, 0x2C, 0x17, 0x00, 0x64, 0x06, 0x00, 0x00,
+	0x21, 0xFF, 0x05, 0x2B, 0x09, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x09, 0x00, 0x63, 0x06, 0x00, 0x00,
+	0x21, 0xFF, 0x06, 0x1B, 0x07, 0x00, 0x08, 0x08, 0x00, 0x00, 0x0B, 0xFF, 0x00, 0x08, 0x00, 0x63,
+	0x06, 0x00, 0x00, 0x1F, 0xFF, 0x06, 0x18, 0x0D, 0x00, 0x04, 0x07, 0x00, 0x00, 0x0F, 0xFF, 0x00,
+	0x07, 0x00, 0x62, 0x06, 0x00, 0x00, 0x1F, 0xFF, 0x06, 0x17, 0x0F, 0x00, 0x03, 0x06, 0x00, 0x00,
+	0x11, 0xFF, 0x00, 0x06, 0x00, 0x63, 0x05, 0x00, 0x00, 0x1F, 0xFF, 0x06, 0x15, 0x19, 0x00, 0x00,
+	0x13, 0xFF, 0x00, 0x06, 0x00, 0x1A, 0x0B, 0x00, 0x3E, 0x05, 0x00, 0x00, 0x1D, 0xFF, 0x06, 0x14,
+	0x19, 0x00, 0x00, 0x15, 0xFF, 0x00, 0x05, 0x00, 0x16, 0x13, 0x00, 0x3B, 0x04, 0x00, 0x00, 0x1D,
+	0xFF, 0x08, 0x13, 0x09, 0x00, 0x00, 0x05, 0xFF, 0x00, 0x0C, 0x00, 0x00, 0x15, 0xFF, 0x00, 0x06,
+	0x00, 0x12, 0x19, 0x00, 0x39, 0x04, 0x00, 0x00, 0x1B, 0xFF, 0x08, 0x13, 0x07, 0x00, 0x00, 0x09,
+	0xFF, 0x00, 0x09, 0x00, 0x00, 0x17, 0xFF, 0x00, 0x05, 0x00, 0x10, 0x1D, 0x00, 0x39, 0x03, 0x00,
+	0x00, 0x19, 0xFF, 0x07, 0x12, 0x06, 0x00, 0x00, 0x0D, 0xFF, 0x00, 0x07, 0x00, 0x00, 0x17, 0xFF,
+	0x00, 0x06, 0x00, 0x0D, 0x21, 0x00, 0x3A, 0x19, 0xFF, 0x09, 0x11, 0x06, 0x00, 0x00, 0x0F, 0xFF,
+	0x00, 0x05, 0x00, 0x00, 0x19, 0xFF, 0x00, 0x05, 0x00, 0x0C, 0x0C, 0x00, 0x00, 0x0B, 0xFF, 0x00,
+	0x0C, 0x00, 0x3A, 0x17, 0xFF, 0x09, 0x11, 0x06, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x05, 0x00, 0x00,
+	0x19, 0xFF, 0x00, 0x05, 0x00, 0x0B, 0x0A, 0x00, 0x00, 0x11, 0xFF, 0x00, 0x0A, 0x00, 0x3B, 0x13,
+	0xFF, 0x09, 0x11, 0x05, 0x00, 0x00, 0x11, 0xFF, 0x00, 0x04, 0x00, 0x00, 0x19, 0xFF, 0x00, 0x05,
+	0x00, 0x09, 0x09, 0x00, 0x00, 0x17, 0xFF, 0x00, 0x09, 0x00, 0x3A, 0x11, 0xFF, 0x09, 0x10, 0x06,
+	0x00, 0x00, 0x11, 0xFF, 0x00, 0x04, 0x00, 0x00, 0x19, 0xFF, 0x00, 0x05, 0x00, 0x08, 0x08, 0x00,
+	0x00, 0x1B, 0xFF, 0x00, 0x08, 0x00, 0x3B, 0x0D, 0xFF, 0x09, 0x10, 0x05, 0x00, 0x00, 0x13, 0xFF,
+	0x00, 0x03, 0x00, 0x00, 0x19, 0xFF, 0x00, 0x05, 0x00, 0x07, 0x08, 0x00, 0x00, 0x1D, 0xFF, 0x00,
+	0x08, 0x00, 0x3D, 0x07, 0xFF, 0x08, 0x10, 0x05, 0x00, 0x00, 0x13, 0xFF, 0x00, 0x03, 0x00, 0x00,
+	0x19, 0xFF, 0x00, 0x05, 0x00, 0x06, 0x08, 0x00, 0x00, 0x1F, 0xFF, 0x00, 0x08, 0x00, 0x08, 0x07,
+	0x0E, 0x00, 0x00, 0x13, 0xFF, 0x00, 0x03, 0x00, 0x00, 0x19, 0xFF, 0x00, 0x06, 0x00, 0x04, 0x07,
+	0x00, 0x00, 0x23, 0xFF, 0x00, 0x07, 0x00, 0x0A, 0x05, 0x10, 0x00, 0x00, 0x13, 0xFF, 0x00, 0x04,
+	0x00, 0x00, 0x09, 0xFF, 0x00, 0x09, 0x00, 0x00, 0x05, 0xFF, 0x00, 0x09, 0x00, 0x02, 0x06, 0x00,
+	0x00, 0x25, 0xFF, 0x00, 0x06, 0x00, 0x09, 0x04, 0x11, 0x00, 0x00, 0x13, 0xFF, 0x00, 0x04, 0x00,
+	0x00, 0x05, 0xFF, 0x00, 0x11, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x10, 0x00, 0x00, 0x27, 0xFF, 0x00,
+	0x06, 0x00, 0x07, 0x03, 0x13, 0x00, 0x00, 0x11, 0xFF, 0x00, 0x06, 0x00, 0x00, 0x02, 0xFF, 0x00,
+	0x23, 0x00, 0x00, 0x29, 0xFF, 0x00, 0x06, 0x00, 0x07, 0x02, 0x0A, 0x00, 0x00, 0x21, 0xFF, 0x00,
+	0x19, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x0B, 0x00, 0x00, 0x29, 0xFF, 0x00, 0x07, 0x00, 0x07, 0x01,
+	0x07, 0x00, 0x00, 0x23, 0xFF, 0x00, 0x1D, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x08, 0x00, 0x00, 0x2B,
+	0xFF, 0x00, 0x06, 0x00, 0x09, 0x01, 0x06, 0x00, 0x00, 0x23, 0xFF, 0x00, 0x0B, 0x00, 0x00, 0x09,
+	0xFF, 0x00, 0x0B, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x06, 0x00, 0x00, 0x2D, 0xFF, 0x00, 0x06, 0x00,
+	0x07, 0x00, 0x06, 0x00, 0x00, 0x23, 0xFF, 0x00, 0x09, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x0E, 0x00,
+	0x00, 0x2F, 0xFF, 0x00, 0x05, 0x00, 0x07, 0x00, 0x05, 0x00, 0x00, 0x23, 0xFF, 0x00, 0x08, 0x00,
+	0x00, 0x13, 0xFF, 0x00, 0x0C, 0x00, 0x00, 0x2F, 0xFF, 0x00, 0x06, 0x00, 0x07, 0x00, 0x05, 0x00,
+	0x00, 0x22, 0xFF, 0x00, 0x07, 0x00, 0x00, 0x17, 0xFF, 0x00, 0x09, 0x00, 0x00, 0x31, 0xFF, 0x00,
+	0x05, 0x00, 0x07, 0x00, 0x05, 0x00, 0x00, 0x21, 0xFF, 0x00, 0x07, 0x00, 0x00, 0x19, 0xFF, 0x00,
+	0x08, 0x00, 0x00, 0x31, 0xFF, 0x00, 0x05, 0x00, 0x07, 0x00, 0x05, 0x00, 0x00, 0x20, 0xFF, 0x00,
+	0x07, 0x00, 0x00, 0x1B, 0xFF, 0x00, 0x07, 0x00, 0x00, 0x31, 0xFF, 0x00, 0x06, 0x00, 0x07, 0x00,
+	0x05, 0x00, 0x00, 0x1F, 0xFF, 0x00, 0x07, 0x00, 0x00, 0x1D, 0xFF, 0x00, 0x05, 0x00, 0x00, 0x33,
+	0xFF, 0x00, 0x05, 0x00, 0x07, 0x00, 0x06, 0x00, 0x00, 0x1E, 0xFF, 0x00, 0x06, 0x00, 0x00, 0x1F,
+	0xFF, 0x00, 0x04, 0x00, 0x00, 0x33, 0xFF, 0x00, 0x05, 0x00, 0x07, 0x01, 0x06, 0x00, 0x00, 0x1C,
+	0xFF, 0x00, 0x06, 0x00, 0x00, 0x21, 0xFF, 0x00, 0x03, 0x00, 0x00, 0x33, 0xFF, 0x00, 0x05, 0x00,
+	0x07, 0x01, 0x07, 0x00, 0x00, 0x1B, 0xFF, 0x00, 0x05, 0x00, 0x00, 0x23, 0xFF, 0x00, 0x01, 0x00,
+	0x00, 0x35, 0xFF, 0x00, 0x05, 0x00, 0x05, 0x02, 0x26, 0x00, 0x00, 0x23, 0xFF, 0x00, 0x01, 0x00,
+	0x00, 0x35, 0xFF, 0x00, 0x05, 0x00, 0x03, 0x03, 0x24, 0x00, 0x00, 0x5A, 0xFF, 0x00, 0x05, 0x00,
+	0x03, 0x04, 0x23, 0x00, 0x00, 0x5A, 0xFF, 0x00, 0x05, 0x00, 0x03, 0x05, 0x21, 0x00, 0x00, 0x5B,
+	0xFF, 0x00, 0x05, 0x00, 0x03, 0x07, 0x1F, 0x00, 0x00, 0x5B, 0xFF, 0x00, 0x05, 0x00, 0x03, 0x21,
+	0x05, 0x00, 0x00, 0x5B, 0xFF, 0x00, 0x05, 0x00, 0x03, 0x20, 0x05, 0x00, 0x00, 0x5C, 0xFF, 0x00,
+	0x05, 0x00, 0x03, 0x20, 0x05, 0x00, 0x00, 0x5C, 0xFF, 0x00, 0x05, 0x00, 0x03, 0x20, 0x05, 0x00,
+	0x00, 0x5C, 0xFF, 0x00, 0x05, 0x00, 0x03, 0x20, 0x05, 0x00, 0x00, 0x5C, 0xFF, 0x00, 0x05, 0x00,
+	0x03, 0x11, 0x14, 0x00, 0x00, 0x5B, 0xFF, 0x00, 0x06, 0x00, 0x03, 0x0E, 0x17, 0x00, 0x00, 0x5B,
+	0xFF, 0x00, 0x09, 0x00, 0x03, 0x0C, 0x19, 0x00, 0x00, 0x5B, 0xFF, 0x00, 0x0B, 0x00, 0x03, 0x0B,
+	0x1A, 0x00, 0x00, 0x5A, 0xFF, 0x00, 0x0D, 0x00, 0x03, 0x0A, 0x0D, 0x00, 0x00, 0x6A, 0xFF, 0x00,
+	0x0C, 0x00, 0x03, 0x09, 0x09, 0x00, 0x00, 0x73, 0xFF, 0x00, 0x09, 0x00, 0x03, 0x08, 0x07, 0x00,
+	0x00, 0x79, 0xFF, 0x00, 0x07, 0x00, 0x03, 0x07, 0x07, 0x00, 0x00, 0x7B, 0xFF, 0x00, 0x07, 0x00,
+	0x03, 0x06, 0x07, 0x00, 0x00, 0x7D, 0xFF, 0x00, 0x07, 0x00, 0x03, 0x05, 0x07, 0x00, 0x00, 0x7F,
+	0xFF, 0x00, 0x07, 0x00, 0x03, 0x05, 0x06, 0x00, 0x00, 0x81, 0xFF, 0x00, 0x06, 0x00, 0x03, 0x04,
+	0x06, 0x00, 0x00, 0x83, 0xFF, 0x00, 0x06, 0x00, 0x03, 0x04, 0x05, 0x00, 0x00, 0x85, 0xFF, 0x00,
+	0x05, 0x00, 0x03, 0x04, 0x05, 0x00, 0x00, 0x85, 0xFF, 0x00, 0x05, 0x00, 0x03, 0x03, 0x06, 0x00,
+	0x00, 0x85, 0xFF, 0x00, 0x06, 0x00, 0x03, 0x03, 0x05, 0x00, 0x00, 0x87, 0xFF, 0x00, 0x05, 0x00,
+	0x03, 0x03, 0x05, 0x00, 0x00, 0x87, 0xFF, 0x00, 0x05, 0x00, 0x03, 0x03, 0x05, 0x00, 0x00, 0x87,
+	0xFF, 0x00, 0x05, 0x00, 0x03, 0x03, 0x05, 0x00, 0x00, 0x87, 0xFF, 0x00, 0x05, 0x00, 0x03, 0x03,
+	0x05, 0x00, 0x00, 0x87, 0xFF, 0x00, 0x05, 0x00, 0x03, 0x03, 0x05, 0x00, 0x00, 0x87, 0xFF, 0x00,
+	0x05, 0x00, 0x03, 0x03, 0x05, 0x00, 0x00, 0x87, 0xFF, 0x00, 0x05, 0x00, 0x03, 0x03, 0x06, 0x00,
+	0x00, 0x85, 0xFF, 0x00, 0x06, 0x00, 0x03, 0x04, 0x05, 0x00, 0x00, 0x85, 0xFF, 0x00, 0x05, 0x00,
+	0x03, 0x04, 0x05, 0x00, 0x00, 0x85, 0xFF, 0x00, 0x05, 0x00, 0x03, 0x04, 0x06, 0x00, 0x00, 0x83,
+	0xFF, 0x00, 0x06, 0x00, 0x03, 0x05, 0x06, 0x00, 0x00, 0x81, 0xFF, 0x00, 0x06, 0x00, 0x03, 0x05,
+	0x07, 0x00, 0x00, 0x7F, 0xFF, 0x00, 0x07, 0x00, 0x03, 0x06, 0x07, 0x00, 0x00, 0x7D, 0xFF, 0x00,
+	0x07, 0x00, 0x03, 0x07, 0x07, 0x00, 0x00, 0x7B, 0xFF, 0x00, 0x07, 0x00, 0x03, 0x08, 0x07, 0x00,
+	0x00, 0x79, 0xFF, 0x00, 0x07, 0x00, 0x03, 0x09, 0x09, 0x00, 0x00, 0x73, 0xFF, 0x00, 0x09, 0x00,
+	0x01, 0x0A, 0x83, 0x00, 0x01, 0x0B, 0x81, 0x00, 0x01, 0x0C, 0x7F, 0x00, 0x01, 0x0E, 0x7B, 0x00,
+	0x01, 0x11, 0x75, 0x00,
+};
+constexpr uint8_t IconSprite_03n_S_y305_runs[] = {
+	0x01, 0x52, 0x07, 0xFF, 0x01, 0x4F, 0x0D, 0xFF, 0x01, 0x4D, 0x11, 0xFF, 0x01, 0x4C, 0x13, 0xFF,
+	0x01, 0x4A, 0x17, 0xFF, 0x01, 0x49, 0x19, 0xFF, 0x02, 0x46, 0x03, 0x00, 0x00, 0x19, 0xFF, 0x02,
+	0x44, 0x04, 0x00, 0x00, 0x1B, 0xFF, 0x02, 0x43, 0x04, 0x00, 0x00, 0x1D, 0xFF, 0x02, 0x42, 0x05,
+	0x00, 0x00, 0x1D, 0xFF, 0x02, 0x41, 0x05, 0x00, 0x00, 0x1F, 0xFF, 0x02, 0x40, 0x06, 0x00, 0x00,
+	0x1F, 0xFF, 0x02, 0x40, 0x06, 0x00, 0x00, 0x1F, 0xFF, 0x02, 0x3F, 0x06, 0x00, 0x00, 0x21, 0xFF,
+	0x02, 0x3F, 0x06, 0x00, 0x00, 0x21, 0xFF, 0x02, 0x3F, 0x06, 0x00, 0x00, 0x21, 0xFF, 0x02, 0x3F,
+	0x06, 0x00, 0x00, 0x21, 0xFF, 0x02, 0x3F, 0x06, 0x00, 0x00, 0x21, 0xFF, 0x03, 0x29, 0x05, 0x00,
+	0x11, 0x06, 0x00, 0x00, 0x21, 0xFF, 0x03, 0x27, 0x09, 0x00, 0x0F, 0x06, 0x00, 0x00, 0x21, 0xFF,
+	0x03, 0x26, 0x0B, 0x00, 0x0F, 0x06, 0x00, 0x00, 0x1F, 0xFF, 0x04, 0x1D, 0x05, 0x00, 0x03, 0x0D,
+	0x00, 0x0E, 0x06, 0x00, 0x00, 0x1F, 0xFF, 0x03, 0x1B, 0x18, 0x00, 0x0E, 0x05, 0x00, 0x00, 0x1F,
+	0xFF, 0x05, 0x1A, 0x10, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x06, 0x00, 0x0F, 0x05, 0x00, 0x00, 0x1D,
+	0xFF, 0x05, 0x19, 0x10, 0x00, 0x00, 0x05, 0xFF, 0x00, 0x06, 0x00, 0x0F, 0x04, 0x00, 0x00, 0x1D,
+	0xFF, 0x05, 0x19, 0x0F, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x05, 0x00, 0x10, 0x04, 0x00, 0x00, 0x1B,
+	0xFF, 0x07, 0x18, 0x06, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x07, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x05,
+	0x00, 0x12, 0x03, 0x00, 0x00, 0x19, 0xFF, 0x06, 0x18, 0x05, 0x00, 0x00, 0x05, 0xFF, 0x00, 0x06,
+	0x00, 0x00, 0x07, 0xFF, 0x00, 0x05, 0x00, 0x15, 0x19, 0xFF, 0x06, 0x13, 0x0A, 0x00, 0x00, 0x05,
+	0xFF, 0x00, 0x07, 0x00, 0x00, 0x05, 0xFF, 0x00, 0x08, 0x00, 0x14, 0x17, 0xFF, 0x06, 0x12, 0x0B,
+	0x00, 0x00, 0x05, 0xFF, 0x00, 0x08, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x0A, 0x00, 0x15, 0x13, 0xFF,
+	0x04, 0x11, 0x0D, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x17, 0x00, 0x15, 0x11, 0xFF, 0x02, 0x10, 0x2A,
+	0x00, 0x15, 0x0D, 0xFF, 0x04, 0x10, 0x07, 0x00, 0x00, 0x11, 0xFF, 0x00, 0x13, 0x00, 0x17, 0x07,
+	0xFF, 0x05, 0x10, 0x05, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x01, 0x00, 0x00, 0x10, 0xFF, 0x00, 0x15,
+	0x00, 0x03, 0x10, 0x1E, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x08, 0x00, 0x03, 0x10, 0x1C, 0x00, 0x00,
+	0x0B, 0xFF, 0x00, 0x07, 0x00, 0x03, 0x11, 0x1A, 0x00, 0x00, 0x0D, 0xFF, 0x00, 0x07, 0x00, 0x03,
+	0x12, 0x18, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x06, 0x00, 0x03, 0x13, 0x16, 0x00, 0x00, 0x11, 0xFF,
+	0x00, 0x06, 0x00, 0x03, 0x12, 0x16, 0x00, 0x00, 0x13, 0xFF, 0x00, 0x05, 0x00, 0x05, 0x11, 0x08,
+	0x00, 0x00, 0x05, 0xFF, 0x00, 0x0A, 0x00, 0x00, 0x13, 0xFF, 0x00, 0x05, 0x00, 0x05, 0x11, 0x06,
+	0x00, 0x00, 0x09, 0xFF, 0x00, 0x07, 0x00, 0x00, 0x15, 0xFF, 0x00, 0x05, 0x00, 0x05, 0x10, 0x06,
+	0x00, 0x00, 0x0B, 0xFF, 0x00, 0x06, 0x00, 0x00, 0x15, 0xFF, 0x00, 0x05, 0x00, 0x05, 0x10, 0x05,
+	0x00, 0x00, 0x0D, 0xFF, 0x00, 0x05, 0x00, 0x00, 0x15, 0xFF, 0x00, 0x05, 0x00, 0x05, 0x0F, 0x06,
+	0x00, 0x00, 0x0D, 0xFF, 0x00, 0x05, 0x00, 0x00, 0x15, 0xFF, 0x00, 0x05, 0x00, 0x05, 0x0F, 0x05,
+	0x00, 0x00, 0x0F, 0xFF, 0x00, 0x04, 0x00, 0x00, 0x15, 0xFF, 0x00, 0x05, 0x00, 0x05, 0x0F, 0x05,
+	0x00, 0x00, 0x0F, 0xFF, 0x00, 0x04, 0x00, 0x00, 0x15, 0xFF, 0x00, 0x05, 0x00, 0x05, 0x07, 0x0D,
+	0x00, 0x00, 0x0F, 0xFF, 0x00, 0x04, 0x00, 0x00, 0x15, 0xFF, 0x00, 0x06, 0x00, 0x05, 0x05, 0x0F,
+	0x00, 0x00, 0x0F, 0xFF, 0x00, 0x05, 0x00, 0x00, 0x13, 0xFF, 0x00, 0x09, 0x00, 0x05, 0x03, 0x11,
+	0x00, 0x00, 0x0F, 0xFF, 0x00, 0x05, 0x00, 0x00, 0x13, 0xFF, 0x00, 0x0B, 0x00, 0x05, 0x02, 0x13,
+	0x00, 0x00, 0x0D, 0xFF, 0x00, 0x07, 0x00, 0x00, 0x11, 0xFF, 0x00, 0x0D, 0x00, 0x03, 0x02, 0x09,
+	0x00, 0x00, 0x35, 0xFF, 0x00, 0x07, 0x00, 0x03, 0x01, 0x07, 0x00, 0x00, 0x39, 0xFF, 0x00, 0x07,
+	0x00, 0x03, 0x01, 0x05, 0x00, 0x00, 0x3D, 0xFF, 0x00, 0x05, 0x00, 0x03, 0x00, 0x06, 0x00, 0x00,
+	0x3D, 0xFF, 0x00, 0x06, 0x00, 0x03, 0x00, 0x05, 0x00, 0x00, 0x3F, 0xFF, 0x00, 0x05, 0x00, 0x03,
+	0x00, 0x05, 0x00, 0x00, 0x3F, 0xFF, 0x00, 0x05, 0x00, 0x03, 0x00, 0x05, 0x00, 0x00, 0x3F, 0xFF,
+	0x00, 0x05, 0x00, 0x03, 0x00, 0x06, 0x00, 0x00, 0x3D, 0xFF, 0x00, 0x06, 0x00, 0x03, 0x01, 0x05,
+	0x00, 0x00, 0x3D, 0xFF, 0x00, 0x05, 0x00, 0x03, 0x01, 0x07, 0x00, 0x00, 0x39, 0xFF, 0x00, 0x07,
+	0x00, 0x01, 0x02, 0x45, 0x00, 0x01, 0x02, 0x45, 0x00, 0x01, 0x03, 0x43, 0x00, 0x01, 0x05, 0x3F,
+	0x00, 0x01, 0x07, 0x3B, 0x00,
+};
+constexpr uint8_t IconSprite_04d_L_runs[] = {
+	0x01, 0x2C, 0x05, 0x00, 0x01, 0x2C, 0x05, 0x00, 0x01, 0x2C, 0x05, 0x00, 0x01, 0x2C, 0x05, 0x00,
+	0x01, 0x2C, 0x05, 0x00, 0x01, 0x2C, 0x05, 0x00, 0x01, 0x2C, 0x05, 0x00, 0x01, 0x2C, 0x05, 0x00,
+	0x01, 0x2C, 0x05, 0x00, 0x01, 0x2C, 0x05, 0x00, 0x03, 0x12, 0x01, 0x00, 0x19, 0x05, 0x00, 0x15,
+	0x01, 0x00, 0x03, 0x11, 0x03, 0x00, 0x18, 0x05, 0x00, 0x14, 0x03, 0x00, 0x03, 0x10, 0x05, 0x00,
+	0x17, 0x05, 0x00, 0x13, 0x05, 0x00, 0x03, 0x0F, 0x07, 0x00, 0x16, 0x05, 0x00, 0x12, 0x07, 0x00,
+	0x03, 0x0E, 0x09, 0x00, 0x10, 0x0B, 0xFF, 0x10, 0x09, 0x00, 0x04, 0x0F, 0x09, 0x00, 0x0C, 0x11,
+	0xFF, 0x0C, 0x09, 0x00, 0x1F, 0x0B, 0x00, 0x04, 0x10, 0x09, 0x00, 0x08, 0x17, 0xFF, 0x08, 0x09,
+	0x00, 0x1B, 0x15, 0x00, 0x04, 0x11, 0x09, 0x00, 0x05, 0x1B, 0xFF, 0x05, 0x09, 0x00, 0x1A, 0x19,
+	0x00, 0x04, 0x12, 0x09, 0x00, 0x03, 0x1D, 0xFF, 0x03, 0x09, 0x00, 0x18, 0x1F, 0x00, 0x04, 0x13,
+	0x09, 0x00, 0x01, 0x1F, 0xFF, 0x01, 0x09, 0x00, 0x17, 0x23, 0x00, 0x08, 0x14, 0x07, 0x00, 0x00,
+	0x0D, 0xFF, 0x00, 0x09, 0x00, 0x00, 0x0D, 0xFF, 0x00, 0x07, 0x00, 0x17, 0x0D, 0x00, 0x00, 0x0B,
+	0xFF, 0x00, 0x0D, 0x00, 0x08, 0x15, 0x05, 0x00, 0x00, 0x0B, 0xFF, 0x00, 0x0F, 0x00, 0x00, 0x0B,
+	0xFF, 0x00, 0x05, 0x00, 0x16, 0x0B, 0x00, 0x00, 0x13, 0xFF, 0x00, 0x0B, 0x00, 0x08, 0x16, 0x03,
+	0x00, 0x00, 0x0A, 0xFF, 0x00, 0x13, 0x00, 0x00, 0x0A, 0xFF, 0x00, 0x03, 0x00, 0x16, 0x0A, 0x00,
+	0x00, 0x17, 0xFF, 0x00, 0x0A, 0x00, 0x08, 0x17, 0x01, 0x00, 0x00, 0x09, 0xFF, 0x00, 0x17, 0x00,
+	0x00, 0x09, 0xFF, 0x00, 0x01, 0x00, 0x16, 0x08, 0x00, 0x00, 0x1D, 0xFF, 0x00, 0x08, 0x00, 0x06,
+	0x18, 0x08, 0xFF, 0x00, 0x19, 0x00, 0x00, 0x08, 0xFF, 0x16, 0x08, 0x00, 0x00, 0x1F, 0xFF, 0x00,
+	0x08, 0x00, 0x08, 0x17, 0x08, 0xFF, 0x00, 0x0A, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x0A, 0x00, 0x00,
+	0x08, 0xFF, 0x14, 0x07, 0x00, 0x00, 0x23, 0xFF, 0x00, 0x07, 0x00, 0x08, 0x16, 0x08, 0xFF, 0x00,
+	0x08, 0x00, 0x00, 0x0D, 0xFF, 0x00, 0x08, 0x00, 0x00, 0x08, 0xFF, 0x12, 0x07, 0x00, 0x00, 0x25,
+	0xFF, 0x00, 0x07, 0x00, 0x08, 0x15, 0x08, 0xFF, 0x00, 0x07, 0x00, 0x00, 0x11, 0xFF, 0x00, 0x07,
+	0x00, 0x00, 0x08, 0xFF, 0x10, 0x07, 0x00, 0x00, 0x27, 0xFF, 0x00, 0x07, 0x00, 0x08, 0x15, 0x07,
+	0xFF, 0x00, 0x07, 0x00, 0x00, 0x13, 0xFF, 0x00, 0x0C, 0x00, 0x00, 0x02, 0xFF, 0x0F, 0x07, 0x00,
+	0x00, 0x29, 0xFF, 0x00, 0x07, 0x00, 0x07, 0x14, 0x07, 0xFF, 0x00, 0x07, 0x00, 0x00, 0x11, 0xFF,
+	0x00, 0x13, 0x00, 0x0C, 0x07, 0x00, 0x00, 0x2B, 0xFF, 0x00, 0x07, 0x00, 0x07, 0x14, 0x07, 0xFF,
+	0x00, 0x06, 0x00, 0x00, 0x10, 0xFF, 0x00, 0x17, 0x00, 0x09, 0x07, 0x00, 0x00, 0x2D, 0xFF, 0x00,
+	0x07, 0x00, 0x07, 0x14, 0x06, 0xFF, 0x00, 0x06, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x1B, 0x00, 0x07,
+	0x06, 0x00, 0x00, 0x2F, 0xFF, 0x00, 0x06, 0x00, 0x07, 0x13, 0x07, 0xFF, 0x00, 0x05, 0x00, 0x00,
+	0x0E, 0xFF, 0x00, 0x1F, 0x00, 0x04, 0x06, 0x00, 0x00, 0x31, 0xFF, 0x00, 0x06, 0x00, 0x09, 0x13,
+	0x06, 0xFF, 0x00, 0x06, 0x00, 0x00, 0x0D, 0xFF, 0x00, 0x0C, 0x00, 0x00, 0x09, 0xFF, 0x00, 0x0C,
+	0x00, 0x02, 0x06, 0x00, 0x00, 0x33, 0xFF, 0x00, 0x06, 0x00, 0x09, 0x13, 0x06, 0xFF, 0x00, 0x05,
+	0x00, 0x00, 0x0D, 0xFF, 0x00, 0x09, 0x00, 0x00, 0x11, 0xFF, 0x00, 0x09, 0x00, 0x01, 0x06, 0x00,
+	0x00, 0x33, 0xFF, 0x00, 0x06, 0x00, 0x08, 0x12, 0x07, 0xFF, 0x00, 0x05, 0x00, 0x00, 0x0B, 0xFF,
+	0x00, 0x09, 0x00, 0x00, 0x15, 0xFF, 0x00, 0x0D, 0x00, 0x00, 0x35, 0xFF, 0x00, 0x06, 0x00, 0x08,
+	0x12, 0x06, 0xFF, 0x00, 0x06, 0x00, 0x00, 0x0A, 0xFF, 0x00, 0x08, 0x00, 0x00, 0x19, 0xFF, 0x00,
+	0x0A, 0x00, 0x00, 0x37, 0xFF, 0x00, 0x05, 0x00, 0x08, 0x12, 0x06, 0xFF, 0x00, 0x05, 0x00, 0x00,
+	0x0A, 0xFF, 0x00, 0x08, 0x00, 0x00, 0x1B, 0xFF, 0x00, 0x09, 0x00, 0x00, 0x37, 0xFF, 0x00, 0x05,
+	0x00, 0x08, 0x12, 0x06, 0xFF, 0x00, 0x05, 0x00, 0x00, 0x0A, 0xFF, 0x00, 0x07, 0x00, 0x00, 0x1D,
+	0xFF, 0x00, 0x08, 0x00, 0x00, 0x37, 0xFF, 0x00, 0x06, 0x00, 0x08, 0x12, 0x06, 0xFF, 0x00, 0x05,
+	0x00, 0x00, 0x09, 0xFF, 0x00, 0x06, 0x00, 0x00, 0x21, 0xFF, 0x00, 0x05, 0x00, 0x00, 0x39, 0xFF,
+	0x00, 0x05, 0x00, 0x09, 0x04, 0x0E, 0x00, 0x00, 0x06, 0xFF, 0x00, 0x05, 0x00, 0x00, 0x08, 0xFF,
+	0x00, 0x06, 0x00, 0x00, 0x23, 0xFF, 0x00, 0x04, 0x00, 0x00, 0x39, 0xFF, 0x00, 0x06, 0x00, 0x09,
+	0x04, 0x0E, 0x00, 0x00, 0x06, 0xFF, 0x00, 0x05, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x07, 0x00, 0x00,
+	0x23, 0xFF, 0x00, 0x03, 0x00, 0x00, 0x3B, 0xFF, 0x00, 0x05, 0x00, 0x09, 0x04, 0x0E, 0x00, 0x00,
+	0x06, 0xFF, 0x00, 0x05, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x06, 0x00, 0x00, 0x25, 0xFF, 0x00, 0x02,
+	0x00, 0x00, 0x3B, 0xFF, 0x00, 0x05, 0x00, 0x09, 0x04, 0x0E, 0x00, 0x00, 0x06, 0xFF, 0x00, 0x05,
+	0x00, 0x00, 0x06, 0xFF, 0x00, 0x06, 0x00, 0x00, 0x27, 0xFF, 0x00, 0x01, 0x00, 0x00, 0x3B, 0xFF,
+	0x00, 0x05, 0x00, 0x07, 0x04, 0x0E, 0x00, 0x00, 0x06, 0xFF, 0x00, 0x06, 0x00, 0x00, 0x05, 0xFF,
+	0x00, 0x05, 0x00, 0x00, 0x64, 0xFF, 0x00, 0x05, 0x00, 0x06, 0x12, 0x07, 0xFF, 0x00, 0x05, 0x00,
+	0x00, 0x04, 0xFF, 0x00, 0x06, 0x00, 0x00, 0x65, 0xFF, 0x00, 0x05, 0x00, 0x06, 0x13, 0x06, 0xFF,
+	0x00, 0x05, 0x00, 0x00, 0x04, 0xFF, 0x00, 0x05, 0x00, 0x00, 0x66, 0xFF, 0x00, 0x05, 0x00, 0x06,
+	0x13, 0x06, 0xFF, 0x00, 0x06, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x06, 0x00, 0x00, 0x66, 0xFF, 0x00,
+	0x05, 0x00, 0x06, 0x13, 0x07, 0xFF, 0x00, 0x05, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x05, 0x00, 0x00,
+	0x67, 0xFF, 0x00, 0x05, 0x00, 0x06, 0x14, 0x06, 0xFF, 0x00, 0x06, 0x00, 0x00, 0x01, 0xFF, 0x00,
+	0x05, 0x00, 0x00, 0x67, 0xFF, 0x00, 0x05, 0x00, 0x04, 0x14, 0x07, 0xFF, 0x00, 0x0B, 0x00, 0x00,
+	0x67, 0xFF, 0x00, 0x05, 0x00, 0x04, 0x14, 0x07, 0xFF, 0x00, 0x0B, 0x00, 0x00, 0x67, 0xFF, 0x00,
+	0x05, 0x00, 0x04, 0x15, 0x07, 0xFF, 0x00, 0x09, 0x00, 0x00, 0x68, 0xFF, 0x00, 0x05, 0x00, 0x04,
+	0x15, 0x08, 0xFF, 0x00, 0x08, 0x00, 0x00, 0x68, 0xFF, 0x00, 0x05, 0x00, 0x04, 0x16, 0x08, 0xFF,
+	0x00, 0x07, 0x00, 0x00, 0x68, 0xFF, 0x00, 0x05, 0x00, 0x04, 0x17, 0x08, 0xFF, 0x00, 0x06, 0x00,
+	0x00, 0x68, 0xFF, 0x00, 0x05, 0x00, 0x03, 0x10, 0x15, 0x00, 0x00, 0x67, 0xFF, 0x00, 0x05, 0x00,
+	0x03, 0x0D, 0x18, 0x00, 0x00, 0x67, 0xFF, 0x00, 0x08, 0x00, 0x03, 0x0B, 0x1A, 0x00, 0x00, 0x67,
+	0xFF, 0x00, 0x0A, 0x00, 0x03, 0x09, 0x1C, 0x00, 0x00, 0x67, 0xFF, 0x00, 0x0C, 0x00, 0x03, 0x08,
+	0x0E, 0x00, 0x00, 0x76, 0xFF, 0x00, 0x0D, 0x00, 0x03, 0x07, 0x0A, 0x00, 0x00, 0x7F, 0xFF, 0x00,
+	0x0A, 0x00, 0x03, 0x06, 0x08, 0x00, 0x00, 0x85, 0xFF, 0x00, 0x08, 0x00, 0x03, 0x05, 0x07, 0x00,
+	0x00, 0x89, 0xFF, 0x00, 0x07, 0x00, 0x03, 0x04, 0x07, 0x00, 0x00, 0x8B, 0xFF, 0x00, 0x07, 0x00,
+	0x03, 0x03, 0x07, 0x00, 0x00, 0x8D, 0xFF, 0x00, 0x07, 0x00, 0x03, 0x03, 0x06, 0x00, 0x00, 0x8F,
+	0xFF, 0x00, 0x06, 0x00, 0x03, 0x02, 0x06, 0x00, 0x00, 0x91, 0xFF, 0x00, 0x06, 0x00, 0x03, 0x02,
+	0x05, 0x00, 0x00, 0x93, 0xFF, 0x00, 0x05, 0x00, 0x03, 0x01, 0x06, 0x00, 0x00, 0x93, 0xFF, 0x00,
+	0x06, 0x00, 0x03, 0x01, 0x05, 0x00, 0x00, 0x95, 0xFF, 0x00, 0x05, 0x00, 0x03, 0x01, 0x05, 0x00,
+	0x00, 0x95, 0xFF, 0x00, 0x05, 0x00, 0x03, 0x00, 0x06, 0x00, 0x00, 0x95, 0xFF, 0x00, 0x06, 0x00,
+	0x03, 0x00, 0x05, 0x00, 0x00, 0x97, 0xFF, 0x00, 0x05, 0x00, 0x03, 0x00, 0x05, 0x00, 0x00, 0x97,
+	0xFF, 0x00, 0x05, 0x00, 0x03, 0x00, 0x05, 0x00, 0x00, 0x97, 0xFF, 0x00, 0x05, 0x00, 0x03, 0x00,
+	0x05, 0x00, 0x00, 0x97, 0xFF, 0x00, 0x05, 0x00, 0x03, 0x00, 0x05, 0x00, 0x00, 0x97, 0xFF, 0x00,
+	0x05, 0x00, 0x03, 0x00, 0x05, 0x00, 0x00, 0x97, 0xFF, 0x00, 0x05, 0x00, 0x03, 0x00, 0x05, 0x00,
+	0x00, 0x97, 0xFF, 0x00, 0x05, 0x00, 0x03, 0x00, 0x06, 0x00, 0x00, 0x95, 0xFF, 0x00, 0x06, 0x00,
+	0x03, 0x01, 0x05, 0x00, 0x00, 0x95, 0xFF, 0x00, 0x05, 0x00, 0x03, 0x01, 0x05, 0x00, 0x00, 0x95,
+	0xFF, 0x00, 0x05, 0x00, 0x03, 0x01, 0x06, 0x00, 0x00, 0x93, 0xFF, 0x00, 0x06, 0x00, 0x03, 0x02,
+	0x05, 0x00, 0x00, 0x93, 0xFF, 0x00, 0x05, 0x00, 0x03, 0x02, 0x06, 0x00, 0x00, 0x91, 0xFF, 0x00,
+	0x06, 0x00, 0x03, 0x03, 0x06, 0x00, 0x00, 0x8F, 0xFF, 0x00, 0x06, 0x00, 0x03, 0x03, 0x07, 0x00,
+	0x00, 0x8D, 0xFF, 0x00, 0x07, 0x00, 0x03, 0x04, 0x07, 0x00, 0x00, 0x8B, 0xFF, 0x00, 0x07, 0x00,
+	0x03, 0x05, 0x07, 0x00, 0x00, 0x89, 0xFF, 0x00, 0x07, 0x00, 0x03, 0x06, 0x08, 0x00, 0x00, 0x85,
+	0xFF, 0x00, 0x08, 0x00, 0x03, 0x07, 0x0A, 0x00, 0x00, 0x7F, 0xFF, 0x00, 0x0A, 0x00, 0x01, 0x08,
+	0x91, 0x00, 0x01, 0x09, 0x8F, 0x00, 0x01, 0x0B, 0x8B, 0x00, 0x01, 0x0D, 0x87, 0x00, 0x01, 0x10,
+	0x81, 0x00,
+};
+constexpr uint8_t IconSprite_04d_S_runs[] = {
+	0x01, 0x14, 0x05, 0x00, 0x01, 0x14, 0x05, 0x00, 0x01, 0x14, 0x05, 0x00, 0x01, 0x14, 0x05, 0x00,
+	0x03, 0x08, 0x01, 0x00, 0x0B, 0x05, 0x00, 0x07, 0x01, 0x00, 0x03, 0x07, 0x03, 0x00, 0x0A, 0x05,
+	0x00, 0x06, 0x03, 0x00, 0x03, 0x06, 0x05, 0x00, 0x09, 0x05, 0x00, 0x05, 0x05, 0x00, 0x04, 0x05,
+	0x07, 0x00, 0x05, 0x07, 0xFF, 0x00, 0x01, 0x00, 0x04, 0x07, 0x00, 0x03, 0x04, 0x09, 0x00, 0x01,
+	0x0D, 0xFF, 0x01, 0x09, 0x00, 0x03, 0x05, 0x08, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x08, 0x00, 0x05,
+	0x06, 0x06, 0x00, 0x00, 0x05, 0xFF, 0x00, 0x07, 0x00, 0x00, 0x05, 0xFF, 0x00, 0x06, 0x00, 0x05,
+	0x07, 0x04, 0x00, 0x00, 0x04, 0xFF, 0x00, 0x0B, 0x00, 0x00, 0x04, 0xFF, 0x00, 0x04, 0x00, 0x05,
+	0x08, 0x02, 0x00, 0x00, 0x04, 0xFF, 0x00, 0x0D, 0x00, 0x00, 0x04, 0xFF, 0x00, 0x02, 0x00, 0x03,
+	0x09, 0x04, 0xFF, 0x00, 0x0F, 0x00, 0x00, 0x04, 0xFF, 0x03, 0x08, 0x04, 0xFF, 0x00, 0x11, 0x00,
+	0x00, 0x04, 0xFF, 0x05, 0x08, 0x03, 0xFF, 0x00, 0x07, 0x00, 0x00, 0x05, 0xFF, 0x00, 0x07, 0x00,
+	0x00, 0x03, 0xFF, 0x06, 0x08, 0x03, 0xFF, 0x00, 0x06, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x06, 0x00,
+	0x00, 0x03, 0xFF, 0x0C, 0x07, 0x00, 0x06, 0x07, 0x03, 0xFF, 0x00, 0x06, 0x00, 0x00, 0x09, 0xFF,
+	0x00, 0x06, 0x00, 0x00, 0x03, 0xFF, 0x09, 0x0B, 0x00, 0x06, 0x07, 0x03, 0xFF, 0x00, 0x05, 0x00,
+	0x00, 0x0B, 0xFF, 0x00, 0x05, 0x00, 0x00, 0x03, 0xFF, 0x07, 0x0F, 0x00, 0x06, 0x07, 0x03, 0xFF,
+	0x00, 0x05, 0x00, 0x00, 0x0B, 0xFF, 0x00, 0x05, 0x00, 0x00, 0x03, 0xFF, 0x06, 0x11, 0x00, 0x07,
+	0x00, 0x07, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x05, 0x00, 0x00, 0x0B, 0xFF, 0x00, 0x05, 0x00, 0x00,
+	0x03, 0xFF, 0x00, 0x18, 0x00, 0x09, 0x00, 0x07, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x05, 0x00, 0x00,
+	0x0B, 0xFF, 0x00, 0x05, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x0C, 0x00, 0x00, 0x05, 0xFF, 0x00, 0x08,
+	0x00, 0x07, 0x00, 0x07, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x05, 0x00, 0x00, 0x0B, 0xFF, 0x00, 0x12,
+	0x00, 0x00, 0x09, 0xFF, 0x00, 0x06, 0x00, 0x07, 0x00, 0x07, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x06,
+	0x00, 0x00, 0x09, 0xFF, 0x00, 0x12, 0x00, 0x00, 0x0B, 0xFF, 0x00, 0x06, 0x00, 0x07, 0x00, 0x08,
+	0x00, 0x00, 0x03, 0xFF, 0x00, 0x06, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x12, 0x00, 0x00, 0x0D, 0xFF,
+	0x00, 0x05, 0x00, 0x06, 0x08, 0x03, 0xFF, 0x00, 0x07, 0x00, 0x00, 0x05, 0xFF, 0x00, 0x13, 0x00,
+	0x00, 0x0D, 0xFF, 0x00, 0x06, 0x00, 0x04, 0x08, 0x04, 0xFF, 0x00, 0x1D, 0x00, 0x00, 0x0F, 0xFF,
+	0x00, 0x05, 0x00, 0x06, 0x09, 0x04, 0xFF, 0x00, 0x11, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x08, 0x00,
+	0x00, 0x0F, 0xFF, 0x00, 0x05, 0x00, 0x07, 0x08, 0x02, 0x00, 0x00, 0x04, 0xFF, 0x00, 0x0E, 0x00,
+	0x00, 0x07, 0xFF, 0x00, 0x06, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x05, 0x00, 0x07, 0x07, 0x04, 0x00,
+	0x00, 0x04, 0xFF, 0x00, 0x0D, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x06, 0x00, 0x00, 0x0F, 0xFF, 0x00,
+	0x05, 0x00, 0x07, 0x06, 0x06, 0x00, 0x00, 0x05, 0xFF, 0x00, 0x0A, 0x00, 0x00, 0x09, 0xFF, 0x00,
+	0x05, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x05, 0x00, 0x07, 0x05, 0x08, 0x00, 0x00, 0x02, 0xFF, 0x00,
+	0x0C, 0x00, 0x00, 0x09, 0xFF, 0x00, 0x06, 0x00, 0x00, 0x0D, 0xFF, 0x00, 0x07, 0x00, 0x05, 0x04,
+	0x17, 0x00, 0x00, 0x09, 0xFF, 0x00, 0x06, 0x00, 0x00, 0x0D, 0xFF, 0x00, 0x09, 0x00, 0x05, 0x05,
+	0x17, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x08, 0x00, 0x00, 0x0B, 0xFF, 0x00, 0x0B, 0x00, 0x05, 0x06,
+	0x16, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x09, 0x00, 0x00, 0x09, 0xFF, 0x00, 0x0D, 0x00, 0x04, 0x07,
+	0x03, 0x00, 0x01, 0x08, 0x00, 0x00, 0x29, 0xFF, 0x00, 0x06, 0x00, 0x04, 0x08, 0x01, 0x00, 0x01,
+	0x06, 0x00, 0x00, 0x2D, 0xFF, 0x00, 0x06, 0x00, 0x03, 0x0A, 0x05, 0x00, 0x00, 0x2F, 0xFF, 0x00,
+	0x05, 0x00, 0x03, 0x0A, 0x05, 0x00, 0x00, 0x2F, 0xFF, 0x00, 0x05, 0x00, 0x03, 0x0A, 0x05, 0x00,
+	0x00, 0x2F, 0xFF, 0x00, 0x05, 0x00, 0x03, 0x0A, 0x06, 0x00, 0x00, 0x2D, 0xFF, 0x00, 0x06, 0x00,
+	0x01, 0x0B, 0x37, 0x00, 0x01, 0x0B, 0x37, 0x00, 0x01, 0x0C, 0x35, 0x00, 0x01, 0x0D, 0x33, 0x00,
+	0x01, 0x0F, 0x2F, 0x00,
+};
+constexpr uint8_t IconSprite_04n_L_runs[] = {
+	0x01, 0xBF, 0x07, 0xFF, 0x01, 0xBC, 0x0D, 0xFF, 0x02, 0x2C, 0x05, 0x00, 0x89, 0x11, 0xFF, 0x02,
+	0x2C, 0x05, 0x00, 0x88, 0x13, 0xFF, 0x02, 0x2C, 0x05, 0x00, 0x86, 0x17, 0xFF, 0x02, 0x2C, 0x05,
+	0x00, 0x85, 0x19, 0xFF, 0x03, 0x2C, 0x05, 0x00, 0x82, 0x03, 0x00, 0x00, 0x19, 0xFF, 0x03, 0x2C,
+	0x05, 0x00, 0x80, 0x04, 0x00, 0x00, 0x1B, 0xFF, 0x03, 0x2C, 0x05, 0x00, 0x7F, 0x04, 0x00, 0x00,
+	0x1D, 0xFF, 0x03, 0x2C, 0x05, 0x00, 0x7E, 0x05, 0x00, 0x00, 0x1D, 0xFF, 0x03, 0x2C, 0x05, 0x00,
+	0x7D, 0x05, 0x00, 0x00, 0x1F, 0xFF, 0x03, 0x2C, 0x05, 0x00, 0x7C, 0x06, 0x00, 0x00, 0x1F, 0xFF,
+	0x05, 0x12, 0x01, 0x00, 0x19, 0x05, 0x00, 0x15, 0x01, 0x00, 0x66, 0x06, 0x00, 0x00, 0x1F, 0xFF,
+	0x05, 0x11, 0x03, 0x00, 0x18, 0x05, 0x00, 0x14, 0x03, 0x00, 0x64, 0x06, 0x00, 0x00, 0x21, 0xFF,
+	0x05, 0x10, 0x05, 0x00, 0x17, 0x05, 0x00, 0x13, 0x05, 0x00, 0x63, 0x06, 0x00, 0x00, 0x21, 0xFF,
+	0x05, 0x0F, 0x07, 0x00, 0x16, 0x05, 0x00, 0x12, 0x07, 0x00, 0x62, 0x06, 0x00, 0x00, 0x21, 0xFF,
+	0x05, 0x0E, 0x09, 0x00, 0x10, 0x0B, 0xFF, 0x10, 0x09, 0x00, 0x61, 0x06, 0x00, 0x00, 0x21, 0xFF,
+	0x06, 0x0F, 0x09, 0x00, 0x0C, 0x11, 0xFF, 0x0C, 0x09, 0x00, 0x1F, 0x0B, 0x00, 0x38, 0x06, 0x00,
+	0x00, 0x21, 0xFF, 0x06, 0x10, 0x09, 0x00, 0x08, 0x17, 0xFF, 0x08, 0x09, 0x00, 0x1B, 0x15, 0x00,
+	0x33, 0x06, 0x00, 0x00, 0x21, 0xFF, 0x06, 0x11, 0x09, 0x00, 0x05, 0x1B, 0xFF, 0x05, 0x09, 0x00,
+	0x1A, 0x19, 0x00, 0x31, 0x06, 0x00, 0x00, 0x21, 0xFF, 0x06, 0x12, 0x09, 0x00, 0x03, 0x1D, 0xFF,
+	0x03, 0x09, 0x00, 0x18, 0x1F, 0x00, 0x2F, 0x06, 0x00, 0x00, 0x1F, 0xFF, 0x06, 0x13, 0x09, 0x00,
+	0x01, 0x1F, 0xFF, 0x01, 0x09, 0x00, 0x17, 0x23, 0x00, 0x2D, 0x06, 0x00, 0x00, 0x1F, 0xFF, 0x0A,
+	0x14, 0x07, 0x00, 0x00, 0x0D, 0xFF, 0x00, 0x09, 0x00, 0x00, 0x0D, 0xFF, 0x00, 0x07, 0x00, 0x17,
+	0x0D, 0x00, 0x00, 0x0B, 0xFF, 0x00, 0x0D, 0x00, 0x2D, 0x05, 0x00, 0x00, 0x1F, 0xFF, 0x0A, 0x15,
+	0x05, 0x00, 0x00, 0x0B, 0xFF, 0x00, 0x0F, 0x00, 0x00, 0x0B, 0xFF, 0x00, 0x05, 0x00, 0x16, 0x0B,
+	0x00, 0x00, 0x13, 0xFF, 0x00, 0x0B, 0x00, 0x2C, 0x05, 0x00, 0x00, 0x1D, 0xFF, 0x0A, 0x16, 0x03,
+	0x00, 0x00, 0x0A, 0xFF, 0x00, 0x13, 0x00, 0x00, 0x0A, 0xFF, 0x00, 0x03, 0x00, 0x16, 0x0A, 0x00,
+	0x00, 0x17, 0xFF, 0x00, 0x0A, 0x00, 0x2C, 0x04, 0x00, 0x00, 0x1D, 0xFF, 0x0A, 0x17, 0x01, 0x00,
+	0x00, 0x09, 0xFF, 0x00, 0x17, 0x00, 0x00, 0x09, 0xFF, 0x00, 0x01, 0x00, 0x16, 0x08, 0x00, 0x00,
+	0x1D, 0xFF, 0x00, 0x08, 0x00, 0x2C, 0x04, 0x00, 0x00, 0x1B, 0xFF, 0x08, 0x18, 0x08, 0xFF, 0x00,
+	0x19, 0x00, 0x00, 0x08, 0xFF, 0x16, 0x08, 0x00, 0x00, 0x1F, 0xFF, 0x00, 0x08, 0x00, 0x2D, 0x03,
+	0x00, 0x00, 0x19, 0xFF, 0x09, 0x17, 0x08, 0xFF, 0x00, 0x0A, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x0A,
+	0x00, 0x00, 0x08, 0xFF, 0x14, 0x07, 0x00, 0x00, 0x23, 0xFF, 0x00, 0x07, 0x00, 0x2F, 0x19, 0xFF,
+	0x09, 0x16, 0x08, 0xFF, 0x00, 0x08, 0x00, 0x00, 0x0D, 0xFF, 0x00, 0x08, 0x00, 0x00, 0x08, 0xFF,
+	0x12, 0x07, 0x00, 0x00, 0x25, 0xFF, 0x00, 0x07, 0x00, 0x2F, 0x17, 0xFF, 0x09, 0x15, 0x08, 0xFF,
+	0x00, 0x07, 0x00, 0x00, 0x11, 0xFF, 0x00, 0x07, 0x00, 0x00, 0x08, 0xFF, 0x10, 0x07, 0x00, 0x00,
+	0x27, 0xFF, 0x00, 0x07, 0x00, 0x30, 0x13, 0xFF, 0x09, 0x15, 0x07, 0xFF, 0x00, 0x07, 0x00, 0x00,
+	0x13, 0xFF, 0x00, 0x0C, 0x00, 0x00, 0x02, 0xFF, 0x0F, 0x07, 0x00, 0x00, 0x29, 0xFF, 0x00, 0x07,
+	0x00, 0x30, 0x11, 0xFF, 0x08, 0x14, 0x07, 0xFF, 0x00, 0x07, 0x00, 0x00, 0x11, 0xFF, 0x00, 0x13,
+	0x00, 0x0C, 0x07, 0x00, 0x00, 0x2B, 0xFF, 0x00, 0x07, 0x00, 0x31, 0x0D, 0xFF, 0x08, 0x14, 0x07,
+	0xFF, 0x00, 0x06, 0x00, 0x00, 0x10, 0xFF, 0x00, 0x17, 0x00, 0x09, 0x07, 0x00, 0x00, 0x2D, 0xFF,
+	0x00, 0x07, 0x00, 0x33, 0x07, 0xFF, 0x07, 0x14, 0x06, 0xFF, 0x00, 0x06, 0x00, 0x00, 0x0F, 0xFF,
+	0x00, 0x1B, 0x00, 0x07, 0x06, 0x00, 0x00, 0x2F, 0xFF, 0x00, 0x06, 0x00, 0x07, 0x13, 0x07, 0xFF,
+	0x00, 0x05, 0x00, 0x00, 0x0E, 0xFF, 0x00, 0x1F, 0x00, 0x04, 0x06, 0x00, 0x00, 0x31, 0xFF, 0x00,
+	0x06, 0x00, 0x09, 0x13, 0x06, 0xFF, 0x00, 0x06, 0x00, 0x00, 0x0D, 0xFF, 0x00, 0x0C, 0x00, 0x00,
+	0x09, 0xFF, 0x00, 0x0C, 0x00, 0x02, 0x06, 0x00, 0x00, 0x33, 0xFF, 0x00, 0x06, 0x00, 0x09, 0x13,
+	0x06, 0xFF, 0x00, 0x05, 0x00, 0x00, 0x0D, 0xFF, 0x00, 0x09, 0x00, 0x00, 0x11, 0xFF, 0x00, 0x09,
+	0x00, 0x01, 0x06, 0x00, 0x00, 0x33, 0xFF, 0x00, 0x06, 0x00, 0x08, 0x12, 0x07, 0xFF, 0x00, 0x05,
+	0x00, 0x00, 0x0B, 0xFF, 0x00, 0x09, 0x00, 0x00, 0x15, 0xFF, 0x00, 0x0D, 0x00, 0x00, 0x35, 0xFF,
+	0x00, 0x06, 0x00, 0x08, 0x12, 0x06, 0xFF, 0x00, 0x06, 0x00, 0x00, 0x0A, 0xFF, 0x00, 0x08, 0x00,
+	0x00, 0x19, 0xFF, 0x00, 0x0A, 0x00, 0x00, 0x37, 0xFF, 0x00, 0x05, 0x00, 0x08, 0x12, 0x06, 0xFF,
+	0x00, 0x05, 0x00, 0x00, 0x0A, 0xFF, 0x00, 0x08, 0x00, 0x00, 0x1B, 0xFF, 0x00, 0x09, 0x00, 0x00,
+	0x37, 0xFF, 0x00, 0x05, 0x00, 0x08, 0x12, 0x06, 0xFF, 0x00, 0x05, 0x00, 0x00, 0x0A, 0xFF, 0x00,
+	0x07, 0x00, 0x00, 0x1D, 0xFF, 0x00, 0x08, 0x00, 0x00, 0x37, 0xFF, 0x00, 0x06, 0x00, 0x08, 0x12,
+	0x06, 0xFF, 0x00, 0x05, 0x00, 0x00, 0x09, 0xFF, 0x00, 0x06, 0x00, 0x00, 0x21, 0xFF, 0x00, 0x05,
+	0x00, 0x00, 0x39, 0xFF, 0x00, 0x05, 0x00, 0x09, 0x04, 0x0E, 0x00, 0x00, 0x06, 0xFF, 0x00, 0x05,
+	0x00, 0x00, 0x08, 0xFF, 0x00, 0x06, 0x00, 0x00, 0x23, 0xFF, 0x00, 0x04, 0x00, 0x00, 0x39, 0xFF,
+	0x00, 0x06, 0x00, 0x09, 0x04, 0x0E, 0x00, 0x00, 0x06, 0xFF, 0x00, 0x05, 0x00, 0x00, 0x07, 0xFF,
+	0x00, 0x07, 0x00, 0x00, 0x23, 0xFF, 0x00, 0x03, 0x00, 0x00, 0x3B, 0xFF, 0x00, 0x05, 0x00, 0x09,
+	0x04, 0x0E, 0x00, 0x00, 0x06, 0xFF, 0x00, 0x05, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x06, 0x00, 0x00,
+	0x25, 0xFF, 0x00, 0x02, 0x00, 0x00, 0x3B, 0xFF, 0x00, 0x05, 0x00, 0x09, 0x04, 0x0E, 0x00, 0x00,
+	0x06, 0xFF, 0x00, 0x05, 0x00, 0x00, 0x06, 0xFF, 0x00, 0x06, 0x00, 0x00, 0x27, 0xFF, 0x00, 0x01,
+	0x00, 0x00, 0x3B, 0xFF, 0x00, 0x05, 0x00, 0x07, 0x04, 0x0E, 0x00, 0x00, 0x06, 0xFF, 0x00, 0x06,
+	0x00, 0x00, 0x05, 0xFF, 0x00, 0x05, 0x00, 0x00, 0x64, 0xFF, 0x00, 0x05, 0x00, 0x06, 0x12, 0x07,
+	0xFF, 0x00, 0x05, 0x00, 0x00, 0x04, 0xFF, 0x00, 0x06, 0x00, 0x00, 0x65, 0xFF, 0x00, 0x05, 0x00,
+	0x06, 0x13, 0x06, 0xFF, 0x00, 0x05, 0x00, 0x00, 0x04, 0xFF, 0x00, 0x05, 0x00, 0x00, 0x66, 0xFF,
+	0x00, 0x05, 0x00, 0x06, 0x13, 0x06, 0xFF, 0x00, 0x06, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x06, 0x00,
+	0x00, 0x66, 0xFF, 0x00, 0x05, 0x00, 0x06, 0x13, 0x07, 0xFF, 0x00, 0x05, 0x00, 0x00, 0x02, 0xFF,
+	0x00, 0x05, 0x00, 0x00, 0x67, 0xFF, 0x00, 0x05, 0x00, 0x06, 0x14, 0x06, 0xFF, 0x00, 0x06, 0x00,
+	0x00, 0x01, 0xFF, 0x00, 0x05, 0x00, 0x00, 0x67, 0xFF, 0x00, 0x05, 0x00, 0x04, 0x14, 0x07, 0xFF,
+	0x00, 0x0B, 0x00, 0x00, 0x67, 0xFF, 0x00, 0x05, 0x00, 0x04, 0x14, 0x07, 0xFF, 0x00, 0x0B, 0x00,
+	0x00, 0x67, 0xFF, 0x00, 0x05, 0x00, 0x04, 0x15, 0x07, 0xFF, 0x00, 0x09, 0x00, 0x00, 0x68, 0xFF,
+	0x00, 0x05, 0x00, 0x04, 0x15, 0x08, 0xFF, 0x00, 0x08, 0x00, 0x00, 0x68, 0xFF, 0x00, 0x05, 0x00,
+	0x04, 0x16, 0x08, 0xFF, 0x00, 0x07, 0x00, 0x00, 0x68, 0xFF, 0x00, 0x05, 0x00, 0x04, 0x17, 0x08,
+	0xFF, 0x00, 0x06, 0x00, 0x00, 0x68, 0xFF, 0x00, 0x05, 0x00, 0x03, 0x10, 0x15, 0x00, 0x00, 0x67,
+	0xFF, 0x00, 0x05, 0x00, 0x03, 0x0D, 0x18, 0x00, 0x00, 0x67, 0xFF, 0x00, 0x08, 0x00, 0x03, 0x0B,
+	0x1A, 0x00, 0x00, 0x67, 0xFF, 0x00, 0x0A, 0x00, 0x03, 0x09, 0x1C, 0x00, 0x00, 0x67, 0xFF, 0x00,
+	0x0C, 0x00, 0x03, 0x08, 0x0E, 0x00, 0x00, 0x76, 0xFF, 0x00, 0x0D, 0x00, 0x03, 0x07, 0x0A, 0x00,
+	0x00, 0x7F, 0xFF, 0x00, 0x0A, 0x00, 0x03, 0x06, 0x08, 0x00, 0x00, 0x85, 0xFF, 0x00, 0x08, 0x00,
+	0x03, 0x05, 0x07, 0x00, 0x00, 0x89, 0xFF, 0x00, 0x07, 0x00, 0x03, 0x04, 0x07, 0x00, 0x00, 0x8B,
+	0xFF, 0x00, 0x07, 0x00, 0x03, 0x03, 0x07, 0x00, 0x00, 0x8D, 0xFF, 0x00, 0x07, 0x00, 0x03, 0x03,
+	0x06, 0x00, 0x00, 0x8F, 0xFF, 0x00, 0x06, 0x00, 0x03, 0x02, 0x06, 0x00, 0x00, 0x91, 0xFF, 0x00,
+	0x06, 0x00, 0x03, 0x02, 0x05, 0x00, 0x00, 0x93, 0xFF, 0x00, 0x05, 0x00, 0x03, 0x01, 0x06, 0x00,
+	0x00, 0x93, 0xFF, 0x00, 0x06, 0x00, 0x03, 0x01, 0x05, 0x00, 0x00, 0x95, 0xFF, 0x00, 0x05, 0x00,
+	0x03, 0x01, 0x05, 0x00, 0x00, 0x95, 0xFF, 0x00, 0x05, 0x00, 0x03, 0x00, 0x06, 0x00, 0x00, 0x95,
+	0xFF, 0x00, 0x06, 0x00, 0x03, 0x00, 0x05, 0x00, 0x00, 0x97, 0xFF, 0x00, 0x05, 0x00, 0x03, 0x00,
+	0x05, 0x00, 0x00, 0x97, 0xFF, 0x00, 0x05, 0x00, 0x03, 0x00, 0x05, 0x00, 0x00, 0x97, 0xFF, 0x00,
+	0x05, 0x00, 0x03, 0x00, 0x05, 0x00, 0x00, 0x97, 0xFF, 0x00, 0x05, 0x00, 0x03, 0x00, 0x05, 0x00,
+	0x00, 0x97, 0xFF, 0x00, 0x05, 0x00, 0x03, 0x00, 0x05, 0x00, 0x00, 0x97, 0xFF, 0x00, 0x05, 0x00,
+	0x03, 0x00, 0x05, 0x00, 0x00, 0x97, 0xFF, 0x00, 0x05, 0x00, 0x03, 0x00, 0x06, 0x00, 0x00, 0x95,
+	0xFF, 0x00, 0x06, 0x00, 0x03, 0x01, 0x05, 0x00, 0x00, 0x95, 0xFF, 0x00, 0x05, 0x00, 0x03, 0x01,
+	0x05, 0x00, 0x00, 0x95, 0xFF, 0x00, 0x05, 0x00, 0x03, 0x01, 0x06, 0x00, 0x00, 0x93, 0xFF, 0x00,
+	0x06, 0x00, 0x03, 0x02, 0x05, 0x00, 0x00, 0x93, 0xFF, 0x00, 0x05, 0x00, 0x03, 0x02, 0x06, 0x00,
+	0x00, 0x91, 0xFF, 0x00, 0x06, 0x00, 0x03, 0x03, 0x06, 0x00, 0x00, 0x8F, 0xFF, 0x00, 0x06, 0x00,
+	0x03, 0x03, 0x07, 0x00, 0x00, 0x8D, 0xFF, 0x00, 0x07, 0x00, 0x03, 0x04, 0x07, 0x00, 0x00, 0x8B,
+	0xFF, 0x00, 0x07, 0x00, 0x03, 0x05, 0x07, 0x00, 0x00, 0x89, 0xFF, 0x00, 0x07, 0x00, 0x03, 0x06,
+	0x08, 0x00, 0x00, 0x85, 0xFF, 0x00, 0x08, 0x00, 0x03, 0x07, 0x0A, 0x00, 0x00, 0x7F, 0xFF, 0x00,
+	0x0A, 0x00, 0x01, 0x08, 0x91, 0x00, 0x01, 0x09, 0x8F, 0x00, 0x01, 0x0B, 0x8B, 0x00, 0x01, 0x0D,
+	0x87, 0x00, 0x01, 0x10, 0x81, 0x00,
+};
+constexpr uint8_t IconSprite_04n_S_runs[] = {
+	0x01, 0x54, 0x07, 0xFF, 0x01, 0x51, 0x0D, 0xFF, 0x01, 0x4F, 0x11, 0xFF, 0x01, 0x4E, 0x13, 0xFF,
+	0x01, 0x4C, 0x17, 0xFF, 0x01, 0x4B, 0x19, 0xFF, 0x02, 0x48, 0x03, 0x00, 0x00, 0x19, 0xFF, 0x02,
+	0x46, 0x04, 0x00, 0x00, 0x1B, 0xFF, 0x02, 0x45, 0x04, 0x00, 0x00, 0x1D, 0xFF, 0x02, 0x44, 0x05,
+	0x00, 0x00, 0x1D, 0xFF, 0x02, 0x43, 0x05, 0x00, 0x00, 0x1F, 0xFF, 0x02, 0x42, 0x06, 0x00, 0x00,
+	0x1F, 0xFF, 0x02, 0x42, 0x06, 0x00, 0x00, 0x1F, 0xFF, 0x02, 0x41, 0x06, 0x00, 0x00, 0x21, 0xFF,
+	0x02, 0x41, 0x06, 0x00, 0x00, 0x21, 0xFF, 0x02, 0x41, 0x06, 0x00, 0x00, 0x21, 0xFF, 0x02, 0x41,
+	0x06, 0x00, 0x00, 0x21, 0xFF, 0x02, 0x41, 0x06, 0x00, 0x00, 0x21, 0xFF, 0x03, 0x14, 0x05, 0x00,
+	0x28, 0x06, 0x00, 0x00, 0x21, 0xFF, 0x03, 0x14, 0x05, 0x00, 0x28, 0x06, 0x00, 0x00, 0x21, 0xFF,
+	0x03, 0x14, 0x05, 0x00, 0x29, 0x06, 0x00, 0x00, 0x1F, 0xFF, 0x03, 0x14, 0x05, 0x00, 0x29, 0x06,
+	0x00, 0x00, 0x1F, 0xFF, 0x05, 0x08, 0x01, 0x00, 0x0B, 0x05, 0x00, 0x07, 0x01, 0x00, 0x22, 0x05,
+	0x00, 0x00, 0x1F, 0xFF, 0x05, 0x07, 0x03, 0x00, 0x0A, 0x05, 0x00, 0x06, 0x03, 0x00, 0x22, 0x05,
+	0x00, 0x00, 0x1D, 0xFF, 0x05, 0x06, 0x05, 0x00, 0x09, 0x05, 0x00, 0x05, 0x05, 0x00, 0x22, 0x04,
+	0x00, 0x00, 0x1D, 0xFF, 0x06, 0x05, 0x07, 0x00, 0x05, 0x07, 0xFF, 0x00, 0x01, 0x00, 0x04, 0x07,
+	0x00, 0x22, 0x04, 0x00, 0x00, 0x1B, 0xFF, 0x05, 0x04, 0x09, 0x00, 0x01, 0x0D, 0xFF, 0x01, 0x09,
+	0x00, 0x23, 0x03, 0x00, 0x00, 0x19, 0xFF, 0x04, 0x05, 0x08, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x08,
+	0x00, 0x27, 0x19, 0xFF, 0x06, 0x06, 0x06, 0x00, 0x00, 0x05, 0xFF, 0x00, 0x07, 0x00, 0x00, 0x05,
+	0xFF, 0x00, 0x06, 0x00, 0x29, 0x17, 0xFF, 0x06, 0x07, 0x04, 0x00, 0x00, 0x04, 0xFF, 0x00, 0x0B,
+	0x00, 0x00, 0x04, 0xFF, 0x00, 0x04, 0x00, 0x2C, 0x13, 0xFF, 0x06, 0x08, 0x02, 0x00, 0x00, 0x04,
+	0xFF, 0x00, 0x0D, 0x00, 0x00, 0x04, 0xFF, 0x00, 0x02, 0x00, 0x2E, 0x11, 0xFF, 0x04, 0x09, 0x04,
+	0xFF, 0x00, 0x0F, 0x00, 0x00, 0x04, 0xFF, 0x31, 0x0D, 0xFF, 0x04, 0x08, 0x04, 0xFF, 0x00, 0x11,
+	0x00, 0x00, 0x04, 0xFF, 0x33, 0x07, 0xFF, 0x05, 0x08, 0x03, 0xFF, 0x00, 0x07, 0x00, 0x00, 0x05,
+	0xFF, 0x00, 0x07, 0x00, 0x00, 0x03, 0xFF, 0x06, 0x08, 0x03, 0xFF, 0x00, 0x06, 0x00, 0x00, 0x07,
+	0xFF, 0x00, 0x06, 0x00, 0x00, 0x03, 0xFF, 0x0C, 0x07, 0x00, 0x06, 0x07, 0x03, 0xFF, 0x00, 0x06,
+	0x00, 0x00, 0x09, 0xFF, 0x00, 0x06, 0x00, 0x00, 0x03, 0xFF, 0x09, 0x0B, 0x00, 0x06, 0x07, 0x03,
+	0xFF, 0x00, 0x05, 0x00, 0x00, 0x0B, 0xFF, 0x00, 0x05, 0x00, 0x00, 0x03, 0xFF, 0x07, 0x0F, 0x00,
+	0x06, 0x07, 0x03, 0xFF, 0x00, 0x05, 0x00, 0x00, 0x0B, 0xFF, 0x00, 0x05, 0x00, 0x00, 0x03, 0xFF,
+	0x06, 0x11, 0x00, 0x07, 0x00, 0x07, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x05, 0x00, 0x00, 0x0B, 0xFF,
+	0x00, 0x05, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x18, 0x00, 0x09, 0x00, 0x07, 0x00, 0x00, 0x03, 0xFF,
+	0x00, 0x05, 0x00, 0x00, 0x0B, 0xFF, 0x00, 0x05, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x0C, 0x00, 0x00,
+	0x05, 0xFF, 0x00, 0x08, 0x00, 0x07, 0x00, 0x07, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x05, 0x00, 0x00,
+	0x0B, 0xFF, 0x00, 0x12, 0x00, 0x00, 0x09, 0xFF, 0x00, 0x06, 0x00, 0x07, 0x00, 0x07, 0x00, 0x00,
+	0x03, 0xFF, 0x00, 0x06, 0x00, 0x00, 0x09, 0xFF, 0x00, 0x12, 0x00, 0x00, 0x0B, 0xFF, 0x00, 0x06,
+	0x00, 0x07, 0x00, 0x08, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x06, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x12,
+	0x00, 0x00, 0x0D, 0xFF, 0x00, 0x05, 0x00, 0x06, 0x08, 0x03, 0xFF, 0x00, 0x07, 0x00, 0x00, 0x05,
+	0xFF, 0x00, 0x13, 0x00, 0x00, 0x0D, 0xFF, 0x00, 0x06, 0x00, 0x04, 0x08, 0x04, 0xFF, 0x00, 0x1D,
+	0x00, 0x00, 0x0F, 0xFF, 0x00, 0x05, 0x00, 0x06, 0x09, 0x04, 0xFF, 0x00, 0x11, 0x00, 0x00, 0x03,
+	0xFF, 0x00, 0x08, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x05, 0x00, 0x07, 0x08, 0x02, 0x00, 0x00, 0x04,
+	0xFF, 0x00, 0x0E, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x06, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x05, 0x00,
+	0x07, 0x07, 0x04, 0x00, 0x00, 0x04, 0xFF, 0x00, 0x0D, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x06, 0x00,
+	0x00, 0x0F, 0xFF, 0x00, 0x05, 0x00, 0x07, 0x06, 0x06, 0x00, 0x00, 0x05, 0xFF, 0x00, 0x0A, 0x00,
+	0x00, 0x09, 0xFF, 0x00, 0x05, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x05, 0x00, 0x07, 0x05, 0x08, 0x00,
+	0x00, 0x02, 0xFF, 0x00, 0x0C, 0x00, 0x00, 0x09, 0xFF, 0x00, 0x06, 0x00, 0x00, 0x0D, 0xFF, 0x00,
+	0x07, 0x00, 0x05, 0x04, 0x17, 0x00, 0x00, 0x09, 0xFF, 0x00, 0x06, 0x00, 0x00, 0x0D, 0xFF, 0x00,
+	0x09, 0x00, 0x05, 0x05, 0x17, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x08, 0x00, 0x00, 0x0B, 0xFF, 0x00,
+	0x0B, 0x00, 0x05, 0x06, 0x16, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x09, 0x00, 0x00, 0x09, 0xFF, 0x00,
+	0x0D, 0x00, 0x04, 0x07, 0x03, 0x00, 0x01, 0x08, 0x00, 0x00, 0x29, 0xFF, 0x00, 0x06, 0x00, 0x04,
+	0x08, 0x01, 0x00, 0x01, 0x06, 0x00, 0x00, 0x2D, 0xFF, 0x00, 0x06, 0x00, 0x03, 0x0A, 0x05, 0x00,
+	0x00, 0x2F, 0xFF, 0x00, 0x05, 0x00, 0x03, 0x0A, 0x05, 0x00, 0x00, 0x2F, 0xFF, 0x00, 0x05, 0x00,
+	0x03, 0x0A, 0x05, 0x00, 0x00, 0x2F, 0xFF, 0x00, 0x05, 0x00, 0x03, 0x0A, 0x06, 0x00, 0x00, 0x2D,
+	0xFF, 0x00, 0x06, 0x00, 0x01, 0x0B, 0x37, 0x00, 0x01, 0x0B, 0x37, 0x00, 0x01, 0x0C, 0x35, 0x00,
+	0x01, 0x0D, 0x33, 0x00, 0x01, 0x0F, 0x2F, 0x00,
+};
+constexpr uint8_t IconSprite_09d_L_runs[] = {
+	0x01, 0x2C, 0x05, 0x00, 0x01, 0x2C, 0x05, 0x00, 0x01, 0x2C, 0x05, 0x00, 0x01, 0x2C, 0x05, 0x00,
+	0x01, 0x2C, 0x05, 0x00, 0x01, 0x2C, 0x05, 0x00, 0x01, 0x2C, 0x05, 0x00, 0x01, 0x2C, 0x05, 0x00,
+	0x01, 0x2C, 0x05, 0x00, 0x01, 0x2C, 0x05, 0x00, 0x03, 0x12, 0x01, 0x00, 0x19, 0x05, 0x00, 0x15,
+	0x01, 0x00, 0x03, 0x11, 0x03, 0x00, 0x18, 0x05, 0x00, 0x14, 0x03, 0x00, 0x03, 0x10, 0x05, 0x00,
+	0x17, 0x05, 0x00, 0x13, 0x05, 0x00, 0x03, 0x0F, 0x07, 0x00, 0x16, 0x05, 0x00, 0x12, 0x07, 0x00,
+	0x03, 0x0E, 0x09, 0x00, 0x10, 0x0B, 0xFF, 0x10, 0x09, 0x00, 0x04, 0x0F, 0x09, 0x00, 0x0C, 0x11,
+	0xFF, 0x0C, 0x09, 0x00, 0x1F, 0x0B, 0x00, 0x04, 0x10, 0x09, 0x00, 0x08, 0x17, 0xFF, 0x08, 0x09,
+	0x00, 0x1B, 0x15, 0x00, 0x04, 0x11, 0x09, 0x00, 0x05, 0x1B, 0xFF, 0x05, 0x09, 0x00, 0x1A, 0x19,
+	0x00, 0x04, 0x12, 0x09, 0x00, 0x03, 0x1D, 0xFF, 0x03, 0x09, 0x00, 0x18, 0x1F, 0x00, 0x04, 0x13,
+	0x09, 0x00, 0x01, 0x1F, 0xFF, 0x01, 0x09, 0x00, 0x17, 0x23, 0x00, 0x08, 0x14, 0x07, 0x00, 0x00,
+	0x0D, 0xFF, 0x00, 0x09, 0x00, 0x00, 0x0D, 0xFF, 0x00, 0x07, 0x00, 0x17, 0x0D, 0x00, 0x00, 0x0B,
+	0xFF, 0x00, 0x0D, 0x00, 0x08, 0x15, 0x05, 0x00, 0x00, 0x0B, 0xFF, 0x00, 0x0F, 0x00, 0x00, 0x0B,
+	0xFF, 0x00, 0x05, 0x00, 0x16, 0x0B, 0x00, 0x00, 0x13, 0xFF, 0x00, 0x0B, 0x00, 0x08, 0x16, 0x03,
+	0x00, 0x00, 0x0A, 0xFF, 0x00, 0x13, 0x00, 0x00, 0x0A, 0xFF, 0x00, 0x03, 0x00, 0x16, 0x0A, 0x00,
+	0x00, 0x17, 0xFF, 0x00, 0x0A, 0x00, 0x08, 0x17, 0x01, 0x00, 0x00, 0x09, 0xFF, 0x00, 0x17, 0x00,
+	0x00, 0x09, 0xFF, 0x00, 0x01, 0x00, 0x16, 0x08, 0x00, 0x00, 0x1D, 0xFF, 0x00, 0x08, 0x00, 0x06,
+	0x18, 0x08, 0xFF, 0x00, 0x19, 0x00, 0x00, 0x08, 0xFF, 0x16, 0x08, 0x00, 0x00, 0x1F, 0xFF, 0x00,
+	0x08, 0x00, 0x08, 0x17, 0x08, 0xFF, 0x00, 0x0A, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x0A, 0x00, 0x00,
+	0x08, 0xFF, 0x14, 0x07, 0x00, 0x00, 0x23, 0xFF, 0x00, 0x07, 0x00, 0x08, 0x16, 0x08, 0xFF, 0x00,
+	0x08, 0x00, 0x00, 0x0D, 0xFF, 0x00, 0x08, 0x00, 0x00, 0x08, 0xFF, 0x12, 0x07, 0x00, 0x00, 0x25,
+	0xFF, 0x00, 0x07, 0x00, 0x08, 0x15, 0x08, 0xFF, 0x00, 0x07, 0x00, 0x00, 0x11, 0xFF, 0x00, 0x07,
+	0x00, 0x00, 0x08, 0xFF, 0x10, 0x07, 0x00, 0x00, 0x27, 0xFF, 0x00, 0x07, 0x00, 0x08, 0x15, 0x07,
+	0xFF, 0x00, 0x07, 0x00, 0x00, 0x13, 0xFF, 0x00, 0x0C, 0x00, 0x00, 0x02, 0xFF, 0x0F, 0x07, 0x00,
+	0x00, 0x29, 0xFF, 0x00, 0x07, 0x00, 0x07, 0x14, 0x07, 0xFF, 0x00, 0x07, 0x00, 0x00, 0x11, 0xFF,
+	0x00, 0x13, 0x00, 0x0C, 0x07, 0x00, 0x00, 0x2B, 0xFF, 0x00, 0x07, 0x00, 0x07, 0x14, 0x07, 0xFF,
+	0x00, 0x06, 0x00, 0x00, 0x10, 0xFF, 0x00, 0x17, 0x00, 0x09, 0x07, 0x00, 0x00, 0x2D, 0xFF, 0x00,
+	0x07, 0x00, 0x07, 0x14, 0x06, 0xFF, 0x00, 0x06, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x1B, 0x00, 0x07,
+	0x06, 0x00, 0x00, 0x2F, 0xFF, 0x00, 0x06, 0x00, 0x07, 0x13, 0x07, 0xFF, 0x00, 0x05, 0x00, 0x00,
+	0x0E, 0xFF, 0x00, 0x1F, 0x00, 0x04, 0x06, 0x00, 0x00, 0x31, 0xFF, 0x00, 0x06, 0x00, 0x09, 0x13,
+	0x06, 0xFF, 0x00, 0x06, 0x00, 0x00, 0x0D, 0xFF, 0x00, 0x0C, 0x00, 0x00, 0x09, 0xFF, 0x00, 0x0C,
+	0x00, 0x02, 0x06, 0x00, 0x00, 0x33, 0xFF, 0x00, 0x06, 0x00, 0x09, 0x13, 0x06, 0xFF, 0x00, 0x05,
+	0x00, 0x00, 0x0D, 0xFF, 0x00, 0x09, 0x00, 0x00, 0x11, 0xFF, 0x00, 0x09, 0x00, 0x01, 0x06, 0x00,
+	0x00, 0x33, 0xFF, 0x00, 0x06, 0x00, 0x08, 0x12, 0x07, 0xFF, 0x00, 0x05, 0x00, 0x00, 0x0B, 0xFF,
+	0x00, 0x09, 0x00, 0x00, 0x15, 0xFF, 0x00, 0x0D, 0x00, 0x00, 0x35, 0xFF, 0x00, 0x06, 0x00, 0x08,
+	0x12, 0x06, 0xFF, 0x00, 0x06, 0x00, 0x00, 0x0A, 0xFF, 0x00, 0x08, 0x00, 0x00, 0x19, 0xFF, 0x00,
+	0x0A, 0x00, 0x00, 0x37, 0xFF, 0x00, 0x05, 0x00, 0x08, 0x12, 0x06, 0xFF, 0x00, 0x05, 0x00, 0x00,
+	0x0A, 0xFF, 0x00, 0x08, 0x00, 0x00, 0x1B, 0xFF, 0x00, 0x09, 0x00, 0x00, 0x37, 0xFF, 0x00, 0x05,
+	0x00, 0x08, 0x12, 0x06, 0xFF, 0x00, 0x05, 0x00, 0x00, 0x0A, 0xFF, 0x00, 0x07, 0x00, 0x00, 0x1D,
+	0xFF, 0x00, 0x08, 0x00, 0x00, 0x37, 0xFF, 0x00, 0x06, 0x00, 0x08, 0x12, 0x06, 0xFF, 0x00, 0x05,
+	0x00, 0x00, 0x09, 0xFF, 0x00, 0x06, 0x00, 0x00, 0x21, 0xFF, 0x00, 0x05, 0x00, 0x00, 0x39, 0xFF,
+	0x00, 0x05, 0x00, 0x09, 0x04, 0x0E, 0x00, 0x00, 0x06, 0xFF, 0x00, 0x05, 0x00, 0x00, 0x08, 0xFF,
+	0x00, 0x06, 0x00, 0x00, 0x23, 0xFF, 0x00, 0x04, 0x00, 0x00, 0x39, 0xFF, 0x00, 0x06, 0x00, 0x09,
+	0x04, 0x0E, 0x00, 0x00, 0x06, 0xFF, 0x00, 0x05, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x07, 0x00, 0x00,
+	0x23, 0xFF, 0x00, 0x03, 0x00, 0x00, 0x3B, 0xFF, 0x00, 0x05, 0x00, 0x09, 0x04, 0x0E, 0x00, 0x00,
+	0x06, 0xFF, 0x00, 0x05, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x06, 0x00, 0x00, 0x25, 0xFF, 0x00, 0x02,
+	0x00, 0x00, 0x3B, 0xFF, 0x00, 0x05, 0x00, 0x09, 0x04, 0x0E, 0x00, 0x00, 0x06, 0xFF, 0x00, 0x05,
+	0x00, 0x00, 0x06, 0xFF, 0x00, 0x06, 0x00, 0x00, 0x27, 0xFF, 0x00, 0x01, 0x00, 0x00, 0x3B, 0xFF,
+	0x00, 0x05, 0x00, 0x07, 0x04, 0x0E, 0x00, 0x00, 0x06, 0xFF, 0x00, 0x06, 0x00, 0x00, 0x05, 0xFF,
+	0x00, 0x05, 0x00, 0x00, 0x64, 0xFF, 0x00, 0x05, 0x00, 0x06, 0x12, 0x07, 0xFF, 0x00, 0x05, 0x00,
+	0x00, 0x04, 0xFF, 0x00, 0x06, 0x00, 0x00, 0x65, 0xFF, 0x00, 0x05, 0x00, 0x06, 0x13, 0x06, 0xFF,
+	0x00, 0x05, 0x00, 0x00, 0x04, 0xFF, 0x00, 0x05, 0x00, 0x00, 0x66, 0xFF, 0x00, 0x05, 0x00, 0x06,
+	0x13, 0x06, 0xFF, 0x00, 0x06, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x06, 0x00, 0x00, 0x66, 0xFF, 0x00,
+	0x05, 0x00, 0x06, 0x13, 0x07, 0xFF, 0x00, 0x05, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x05, 0x00, 0x00,
+	0x67, 0xFF, 0x00, 0x05, 0x00, 0x06, 0x14, 0x06, 0xFF, 0x00, 0x06, 0x00, 0x00, 0x01, 0xFF, 0x00,
+	0x05, 0x00, 0x00, 0x67, 0xFF, 0x00, 0x05, 0x00, 0x04, 0x14, 0x07, 0xFF, 0x00, 0x0B, 0x00, 0x00,
+	0x67, 0xFF, 0x00, 0x05, 0x00, 0x04, 0x14, 0x07, 0xFF, 0x00, 0x0B, 0x00, 0x00, 0x67, 0xFF, 0x00,
+	0x05, 0x00, 0x04, 0x15, 0x07, 0xFF, 0x00, 0x09, 0x00, 0x00, 0x68, 0xFF, 0x00, 0x05, 0x00, 0x04,
+	0x15, 0x08, 0xFF, 0x00, 0x08, 0x00, 0x00, 0x68, 0xFF, 0x00, 0x05, 0x00, 0x04, 0x16, 0x08, 0xFF,
+	0x00, 0x07, 0x00, 0x00, 0x68, 0xFF, 0x00, 0x05, 0x00, 0x04, 0x17, 0x08, 0xFF, 0x00, 0x06, 0x00,
+	0x00, 0x68, 0xFF, 0x00, 0x05, 0x00, 0x03, 0x10, 0x15, 0x00, 0x00, 0x67, 0xFF, 0x00, 0x05, 0x00,
+	0x03, 0x0D, 0x18, 0x00, 0x00, 0x67, 0xFF, 0x00, 0x08, 0x00, 0x03, 0x0B, 0x1A, 0x00, 0x00, 0x67,
+	0xFF, 0x00, 0x0A, 0x00, 0x03, 0x09, 0x1C, 0x00, 0x00, 0x67, 0xFF, 0x00, 0x0C, 0x00, 0x03, 0x08,
+	0x0E, 0x00, 0x00, 0x76, 0xFF, 0x00, 0x0D, 0x00, 0x03, 0x07, 0x0A, 0x00, 0x00, 0x7F, 0xFF, 0x00,
+	0x0A, 0x00, 0x03, 0x06, 0x08, 0x00, 0x00, 0x85, 0xFF, 0x00, 0x08, 0x00, 0x03, 0x05, 0x07, 0x00,
+	0x00, 0x89, 0xFF, 0x00, 0x07, 0x00, 0x03, 0x04, 0x07, 0x00, 0x00, 0x8B, 0xFF, 0x00, 0x07, 0x00,
+	0x03, 0x03, 0x07, 0x00, 0x00, 0x8D, 0xFF, 0x00, 0x07, 0x00, 0x03, 0x03, 0x06, 0x00, 0x00, 0x8F,
+	0xFF, 0x00, 0x06, 0x00, 0x03, 0x02, 0x06, 0x00, 0x00, 0x91, 0xFF, 0x00, 0x06, 0x00, 0x03, 0x02,
+	0x05, 0x00, 0x00, 0x93, 0xFF, 0x00, 0x05, 0x00, 0x03, 0x01, 0x06, 0x00, 0x00, 0x93, 0xFF, 0x00,
+	0x06, 0x00, 0x03, 0x01, 0x05, 0x00, 0x00, 0x95, 0xFF, 0x00, 0x05, 0x00, 0x03, 0x01, 0x05, 0x00,
+	0x00, 0x95, 0xFF, 0x00, 0x05, 0x00, 0x03, 0x00, 0x06, 0x00, 0x00, 0x95, 0xFF, 0x00, 0x06, 0x00,
+	0x03, 0x00, 0x05, 0x00, 0x00, 0x97, 0xFF, 0x00, 0x05, 0x00, 0x03, 0x00, 0x05, 0x00, 0x00, 0x97,
+	0xFF, 0x00, 0x05, 0x00, 0x03, 0x00, 0x05, 0x00, 0x00, 0x97, 0xFF, 0x00, 0x05, 0x00, 0x03, 0x00,
+	0x05, 0x00, 0x00, 0x97, 0xFF, 0x00, 0x05, 0x00, 0x03, 0x00, 0x05, 0x00, 0x00, 0x97, 0xFF, 0x00,
+	0x05, 0x00, 0x03, 0x00, 0x05, 0x00, 0x00, 0x97, 0xFF, 0x00, 0x05, 0x00, 0x03, 0x00, 0x05, 0x00,
+	0x00, 0x97, 0xFF, 0x00, 0x05, 0x00, 0x03, 0x00, 0x06, 0x00, 0x00, 0x95, 0xFF, 0x00, 0x06, 0x00,
+	0x03, 0x01, 0x05, 0x00, 0x00, 0x95, 0xFF, 0x00, 0x05, 0x00, 0x03, 0x01, 0x05, 0x00, 0x00, 0x95,
+	0xFF, 0x00, 0x05, 0x00, 0x03, 0x01, 0x06, 0x00, 0x00, 0x93, 0xFF, 0x00, 0x06, 0x00, 0x03, 0x02,
+	0x05, 0x00, 0x00, 0x93, 0xFF, 0x00, 0x05, 0x00, 0x03, 0x02, 0x06, 0x00, 0x00, 0x91, 0xFF, 0x00,
+	0x06, 0x00, 0x03, 0x03, 0x06, 0x00, 0x00, 0x8F, 0xFF, 0x00, 0x06, 0x00, 0x03, 0x03, 0x07, 0x00,
+	0x00, 0x8D, 0xFF, 0x00, 0x07, 0x00, 0x03, 0x04, 0x07, 0x00, 0x00, 0x8B, 0xFF, 0x00, 0x07, 0x00,
+	0x03, 0x05, 0x07, 0x00, 0x00, 0x89, 0xFF, 0x00, 0x07, 0x00, 0x03, 0x06, 0x08, 0x00, 0x00, 0x85,
+	0xFF, 0x00, 0x08, 0x00, 0x03, 0x07, 0x0A, 0x00, 0x00, 0x7F, 0xFF, 0x00, 0x0A, 0x00, 0x01, 0x08,
+	0x91, 0x00, 0x01, 0x09, 0x8F, 0x00, 0x01, 0x0B, 0x8B, 0x00, 0x01, 0x0D, 0x87, 0x00, 0x01, 0x10,
+	0x81, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x14, 0x0A, 0xFF, 0x00, 0x01, 0x22, 0x00, 0x04, 0x00,
+	0x00, 0x01, 0xAA, 0x00, 0x0A, 0xFF, 0x00, 0x01, 0x22, 0x00, 0x04, 0x00, 0x00, 0x01, 0xAA, 0x00,
+	0x0A, 0xFF, 0x00, 0x01, 0x22, 0x00, 0x04, 0x00, 0x00, 0x01, 0xAA, 0x00, 0x0A, 0xFF, 0x00, 0x01,
+	0x22, 0x00, 0x04, 0x00, 0x00, 0x01, 0xAA, 0x00, 0x0A, 0xFF, 0x00, 0x01, 0x22, 0x00, 0x04, 0x00,
+	0x00, 0x01, 0xAA, 0x00, 0x0A, 0xFF, 0x00, 0x01, 0x22, 0x00, 0x04, 0x00, 0x00, 0x01, 0xAA, 0x00,
+	0x0A, 0xFF, 0x00, 0x01, 0x22, 0x00, 0x04, 0x00, 0x00, 0x01, 0xAA, 0x1D, 0x14, 0x09, 0xFF, 0x00,
+	0x01, 0xDD, 0x00, 0x04, 0x00, 0x00, 0x01, 0x11, 0x00, 0x0A, 0xFF, 0x00, 0x01, 0xDD, 0x00, 0x04,
+	0x00, 0x00, 0x01, 0x11, 0x00, 0x0A, 0xFF, 0x00, 0x01, 0xDD, 0x00, 0x04, 0x00, 0x00, 0x01, 0x11,
+	0x00, 0x0A, 0xFF, 0x00, 0x01, 0xDD, 0x00, 0x04, 0x00, 0x00, 0x01, 0x11, 0x00, 0x0A, 0xFF, 0x00,
+	0x01, 0xDD, 0x00, 0x04, 0x00, 0x00, 0x01, 0x11, 0x00, 0x0A, 0xFF, 0x00, 0x01, 0xDD, 0x00, 0x04,
+	0x00, 0x00, 0x01, 0x11, 0x00, 0x0A, 0xFF, 0x00, 0x01, 0xDD, 0x00, 0x04, 0x00, 0x00, 0x01, 0x11,
+	0x00, 0x01, 0xFF, 0x1D, 0x14, 0x09, 0xFF, 0x00, 0x01, 0x66, 0x00, 0x04, 0x00, 0x00, 0x01, 0x66,
+	0x00, 0x0A, 0xFF, 0x00, 0x01, 0x66, 0x00, 0x04, 0x00, 0x00, 0x01, 0x66, 0x00, 0x0A, 0xFF, 0x00,
+	0x01, 0x66, 0x00, 0x04, 0x00, 0x00, 0x01, 0x66, 0x00, 0x0A, 0xFF, 0x00, 0x01, 0x66, 0x00, 0x04,
+	0x00, 0x00, 0x01, 0x66, 0x00, 0x0A, 0xFF, 0x00, 0x01, 0x66, 0x00, 0x04, 0x00, 0x00, 0x01, 0x66,
+	0x00, 0x0A, 0xFF, 0x00, 0x01, 0x66, 0x00, 0x04, 0x00, 0x00, 0x01, 0x66, 0x00, 0x0A, 0xFF, 0x00,
+	0x01, 0x66, 0x00, 0x04, 0x00, 0x00, 0x01, 0x66, 0x00, 0x01, 0xFF, 0x1D, 0x14, 0x09, 0xFF, 0x00,
+	0x01, 0x11, 0x00, 0x04, 0x00, 0x00, 0x01, 0xCC, 0x00, 0x0A, 0xFF, 0x00, 0x01, 0x11, 0x00, 0x04,
+	0x00, 0x00, 0x01, 0xCC, 0x00, 0x0A, 0xFF, 0x00, 0x01, 0x11, 0x00, 0x04, 0x00, 0x00, 0x01, 0xCC,
+	0x00, 0x0A, 0xFF, 0x00, 0x01, 0x11, 0x00, 0x04, 0x00, 0x00, 0x01, 0xCC, 0x00, 0x0A, 0xFF, 0x00,
+	0x01, 0x11, 0x00, 0x04, 0x00, 0x00, 0x01, 0xCC, 0x00, 0x0A, 0xFF, 0x00, 0x01, 0x11, 0x00, 0x04,
+	0x00, 0x00, 0x01, 0xCC, 0x00, 0x0A, 0xFF, 0x00, 0x01, 0x11, 0x00, 0x04, 0x00, 0x00, 0x01, 0xCC,
+	0x00, 0x01, 0xFF, 0x1D, 0x14, 0x08, 0xFF, 0x00, 0x01, 0xAA, 0x00, 0x04, 0x00, 0x00, 0x01, 0x22,
+	0x00, 0x0A, 0xFF, 0x00, 0x01, 0xAA, 0x00, 0x04, 0x00, 0x00, 0x01, 0x22, 0x00, 0x0A, 0xFF, 0x00,
+	0x01, 0xAA, 0x00, 0x04, 0x00, 0x00, 0x01, 0x22, 0x00, 0x0A, 0xFF, 0x00, 0x01, 0xAA, 0x00, 0x04,
+	0x00, 0x00, 0x01, 0x22, 0x00, 0x0A, 0xFF, 0x00, 0x01, 0xAA, 0x00, 0x04, 0x00, 0x00, 0x01, 0x22,
+	0x00, 0x0A, 0xFF, 0x00, 0x01, 0xAA, 0x00, 0x04, 0x00, 0x00, 0x01, 0x22, 0x00, 0x0A, 0xFF, 0x00,
+	0x01, 0xAA, 0x00, 0x04, 0x00, 0x00, 0x01, 0x22, 0x00, 0x02, 0xFF, 0x1D, 0x14, 0x08, 0xFF, 0x00,
+	0x01, 0x44, 0x00, 0x04, 0x00, 0x00, 0x01, 0x88, 0x00, 0x0A, 0xFF, 0x00, 0x01, 0x44, 0x00, 0x04,
+	0x00, 0x00, 0x01, 0x88, 0x00, 0x0A, 0xFF, 0x00, 0x01, 0x44, 0x00, 0x04, 0x00, 0x00, 0x01, 0x88,
+	0x00, 0x0A, 0xFF, 0x00, 0x01, 0x44, 0x00, 0x04, 0x00, 0x00, 0x01, 0x88, 0x00, 0x0A, 0xFF, 0x00,
+	0x01, 0x44, 0x00, 0x04, 0x00, 0x00, 0x01, 0x88, 0x00, 0x0A, 0xFF, 0x00, 0x01, 0x44, 0x00, 0x04,
+	0x00, 0x00, 0x01, 0x88, 0x00, 0x0A, 0xFF, 0x00, 0x01, 0x44, 0x00, 0x04, 0x00, 0x00, 0x01, 0x88,
+	0x00, 0x02, 0xFF, 0x1D, 0x14, 0x07, 0xFF, 0x00, 0x01, 0xEE, 0x00, 0x05, 0x00, 0x00, 0x01, 0xEE,
+	0x00, 0x09, 0xFF, 0x00, 0x01, 0xEE, 0x00, 0x05, 0x00, 0x00, 0x01, 0xEE, 0x00, 0x09, 0xFF, 0x00,
+	0x01, 0xEE, 0x00, 0x05, 0x00, 0x00, 0x01, 0xEE, 0x00, 0x09, 0xFF, 0x00, 0x01, 0xEE, 0x00, 0x05,
+	0x00, 0x00, 0x01, 0xEE, 0x00, 0x09, 0xFF, 0x00, 0x01, 0xEE, 0x00, 0x05, 0x00, 0x00, 0x01, 0xEE,
+	0x00, 0x09, 0xFF, 0x00, 0x01, 0xEE, 0x00, 0x05, 0x00, 0x00, 0x01, 0xEE, 0x00, 0x09, 0xFF, 0x00,
+	0x01, 0xEE, 0x00, 0x05, 0x00, 0x00, 0x01, 0xEE, 0x00, 0x02, 0xFF, 0x1D, 0x14, 0x07, 0xFF, 0x00,
+	0x01, 0x99, 0x00, 0x04, 0x00, 0x00, 0x01, 0x44, 0x00, 0x0A, 0xFF, 0x00, 0x01, 0x99, 0x00, 0x04,
+	0x00, 0x00, 0x01, 0x44, 0x00, 0x0A, 0xFF, 0x00, 0x01, 0x99, 0x00, 0x04, 0x00, 0x00, 0x01, 0x44,
+	0x00, 0x0A, 0xFF, 0x00, 0x01, 0x99, 0x00, 0x04, 0x00, 0x00, 0x01, 0x44, 0x00, 0x0A, 0xFF, 0x00,
+	0x01, 0x99, 0x00, 0x04, 0x00, 0x00, 0x01, 0x44, 0x00, 0x0A, 0xFF, 0x00, 0x01, 0x99, 0x00, 0x04,
+	0x00, 0x00, 0x01, 0x44, 0x00, 0x0A, 0xFF, 0x00, 0x01, 0x99, 0x00, 0x04, 0x00, 0x00, 0x01, 0x44,
+	0x00, 0x03, 0xFF, 0x1D, 0x14, 0x07, 0xFF, 0x00, 0x01, 0x33, 0x00, 0x04, 0x00, 0x00, 0x01, 0xAA,
+	0x00, 0x0A, 0xFF, 0x00, 0x01, 0x33, 0x00, 0x04, 0x00, 0x00, 0x01, 0xAA, 0x00, 0x0A, 0xFF, 0x00,
+	0x01, 0x33, 0x00, 0x04, 0x00, 0x00, 0x01, 0xAA, 0x00, 0x0A, 0xFF, 0x00, 0x01, 0x33, 0x00, 0x04,
+	0x00, 0x00, 0x01, 0xAA, 0x00, 0x0A, 0xFF, 0x00, 0x01, 0x33, 0x00, 0x04, 0x00, 0x00, 0x01, 0xAA,
+	0x00, 0x0A, 0xFF, 0x00, 0x01, 0x33, 0x00, 0x04, 0x00, 0x00, 0x01, 0xAA, 0x00, 0x0A, 0xFF, 0x00,
+	0x01, 0x33, 0x00, 0x04, 0x00, 0x00, 0x01, 0xAA, 0x00, 0x03, 0xFF, 0x1D, 0x14, 0x06, 0xFF, 0x00,
+	0x01, 0xDD, 0x00, 0x04, 0x00, 0x00, 0x01, 0x11, 0x00, 0x0A, 0xFF, 0x00, 0x01, 0xDD, 0x00, 0x04,
+	0x00, 0x00, 0x01, 0x11, 0x00, 0x0A, 0xFF, 0x00, 0x01, 0xDD, 0x00, 0x04, 0x00, 0x00, 0x01, 0x11,
+	0x00, 0x0A, 0xFF, 0x00, 0x01, 0xDD, 0x00, 0x04, 0x00, 0x00, 0x01, 0x11, 0x00, 0x0A, 0xFF, 0x00,
+	0x01, 0xDD, 0x00, 0x04, 0x00, 0x00, 0x01, 0x11, 0x00, 0x0A, 0xFF, 0x00, 0x01, 0xDD, 0x00, 0x04,
+	0x00, 0x00, 0x01, 0x11, 0x00, 0x0A, 0xFF, 0x00, 0x01, 0xDD, 0x00, 0x04, 0x00, 0x00, 0x01, 0x11,
+	0x00, 0x04, 0xFF, 0x1D, 0x14, 0x06, 0xFF, 0x00, 0x01, 0x77, 0x00, 0x04, 0x00, 0x00, 0x01, 0x66,
+	0x00, 0x0A, 0xFF, 0x00, 0x01, 0x77, 0x00, 0x04, 0x00, 0x00, 0x01, 0x66, 0x00, 0x0A, 0xFF, 0x00,
+	0x01, 0x77, 0x00, 0x04, 0x00, 0x00, 0x01, 0x66, 0x00, 0x0A, 0xFF, 0x00, 0x01, 0x77, 0x00, 0x04,
+	0x00, 0x00, 0x01, 0x66, 0x00, 0x0A, 0xFF, 0x00, 0x01, 0x77, 0x00, 0x04, 0x00, 0x00, 0x01, 0x66,
+	0x00, 0x0A, 0xFF, 0x00, 0x01, 0x77, 0x00, 0x04, 0x00, 0x00, 0x01, 0x66, 0x00, 0x0A, 0xFF, 0x00,
+	0x01, 0x77, 0x00, 0x04, 0x00, 0x00, 0x01, 0x66, 0x00, 0x04, 0xFF, 0x1D, 0x14, 0x06, 0xFF, 0x00,
+	0x01, 0x11, 0x00, 0x04, 0x00, 0x00, 0x01, 0xCC, 0x00, 0x0A, 0xFF, 0x00, 0x01, 0x11, 0x00, 0x04,
+	0x00, 0x00, 0x01, 0xCC, 0x00, 0x0A, 0xFF, 0x00, 0x01, 0x11, 0x00, 0x04, 0x00, 0x00, 0x01, 0xCC,
+	0x00, 0x0A, 0xFF, 0x00, 0x01, 0x11, 0x00, 0x04, 0x00, 0x00, 0x01, 0xCC, 0x00, 0x0A, 0xFF, 0x00,
+	0x01, 0x11, 0x00, 0x04, 0x00, 0x00, 0x01, 0xCC, 0x00, 0x0A, 0xFF, 0x00, 0x01, 0x11, 0x00, 0x04,
+	0x00, 0x00, 0x01, 0xCC, 0x00, 0x0A, 0xFF, 0x00, 0x01, 0x11, 0x00, 0x04, 0x00, 0x00, 0x01, 0xCC,
+	0x00, 0x04, 0xFF, 0x1D, 0x14, 0x05, 0xFF, 0x00, 0x01, 0xBB, 0x00, 0x04, 0x00, 0x00, 0x01, 0x22,
+	0x00, 0x0A, 0xFF, 0x00, 0x01, 0xBB, 0x00, 0x04, 0x00, 0x00, 0x01, 0x22, 0x00, 0x0A, 0xFF, 0x00,
+	0x01, 0xBB, 0x00, 0x04, 0x00, 0x00, 0x01, 0x22, 0x00, 0x0A, 0xFF, 0x00, 0x01, 0xBB, 0x00, 0x04,
+	0x00, 0x00, 0x01, 0x22, 0x00, 0x0A, 0xFF, 0x00, 0x01, 0xBB, 0x00, 0x04, 0x00, 0x00, 0x01, 0x22,
+	0x00, 0x0A, 0xFF, 0x00, 0x01, 0xBB, 0x00, 0x04, 0x00, 0x00, 0x01, 0x22, 0x00, 0x0A, 0xFF, 0x00,
+	0x01, 0xBB, 0x00, 0x04, 0x00, 0x00, 0x01, 0x22, 0x00, 0x05, 0xFF, 0x1D, 0x14, 0x05, 0xFF, 0x00,
+	0x01, 0x55, 0x00, 0x04, 0x00, 0x00, 0x01, 0x88, 0x00, 0x0A, 0xFF, 0x00, 0x01, 0x55, 0x00, 0x04,
+	0x00, 0x00, 0x01, 0x88, 0x00, 0x0A, 0xFF, 0x00, 0x01, 0x55, 0x00, 0x04, 0x00, 0x00, 0x01, 0x88,
+	0x00, 0x0A, 0xFF, 0x00, 0x01, 0x55, 0x00, 0x04, 0x00, 0x00, 0x01, 0x88, 0x00, 0x0A, 0xFF, 0x00,
+	0x01, 0x55, 0x00, 0x04, 0x00, 0x00, 0x01, 0x88, 0x00, 0x0A, 0xFF, 0x00, 0x01, 0x55, 0x00, 0x04,
+	0x00, 0x00, 0x01, 0x88, 0x00, 0x0A, 0xFF, 0x00, 0x01, 0x55, 0x00, 0x04, 0x00, 0x00, 0x01, 0x88,
+	0x00, 0x05, 0xFF, 0x1D, 0x14, 0x04, 0xFF, 0x00, 0x01, 0xEE, 0x00, 0x05, 0x00, 0x00, 0x01, 0xEE,
+	0x00, 0x09, 0xFF, 0x00, 0x01, 0xEE, 0x00, 0x05, 0x00, 0x00, 0x01, 0xEE, 0x00, 0x09, 0xFF, 0x00,
+	0x01, 0xEE, 0x00, 0x05, 0x00, 0x00, 0x01, 0xEE, 0x00, 0x09, 0xFF, 0x00, 0x01, 0xEE, 0x00, 0x05,
+	0x00, 0x00, 0x01, 0xEE, 0x00, 0x09, 0xFF, 0x00, 0x01, 0xEE, 0x00, 0x05, 0x00, 0x00, 0x01, 0xEE,
+	0x00, 0x09, 0xFF, 0x00, 0x01, 0xEE, 0x00, 0x05, 0x00, 0x00, 0x01, 0xEE, 0x00, 0x09, 0xFF, 0x00,
+	0x01, 0xEE, 0x00, 0x05, 0x00, 0x00, 0x01, 0xEE, 0x00, 0x05, 0xFF, 0x1D, 0x14, 0x04, 0xFF, 0x00,
+	0x01, 0x99, 0x00, 0x04, 0x00, 0x00, 0x01, 0x44, 0x00, 0x0A, 0xFF, 0x00, 0x01, 0x99, 0x00, 0x04,
+	0x00, 0x00, 0x01, 0x44, 0x00, 0x0A, 0xFF, 0x00, 0x01, 0x99, 0x00, 0x04, 0x00, 0x00, 0x01, 0x44,
+	0x00, 0x0A, 0xFF, 0x00, 0x01, 0x99, 0x00, 0x04, 0x00, 0x00, 0x01, 0x44, 0x00, 0x0A, 0xFF, 0x00,
+	0x01, 0x99, 0x00, 0x04, 0x00, 0x00, 0x01, 0x44, 0x00, 0x0A, 0xFF, 0x00, 0x01, 0x99, 0x00, 0x04,
+	0x00, 0x00, 0x01, 0x44, 0x00, 0x0A, 0xFF, 0x00, 0x01, 0x99, 0x00, 0x04, 0x00, 0x00, 0x01, 0x44,
+	0x00, 0x06, 0xFF, 0x1D, 0x14, 0x04, 0xFF, 0x00, 0x01, 0x33, 0x00, 0x04, 0x00, 0x00, 0x01, 0xAA,
+	0x00, 0x0A, 0xFF, 0x00, 0x01, 0x33, 0x00, 0x04, 0x00, 0x00, 0x01, 0xAA, 0x00, 0x0A, 0xFF, 0x00,
+	0x01, 0x33, 0x00, 0x04, 0x00, 0x00, 0x01, 0xAA, 0x00, 0x0A, 0xFF, 0x00, 0x01, 0x33, 0x00, 0x04,
+	0x00, 0x00, 0x01, 0xAA, 0x00, 0x0A, 0xFF, 0x00, 0x01, 0x33, 0x00, 0x04, 0x00, 0x00, 0x01, 0xAA,
+	0x00, 0x0A, 0xFF, 0x00, 0x01, 0x33, 0x00, 0x04, 0x00, 0x00, 0x01, 0xAA, 0x00, 0x0A, 0xFF, 0x00,
+	0x01, 0x33, 0x00, 0x04, 0x00, 0x00, 0x01, 0xAA, 0x00, 0x06, 0xFF, 0x1D, 0x14, 0x03, 0xFF, 0x00,
+	0x01, 0xDD, 0x00, 0x04, 0x00, 0x00, 0x01, 0x11, 0x00, 0x0A, 0xFF, 0x00, 0x01, 0xDD, 0x00, 0x04,
+	0x00, 0x00, 0x01, 0x11, 0x00, 0x0A, 0xFF, 0x00, 0x01, 0xDD, 0x00, 0x04, 0x00, 0x00, 0x01, 0x11,
+	0x00, 0x0A, 0xFF, 0x00, 0x01, 0xDD, 0x00, 0x04, 0x00, 0x00, 0x01, 0x11, 0x00, 0x0A, 0xFF, 0x00,
+	0x01, 0xDD, 0x00, 0x04, 0x00, 0x00, 0x01, 0x11, 0x00, 0x0A, 0xFF, 0x00, 0x01, 0xDD, 0x00, 0x04,
+	0x00, 0x00, 0x01, 0x11, 0x00, 0x0A, 0xFF, 0x00, 0x01, 0xDD, 0x00, 0x04, 0x00, 0x00, 0x01, 0x11,
+	0x00, 0x07, 0xFF, 0x1D, 0x14, 0x03, 0xFF, 0x00, 0x01, 0x77, 0x00, 0x04, 0x00, 0x00, 0x01, 0x66,
+	0x00, 0x0A, 0xFF, 0x00, 0x01, 0x77, 0x00, 0x04, 0x00, 0x00, 0x01, 0x66, 0x00, 0x0A, 0xFF, 0x00,
+	0x01, 0x77, 0x00, 0x04, 0x00, 0x00, 0x01, 0x66, 0x00, 0x0A, 0xFF, 0x00, 0x01, 0x77, 0x00, 0x04,
+	0x00, 0x00, 0x01, 0x66, 0x00, 0x0A, 0xFF, 0x00, 0x01, 0x77, 0x00, 0x04, 0x00, 0x00, 0x01, 0x66,
+	0x00, 0x0A, 0xFF, 0x00, 0x01, 0x77, 0x00, 0x04, 0x00, 0x00, 0x01, 0x66, 0x00, 0x0A, 0xFF, 0x00,
+	0x01, 0x77, 0x00, 0x04, 0x00, 0x00, 0x01, 0x66, 0x00, 0x07, 0xFF, 0x1D, 0x14, 0x03, 0xFF, 0x00,
+	0x01, 0x11, 0x00, 0x04, 0x00, 0x00, 0x01, 0xCC, 0x00, 0x0A, 0xFF, 0x00, 0x01, 0x11, 0x00, 0x04,
+	0x00, 0x00, 0x01, 0xCC, 0x00, 0x0A, 0xFF, 0x00, 0x01, 0x11, 0x00, 0x04, 0x00, 0x00, 0x01, 0xCC,
+	0x00, 0x0A, 0xFF, 0x00, 0x01, 0x11, 0x00, 0x04, 0x00, 0x00, 0x01, 0xCC, 0x00, 0x0A, 0xFF, 0x00,
+	0x01, 0x11, 0x00, 0x04, 0x00, 0x00, 0x01, 0xCC, 0x00, 0x0A, 0xFF, 0x00, 0x01, 0x11, 0x00, 0x04,
+	0x00, 0x00, 0x01, 0xCC, 0x00, 0x0A, 0xFF, 0x00, 0x01, 0x11, 0x00, 0x04, 0x00, 0x00, 0x01, 0xCC,
+	0x00, 0x07, 0xFF, 0x1D, 0x14, 0x02, 0xFF, 0x00, 0x01, 0xBB, 0x00, 0x04, 0x00, 0x00, 0x01, 0x22,
+	0x00, 0x0A, 0xFF, 0x00, 0x01, 0xBB, 0x00, 0x04, 0x00, 0x00, 0x01, 0x22, 0x00, 0x0A, 0xFF, 0x00,
+	0x01, 0xBB, 0x00, 0x04, 0x00, 0x00, 0x01, 0x22, 0x00, 0x0A, 0xFF, 0x00, 0x01, 0xBB, 0x00, 0x04,
+	0x00, 0x00, 0x01, 0x22, 0x00, 0x0A, 0xFF, 0x00, 0x01, 0xBB, 0x00, 0x04, 0x00, 0x00, 0x01, 0x22,
+	0x00, 0x0A, 0xFF, 0x00, 0x01, 0xBB, 0x00, 0x04, 0x00, 0x00, 0x01, 0x22, 0x00, 0x0A, 0xFF, 0x00,
+	0x01, 0xBB, 0x00, 0x04, 0x00, 0x00, 0x01, 0x22, 0x00, 0x08, 0xFF, 0x1D, 0x14, 0x02, 0xFF, 0x00,
+	0x01, 0x55, 0x00, 0x04, 0x00, 0x00, 0x01, 0x88, 0x00, 0x0A, 0xFF, 0x00, 0x01, 0x55, 0x00, 0x04,
+	0x00, 0x00, 0x01, 0x88, 0x00, 0x0A, 0xFF, 0x00, 0x01, 0x55, 0x00, 0x04, 0x00, 0x00, 0x01, 0x88,
+	0x00, 0x0A, 0xFF, 0x00, 0x01, 0x55, 0x00, 0x04, 0x00, 0x00, 0x01, 0x88, 0x00, 0x0A, 0xFF, 0x00,
+	0x01, 0x55, 0x00, 0x04, 0x00, 0x00, 0x01, 0x88, 0x00, 0x0A, 0xFF, 0x00, 0x01, 0x55, 0x00, 0x04,
+	0x00, 0x00, 0x01, 0x88, 0x00, 0x0A, 0xFF, 0x00, 0x01, 0x55, 0x00, 0x04, 0x00, 0x00, 0x01, 0x88,
+	0x00, 0x08, 0xFF, 0x1D, 0x14, 0x01, 0xFF, 0x00, 0x01, 0xEE, 0x00, 0x05, 0x00, 0x00, 0x01, 0xEE,
+	0x00, 0x09, 0xFF, 0x00, 0x01, 0xEE, 0x00, 0x05, 0x00, 0x00, 0x01, 0xEE, 0x00, 0x09, 0xFF, 0x00,
+	0x01, 0xEE, 0x00, 0x05, 0x00, 0x00, 0x01, 0xEE, 0x00, 0x09, 0xFF, 0x00, 0x01, 0xEE, 0x00, 0x05,
+	0x00, 0x00, 0x01, 0xEE, 0x00, 0x09, 0xFF, 0x00, 0x01, 0xEE, 0x00, 0x05, 0x00, 0x00, 0x01, 0xEE,
+	0x00, 0x09, 0xFF, 0x00, 0x01, 0xEE, 0x00, 0x05, 0x00, 0x00, 0x01, 0xEE, 0x00, 0x09, 0xFF, 0x00,
+	0x01, 0xEE, 0x00, 0x05, 0x00, 0x00, 0x01, 0xEE, 0x00, 0x08, 0xFF, 0x1D, 0x14, 0x01, 0xFF, 0x00,
+	0x01, 0x99, 0x00, 0x04, 0x00, 0x00, 0x01, 0x44, 0x00, 0x0A, 0xFF, 0x00, 0x01, 0x99, 0x00, 0x04,
+	0x00, 0x00, 0x01, 0x44, 0x00, 0x0A, 0xFF, 0x00, 0x01, 0x99, 0x00, 0x04, 0x00, 0x00, 0x01, 0x44,
+	0x00, 0x0A, 0xFF, 0x00, 0x01, 0x99, 0x00, 0x04, 0x00, 0x00, 0x01, 0x44, 0x00, 0x0A, 0xFF, 0x00,
+	0x01, 0x99, 0x00, 0x04, 0x00, 0x00, 0x01, 0x44, 0x00, 0x0A, 0xFF, 0x00, 0x01, 0x99, 0x00, 0x04,
+	0x00, 0x00, 0x01, 0x44, 0x00, 0x0A, 0xFF, 0x00, 0x01, 0x99, 0x00, 0x04, 0x00, 0x00, 0x01, 0x44,
+	0x00, 0x09, 0xFF, 0x1D, 0x14, 0x01, 0xFF, 0x00, 0x01, 0x33, 0x00, 0x04, 0x00, 0x00, 0x01, 0xAA,
+	0x00, 0x0A, 0xFF, 0x00, 0x01, 0x33, 0x00, 0x04, 0x00, 0x00, 0x01, 0xAA, 0x00, 0x0A, 0xFF, 0x00,
+	0x01, 0x33, 0x00, 0x04, 0x00, 0x00, 0x01, 0xAA, 0x00, 0x0A, 0xFF, 0x00, 0x01, 0x33, 0x00, 0x04,
+	0x00, 0x00, 0x01, 0xAA, 0x00, 0x0A, 0xFF, 0x00, 0x01, 0x33, 0x00, 0x04, 0x00, 0x00, 0x01, 0xAA,
+	0x00, 0x0A, 0xFF, 0x00, 0x01, 0x33, 0x00, 0x04, 0x00, 0x00, 0x01, 0xAA, 0x00, 0x0A, 0xFF, 0x00,
+	0x01, 0x33, 0x00, 0x04, 0x00, 0x00, 0x01, 0xAA, 0x00, 0x09, 0xFF, 0x1C, 0x14, 0x01, 0xDD, 0x00,
+	0x04, 0x00, 0x00, 0x01, 0x11, 0x00, 0x0A, 0xFF, 0x00, 0x01, 0xDD, 0x00, 0x04, 0x00, 0x00, 0x01,
+	0x11, 0x00, 0x0A, 0xFF, 0x00, 0x01, 0xDD, 0x00, 0x04, 0x00, 0x00, 0x01, 0x11, 0x00, 0x0A, 0xFF,
+	0x00, 0x01, 0xDD, 0x00, 0x04, 0x00, 0x00, 0x01, 0x11, 0x00, 0x0A, 0xFF, 0x00, 0x01, 0xDD, 0x00,
+	0x04, 0x00, 0x00, 0x01, 0x11, 0x00, 0x0A, 0xFF, 0x00, 0x01, 0xDD, 0x00, 0x04, 0x00, 0x00, 0x01,
+	0x11, 0x00, 0x0A, 0xFF, 0x00, 0x01, 0xDD, 0x00, 0x04, 0x00, 0x00, 0x01, 0x11, 0x00, 0x0A, 0xFF,
+	0x1C, 0x14, 0x01, 0x77, 0x00, 0x04, 0x00, 0x00, 0x01, 0x66, 0x00, 0x0A, 0xFF, 0x00, 0x01, 0x77,
+	0x00, 0x04, 0x00, 0x00, 0x01, 0x66, 0x00, 0x0A, 0xFF, 0x00, 0x01, 0x77, 0x00, 0x04, 0x00, 0x00,
+	0x01, 0x66, 0x00, 0x0A, 0xFF, 0x00, 0x01, 0x77, 0x00, 0x04, 0x00, 0x00, 0x01, 0x66, 0x00, 0x0A,
+	0xFF, 0x00, 0x01, 0x77, 0x00, 0x04, 0x00, 0x00, 0x01, 0x66, 0x00, 0x0A, 0xFF, 0x00, 0x01, 0x77,
+	0x00, 0x04, 0x00, 0x00, 0x01, 0x66, 0x00, 0x0A, 0xFF, 0x00, 0x01, 0x77, 0x00, 0x04, 0x00, 0x00,
+	0x01, 0x66, 0x00, 0x0A, 0xFF,
+};
+constexpr uint8_t IconSprite_09d_S_runs[] = {
+	0x01, 0x14, 0x05, 0x00, 0x01, 0x14, 0x05, 0x00, 0x01, 0x14, 0x05, 0x00, 0x01, 0x14, 0x05, 0x00,
+	0x03, 0x08, 0x01, 0x00, 0x0B, 0x05, 0x00, 0x07, 0x01, 0x00, 0x03, 0x07, 0x03, 0x00, 0x0A, 0x05,
+	0x00, 0x06, 0x03, 0x00, 0x03, 0x06, 0x05, 0x00, 0x09, 0x05, 0x00, 0x05, 0x05, 0x00, 0x04, 0x05,
+	0x07, 0x00, 0x05, 0x07, 0xFF, 0x00, 0x01, 0x00, 0x04, 0x07, 0x00, 0x03, 0x04, 0x09, 0x00, 0x01,
+	0x0D, 0xFF, 0x01, 0x09, 0x00, 0x03, 0x05, 0x08, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x08, 0x00, 0x05,
+	0x06, 0x06, 0x00, 0x00, 0x05, 0xFF, 0x00, 0x07, 0x00, 0x00, 0x05, 0xFF, 0x00, 0x06, 0x00, 0x05,
+	0x07, 0x04, 0x00, 0x00, 0x04, 0xFF, 0x00, 0x0B, 0x00, 0x00, 0x04, 0xFF, 0x00, 0x04, 0x00, 0x05,
+	0x08, 0x02, 0x00, 0x00, 0x04, 0xFF, 0x00, 0x0D, 0x00, 0x00, 0x04, 0xFF, 0x00, 0x02, 0x00, 0x03,
+	0x09, 0x04, 0xFF, 0x00, 0x0F, 0x00, 0x00, 0x04, 0xFF, 0x03, 0x08, 0x04, 0xFF, 0x00, 0x11, 0x00,
+	0x00, 0x04, 0xFF, 0x05, 0x08, 0x03, 0xFF, 0x00, 0x07, 0x00, 0x00, 0x05, 0xFF, 0x00, 0x07, 0x00,
+	0x00, 0x03, 0xFF, 0x05, 0x08, 0x03, 0xFF, 0x00, 0x06, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x06, 0x00,
+	0x00, 0x03, 0xFF, 0x05, 0x07, 0x03, 0xFF, 0x00, 0x06, 0x00, 0x00, 0x09, 0xFF, 0x00, 0x06, 0x00,
+	0x00, 0x03, 0xFF, 0x05, 0x07, 0x03, 0xFF, 0x00, 0x05, 0x00, 0x00, 0x0B, 0xFF, 0x00, 0x05, 0x00,
+	0x00, 0x03, 0xFF, 0x05, 0x07, 0x03, 0xFF, 0x00, 0x05, 0x00, 0x00, 0x0B, 0xFF, 0x00, 0x05, 0x00,
+	0x00, 0x03, 0xFF, 0x08, 0x00, 0x07, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x05, 0x00, 0x00, 0x0B, 0xFF,
+	0x00, 0x05, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x06, 0x00, 0x04, 0x07, 0x00, 0x08, 0x00, 0x07, 0x00,
+	0x00, 0x03, 0xFF, 0x00, 0x05, 0x00, 0x00, 0x0B, 0xFF, 0x00, 0x05, 0x00, 0x00, 0x03, 0xFF, 0x00,
+	0x06, 0x00, 0x02, 0x0B, 0x00, 0x08, 0x00, 0x07, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x05, 0x00, 0x00,
+	0x0B, 0xFF, 0x00, 0x05, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x06, 0x00, 0x01, 0x0D, 0x00, 0x07, 0x00,
+	0x07, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x06, 0x00, 0x00, 0x09, 0xFF, 0x00, 0x06, 0x00, 0x00, 0x03,
+	0xFF, 0x00, 0x15, 0x00, 0x05, 0x00, 0x08, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x06, 0x00, 0x00, 0x07,
+	0xFF, 0x00, 0x20, 0x00, 0x07, 0x08, 0x03, 0xFF, 0x00, 0x07, 0x00, 0x00, 0x05, 0xFF, 0x00, 0x0E,
+	0x00, 0x01, 0x07, 0x00, 0x00, 0x05, 0xFF, 0x00, 0x07, 0x00, 0x04, 0x08, 0x04, 0xFF, 0x00, 0x20,
+	0x00, 0x00, 0x07, 0xFF, 0x00, 0x06, 0x00, 0x04, 0x09, 0x04, 0xFF, 0x00, 0x1E, 0x00, 0x00, 0x09,
+	0xFF, 0x00, 0x06, 0x00, 0x05, 0x08, 0x02, 0x00, 0x00, 0x04, 0xFF, 0x00, 0x1C, 0x00, 0x00, 0x0B,
+	0xFF, 0x00, 0x05, 0x00, 0x07, 0x07, 0x04, 0x00, 0x00, 0x04, 0xFF, 0x00, 0x10, 0x00, 0x00, 0x03,
+	0xFF, 0x00, 0x08, 0x00, 0x00, 0x0B, 0xFF, 0x00, 0x05, 0x00, 0x07, 0x06, 0x06, 0x00, 0x00, 0x05,
+	0xFF, 0x00, 0x0D, 0x00, 0x00, 0x05, 0xFF, 0x00, 0x07, 0x00, 0x00, 0x0B, 0xFF, 0x00, 0x05, 0x00,
+	0x07, 0x05, 0x08, 0x00, 0x00, 0x0B, 0xFF, 0x00, 0x05, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x06, 0x00,
+	0x00, 0x0B, 0xFF, 0x00, 0x05, 0x00, 0x07, 0x04, 0x09, 0x00, 0x01, 0x04, 0xFF, 0x00, 0x0B, 0x00,
+	0x00, 0x07, 0xFF, 0x00, 0x06, 0x00, 0x00, 0x0B, 0xFF, 0x00, 0x06, 0x00, 0x06, 0x05, 0x07, 0x00,
+	0x05, 0x0C, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x07, 0x00, 0x00, 0x09, 0xFF, 0x00, 0x08, 0x00, 0x06,
+	0x06, 0x05, 0x00, 0x05, 0x0E, 0x00, 0x00, 0x05, 0xFF, 0x00, 0x09, 0x00, 0x00, 0x07, 0xFF, 0x00,
+	0x0A, 0x00, 0x06, 0x07, 0x03, 0x00, 0x05, 0x10, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x0B, 0x00, 0x00,
+	0x05, 0xFF, 0x00, 0x0C, 0x00, 0x04, 0x08, 0x01, 0x00, 0x05, 0x08, 0x00, 0x00, 0x23, 0xFF, 0x00,
+	0x06, 0x00, 0x05, 0x0E, 0x06, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x01, 0x00, 0x00, 0x23, 0xFF, 0x00,
+	0x06, 0x00, 0x03, 0x0E, 0x05, 0x00, 0x00, 0x27, 0xFF, 0x00, 0x05, 0x00, 0x05, 0x0E, 0x06, 0x00,
+	0x00, 0x01, 0xFF, 0x00, 0x01, 0x00, 0x00, 0x23, 0xFF, 0x00, 0x06, 0x00, 0x01, 0x0E, 0x31, 0x00,
+	0x01, 0x0F, 0x2F, 0x00, 0x01, 0x10, 0x2D, 0x00, 0x01, 0x11, 0x2B, 0x00, 0x01, 0x12, 0x29, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x0D, 0x04, 0xFF, 0x00, 0x01, 0x77, 0x00, 0x01, 0x00, 0x00,
+	0x01, 0x44, 0x00, 0x04, 0xFF, 0x00, 0x01, 0x77, 0x00, 0x01, 0x00, 0x00, 0x01, 0x44, 0x00, 0x04,
+	0xFF, 0x00, 0x01, 0x77, 0x00, 0x01, 0x00, 0x00, 0x01, 0x44, 0x00, 0x04, 0xFF, 0x00, 0x01, 0x77,
+	0x00, 0x01, 0x00, 0x00, 0x01, 0x44, 0x00, 0x04, 0xFF, 0x00, 0x01, 0x77, 0x00, 0x01, 0x00, 0x00,
+	0x01, 0x44, 0x00, 0x04, 0xFF, 0x00, 0x01, 0x77, 0x00, 0x01, 0x00, 0x00, 0x01, 0x44, 0x00, 0x04,
+	0xFF, 0x00, 0x01, 0x77, 0x00, 0x01, 0x00, 0x00, 0x01, 0x44, 0x1C, 0x0D, 0x04, 0xFF, 0x00, 0x01,
+	0x11, 0x00, 0x01, 0x00, 0x00, 0x01, 0xAA, 0x00, 0x04, 0xFF, 0x00, 0x01, 0x11, 0x00, 0x01, 0x00,
+	0x00, 0x01, 0xAA, 0x00, 0x04, 0xFF, 0x00, 0x01, 0x11, 0x00, 0x01, 0x00, 0x00, 0x01, 0xAA, 0x00,
+	0x04, 0xFF, 0x00, 0x01, 0x11, 0x00, 0x01, 0x00, 0x00, 0x01, 0xAA, 0x00, 0x04, 0xFF, 0x00, 0x01,
+	0x11, 0x00, 0x01, 0x00, 0x00, 0x01, 0xAA, 0x00, 0x04, 0xFF, 0x00, 0x01, 0x11, 0x00, 0x01, 0x00,
+	0x00, 0x01, 0xAA, 0x00, 0x04, 0xFF, 0x00, 0x01, 0x11, 0x00, 0x01, 0x00, 0x00, 0x01, 0xAA, 0x16,
+	0x0D, 0x03, 0xFF, 0x00, 0x01, 0xBB, 0x00, 0x02, 0x00, 0x00, 0x04, 0xFF, 0x00, 0x01, 0xBB, 0x00,
+	0x02, 0x00, 0x00, 0x04, 0xFF, 0x00, 0x01, 0xBB, 0x00, 0x02, 0x00, 0x00, 0x04, 0xFF, 0x00, 0x01,
+	0xBB, 0x00, 0x02, 0x00, 0x00, 0x04, 0xFF, 0x00, 0x01, 0xBB, 0x00, 0x02, 0x00, 0x00, 0x04, 0xFF,
+	0x00, 0x01, 0xBB, 0x00, 0x02, 0x00, 0x00, 0x04, 0xFF, 0x00, 0x01, 0xBB, 0x00, 0x02, 0x00, 0x00,
+	0x01, 0xFF, 0x1D, 0x0D, 0x03, 0xFF, 0x00, 0x01, 0x55, 0x00, 0x01, 0x00, 0x00, 0x01, 0x66, 0x00,
+	0x04, 0xFF, 0x00, 0x01, 0x55, 0x00, 0x01, 0x00, 0x00, 0x01, 0x66, 0x00, 0x04, 0xFF, 0x00, 0x01,
+	0x55, 0x00, 0x01, 0x00, 0x00, 0x01, 0x66, 0x00, 0x04, 0xFF, 0x00, 0x01, 0x55, 0x00, 0x01, 0x00,
+	0x00, 0x01, 0x66, 0x00, 0x04, 0xFF, 0x00, 0x01, 0x55, 0x00, 0x01, 0x00, 0x00, 0x01, 0x66, 0x00,
+	0x04, 0xFF, 0x00, 0x01, 0x55, 0x00, 0x01, 0x00, 0x00, 0x01, 0x66, 0x00, 0x04, 0xFF, 0x00, 0x01,
+	0x55, 0x00, 0x01, 0x00, 0x00, 0x01, 0x66, 0x00, 0x01, 0xFF, 0x1D, 0x0D, 0x02, 0xFF, 0x00, 0x01,
+	0xEE, 0x00, 0x02, 0x00, 0x00, 0x01, 0xCC, 0x00, 0x03, 0xFF, 0x00, 0x01, 0xEE, 0x00, 0x02, 0x00,
+	0x00, 0x01, 0xCC, 0x00, 0x03, 0xFF, 0x00, 0x01, 0xEE, 0x00, 0x02, 0x00, 0x00, 0x01, 0xCC, 0x00,
+	0x03, 0xFF, 0x00, 0x01, 0xEE, 0x00, 0x02, 0x00, 0x00, 0x01, 0xCC, 0x00, 0x03, 0xFF, 0x00, 0x01,
+	0xEE, 0x00, 0x02, 0x00, 0x00, 0x01, 0xCC, 0x00, 0x03, 0xFF, 0x00, 0x01, 0xEE, 0x00, 0x02, 0x00,
+	0x00, 0x01, 0xCC, 0x00, 0x03, 0xFF, 0x00, 0x01, 0xEE, 0x00, 0x02, 0x00, 0x00, 0x01, 0xCC, 0x00,
+	0x01, 0xFF, 0x1D, 0x0D, 0x02, 0xFF, 0x00, 0x01, 0x88, 0x00, 0x01, 0x00, 0x00, 0x01, 0x22, 0x00,
+	0x04, 0xFF, 0x00, 0x01, 0x88, 0x00, 0x01, 0x00, 0x00, 0x01, 0x22, 0x00, 0x04, 0xFF, 0x00, 0x01,
+	0x88, 0x00, 0x01, 0x00, 0x00, 0x01, 0x22, 0x00, 0x04, 0xFF, 0x00, 0x01, 0x88, 0x00, 0x01, 0x00,
+	0x00, 0x01, 0x22, 0x00, 0x04, 0xFF, 0x00, 0x01, 0x88, 0x00, 0x01, 0x00, 0x00, 0x01, 0x22, 0x00,
+	0x04, 0xFF, 0x00, 0x01, 0x88, 0x00, 0x01, 0x00, 0x00, 0x01, 0x22, 0x00, 0x04, 0xFF, 0x00, 0x01,
+	0x88, 0x00, 0x01, 0x00, 0x00, 0x01, 0x22, 0x00, 0x02, 0xFF, 0x1D, 0x0D, 0x02, 0xFF, 0x00, 0x01,
+	0x22, 0x00, 0x01, 0x00, 0x00, 0x01, 0x88, 0x00, 0x04, 0xFF, 0x00, 0x01, 0x22, 0x00, 0x01, 0x00,
+	0x00, 0x01, 0x88, 0x00, 0x04, 0xFF, 0x00, 0x01, 0x22, 0x00, 0x01, 0x00, 0x00, 0x01, 0x88, 0x00,
+	0x04, 0xFF, 0x00, 0x01, 0x22, 0x00, 0x01, 0x00, 0x00, 0x01, 0x88, 0x00, 0x04, 0xFF, 0x00, 0x01,
+	0x22, 0x00, 0x01, 0x00, 0x00, 0x01, 0x88, 0x00, 0x04, 0xFF, 0x00, 0x01, 0x22, 0x00, 0x01, 0x00,
+	0x00, 0x01, 0x88, 0x00, 0x04, 0xFF, 0x00, 0x01, 0x22, 0x00, 0x01, 0x00, 0x00, 0x01, 0x88, 0x00,
+	0x02, 0xFF, 0x1D, 0x0D, 0x01, 0xFF, 0x00, 0x01, 0xCC, 0x00, 0x02, 0x00, 0x00, 0x01, 0xEE, 0x00,
+	0x03, 0xFF, 0x00, 0x01, 0xCC, 0x00, 0x02, 0x00, 0x00, 0x01, 0xEE, 0x00, 0x03, 0xFF, 0x00, 0x01,
+	0xCC, 0x00, 0x02, 0x00, 0x00, 0x01, 0xEE, 0x00, 0x03, 0xFF, 0x00, 0x01, 0xCC, 0x00, 0x02, 0x00,
+	0x00, 0x01, 0xEE, 0x00, 0x03, 0xFF, 0x00, 0x01, 0xCC, 0x00, 0x02, 0x00, 0x00, 0x01, 0xEE, 0x00,
+	0x03, 0xFF, 0x00, 0x01, 0xCC, 0x00, 0x02, 0x00, 0x00, 0x01, 0xEE, 0x00, 0x03, 0xFF, 0x00, 0x01,
+	0xCC, 0x00, 0x02, 0x00, 0x00, 0x01, 0xEE, 0x00, 0x02, 0xFF, 0x1D, 0x0D, 0x01, 0xFF, 0x00, 0x01,
+	0x66, 0x00, 0x01, 0x00, 0x00, 0x01, 0x44, 0x00, 0x04, 0xFF, 0x00, 0x01, 0x66, 0x00, 0x01, 0x00,
+	0x00, 0x01, 0x44, 0x00, 0x04, 0xFF, 0x00, 0x01, 0x66, 0x00, 0x01, 0x00, 0x00, 0x01, 0x44, 0x00,
+	0x04, 0xFF, 0x00, 0x01, 0x66, 0x00, 0x01, 0x00, 0x00, 0x01, 0x44, 0x00, 0x04, 0xFF, 0x00, 0x01,
+	0x66, 0x00, 0x01, 0x00, 0x00, 0x01, 0x44, 0x00, 0x04, 0xFF, 0x00, 0x01, 0x66, 0x00, 0x01, 0x00,
+	0x00, 0x01, 0x44, 0x00, 0x04, 0xFF, 0x00, 0x01, 0x66, 0x00, 0x01, 0x00, 0x00, 0x01, 0x44, 0x00,
+	0x03, 0xFF, 0x1D, 0x0D, 0x01, 0xFF, 0x00, 0x01, 0x11, 0x00, 0x01, 0x00, 0x00, 0x01, 0xAA, 0x00,
+	0x04, 0xFF, 0x00, 0x01, 0x11, 0x00, 0x01, 0x00, 0x00, 0x01, 0xAA, 0x00, 0x04, 0xFF, 0x00, 0x01,
+	0x11, 0x00, 0x01, 0x00, 0x00, 0x01, 0xAA, 0x00, 0x04, 0xFF, 0x00, 0x01, 0x11, 0x00, 0x01, 0x00,
+	0x00, 0x01, 0xAA, 0x00, 0x04, 0xFF, 0x00, 0x01, 0x11, 0x00, 0x01, 0x00, 0x00, 0x01, 0xAA, 0x00,
+	0x04, 0xFF, 0x00, 0x01, 0x11, 0x00, 0x01, 0x00, 0x00, 0x01, 0xAA, 0x00, 0x04, 0xFF, 0x00, 0x01,
+	0x11, 0x00, 0x01, 0x00, 0x00, 0x01, 0xAA, 0x00, 0x03, 0xFF, 0x15, 0x0D, 0x01, 0xAA, 0x00, 0x02,
+	0x00, 0x00, 0x04, 0xFF, 0x00, 0x01, 0xAA, 0x00, 0x02, 0x00, 0x00, 0x04, 0xFF, 0x00, 0x01, 0xAA,
+	0x00, 0x02, 0x00, 0x00, 0x04, 0xFF, 0x00, 0x01, 0xAA, 0x00, 0x02, 0x00, 0x00, 0x04, 0xFF, 0x00,
+	0x01, 0xAA, 0x00, 0x02, 0x00, 0x00, 0x04, 0xFF, 0x00, 0x01, 0xAA, 0x00, 0x02, 0x00, 0x00, 0x04,
+	0xFF, 0x00, 0x01, 0xAA, 0x00, 0x02, 0x00, 0x00, 0x04, 0xFF, 0x1C, 0x0D, 0x01, 0x44, 0x00, 0x01,
+	0x00, 0x00, 0x01, 0x66, 0x00, 0x04, 0xFF, 0x00, 0x01, 0x44, 0x00, 0x01, 0x00, 0x00, 0x01, 0x66,
+	0x00, 0x04, 0xFF, 0x00, 0x01, 0x44, 0x00, 0x01, 0x00, 0x00, 0x01, 0x66, 0x00, 0x04, 0xFF, 0x00,
+	0x01, 0x44, 0x00, 0x01, 0x00, 0x00, 0x01, 0x66, 0x00, 0x04, 0xFF, 0x00, 0x01, 0x44, 0x00, 0x01,
+	0x00, 0x00, 0x01, 0x66, 0x00, 0x04, 0xFF, 0x00, 0x01, 0x44, 0x00, 0x01, 0x00, 0x00, 0x01, 0x66,
+	0x00, 0x04, 0xFF, 0x00, 0x01, 0x44, 0x00, 0x01, 0x00, 0x00, 0x01, 0x66, 0x00, 0x04, 0xFF,
+};
+constexpr uint8_t IconSprite_09n_L_runs[] = {
+	0x01, 0xBF, 0x07, 0xFF, 0x01, 0xBC, 0x0D, 0xFF, 0x02, 0x2C, 0x05, 0x00, 0x89, 0x11, 0xFF, 0x02,
+	0x2C, 0x05, 0x00, 0x88, 0x13, 0xFF, 0x02, 0x2C, 0x05, 0x00, 0x86, 0x17, 0xFF, 0x02, 0x2C, 0x05,
+	0x00, 0x85, 0x19, 0xFF, 0x03, 0x2C, 0x05, 0x00, 0x82, 0x03, 0x00, 0x00, 0x19, 0xFF, 0x03, 0x2C,
+	0x05, 0x00, 0x80, 0x04, 0x00, 0x00, 0x1B, 0xFF, 0x03, 0x2C, 0x05, 0x00, 0x7F, 0x04, 0x00, 0x00,
+	0x1D, 0xFF, 0x03, 0x2C, 0x05, 0x00, 0x7E, 0x05, 0x00, 0x00, 0x1D, 0xFF, 0x03, 0x2C, 0x05, 0x00,
+	0x7D, 0x05, 0x00, 0x00, 0x1F, 0xFF, 0x03, 0x2C, 0x05, 0x00, 0x7C, 0x06, 0x00, 0x00, 0x1F, 0xFF,
+	0x05, 0x12, 0x01, 0x00, 0x19, 0x05, 0x00, 0x15, 0x01, 0x00, 0x66, 0x06, 0x00, 0x00, 0x1F, 0xFF,
+	0x05, 0x11, 0x03, 0x00, 0x18, 0x05, 0x00, 0x14, 0x03, 0x00, 0x64, 0x06, 0x00, 0x00, 0x21, 0xFF,
+	0x05, 0x10, 0x05, 0x00, 0x17, 0x05, 0x00, 0x13, 0x05, 0x00, 0x63, 0x06, 0x00, 0x00, 0x21, 0xFF,
+	0x05, 0x0F, 0x07, 0x00, 0x16, 0x05, 0x00, 0x12, 0x07, 0x00, 0x62, 0x06, 0x00, 0x00, 0x21, 0xFF,
+	0x05, 0x0E, 0x09, 0x00, 0x10, 0x0B, 0xFF, 0x10, 0x09, 0x00, 0x61, 0x06, 0x00, 0x00, 0x21, 0xFF,
+	0x06, 0x0F, 0x09, 0x00, 0x0C, 0x11, 0xFF, 0x0C, 0x09, 0x00, 0x1F, 0x0B, 0x00, 0x38, 0x06, 0x00,
+	0x00, 0x21, 0xFF, 0x06, 0x10, 0x09, 0x00, 0x08, 0x17, 0xFF, 0x08, 0x09, 0x00, 0x1B, 0x15, 0x00,
+	0x33, 0x06, 0x00, 0x00, 0x21, 0xFF, 0x06, 0x11, 0x09, 0x00, 0x05, 0x1B, 0xFF, 0x05, 0x09, 0x00,
+	0x1A, 0x19, 0x00, 0x31, 0x06, 0x00, 0x00, 0x21, 0xFF, 0x06, 0x12, 0x09, 0x00, 0x03, 0x1D, 0xFF,
+	0x03, 0x09, 0x00, 0x18, 0x1F, 0x00, 0x2F, 0x06, 0x00, 0x00, 0x1F, 0xFF, 0x06, 0x13, 0x09, 0x00,
+	0x01, 0x1F, 0xFF, 0x01, 0x09, 0x00, 0x17, 0x23, 0x00, 0x2D, 0x06, 0x00, 0x00, 0x1F, 0xFF, 0x0A,
+	0x14, 0x07, 0x00, 0x00, 0x0D, 0xFF, 0x00, 0x09, 0x00, 0x00, 0x0D, 0xFF, 0x00, 0x07, 0x00, 0x17,
+	0x0D, 0x00, 0x00, 0x0B, 0xFF, 0x00, 0x0D, 0x00, 0x2D, 0x05, 0x00, 0x00, 0x1F, 0xFF, 0x0A, 0x15,
+	0x05, 0x00, 0x00, 0x0B, 0xFF, 0x00, 0x0F, 0x00, 0x00, 0x0B, 0xFF, 0x00, 0x05, 0x00, 0x16, 0x0B,
+	0x00, 0x00, 0x13, 0xFF, 0x00, 0x0B, 0x00, 0x2C, 0x05, 0x00, 0x00, 0x1D, 0xFF, 0x0A, 0x16, 0x03,
+	0x00, 0x00, 0x0A, 0xFF, 0x00, 0x13, 0x00, 0x00, 0x0A, 0xFF, 0x00, 0x03, 0x00, 0x16, 0x0A, 0x00,
+	0x00, 0x17, 0xFF, 0x00, 0x0A, 0x00, 0x2C, 0x04, 0x00, 0x00, 0x1D, 0xFF, 0x0A, 0x17, 0x01, 0x00,
+	0x00, 0x09, 0xFF, 0x00, 0x17, 0x00, 0x00, 0x09, 0xFF, 0x00, 0x01, 0x00, 0x16, 0x08, 0x00, 0x00,
+	0x1D, 0xFF, 0x00, 0x08, 0x00, 0x2C, 0x04, 0x00, 0x00, 0x1B, 0xFF, 0x08, 0x18, 0x08, 0xFF, 0x00,
+	0x19, 0x00, 0x00, 0x08, 0xFF, 0x16, 0x08, 0x00, 0x00, 0x1F, 0xFF, 0x00, 0x08, 0x00, 0x2D, 0x03,
+	0x00, 0x00, 0x19, 0xFF, 0x09, 0x17, 0x08, 0xFF, 0x00, 0x0A, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x0A,
+	0x00, 0x00, 0x08, 0xFF, 0x14, 0x07, 0x00, 0x00, 0x23, 0xFF, 0x00, 0x07, 0x00, 0x2F, 0x19, 0xFF,
+	0x09, 0x16, 0x08, 0xFF, 0x00, 0x08, 0x00, 0x00, 0x0D, 0xFF, 0x00, 0x08, 0x00, 0x00, 0x08, 0xFF,
+	0x12, 0x07, 0x00, 0x00, 0x25, 0xFF, 0x00, 0x07, 0x00, 0x2F, 0x17, 0xFF, 0x09, 0x15, 0x08, 0xFF,
+	0x00, 0x07, 0x00, 0x00, 0x11, 0xFF, 0x00, 0x07, 0x00, 0x00, 0x08, 0xFF, 0x10, 0x07, 0x00, 0x00,
+	0x27, 0xFF, 0x00, 0x07, 0x00, 0x30, 0x13, 0xFF, 0x09, 0x15, 0x07, 0xFF, 0x00, 0x07, 0x00, 0x00,
+	0x13, 0xFF, 0x00, 0x0C, 0x00, 0x00, 0x02, 0xFF, 0x0F, 0x07, 0x00, 0x00, 0x29, 0xFF, 0x00, 0x07,
+	0x00, 0x30, 0x11, 0xFF, 0x08, 0x14, 0x07, 0xFF, 0x00, 0x07, 0x00, 0x00, 0x11, 0xFF, 0x00, 0x13,
+	0x00, 0x0C, 0x07, 0x00, 0x00, 0x2B, 0xFF, 0x00, 0x07, 0x00, 0x31, 0x0D, 0xFF, 0x08, 0x14, 0x07,
+	0xFF, 0x00, 0x06, 0x00, 0x00, 0x10, 0xFF, 0x00, 0x17, 0x00, 0x09, 0x07, 0x00, 0x00, 0x2D, 0xFF,
+	0x00, 0x07, 0x00, 0x33, 0x07, 0xFF, 0x07, 0x14, 0x06, 0xFF, 0x00, 0x06, 0x00, 0x00, 0x0F, 0xFF,
+	0x00, 0x1B, 0x00, 0x07, 0x06, 0x00, 0x00, 0x2F, 0xFF, 0x00, 0x06, 0x00, 0x07, 0x13, 0x07, 0xFF,
+	0x00, 0x05, 0x00, 0x00, 0x0E, 0xFF, 0x00, 0x1F, 0x00, 0x04, 0x06, 0x00, 0x00, 0x31, 0xFF, 0x00,
+	0x06, 0x00, 0x09, 0x13, 0x06, 0xFF, 0x00, 0x06, 0x00, 0x00, 0x0D, 0xFF, 0x00, 0x0C, 0x00, 0x00,
+	0x09, 0xFF, 0x00, 0x0C, 0x00, 0x02, 0x06, 0x00, 0x00, 0x33, 0xFF, 0x00, 0x06, 0x00, 0x09, 0x13,
+	0x06, 0xFF, 0x00, 0x05, 0x00, 0x00, 0x0D, 0xFF, 0x00, 0x09, 0x00, 0x00, 0x11, 0xFF, 0x00, 0x09,
+	0x00, 0x01, 0x06, 0x00, 0x00, 0x33, 0xFF, 0x00, 0x06, 0x00, 0x08, 0x12, 0x07, 0xFF, 0x00, 0x05,
+	0x00, 0x00, 0x0B, 0xFF, 0x00, 0x09, 0x00, 0x00, 0x15, 0xFF, 0x00, 0x0D, 0x00, 0x00, 0x35, 0xFF,
+	0x00, 0x06, 0x00, 0x08, 0x12, 0x06, 0xFF, 0x00, 0x06, 0x00, 0x00, 0x0A, 0xFF, 0x00, 0x08, 0x00,
+	0x00, 0x19, 0xFF, 0x00, 0x0A, 0x00, 0x00, 0x37, 0xFF, 0x00, 0x05, 0x00, 0x08, 0x12, 0x06, 0xFF,
+	0x00, 0x05, 0x00, 0x00, 0x0A, 0xFF, 0x00, 0x08, 0x00, 0x00, 0x1B, 0xFF, 0x00, 0x09, 0x00, 0x00,
+	0x37, 0xFF, 0x00, 0x05, 0x00, 0x08, 0x12, 0x06, 0xFF, 0x00, 0x05, 0x00, 0x00, 0x0A, 0xFF, 0x00,
+	0x07, 0x00, 0x00, 0x1D, 0xFF, 0x00, 0x08, 0x00, 0x00, 0x37, 0xFF, 0x00, 0x06, 0x00, 0x08, 0x12,
+	0x06, 0xFF, 0x00, 0x05, 0x00, 0x00, 0x09, 0xFF, 0x00, 0x06, 0x00, 0x00, 0x21, 0xFF, 0x00, 0x05,
+	0x00, 0x00, 0x39, 0xFF, 0x00, 0x05, 0x00, 0x09, 0x04, 0x0E, 0x00, 0x00, 0x06, 0xFF, 0x00, 0x05,
+	0x00, 0x00, 0x08, 0xFF, 0x00, 0x06, 0x00, 0x00, 0x23, 0xFF, 0x00, 0x04, 0x00, 0x00, 0x39, 0xFF,
+	0x00, 0x06, 0x00, 0x09, 0x04, 0x0E, 0x00, 0x00, 0x06, 0xFF, 0x00, 0x05, 0x00, 0x00, 0x07, 0xFF,
+	0x00, 0x07, 0x00, 0x00, 0x23, 0xFF, 0x00, 0x03, 0x00, 0x00, 0x3B, 0xFF, 0x00, 0x05, 0x00, 0x09,
+	0x04, 0x0E, 0x00, 0x00, 0x06, 0xFF, 0x00, 0x05, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x06, 0x00, 0x00,
+	0x25, 0xFF, 0x00, 0x02, 0x00, 0x00, 0x3B, 0xFF, 0x00, 0x05, 0x00, 0x09, 0x04, 0x0E, 0x00, 0x00,
+	0x06, 0xFF, 0x00, 0x05, 0x00, 0x00, 0x06, 0xFF, 0x00, 0x06, 0x00, 0x00, 0x27, 0xFF, 0x00, 0x01,
+	0x00, 0x00, 0x3B, 0xFF, 0x00, 0x05, 0x00, 0x07, 0x04, 0x0E, 0x00, 0x00, 0x06, 0xFF, 0x00, 0x06,
+	0x00, 0x00, 0x05, 0xFF, 0x00, 0x05, 0x00, 0x00, 0x64, 0xFF, 0x00, 0x05, 0x00, 0x06, 0x12, 0x07,
+	0xFF, 0x00, 0x05, 0x00, 0x00, 0x04, 0xFF, 0x00, 0x06, 0x00, 0x00, 0x65, 0xFF, 0x00, 0x05, 0x00,
+	0x06, 0x13, 0x06, 0xFF, 0x00, 0x05, 0x00, 0x00, 0x04, 0xFF, 0x00, 0x05, 0x00, 0x00, 0x66, 0xFF,
+	0x00, 0x05, 0x00, 0x06, 0x13, 0x06, 0xFF, 0x00, 0x06, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x06, 0x00,
+	0x00, 0x66, 0xFF, 0x00, 0x05, 0x00, 0x06, 0x13, 0x07, 0xFF, 0x00, 0x05, 0x00, 0x00, 0x02, 0xFF,
+	0x00, 0x05, 0x00, 0x00, 0x67, 0xFF, 0x00, 0x05, 0x00, 0x06, 0x14, 0x06, 0xFF, 0x00, 0x06, 0x00,
+	0x00, 0x01, 0xFF, 0x00, 0x05, 0x00, 0x00, 0x67, 0xFF, 0x00, 0x05, 0x00, 0x04, 0x14, 0x07, 0xFF,
+	0x00, 0x0B, 0x00, 0x00, 0x67, 0xFF, 0x00, 0x05, 0x00, 0x04, 0x14, 0x07, 0xFF, 0x00, 0x0B, 0x00,
+	0x00, 0x67, 0xFF, 0x00, 0x05, 0x00, 0x04, 0x15, 0x07, 0xFF, 0x00, 0x09, 0x00, 0x00, 0x68, 0xFF,
+	0x00, 0x05, 0x00, 0x04, 0x15, 0x08, 0xFF, 0x00, 0x08, 0x00, 0x00, 0x68, 0xFF, 0x00, 0x05, 0x00,
+	0x04, 0x16, 0x08, 0xFF, 0x00, 0x07, 0x00, 0x00, 0x68, 0xFF, 0x00, 0x05, 0x00, 0x04, 0x17, 0x08,
+	0xFF, 0x00, 0x06, 0x00, 0x00, 0x68, 0xFF, 0x00, 0x05, 0x00, 0x03, 0x10, 0x15, 0x00, 0x00, 0x67,
+	0xFF, 0x00, 0x05, 0x00, 0x03, 0x0D, 0x18, 0x00, 0x00, 0x67, 0xFF, 0x00, 0x08, 0x00, 0x03, 0x0B,
+	0x1A, 0x00, 0x00, 0x67, 0xFF, 0x00, 0x0A, 0x00, 0x03, 0x09, 0x1C, 0x00, 0x00, 0x67, 0xFF, 0x00,
+	0x0C, 0x00, 0x03, 0x08, 0x0E, 0x00, 0x00, 0x76, 0xFF, 0x00, 0x0D, 0x00, 0x03, 0x07, 0x0A, 0x00,
+	0x00, 0x7F, 0xFF, 0x00, 0x0A, 0x00, 0x03, 0x06, 0x08, 0x00, 0x00, 0x85, 0xFF, 0x00, 0x08, 0x00,
+	0x03, 0x05, 0x07, 0x00, 0x00, 0x89, 0xFF, 0x00, 0x07, 0x00, 0x03, 0x04, 0x07, 0x00, 0x00, 0x8B,
+	0xFF, 0x00, 0x07, 0x00, 0x03, 0x03, 0x07, 0x00, 0x00, 0x8D, 0xFF, 0x00, 0x07, 0x00, 0x03, 0x03,
+	0x06, 0x00, 0x00, 0x8F, 0xFF, 0x00, 0x06, 0x00, 0x03, 0x02, 0x06, 0x00, 0x00, 0x91, 0xFF, 0x00,
+	0x06, 0x00, 0x03, 0x02, 0x05, 0x00, 0x00, 0x93, 0xFF, 0x00, 0x05, 0x00, 0x03, 0x01, 0x06, 0x00,
+	0x00, 0x93, 0xFF, 0x00, 0x06, 0x00, 0x03, 0x01, 0x05, 0x00, 0x00, 0x95, 0xFF, 0x00, 0x05, 0x00,
+	0x03, 0x01, 0x05, 0x00, 0x00, 0x95, 0xFF, 0x00, 0x05, 0x00, 0x03, 0x00, 0x06, 0x00, 0x00, 0x95,
+	0xFF, 0x00, 0x06, 0x00, 0x03, 0x00, 0x05, 0x00, 0x00, 0x97, 0xFF, 0x00, 0x05, 0x00, 0x03, 0x00,
+	0x05, 0x00, 0x00, 0x97, 0xFF, 0x00, 0x05, 0x00, 0x03, 0x00, 0x05, 0x00, 0x00, 0x97, 0xFF, 0x00,
+	0x05, 0x00, 0x03, 0x00, 0x05, 0x00, 0x00, 0x97, 0xFF, 0x00, 0x05, 0x00, 0x03, 0x00, 0x05, 0x00,
+	0x00, 0x97, 0xFF, 0x00, 0x05, 0x00, 0x03, 0x00, 0x05, 0x00, 0x00, 0x97, 0xFF, 0x00, 0x05, 0x00,
+	0x03, 0x00, 0x05, 0x00, 0x00, 0x97, 0xFF, 0x00, 0x05, 0x00, 0x03, 0x00, 0x06, 0x00, 0x00, 0x95,
+	0xFF, 0x00, 0x06, 0x00, 0x03, 0x01, 0x05, 0x00, 0x00, 0x95, 0xFF, 0x00, 0x05, 0x00, 0x03, 0x01,
+	0x05, 0x00, 0x00, 0x95, 0xFF, 0x00, 0x05, 0x00, 0x03, 0x01, 0x06, 0x00, 0x00, 0x93, 0xFF, 0x00,
+	0x06, 0x00, 0x03, 0x02, 0x05, 0x00, 0x00, 0x93, 0xFF, 0x00, 0x05, 0x00, 0x03, 0x02, 0x06, 0x00,
+	0x00, 0x91, 0xFF, 0x00, 0x06, 0x00, 0x03, 0x03, 0x06, 0x00, 0x00, 0x8F, 0xFF, 0x00, 0x06, 0x00,
+	0x03, 0x03, 0x07, 0x00, 0x00, 0x8D, 0xFF, 0x00, 0x07, 0x00, 0x03, 0x04, 0x07, 0x00, 0x00, 0x8B,
+	0xFF, 0x00, 0x07, 0x00, 0x03, 0x05, 0x07, 0x00, 0x00, 0x89, 0xFF, 0x00, 0x07, 0x00, 0x03, 0x06,
+	0x08, 0x00, 0x00, 0x85, 0xFF, 0x00, 0x08, 0x00, 0x03, 0x07, 0x0A, 0x00, 0x00, 0x7F, 0xFF, 0x00,
+	0x0A, 0x00, 0x01, 0x08, 0x91, 0x00, 0x01, 0x09, 0x8F, 0x00, 0x01, 0x0B, 0x8B, 0x00, 0x01, 0x0D,
+	0x87, 0x00, 0x01, 0x10, 0x81, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x14, 0x0A, 0xFF, 0x00, 0x01,
+	0x22, 0x00, 0x04, 0x00, 0x00, 0x01, 0xAA, 0x00, 0x0A, 0xFF, 0x00, 0x01, 0x22, 0x00, 0x04, 0x00,
+	0x00, 0x01, 0xAA, 0x00, 0x0A, 0xFF, 0x00, 0x01, 0x22, 0x00, 0x04, 0x00, 0x00, 0x01, 0xAA, 0x00,
+	0x0A, 0xFF, 0x00, 0x01, 0x22, 0x00, 0x04, 0x00, 0x00, 0x01, 0xAA, 0x00, 0x0A, 0xFF, 0x00, 0x01,
+	0x22, 0x00, 0x04, 0x00, 0x00, 0x01, 0xAA, 0x00, 0x0A, 0xFF, 0x00, 0x01, 0x22, 0x00, 0x04, 0x00,
+	0x00, 0x01, 0xAA, 0x00, 0x0A, 0xFF, 0x00, 0x01, 0x22, 0x00, 0x04, 0x00, 0x00, 0x01, 0xAA, 0x1D,
+	0x14, 0x09, 0xFF, 0x00, 0x01, 0xDD, 0x00, 0x04, 0x00, 0x00, 0x01, 0x11, 0x00, 0x0A, 0xFF, 0x00,
+	0x01, 0xDD, 0x00, 0x04, 0x00, 0x00, 0x01, 0x11, 0x00, 0x0A, 0xFF, 0x00, 0x01, 0xDD, 0x00, 0x04,
+	0x00, 0x00, 0x01, 0x11, 0x00, 0x0A, 0xFF, 0x00, 0x01, 0xDD, 0x00, 0x04, 0x00, 0x00, 0x01, 0x11,
+	0x00, 0x0A, 0xFF, 0x00, 0x01, 0xDD, 0x00, 0x04, 0x00, 0x00, 0x01, 0x11, 0x00, 0x0A, 0xFF, 0x00,
+	0x01, 0xDD, 0x00, 0x04, 0x00, 0x00, 0x01, 0x11, 0x00, 0x0A, 0xFF, 0x00, 0x01, 0xDD, 0x00, 0x04,
+	0x00, 0x00, 0x01, 0x11, 0x00, 0x01, 0xFF, 0x1D, 0x14, 0x09, 0xFF, 0x00, 0x01, 0x66, 0x00, 0x04,
+	0x00, 0x00, 0x01, 0x66, 0x00, 0x0A, 0xFF, 0x00, 0x01, 0x66, 0x00, 0x04, 0x00, 0x00, 0x01, 0x66,
+	0x00, 0x0A, 0xFF, 0x00, 0x01, 0x66, 0x00, 0x04, 0x00, 0x00, 0x01, 0x66, 0x00, 0x0A, 0xFF, 0x00,
+	0x01, 0x66, 0x00, 0x04, 0x00, 0x00, 0x01, 0x66, 0x00, 0x0A, 0xFF, 0x00, 0x01, 0x66, 0x00, 0x04,
+	0x00, 0x00, 0x01, 0x66, 0x00, 0x0A, 0xFF, 0x00, 0x01, 0x66, 0x00, 0x04, 0x00, 0x00, 0x01, 0x66,
+	0x00, 0x0A, 0xFF, 0x00, 0x01, 0x66, 0x00, 0x04, 0x00, 0x00, 0x01, 0x66, 0x00, 0x01, 0xFF, 0x1D,
+	0x14, 0x09, 0xFF, 0x00, 0x01, 0x11, 0x00, 0x04, 0x00, 0x00, 0x01, 0xCC, 0x00, 0x0A, 0xFF, 0x00,
+	0x01, 0x11, 0x00, 0x04, 0x00, 0x00, 0x01, 0xCC, 0x00, 0x0A, 0xFF, 0x00, 0x01, 0x11, 0x00, 0x04,
+	0x00, 0x00, 0x01, 0xCC, 0x00, 0x0A, 0xFF, 0x00, 0x01, 0x11, 0x00, 0x04, 0x00, 0x00, 0x01, 0xCC,
+	0x00, 0x0A, 0xFF, 0x00, 0x01, 0x11, 0x00, 0x04, 0x00, 0x00, 0x01, 0xCC, 0x00, 0x0A, 0xFF, 0x00,
+	0x01, 0x11, 0x00, 0x04, 0x00, 0x00, 0x01, 0xCC, 0x00, 0x0A, 0xFF, 0x00, 0x01, 0x11, 0x00, 0x04,
+	0x00, 0x00, 0x01, 0xCC, 0x00, 0x01, 0xFF, 0x1D, 0x14, 0x08, 0xFF, 0x00, 0x01, 0xAA, 0x00, 0x04,
+	0x00, 0x00, 0x01, 0x22, 0x00, 0x0A, 0xFF, 0x00, 0x01, 0xAA, 0x00, 0x04, 0x00, 0x00, 0x01, 0x22,
+	0x00, 0x0A, 0xFF, 0x00, 0x01, 0xAA, 0x00, 0x04, 0x00, 0x00, 0x01, 0x22, 0x00, 0x0A, 0xFF, 0x00,
+	0x01, 0xAA, 0x00, 0x04, 0x00, 0x00, 0x01, 0x22, 0x00, 0x0A, 0xFF, 0x00, 0x01, 0xAA, 0x00, 0x04,
+	0x00, 0x00, 0x01, 0x22, 0x00, 0x0A, 0xFF, 0x00, 0x01, 0xAA, 0x00, 0x04, 0x00, 0x00, 0x01, 0x22,
+	0x00, 0x0A, 0xFF, 0x00, 0x01, 0xAA, 0x00, 0x04, 0x00, 0x00, 0x01, 0x22, 0x00, 0x02, 0xFF, 0x1D,
+	0x14, 0x08, 0xFF, 0x00, 0x01, 0x44, 0x00, 0x04, 0x00, 0x00, 0x01, 0x88, 0x00, 0x0A, 0xFF, 0x00,
+	0x01, 0x44, 0x00, 0x04, 0x00, 0x00, 0x01, 0x88, 0x00, 0x0A, 0xFF, 0x00, 0x01, 0x44, 0x00, 0x04,
+	0x00, 0x00, 0x01, 0x88, 0x00, 0x0A, 0xFF, 0x00, 0x01, 0x44, 0x00, 0x04, 0x00, 0x00, 0x01, 0x88,
+	0x00, 0x0A, 0xFF, 0x00, 0x01, 0x44, 0x00, 0x04, 0x00, 0x00, 0x01, 0x88, 0x00, 0x0A, 0xFF, 0x00,
+	0x01, 0x44, 0x00, 0x04, 0x00, 0x00, 0x01, 0x88, 0x00, 0x0A, 0xFF, 0x00, 0x01, 0x44, 0x00, 0x04,
+	0x00, 0x00, 0x01, 0x88, 0x00, 0x02, 0xFF, 0x1D, 0x14, 0x07, 0xFF, 0x00, 0x01, 0xEE, 0x00, 0x05,
+	0x00, 0x00, 0x01, 0xEE, 0x00, 0x09, 0xFF, 0x00, 0x01, 0xEE, 0x00, 0x05, 0x00, 0x00, 0x01, 0xEE,
+	0x00, 0x09, 0xFF, 0x00, 0x01, 0xEE, 0x00, 0x05, 0x00, 0x00, 0x01, 0xEE, 0x00, 0x09, 0xFF, 0x00,
+	0x01, 0xEE, 0x00, 0x05, 0x00, 0x00, 0x01, 0xEE, 0x00, 0x09, 0xFF, 0x00, 0x01, 0xEE, 0x00, 0x05,
+	0x00, 0x00, 0x01, 0xEE, 0x00, 0x09, 0xFF, 0x00, 0x01, 0xEE, 0x00, 0x05, 0x00, 0x00, 0x01, 0xEE,
+	0x00, 0x09, 0xFF, 0x00, 0x01, 0xEE, 0x00, 0x05, 0x00, 0x00, 0x01, 0xEE, 0x00, 0x02, 0xFF, 0x1D,
+	0x14, 0x07, 0xFF, 0x00, 0x01, 0x99, 0x00, 0x04, 0x00, 0x00, 0x01, 0x44, 0x00, 0x0A, 0xFF, 0x00,
+	0x01, 0x99, 0x00, 0x04, 0x00, 0x00, 0x01, 0x44, 0x00, 0x0A, 0xFF, 0x00, 0x01, 0x99, 0x00, 0x04,
+	0x00, 0x00, 0x01, 0x44, 0x00, 0x0A, 0xFF, 0x00, 0x01, 0x99, 0x00, 0x04, 0x00, 0x00, 0x01, 0x44,
+	0x00, 0x0A, 0xFF, 0x00, 0x01, 0x99, 0x00, 0x04, 0x00, 0x00, 0x01, 0x44, 0x00, 0x0A, 0xFF, 0x00,
+	0x01, 0x99, 0x00, 0x04, 0x00, 0x00, 0x01, 0x44, 0x00, 0x0A, 0xFF, 0x00, 0x01, 0x99, 0x00, 0x04,
+	0x00, 0x00, 0x01, 0x44, 0x00, 0x03, 0xFF, 0x1D, 0x14, 0x07, 0xFF, 0x00, 0x01, 0x33, 0x00, 0x04,
+	0x00, 0x00, 0x01, 0xAA, 0x00, 0x0A, 0xFF, 0x00, 0x01, 0x33, 0x00, 0x04, 0x00, 0x00, 0x01, 0xAA,
+	0x00, 0x0A, 0xFF, 0x00, 0x01, 0x33, 0x00, 0x04, 0x00, 0x00, 0x01, 0xAA, 0x00, 0x0A, 0xFF, 0x00,
+	0x01, 0x33, 0x00, 0x04, 0x00, 0x00, 0x01, 0xAA, 0x00, 0x0A, 0xFF, 0x00, 0x01, 0x33, 0x00, 0x04,
+	0x00, 0x00, 0x01, 0xAA, 0x00, 0x0A, 0xFF, 0x00, 0x01, 0x33, 0x00, 0x04, 0x00, 0x00, 0x01, 0xAA,
+	0x00, 0x0A, 0xFF, 0x00, 0x01, 0x33, 0x00, 0x04, 0x00, 0x00, 0x01, 0xAA, 0x00, 0x03, 0xFF, 0x1D,
+	0x14, 0x06, 0xFF, 0x00, 0x01, 0xDD, 0x00, 0x04, 0x00, 0x00, 0x01, 0x11, 0x00, 0x0A, 0xFF, 0x00,
+	0x01, 0xDD, 0x00, 0x04, 0x00, 0x00, 0x01, 0x11, 0x00, 0x0A, 0xFF, 0x00, 0x01, 0xDD, 0x00, 0x04,
+	0x00, 0x00, 0x01, 0x11, 0x00, 0x0A, 0xFF, 0x00, 0x01, 0xDD, 0x00, 0x04, 0x00, 0x00, 0x01, 0x11,
+	0x00, 0x0A, 0xFF, 0x00, 0x01, 0xDD, 0x00, 0x04, 0x00, 0x00, 0x01, 0x11, 0x00, 0x0A, 0xFF, 0x00,
+	0x01, 0xDD, 0x00, 0x04, 0x00, 0x00, 0x01, 0x11, 0x00, 0x0A, 0xFF, 0x00, 0x01, 0xDD, 0x00, 0x04,
+	0x00, 0x00, 0x01, 0x11, 0x00, 0x04, 0xFF, 0x1D, 0x14, 0x06, 0xFF, 0x00, 0x01, 0x77, 0x00, 0x04,
+	0x00, 0x00, 0x01, 0x66, 0x00, 0x0A, 0xFF, 0x00, 0x01, 0x77, 0x00, 0x04, 0x00, 0x00, 0x01, 0x66,
+	0x00, 0x0A, 0xFF, 0x00, 0x01, 0x77, 0x00, 0x04, 0x00, 0x00, 0x01, 0x66, 0x00, 0x0A, 0xFF, 0x00,
+	0x01, 0x77, 0x00, 0x04, 0x00, 0x00, 0x01, 0x66, 0x00, 0x0A, 0xFF, 0x00, 0x01, 0x77, 0x00, 0x04,
+	0x00, 0x00, 0x01, 0x66, 0x00, 0x0A, 0xFF, 0x00, 0x01, 0x77, 0x00, 0x04, 0x00, 0x00, 0x01, 0x66,
+	0x00, 0x0A, 0xFF, 0x00, 0x01, 0x77, 0x00, 0x04, 0x00, 0x00, 0x01, 0x66, 0x00, 0x04, 0xFF, 0x1D,
+	0x14, 0x06, 0xFF, 0x00, 0x01, 0x11, 0x00, 0x04, 0x00, 0x00, 0x01, 0xCC, 0x00, 0x0A, 0xFF, 0x00,
+	0x01, 0x11, 0x00, 0x04, 0x00, 0x00, 0x01, 0xCC, 0x00, 0x0A, 0xFF, 0x00, 0x01, 0x11, 0x00, 0x04,
+	0x00, 0x00, 0x01, 0xCC, 0x00, 0x0A, 0xFF, 0x00, 0x01, 0x11, 0x00, 0x04, 0x00, 0x00, 0x01, 0xCC,
+	0x00, 0x0A, 0xFF, 0x00, 0x01, 0x11, 0x00, 0x04, 0x00, 0x00, 0x01, 0xCC, 0x00, 0x0A, 0xFF, 0x00,
+	0x01, 0x11, 0x00, 0x04, 0x00, 0x00, 0x01, 0xCC, 0x00, 0x0A, 0xFF, 0x00, 0x01, 0x11, 0x00, 0x04,
+	0x00, 0x00, 0x01, 0xCC, 0x00, 0x04, 0xFF, 0x1D, 0x14, 0x05, 0xFF, 0x00, 0x01, 0xBB, 0x00, 0x04,
+	0x00, 0x00, 0x01, 0x22, 0x00, 0x0A, 0xFF, 0x00, 0x01, 0xBB, 0x00, 0x04, 0x00, 0x00, 0x01, 0x22,
+	0x00, 0x0A, 0xFF, 0x00, 0x01, 0xBB, 0x00, 0x04, 0x00, 0x00, 0x01, 0x22, 0x00, 0x0A, 0xFF, 0x00,
+	0x01, 0xBB, 0x00, 0x04, 0x00, 0x00, 0x01, 0x22, 0x00, 0x0A, 0xFF, 0x00, 0x01, 0xBB, 0x00, 0x04,
+	0x00, 0x00, 0x01, 0x22, 0x00, 0x0A, 0xFF, 0x00, 0x01, 0xBB, 0x00, 0x04, 0x00, 0x00, 0x01, 0x22,
+	0x00, 0x0A, 0xFF, 0x00, 0x01, 0xBB, 0x00, 0x04, 0x00, 0x00, 0x01, 0x22, 0x00, 0x05, 0xFF, 0x1D,
+	0x14, 0x05, 0xFF, 0x00, 0x01, 0x55, 0x00, 0x04, 0x00, 0x00, 0x01, 0x88, 0x00, 0x0A, 0xFF, 0x00,
+	0x01, 0x55, 0x00, 0x04, 0x00, 0x00, 0x01, 0x88, 0x00, 0x0A, 0xFF, 0x00, 0x01, 0x55, 0x00, 0x04,
+	0x00, 0x00, 0x01, 0x88, 0x00, 0x0A, 0xFF, 0x00, 0x01, 0x55, 0x00, 0x04, 0x00, 0x00, 0x01, 0x88,
+	0x00, 0x0A, 0xFF, 0x00, 0x01, 0x55, 0x00, 0x04, 0x00, 0x00, 0x01, 0x88, 0x00, 0x0A, 0xFF, 0x00,
+	0x01, 0x55, 0x00, 0x04, 0x00, 0x00, 0x01, 0x88, 0x00, 0x0A, 0xFF, 0x00, 0x01, 0x55, 0x00, 0x04,
+	0x00, 0x00, 0x01, 0x88, 0x00, 0x05, 0xFF, 0x1D, 0x14, 0x04, 0xFF, 0x00, 0x01, 0xEE, 0x00, 0x05,
+	0x00, 0x00, 0x01, 0xEE, 0x00, 0x09, 0xFF, 0x00, 0x01, 0xEE, 0x00, 0x05, 0x00, 0x00, 0x01, 0xEE,
+	0x00, 0x09, 0xFF, 0x00, 0x01, 0xEE, 0x00, 0x05, 0x00, 0x00, 0x01, 0xEE, 0x00, 0x09, 0xFF, 0x00,
+	0x01, 0xEE, 0x00, 0x05, 0x00, 0x00, 0x01, 0xEE, 0x00, 0x09, 0xFF, 0x00, 0x01, 0xEE, 0x00, 0x05,
+	0x00, 0x00, 0x01, 0xEE, 0x00, 0x09, 0xFF, 0x00, 0x01, 0xEE, 0x00, 0x05, 0x00, 0x00, 0x01, 0xEE,
+	0x00, 0x09, 0xFF, 0x00, 0x01, 0xEE, 0x00, 0x05, 0x00, 0x00, 0x01, 0xEE, 0x00, 0x05, 0xFF, 0x1D,
+	0x14, 0x04, 0xFF, 0x00, 0x01, 0x99, 0x00, 0x04, 0x00, 0x00, 0x01, 0x44, 0x00, 0x0A, 0xFF, 0x00,
+	0x01, 0x99, 0x00, 0x04, 0x00, 0x00, 0x01, 0x44, 0x00, 0x0A, 0xFF, 0x00, 0x01, 0x99, 0x00, 0x04,
+	0x00, 0x00, 0x01, 0x44, 0x00, 0x0A, 0xFF, 0x00, 0x01, 0x99, 0x00, 0x04, 0x00, 0x00, 0x01, 0x44,
+	0x00, 0x0A, 0xFF, 0x00, 0x01, 0x99, 0x00, 0x04, 0x00, 0x00, 0x01, 0x44, 0x00, 0x0A, 0xFF, 0x00,
+	0x01, 0x99, 0x00, 0x04, 0x00, 0x00, 0x01, 0x44, 0x00, 0x0A, 0xFF, 0x00, 0x01, 0x99, 0x00, 0x04,
+	0x00, 0x00, 0x01, 0x44, 0x00, 0x06, 0xFF, 0x1D, 0x14, 0x04, 0xFF, 0x00, 0x01, 0x33, 0x00, 0x04,
+	0x00, 0x00, 0x01, 0xAA, 0x00, 0x0A, 0xFF, 0x00, 0x01, 0x33, 0x00, 0x04, 0x00, 0x00, 0x01, 0xAA,
+	0x00, 0x0A, 0xFF, 0x00, 0x01, 0x33, 0x00, 0x04, 0x00, 0x00, 0x01, 0xAA, 0x00, 0x0A, 0xFF, 0x00,
+	0x01, 0x33, 0x00, 0x04, 0x00, 0x00, 0x01, 0xAA, 0x00, 0x0A, 0xFF, 0x00, 0x01, 0x33, 0x00, 0x04,
+	0x00, 0x00, 0x01, 0xAA, 0x00, 0x0A, 0xFF, 0x00, 0x01, 0x33, 0x00, 0x04, 0x00, 0x00, 0x01, 0xAA,
+	0x00, 0x0A, 0xFF, 0x00, 0x01, 0x33, 0x00, 0x04, 0x00, 0x00, 0x01, 0xAA, 0x00, 0x06, 0xFF, 0x1D,
+	0x14, 0x03, 0xFF, 0x00, 0x01, 0xDD, 0x00, 0x04, 0x00, 0x00, 0x01, 0x11, 0x00, 0x0A, 0xFF, 0x00,
+	0x01, 0xDD, 0x00, 0x04, 0x00, 0x00, 0x01, 0x11, 0x00, 0x0A, 0xFF, 0x00, 0x01, 0xDD, 0x00, 0x04,
+	0x00, 0x00, 0x01, 0x11, 0x00, 0x0A, 0xFF, 0x00, 0x01, 0xDD, 0x00, 0x04, 0x00, 0x00, 0x01, 0x11,
+	0x00, 0x0A, 0xFF, 0x00, 0x01, 0xDD, 0x00, 0x04, 0x00, 0x00, 0x01, 0x11, 0x00, 0x0A, 0xFF, 0x00,
+	0x01, 0xDD, 0x00, 0x04, 0x00, 0x00, 0x01, 0x11, 0x00, 0x0A, 0xFF, 0x00, 0x01, 0xDD, 0x00, 0x04,
+	0x00, 0x00, 0x01, 0x11, 0x00, 0x07, 0xFF, 0x1D, 0x14, 0x03, 0xFF, 0x00, 0x01, 0x77, 0x00, 0x04,
+	0x00, 0x00, 0x01, 0x66, 0x00, 0x0A, 0xFF, 0x00, 0x01, 0x77, 0x00, 0x04, 0x00, 0x00, 0x01, 0x66,
+	0x00, 0x0A, 0xFF, 0x00, 0x01, 0x77, 0x00, 0x04, 0x00, 0x00, 0x01, 0x66, 0x00, 0x0A, 0xFF, 0x00,
+	0x01, 0x77, 0x00, 0x04, 0x00, 0x00, 0x01, 0x66, 0x00, 0x0A, 0xFF, 0x00, 0x01, 0x77, 0x00, 0x04,
+	0x00, 0x00, 0x01, 0x66, 0x00, 0x0A, 0xFF, 0x00, 0x01, 0x77, 0x00, 0x04, 0x00, 0x00, 0x01, 0x66,
+	0x00, 0x0A, 0xFF, 0x00, 0x01, 0x77, 0x00, 0x04, 0x00, 0x00, 0x01, 0x66, 0x00, 0x07, 0xFF, 0x1D,
+	0x14, 0x03, 0xFF, 0x00, 0x01, 0x11, 0x00, 0x04, 0x00, 0x00, 0x01, 0xCC, 0x00, 0x0A, 0xFF, 0x00,
+	0x01, 0x11, 0x00, 0x04, 0x00, 0x00, 0x01, 0xCC, 0x00, 0x0A, 0xFF, 0x00, 0x01, 0x11, 0x00, 0x04,
+	0x00, 0x00, 0x01, 0xCC, 0x00, 0x0A, 0xFF, 0x00, 0x01, 0x11, 0x00, 0x04, 0x00, 0x00, 0x01, 0xCC,
+	0x00, 0x0A, 0xFF, 0x00, 0x01, 0x11, 0x00, 0x04, 0x00, 0x00, 0x01, 0xCC, 0x00, 0x0A, 0xFF, 0x00,
+	0x01, 0x11, 0x00, 0x04, 0x00, 0x00, 0x01, 0xCC, 0x00, 0x0A, 0xFF, 0x00, 0x01, 0x11, 0x00, 0x04,
+	0x00, 0x00, 0x01, 0xCC, 0x00, 0x07, 0xFF, 0x1D, 0x14, 0x02, 0xFF, 0x00, 0x01, 0xBB, 0x00, 0x04,
+	0x00, 0x00, 0x01, 0x22, 0x00, 0x0A, 0xFF, 0x00, 0x01, 0xBB, 0x00, 0x04, 0x00, 0x00, 0x01, 0x22,
+	0x00, 0x0A, 0xFF, 0x00, 0x01, 0xBB, 0x00, 0x04, 0x00, 0x00, 0x01, 0x22, 0x00, 0x0A, 0xFF, 0x00,
+	0x01, 0xBB, 0x00, 0x04, 0x00, 0x00, 0x01, 0x22, 0x00, 0x0A, 0xFF, 0x00, 0x01, 0xBB, 0x00, 0x04,
+	0x00, 0x00, 0x01, 0x22, 0x00, 0x0A, 0xFF, 0x00, 0x01, 0xBB, 0x00, 0x04, 0x00, 0x00, 0x01, 0x22,
+	0x00, 0x0A, 0xFF, 0x00, 0x01, 0xBB, 0x00, 0x04, 0x00, 0x00, 0x01, 0x22, 0x00, 0x08, 0xFF, 0x1D,
+	0x14, 0x02, 0xFF, 0x00, 0x01, 0x55, 0x00, 0x04, 0x00, 0x00, 0x01, 0x88, 0x00, 0x0A, 0xFF, 0x00,
+	0x01, 0x55, 0x00, 0x04, 0x00, 0x00, 0x01, 0x88, 0x00, 0x0A, 0xFF, 0x00, 0x01, 0x55, 0x00, 0x04,
+	0x00, 0x00, 0x01, 0x88, 0x00, 0x0A, 0xFF, 0x00, 0x01, 0x55, 0x00, 0x04, 0x00, 0x00, 0x01, 0x88,
+	0x00, 0x0A, 0xFF, 0x00, 0x01, 0x55, 0x00, 0x04, 0x00, 0x00, 0x01, 0x88, 0x00, 0x0A, 0xFF, 0x00,
+	0x01, 0x55, 0x00, 0x04, 0x00, 0x00, 0x01, 0x88, 0x00, 0x0A, 0xFF, 0x00, 0x01, 0x55, 0x00, 0x04,
+	0x00, 0x00, 0x01, 0x88, 0x00, 0x08, 0xFF, 0x1D, 0x14, 0x01, 0xFF, 0x00, 0x01, 0xEE, 0x00, 0x05,
+	0x00, 0x00, 0x01, 0xEE, 0x00, 0x09, 0xFF, 0x00, 0x01, 0xEE, 0x00, 0x05, 0x00, 0x00, 0x01, 0xEE,
+	0x00, 0x09, 0xFF, 0x00, 0x01, 0xEE, 0x00, 0x05, 0x00, 0x00, 0x01, 0xEE, 0x00, 0x09, 0xFF, 0x00,
+	0x01, 0xEE, 0x00, 0x05, 0x00, 0x00, 0x01, 0xEE, 0x00, 0x09, 0xFF, 0x00, 0x01, 0xEE, 0x00, 0x05,
+	0x00, 0x00, 0x01, 0xEE, 0x00, 0x09, 0xFF, 0x00, 0x01, 0xEE, 0x00, 0x05, 0x00, 0x00, 0x01, 0xEE,
+	0x00, 0x09, 0xFF, 0x00, 0x01, 0xEE, 0x00, 0x05, 0x00, 0x00, 0x01, 0xEE, 0x00, 0x08, 0xFF, 0x1D,
+	0x14, 0x01, 0xFF, 0x00, 0x01, 0x99, 0x00, 0x04, 0x00, 0x00, 0x01, 0x44, 0x00, 0x0A, 0xFF, 0x00,
+	0x01, 0x99, 0x00, 0x04, 0x00, 0x00, 0x01, 0x44, 0x00, 0x0A, 0xFF, 0x00, 0x01, 0x99, 0x00, 0x04,
+	0x00, 0x00, 0x01, 0x44, 0x00, 0x0A, 0xFF, 0x00, 0x01, 0x99, 0x00, 0x04, 0x00, 0x00, 0x01, 0x44,
+	0x00, 0x0A, 0xFF, 0x00, 0x01, 0x99, 0x00, 0x04, 0x00, 0x00, 0x01, 0x44, 0x00, 0x0A, 0xFF, 0x00,
+	0x01, 0x99, 0x00, 0x04, 0x00, 0x00, 0x01, 0x44, 0x00, 0x0A, 0xFF, 0x00, 0x01, 0x99, 0x00, 0x04,
+	0x00, 0x00, 0x01, 0x44, 0x00, 0x09, 0xFF, 0x1D, 0x14, 0x01, 0xFF, 0x00, 0x01, 0x33, 0x00, 0x04,
+	0x00, 0x00, 0x01, 0xAA, 0x00, 0x0A, 0xFF, 0x00, 0x01, 0x33, 0x00, 0x04, 0x00, 0x00, 0x01, 0xAA,
+	0x00, 0x0A, 0xFF, 0x00, 0x01, 0x33, 0x00, 0x04, 0x00, 0x00, 0x01, 0xAA, 0x00, 0x0A, 0xFF, 0x00,
+	0x01, 0x33, 0x00, 0x04, 0x00, 0x00, 0x01, 0xAA, 0x00, 0x0A, 0xFF, 0x00, 0x01, 0x33, 0x00, 0x04,
+	0x00, 0x00, 0x01, 0xAA, 0x00, 0x0A, 0xFF, 0x00, 0x01, 0x33, 0x00, 0x04, 0x00, 0x00, 0x01, 0xAA,
+	0x00, 0x0A, 0xFF, 0x00, 0x01, 0x33, 0x00, 0x04, 0x00, 0x00, 0x01, 0xAA, 0x00, 0x09, 0xFF, 0x1C,
+	0x14, 0x01, 0xDD, 0x00, 0x04, 0x00, 0x00, 0x01, 0x11, 0x00, 0x0A, 0xFF, 0x00, 0x01, 0xDD, 0x00,
+	0x04, 0x00, 0x00, 0x01, 0x11, 0x00, 0x0A, 0xFF, 0x00, 0x01, 0xDD, 0x00, 0x04, 0x00, 0x00, 0x01,
+	0x11, 0x00, 0x0A, 0xFF, 0x00, 0x01, 0xDD, 0x00, 0x04, 0x00, 0x00, 0x01, 0x11, 0x00, 0x0A, 0xFF,
+	0x00, 0x01, 0xDD, 0x00, 0x04, 0x00, 0x00, 0x01, 0x11, 0x00, 0x0A, 0xFF, 0x00, 0x01, 0xDD, 0x00,
+	0x04, 0x00, 0x00, 0x01, 0x11, 0x00, 0x0A, 0xFF, 0x00, 0x01, 0xDD, 0x00, 0x04, 0x00, 0x00, 0x01,
+	0x11, 0x00, 0x0A, 0xFF, 0x1C, 0x14, 0x01, 0x77, 0x00, 0x04, 0x00, 0x00, 0x01, 0x66, 0x00, 0x0A,
+	0xFF, 0x00, 0x01, 0x77, 0x00, 0x04, 0x00, 0x00, 0x01, 0x66, 0x00, 0x0A, 0xFF, 0x00, 0x01, 0x77,
+	0x00, 0x04, 0x00, 0x00, 0x01, 0x66, 0x00, 0x0A, 0xFF, 0x00, 0x01, 0x77, 0x00, 0x04, 0x00, 0x00,
+	0x01, 0x66, 0x00, 0x0A, 0xFF, 0x00, 0x01, 0x77, 0x00, 0x04, 0x00, 0x00, 0x01, 0x66, 0x00, 0x0A,
+	0xFF, 0x00, 0x01, 0x77, 0x00, 0x04, 0x00, 0x00, 0x01, 0x66, 0x00, 0x0A, 0xFF, 0x00, 0x01, 0x77,
+	0x00, 0x04, 0x00, 0x00, 0x01, 0x66, 0x00, 0x0A, 0xFF,
+};
+constexpr uint8_t IconSprite_09n_S_runs[] = {
+	0x01, 0x54, 0x07, 0xFF, 0x01, 0x51, 0x0D, 0xFF, 0x01, 0x4F, 0x11, 0xFF, 0x01, 0x4E, 0x13, 0xFF,
+	0x01, 0x4C, 0x17, 0xFF, 0x01, 0x4B, 0x19, 0xFF, 0x02, 0x48, 0x03, 0x00, 0x00, 0x19, 0xFF, 0x02,
+	0x46, 0x04, 0x00, 0x00, 0x1B, 0xFF, 0x02, 0x45, 0x04, 0x00, 0x00, 0x1D, 0xFF, 0x02, 0x44, 0x05,
+	0x00, 0x00, 0x1D, 0xFF, 0x02, 0x43, 0x05, 0x00, 0x00, 0x1F, 0xFF, 0x02, 0x42, 0x06, 0x00, 0x00,
+	0x1F, 0xFF, 0x02, 0x42, 0x06, 0x00, 0x00, 0x1F, 0xFF, 0x02, 0x41, 0x06, 0x00, 0x00, 0x21, 0xFF,
+	0x02, 0x41, 0x06, 0x00, 0x00, 0x21, 0xFF, 0x02, 0x41, 0x06, 0x00, 0x00, 0x21, 0xFF, 0x02, 0x41,
+	0x06, 0x00, 0x00, 0x21, 0xFF, 0x02, 0x41, 0x06, 0x00, 0x00, 0x21, 0xFF, 0x03, 0x14, 0x05, 0x00,
+	0x28, 0x06, 0x00, 0x00, 0x21, 0xFF, 0x03, 0x14, 0x05, 0x00, 0x28, 0x06, 0x00, 0x00, 0x21, 0xFF,
+	0x03, 0x14, 0x05, 0x00, 0x29, 0x06, 0x00, 0x00, 0x1F, 0xFF, 0x03, 0x14, 0x05, 0x00, 0x29, 0x06,
+	0x00, 0x00, 0x1F, 0xFF, 0x05, 0x08, 0x01, 0x00, 0x0B, 0x05, 0x00, 0x07, 0x01, 0x00, 0x22, 0x05,
+	0x00, 0x00, 0x1F, 0xFF, 0x05, 0x07, 0x03, 0x00, 0x0A, 0x05, 0x00, 0x06, 0x03, 0x00, 0x22, 0x05,
+	0x00, 0x00, 0x1D, 0xFF, 0x05, 0x06, 0x05, 0x00, 0x09, 0x05, 0x00, 0x05, 0x05, 0x00, 0x22, 0x04,
+	0x00, 0x00, 0x1D, 0xFF, 0x06, 0x05, 0x07, 0x00, 0x05, 0x07, 0xFF, 0x00, 0x01, 0x00, 0x04, 0x07,
+	0x00, 0x22, 0x04, 0x00, 0x00, 0x1B, 0xFF, 0x05, 0x04, 0x09, 0x00, 0x01, 0x0D, 0xFF, 0x01, 0x09,
+	0x00, 0x23, 0x03, 0x00, 0x00, 0x19, 0xFF, 0x04, 0x05, 0x08, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x08,
+	0x00, 0x27, 0x19, 0xFF, 0x06, 0x06, 0x06, 0x00, 0x00, 0x05, 0xFF, 0x00, 0x07, 0x00, 0x00, 0x05,
+	0xFF, 0x00, 0x06, 0x00, 0x29, 0x17, 0xFF, 0x06, 0x07, 0x04, 0x00, 0x00, 0x04, 0xFF, 0x00, 0x0B,
+	0x00, 0x00, 0x04, 0xFF, 0x00, 0x04, 0x00, 0x2C, 0x13, 0xFF, 0x06, 0x08, 0x02, 0x00, 0x00, 0x04,
+	0xFF, 0x00, 0x0D, 0x00, 0x00, 0x04, 0xFF, 0x00, 0x02, 0x00, 0x2E, 0x11, 0xFF, 0x04, 0x09, 0x04,
+	0xFF, 0x00, 0x0F, 0x00, 0x00, 0x04, 0xFF, 0x31, 0x0D, 0xFF, 0x04, 0x08, 0x04, 0xFF, 0x00, 0x11,
+	0x00, 0x00, 0x04, 0xFF, 0x33, 0x07, 0xFF, 0x05, 0x08, 0x03, 0xFF, 0x00, 0x07, 0x00, 0x00, 0x05,
+	0xFF, 0x00, 0x07, 0x00, 0x00, 0x03, 0xFF, 0x05, 0x08, 0x03, 0xFF, 0x00, 0x06, 0x00, 0x00, 0x07,
+	0xFF, 0x00, 0x06, 0x00, 0x00, 0x03, 0xFF, 0x05, 0x07, 0x03, 0xFF, 0x00, 0x06, 0x00, 0x00, 0x09,
+	0xFF, 0x00, 0x06, 0x00, 0x00, 0x03, 0xFF, 0x05, 0x07, 0x03, 0xFF, 0x00, 0x05, 0x00, 0x00, 0x0B,
+	0xFF, 0x00, 0x05, 0x00, 0x00, 0x03, 0xFF, 0x05, 0x07, 0x03, 0xFF, 0x00, 0x05, 0x00, 0x00, 0x0B,
+	0xFF, 0x00, 0x05, 0x00, 0x00, 0x03, 0xFF, 0x08, 0x00, 0x07, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x05,
+	0x00, 0x00, 0x0B, 0xFF, 0x00, 0x05, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x06, 0x00, 0x04, 0x07, 0x00,
+	0x08, 0x00, 0x07, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x05, 0x00, 0x00, 0x0B, 0xFF, 0x00, 0x05, 0x00,
+	0x00, 0x03, 0xFF, 0x00, 0x06, 0x00, 0x02, 0x0B, 0x00, 0x08, 0x00, 0x07, 0x00, 0x00, 0x03, 0xFF,
+	0x00, 0x05, 0x00, 0x00, 0x0B, 0xFF, 0x00, 0x05, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x06, 0x00, 0x01,
+	0x0D, 0x00, 0x07, 0x00, 0x07, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x06, 0x00, 0x00, 0x09, 0xFF, 0x00,
+	0x06, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x15, 0x00, 0x05, 0x00, 0x08, 0x00, 0x00, 0x03, 0xFF, 0x00,
+	0x06, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x20, 0x00, 0x07, 0x08, 0x03, 0xFF, 0x00, 0x07, 0x00, 0x00,
+	0x05, 0xFF, 0x00, 0x0E, 0x00, 0x01, 0x07, 0x00, 0x00, 0x05, 0xFF, 0x00, 0x07, 0x00, 0x04, 0x08,
+	0x04, 0xFF, 0x00, 0x20, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x06, 0x00, 0x04, 0x09, 0x04, 0xFF, 0x00,
+	0x1E, 0x00, 0x00, 0x09, 0xFF, 0x00, 0x06, 0x00, 0x05, 0x08, 0x02, 0x00, 0x00, 0x04, 0xFF, 0x00,
+	0x1C, 0x00, 0x00, 0x0B, 0xFF, 0x00, 0x05, 0x00, 0x07, 0x07, 0x04, 0x00, 0x00, 0x04, 0xFF, 0x00,
+	0x10, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x08, 0x00, 0x00, 0x0B, 0xFF, 0x00, 0x05, 0x00, 0x07, 0x06,
+	0x06, 0x00, 0x00, 0x05, 0xFF, 0x00, 0x0D, 0x00, 0x00, 0x05, 0xFF, 0x00, 0x07, 0x00, 0x00, 0x0B,
+	0xFF, 0x00, 0x05, 0x00, 0x07, 0x05, 0x08, 0x00, 0x00, 0x0B, 0xFF, 0x00, 0x05, 0x00, 0x00, 0x07,
+	0xFF, 0x00, 0x06, 0x00, 0x00, 0x0B, 0xFF, 0x00, 0x05, 0x00, 0x07, 0x04, 0x09, 0x00, 0x01, 0x04,
+	0xFF, 0x00, 0x0B, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x06, 0x00, 0x00, 0x0B, 0xFF, 0x00, 0x06, 0x00,
+	0x06, 0x05, 0x07, 0x00, 0x05, 0x0C, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x07, 0x00, 0x00, 0x09, 0xFF,
+	0x00, 0x08, 0x00, 0x06, 0x06, 0x05, 0x00, 0x05, 0x0E, 0x00, 0x00, 0x05, 0xFF, 0x00, 0x09, 0x00,
+	0x00, 0x07, 0xFF, 0x00, 0x0A, 0x00, 0x06, 0x07, 0x03, 0x00, 0x05, 0x10, 0x00, 0x00, 0x03, 0xFF,
+	0x00, 0x0B, 0x00, 0x00, 0x05, 0xFF, 0x00, 0x0C, 0x00, 0x04, 0x08, 0x01, 0x00, 0x05, 0x08, 0x00,
+	0x00, 0x23, 0xFF, 0x00, 0x06, 0x00, 0x05, 0x0E, 0x06, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x01, 0x00,
+	0x00, 0x23, 0xFF, 0x00, 0x06, 0x00, 0x03, 0x0E, 0x05, 0x00, 0x00, 0x27, 0xFF, 0x00, 0x05, 0x00,
+	0x05, 0x0E, 0x06, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x01, 0x00, 0x00, 0x23, 0xFF, 0x00, 0x06, 0x00,
+	0x01, 0x0E, 0x31, 0x00, 0x01, 0x0F, 0x2F, 0x00, 0x01, 0x10, 0x2D, 0x00, 0x01, 0x11, 0x2B, 0x00,
+	0x01, 0x12, 0x29, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x0D, 0x04, 0xFF, 0x00, 0x01, 0x77,
+	0x00, 0x01, 0x00, 0x00, 0x01, 0x44, 0x00, 0x04, 0xFF, 0x00, 0x01, 0x77, 0x00, 0x01, 0x00, 0x00,
+	0x01, 0x44, 0x00, 0x04, 0xFF, 0x00, 0x01, 0x77, 0x00, 0x01, 0x00, 0x00, 0x01, 0x44, 0x00, 0x04,
+	0xFF, 0x00, 0x01, 0x77, 0x00, 0x01, 0x00, 0x00, 0x01, 0x44, 0x00, 0x04, 0xFF, 0x00, 0x01, 0x77,
+	0x00, 0x01, 0x00, 0x00, 0x01, 0x44, 0x00, 0x04, 0xFF, 0x00, 0x01, 0x77, 0x00, 0x01, 0x00, 0x00,
+	0x01, 0x44, 0x00, 0x04, 0xFF, 0x00, 0x01, 0x77, 0x00, 0x01, 0x00, 0x00, 0x01, 0x44, 0x1C, 0x0D,
+	0x04, 0xFF, 0x00, 0x01, 0x11, 0x00, 0x01, 0x00, 0x00, 0x01, 0xAA, 0x00, 0x04, 0xFF, 0x00, 0x01,
+	0x11, 0x00, 0x01, 0x00, 0x00, 0x01, 0xAA, 0x00, 0x04, 0xFF, 0x00, 0x01, 0x11, 0x00, 0x01, 0x00,
+	0x00, 0x01, 0xAA, 0x00, 0x04, 0xFF, 0x00, 0x01, 0x11, 0x00, 0x01, 0x00, 0x00, 0x01, 0xAA, 0x00,
+	0x04, 0xFF, 0x00, 0x01, 0x11, 0x00, 0x01, 0x00, 0x00, 0x01, 0xAA, 0x00, 0x04, 0xFF, 0x00, 0x01,
+	0x11, 0x00, 0x01, 0x00, 0x00, 0x01, 0xAA, 0x00, 0x04, 0xFF, 0x00, 0x01, 0x11, 0x00, 0x01, 0x00,
+	0x00, 0x01, 0xAA, 0x16, 0x0D, 0x03, 0xFF, 0x00, 0x01, 0xBB, 0x00, 0x02, 0x00, 0x00, 0x04, 0xFF,
+	0x00, 0x01, 0xBB, 0x00, 0x02, 0x00, 0x00, 0x04, 0xFF, 0x00, 0x01, 0xBB, 0x00, 0x02, 0x00, 0x00,
+	0x04, 0xFF, 0x00, 0x01, 0xBB, 0x00, 0x02, 0x00, 0x00, 0x04, 0xFF, 0x00, 0x01, 0xBB, 0x00, 0x02,
+	0x00, 0x00, 0x04, 0xFF, 0x00, 0x01, 0xBB, 0x00, 0x02, 0x00, 0x00, 0x04, 0xFF, 0x00, 0x01, 0xBB,
+	0x00, 0x02, 0x00, 0x00, 0x01, 0xFF, 0x1D, 0x0D, 0x03, 0xFF, 0x00, 0x01, 0x55, 0x00, 0x01, 0x00,
+	0x00, 0x01, 0x66, 0x00, 0x04, 0xFF, 0x00, 0x01, 0x55, 0x00, 0x01, 0x00, 0x00, 0x01, 0x66, 0x00,
+	0x04, 0xFF, 0x00, 0x01, 0x55, 0x00, 0x01, 0x00, 0x00, 0x01, 0x66, 0x00, 0x04, 0xFF, 0x00, 0x01,
+	0x55, 0x00, 0x01, 0x00, 0x00, 0x01, 0x66, 0x00, 0x04, 0xFF, 0x00, 0x01, 0x55, 0x00, 0x01, 0x00,
+	0x00, 0x01, 0x66, 0x00, 0x04, 0xFF, 0x00, 0x01, 0x55, 0x00, 0x01, 0x00, 0x00, 0x01, 0x66, 0x00,
+	0x04, 0xFF, 0x00, 0x01, 0x55, 0x00, 0x01, 0x00, 0x00, 0x01, 0x66, 0x00, 0x01, 0xFF, 0x1D, 0x0D,
+	0x02, 0xFF, 0x00, 0x01, 0xEE, 0x00, 0x02, 0x00, 0x00, 0x01, 0xCC, 0x00, 0x03, 0xFF, 0x00, 0x01,
+	0xEE, 0x00, 0x02, 0x00, 0x00, 0x01, 0xCC, 0x00, 0x03, 0xFF, 0x00, 0x01, 0xEE, 0x00, 0x02, 0x00,
+	0x00, 0x01, 0xCC, 0x00, 0x03, 0xFF, 0x00, 0x01, 0xEE, 0x00, 0x02, 0x00, 0x00, 0x01, 0xCC, 0x00,
+	0x03, 0xFF, 0x00, 0x01, 0xEE, 0x00, 0x02, 0x00, 0x00, 0x01, 0xCC, 0x00, 0x03, 0xFF, 0x00, 0x01,
+	0xEE, 0x00, 0x02, 0x00, 0x00, 0x01, 0xCC, 0x00, 0x03, 0xFF, 0x00, 0x01, 0xEE, 0x00, 0x02, 0x00,
+	0x00, 0x01, 0xCC, 0x00, 0x01, 0xFF, 0x1D, 0x0D, 0x02, 0xFF, 0x00, 0x01, 0x88, 0x00, 0x01, 0x00,
+	0x00, 0x01, 0x22, 0x00, 0x04, 0xFF, 0x00, 0x01, 0x88, 0x00, 0x01, 0x00, 0x00, 0x01, 0x22, 0x00,
+	0x04, 0xFF, 0x00, 0x01, 0x88, 0x00, 0x01, 0x00, 0x00, 0x01, 0x22, 0x00, 0x04, 0xFF, 0x00, 0x01,
+	0x88, 0x00, 0x01, 0x00, 0x00, 0x01, 0x22, 0x00, 0x04, 0xFF, 0x00, 0x01, 0x88, 0x00, 0x01, 0x00,
+	0x00, 0x01, 0x22, 0x00, 0x04, 0xFF, 0x00, 0x01, 0x88, 0x00, 0x01, 0x00, 0x00, 0x01, 0x22, 0x00,
+	0x04, 0xFF, 0x00, 0x01, 0x88, 0x00, 0x01, 0x00, 0x00, 0x01, 0x22, 0x00, 0x02, 0xFF, 0x1D, 0x0D,
+	0x02, 0xFF, 0x00, 0x01, 0x22, 0x00, 0x01, 0x00, 0x00, 0x01, 0x88, 0x00, 0x04, 0xFF, 0x00, 0x01,
+	0x22, 0x00, 0x01, 0x00, 0x00, 0x01, 0x88, 0x00, 0x04, 0xFF, 0x00, 0x01, 0x22, 0x00, 0x01, 0x00,
+	0x00, 0x01, 0x88, 0x00, 0x04, 0xFF, 0x00, 0x01, 0x22, 0x00, 0x01, 0x00, 0x00, 0x01, 0x88, 0x00,
+	0x04, 0xFF, 0x00, 0x01, 0x22, 0x00, 0x01, 0x00, 0x00, 0x01, 0x88, 0x00, 0x04, 0xFF, 0x00, 0x01,
+	0x22, 0x00, 0x01, 0x00, 0x00, 0x01, 0x88, 0x00, 0x04, 0xFF, 0x00, 0x01, 0x22, 0x00, 0x01, 0x00,
+	0x00, 0x01, 0x88, 0x00, 0x02, 0xFF, 0x1D, 0x0D, 0x01, 0xFF, 0x00, 0x01, 0xCC, 0x00, 0x02, 0x00,
+	0x00, 0x01, 0xEE, 0x00, 0x03, 0xFF, 0x00, 0x01, 0xCC, 0x00, 0x02, 0x00, 0x00, 0x01, 0xEE, 0x00,
+	0x03, 0xFF, 0x00, 0x01, 0xCC, 0x00, 0x02, 0x00, 0x00, 0x01, 0xEE, 0x00, 0x03, 0xFF, 0x00, 0x01,
+	0xCC, 0x00, 0x02, 0x00, 0x00, 0x01, 0xEE, 0x00, 0x03, 0xFF, 0x00, 0x01, 0xCC, 0x00, 0x02, 0x00,
+	0x00, 0x01, 0xEE, 0x00, 0x03, 0xFF, 0x00, 0x01, 0xCC, 0x00, 0x02, 0x00, 0x00, 0x01, 0xEE, 0x00,
+	0x03, 0xFF, 0x00, 0x01, 0xCC, 0x00, 0x02, 0x00, 0x00, 0x01, 0xEE, 0x00, 0x02, 0xFF, 0x1D, 0x0D,
+	0x01, 0xFF, 0x00, 0x01, 0x66, 0x00, 0x01, 0x00, 0x00, 0x01, 0x44, 0x00, 0x04, 0xFF, 0x00, 0x01,
+	0x66, 0x00, 0x01, 0x00, 0x00, 0x01, 0x44, 0x00, 0x04, 0xFF, 0x00, 0x01, 0x66, 0x00, 0x01, 0x00,
+	0x00, 0x01, 0x44, 0x00, 0x04, 0xFF, 0x00, 0x01, 0x66, 0x00, 0x01, 0x00, 0x00, 0x01, 0x44, 0x00,
+	0x04, 0xFF, 0x00, 0x01, 0x66, 0x00, 0x01, 0x00, 0x00, 0x01, 0x44, 0x00, 0x04, 0xFF, 0x00, 0x01,
+	0x66, 0x00, 0x01, 0x00, 0x00, 0x01, 0x44, 0x00, 0x04, 0xFF, 0x00, 0x01, 0x66, 0x00, 0x01, 0x00,
+	0x00, 0x01, 0x44, 0x00, 0x03, 0xFF, 0x1D, 0x0D, 0x01, 0xFF, 0x00, 0x01, 0x11, 0x00, 0x01, 0x00,
+	0x00, 0x01, 0xAA, 0x00, 0x04, 0xFF, 0x00, 0x01, 0x11, 0x00, 0x01, 0x00, 0x00, 0x01, 0xAA, 0x00,
+	0x04, 0xFF, 0x00, 0x01, 0x11, 0x00, 0x01, 0x00, 0x00, 0x01, 0xAA, 0x00, 0x04, 0xFF, 0x00, 0x01,
+	0x11, 0x00, 0x01, 0x00, 0x00, 0x01, 0xAA, 0x00, 0x04, 0xFF, 0x00, 0x01, 0x11, 0x00, 0x01, 0x00,
+	0x00, 0x01, 0xAA, 0x00, 0x04, 0xFF, 0x00, 0x01, 0x11, 0x00, 0x01, 0x00, 0x00, 0x01, 0xAA, 0x00,
+	0x04, 0xFF, 0x00, 0x01, 0x11, 0x00, 0x01, 0x00, 0x00, 0x01, 0xAA, 0x00, 0x03, 0xFF, 0x15, 0x0D,
+	0x01, 0xAA, 0x00, 0x02, 0x00, 0x00, 0x04, 0xFF, 0x00, 0x01, 0xAA, 0x00, 0x02, 0x00, 0x00, 0x04,
+	0xFF, 0x00, 0x01, 0xAA, 0x00, 0x02, 0x00, 0x00, 0x04, 0xFF, 0x00, 0x01, 0xAA, 0x00, 0x02, 0x00,
+	0x00, 0x04, 0xFF, 0x00, 0x01, 0xAA, 0x00, 0x02, 0x00, 0x00, 0x04, 0xFF, 0x00, 0x01, 0xAA, 0x00,
+	0x02, 0x00, 0x00, 0x04, 0xFF, 0x00, 0x01, 0xAA, 0x00, 0x02, 0x00, 0x00, 0x04, 0xFF, 0x1C, 0x0D,
+	0x01, 0x44, 0x00, 0x01, 0x00, 0x00, 0x01, 0x66, 0x00, 0x04, 0xFF, 0x00, 0x01, 0x44, 0x00, 0x01,
+	0x00, 0x00, 0x01, 0x66, 0x00, 0x04, 0xFF, 0x00, 0x01, 0x44, 0x00, 0x01, 0x00, 0x00, 0x01, 0x66,
+	0x00, 0x04, 0xFF, 0x00, 0x01, 0x44, 0x00, 0x01, 0x00, 0x00, 0x01, 0x66, 0x00, 0x04, 0xFF, 0x00,
+	0x01, 0x44, 0x00, 0x01, 0x00, 0x00, 0x01, 0x66, 0x00, 0x04, 0xFF, 0x00, 0x01, 0x44, 0x00, 0x01,
+	0x00, 0x00, 0x01, 0x66, 0x00, 0x04, 0xFF, 0x00, 0x01, 0x44, 0x00, 0x01, 0x00, 0x00, 0x01, 0x66,
+	0x00, 0x04, 0xFF,
+};
+constexpr uint8_t IconSprite_10d_L_runs[] = {
+	0x01, 0x69, 0x0B, 0x00, 0x01, 0x64, 0x15, 0x00, 0x01, 0x62, 0x19, 0x00, 0x01, 0x5F, 0x1F, 0x00,
+	0x01, 0x5D, 0x23, 0x00, 0x03, 0x5C, 0x0D, 0x00, 0x00, 0x0B, 0xFF, 0x00, 0x0D, 0x00, 0x03, 0x5A,
+	0x0B, 0x00, 0x00, 0x13, 0xFF, 0x00, 0x0B, 0x00, 0x03, 0x59, 0x0A, 0x00, 0x00, 0x17, 0xFF, 0x00,
+	0x0A, 0x00, 0x03, 0x58, 0x08, 0x00, 0x00, 0x1D, 0xFF, 0x00, 0x08, 0x00, 0x03, 0x57, 0x08, 0x00,
+	0x00, 0x1F, 0xFF, 0x00, 0x08, 0x00, 0x03, 0x56, 0x07, 0x00, 0x00, 0x23, 0xFF, 0x00, 0x07, 0x00,
+	0x03, 0x55, 0x07, 0x00, 0x00, 0x25, 0xFF, 0x00, 0x07, 0x00, 0x03, 0x54, 0x07, 0x00, 0x00, 0x27,
+	0xFF, 0x00, 0x07, 0x00, 0x04, 0x37, 0x0B, 0x00, 0x11, 0x07, 0x00, 0x00, 0x29, 0xFF, 0x00, 0x07,
+	0x00, 0x04, 0x33, 0x13, 0x00, 0x0C, 0x07, 0x00, 0x00, 0x2B, 0xFF, 0x00, 0x07, 0x00, 0x04, 0x31,
+	0x17, 0x00, 0x09, 0x07, 0x00, 0x00, 0x2D, 0xFF, 0x00, 0x07, 0x00, 0x04, 0x2F, 0x1B, 0x00, 0x07,
+	0x06, 0x00, 0x00, 0x2F, 0xFF, 0x00, 0x06, 0x00, 0x04, 0x2D, 0x1F, 0x00, 0x04, 0x06, 0x00, 0x00,
+	0x31, 0xFF, 0x00, 0x06, 0x00, 0x06, 0x2C, 0x0C, 0x00, 0x00, 0x09, 0xFF, 0x00, 0x0C, 0x00, 0x02,
+	0x06, 0x00, 0x00, 0x33, 0xFF, 0x00, 0x06, 0x00, 0x06, 0x2B, 0x09, 0x00, 0x00, 0x11, 0xFF, 0x00,
+	0x09, 0x00, 0x01, 0x06, 0x00, 0x00, 0x33, 0xFF, 0x00, 0x06, 0x00, 0x05, 0x29, 0x09, 0x00, 0x00,
+	0x15, 0xFF, 0x00, 0x0D, 0x00, 0x00, 0x35, 0xFF, 0x00, 0x06, 0x00, 0x05, 0x28, 0x08, 0x00, 0x00,
+	0x19, 0xFF, 0x00, 0x0A, 0x00, 0x00, 0x37, 0xFF, 0x00, 0x05, 0x00, 0x05, 0x27, 0x08, 0x00, 0x00,
+	0x1B, 0xFF, 0x00, 0x09, 0x00, 0x00, 0x37, 0xFF, 0x00, 0x05, 0x00, 0x05, 0x27, 0x07, 0x00, 0x00,
+	0x1D, 0xFF, 0x00, 0x08, 0x00, 0x00, 0x37, 0xFF, 0x00, 0x06, 0x00, 0x05, 0x26, 0x06, 0x00, 0x00,
+	0x21, 0xFF, 0x00, 0x05, 0x00, 0x00, 0x39, 0xFF, 0x00, 0x05, 0x00, 0x05, 0x25, 0x06, 0x00, 0x00,
+	0x23, 0xFF, 0x00, 0x04, 0x00, 0x00, 0x39, 0xFF, 0x00, 0x06, 0x00, 0x05, 0x24, 0x07, 0x00, 0x00,
+	0x23, 0xFF, 0x00, 0x03, 0x00, 0x00, 0x3B, 0xFF, 0x00, 0x05, 0x00, 0x05, 0x24, 0x06, 0x00, 0x00,
+	0x25, 0xFF, 0x00, 0x02, 0x00, 0x00, 0x3B, 0xFF, 0x00, 0x05, 0x00, 0x05, 0x23, 0x06, 0x00, 0x00,
+	0x27, 0xFF, 0x00, 0x01, 0x00, 0x00, 0x3B, 0xFF, 0x00, 0x05, 0x00, 0x03, 0x23, 0x05, 0x00, 0x00,
+	0x64, 0xFF, 0x00, 0x05, 0x00, 0x03, 0x22, 0x06, 0x00, 0x00, 0x65, 0xFF, 0x00, 0x05, 0x00, 0x03,
+	0x22, 0x05, 0x00, 0x00, 0x66, 0xFF, 0x00, 0x05, 0x00, 0x03, 0x21, 0x06, 0x00, 0x00, 0x66, 0xFF,
+	0x00, 0x05, 0x00, 0x03, 0x21, 0x05, 0x00, 0x00, 0x67, 0xFF, 0x00, 0x05, 0x00, 0x03, 0x21, 0x05,
+	0x00, 0x00, 0x67, 0xFF, 0x00, 0x05, 0x00, 0x03, 0x21, 0x05, 0x00, 0x00, 0x67, 0xFF, 0x00, 0x05,
+	0x00, 0x03, 0x20, 0x06, 0x00, 0x00, 0x67, 0xFF, 0x00, 0x05, 0x00, 0x03, 0x20, 0x05, 0x00, 0x00,
+	0x68, 0xFF, 0x00, 0x05, 0x00, 0x03, 0x20, 0x05, 0x00, 0x00, 0x68, 0xFF, 0x00, 0x05, 0x00, 0x03,
+	0x20, 0x05, 0x00, 0x00, 0x68, 0xFF, 0x00, 0x05, 0x00, 0x03, 0x20, 0x05, 0x00, 0x00, 0x68, 0xFF,
+	0x00, 0x05, 0x00, 0x03, 0x10, 0x15, 0x00, 0x00, 0x67, 0xFF, 0x00, 0x05, 0x00, 0x03, 0x0D, 0x18,
+	0x00, 0x00, 0x67, 0xFF, 0x00, 0x08, 0x00, 0x03, 0x0B, 0x1A, 0x00, 0x00, 0x67, 0xFF, 0x00, 0x0A,
+	0x00, 0x03, 0x09, 0x1C, 0x00, 0x00, 0x67, 0xFF, 0x00, 0x0C, 0x00, 0x03, 0x08, 0x0E, 0x00, 0x00,
+	0x76, 0xFF, 0x00, 0x0D, 0x00, 0x03, 0x07, 0x0A, 0x00, 0x00, 0x7F, 0xFF, 0x00, 0x0A, 0x00, 0x03,
+	0x06, 0x08, 0x00, 0x00, 0x85, 0xFF, 0x00, 0x08, 0x00, 0x03, 0x05, 0x07, 0x00, 0x00, 0x89, 0xFF,
+	0x00, 0x07, 0x00, 0x03, 0x04, 0x07, 0x00, 0x00, 0x8B, 0xFF, 0x00, 0x07, 0x00, 0x03, 0x03, 0x07,
+	0x00, 0x00, 0x8D, 0xFF, 0x00, 0x07, 0x00, 0x03, 0x03, 0x06, 0x00, 0x00, 0x8F, 0xFF, 0x00, 0x06,
+	0x00, 0x03, 0x02, 0x06, 0x00, 0x00, 0x91, 0xFF, 0x00, 0x06, 0x00, 0x03, 0x02, 0x05, 0x00, 0x00,
+	0x93, 0xFF, 0x00, 0x05, 0x00, 0x03, 0x01, 0x06, 0x00, 0x00, 0x93, 0xFF, 0x00, 0x06, 0x00, 0x03,
+	0x01, 0x05, 0x00, 0x00, 0x95, 0xFF, 0x00, 0x05, 0x00, 0x03, 0x01, 0x05, 0x00, 0x00, 0x95, 0xFF,
+	0x00, 0x05, 0x00, 0x03, 0x00, 0x06, 0x00, 0x00, 0x95, 0xFF, 0x00, 0x06, 0x00, 0x03, 0x00, 0x05,
+	0x00, 0x00, 0x97, 0xFF, 0x00, 0x05, 0x00, 0x03, 0x00, 0x05, 0x00, 0x00, 0x97, 0xFF, 0x00, 0x05,
+	0x00, 0x03, 0x00, 0x05, 0x00, 0x00, 0x97, 0xFF, 0x00, 0x05, 0x00, 0x03, 0x00, 0x05, 0x00, 0x00,
+	0x97, 0xFF, 0x00, 0x05, 0x00, 0x03, 0x00, 0x05, 0x00, 0x00, 0x97, 0xFF, 0x00, 0x05, 0x00, 0x03,
+	0x00, 0x05, 0x00, 0x00, 0x97, 0xFF, 0x00, 0x05, 0x00, 0x03, 0x00, 0x05, 0x00, 0x00, 0x97, 0xFF,
+	0x00, 0x05, 0x00, 0x03, 0x00, 0x06, 0x00, 0x00, 0x95, 0xFF, 0x00, 0x06, 0x00, 0x03, 0x01, 0x05,
+	0x00, 0x00, 0x95, 0xFF, 0x00, 0x05, 0x00, 0x03, 0x01, 0x05, 0x00, 0x00, 0x95, 0xFF, 0x00, 0x05,
+	0x00, 0x03, 0x01, 0x06, 0x00, 0x00, 0x93, 0xFF, 0x00, 0x06, 0x00, 0x03, 0x02, 0x05, 0x00, 0x00,
+	0x93, 0xFF, 0x00, 0x05, 0x00, 0x03, 0x02, 0x06, 0x00, 0x00, 0x91, 0xFF, 0x00, 0x06, 0x00, 0x03,
+	0x03, 0x06, 0x00, 0x00, 0x8F, 0xFF, 0x00, 0x06, 0x00, 0x03, 0x03, 0x07, 0x00, 0x00, 0x8D, 0xFF,
+	0x00, 0x07, 0x00, 0x03, 0x04, 0x07, 0x00, 0x00, 0x8B, 0xFF, 0x00, 0x07, 0x00, 0x03, 0x05, 0x07,
+	0x00, 0x00, 0x89, 0xFF, 0x00, 0x07, 0x00, 0x03, 0x06, 0x08, 0x00, 0x00, 0x85, 0xFF, 0x00, 0x08,
+	0x00, 0x03, 0x07, 0x0A, 0x00, 0x00, 0x7F, 0xFF, 0x00, 0x0A, 0x00, 0x01, 0x08, 0x91, 0x00, 0x01,
+	0x09, 0x8F, 0x00, 0x01, 0x0B, 0x8B, 0x00, 0x01, 0x0D, 0x87, 0x00, 0x01, 0x10, 0x81, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x1C, 0x14, 0x0A, 0xFF, 0x00, 0x01, 0x22, 0x00, 0x04, 0x00, 0x00, 0x01, 0xAA,
+	0x00, 0x0A, 0xFF, 0x00, 0x01, 0x22, 0x00, 0x04, 0x00, 0x00, 0x01, 0xAA, 0x00, 0x0A, 0xFF, 0x00,
+	0x01, 0x22, 0x00, 0x04, 0x00, 0x00, 0x01, 0xAA, 0x00, 0x0A, 0xFF, 0x00, 0x01, 0x22, 0x00, 0x04,
+	0x00, 0x00, 0x01, 0xAA, 0x00, 0x0A, 0xFF, 0x00, 0x01, 0x22, 0x00, 0x04, 0x00, 0x00, 0x01, 0xAA,
+	0x00, 0x0A, 0xFF, 0x00, 0x01, 0x22, 0x00, 0x04, 0x00, 0x00, 0x01, 0xAA, 0x00, 0x0A, 0xFF, 0x00,
+	0x01, 0x22, 0x00, 0x04, 0x00, 0x00, 0x01, 0xAA, 0x1D, 0x14, 0x09, 0xFF, 0x00, 0x01, 0xDD, 0x00,
+	0x04, 0x00, 0x00, 0x01, 0x11, 0x00, 0x0A, 0xFF, 0x00, 0x01, 0xDD, 0x00, 0x04, 0x00, 0x00, 0x01,
+	0x11, 0x00, 0x0A, 0xFF, 0x00, 0x01, 0xDD, 0x00, 0x04, 0x00, 0x00, 0x01, 0x11, 0x00, 0x0A, 0xFF,
+	0x00, 0x01, 0xDD, 0x00, 0x04, 0x00, 0x00, 0x01, 0x11, 0x00, 0x0A, 0xFF, 0x00, 0x01, 0xDD, 0x00,
+	0x04, 0x00, 0x00, 0x01, 0x11, 0x00, 0x0A, 0xFF, 0x00, 0x01, 0xDD, 0x00, 0x04, 0x00, 0x00, 0x01,
+	0x11, 0x00, 0x0A, 0xFF, 0x00, 0x01, 0xDD, 0x00, 0x04, 0x00, 0x00, 0x01, 0x11, 0x00, 0x01, 0xFF,
+	0x1D, 0x14, 0x09, 0xFF, 0x00, 0x01, 0x66, 0x00, 0x04, 0x00, 0x00, 0x01, 0x66, 0x00, 0x0A, 0xFF,
+	0x00, 0x01, 0x66, 0x00, 0x04, 0x00, 0x00, 0x01, 0x66, 0x00, 0x0A, 0xFF, 0x00, 0x01, 0x66, 0x00,
+	0x04, 0x00, 0x00, 0x01, 0x66, 0x00, 0x0A, 0xFF, 0x00, 0x01, 0x66, 0x00, 0x04, 0x00, 0x00, 0x01,
+	0x66, 0x00, 0x0A, 0xFF, 0x00, 0x01, 0x66, 0x00, 0x04, 0x00, 0x00, 0x01, 0x66, 0x00, 0x0A, 0xFF,
+	0x00, 0x01, 0x66, 0x00, 0x04, 0x00, 0x00, 0x01, 0x66, 0x00, 0x0A, 0xFF, 0x00, 0x01, 0x66, 0x00,
+	0x04, 0x00, 0x00, 0x01, 0x66, 0x00, 0x01, 0xFF, 0x1D, 0x14, 0x09, 0xFF, 0x00, 0x01, 0x11, 0x00,
+	0x04, 0x00, 0x00, 0x01, 0xCC, 0x00, 0x0A, 0xFF, 0x00, 0x01, 0x11, 0x00, 0x04, 0x00, 0x00, 0x01,
+	0xCC, 0x00, 0x0A, 0xFF, 0x00, 0x01, 0x11, 0x00, 0x04, 0x00, 0x00, 0x01, 0xCC, 0x00, 0x0A, 0xFF,
+	0x00, 0x01, 0x11, 0x00, 0x04, 0x00, 0x00, 0x01, 0xCC, 0x00, 0x0A, 0xFF, 0x00, 0x01, 0x11, 0x00,
+	0x04, 0x00, 0x00, 0x01, 0xCC, 0x00, 0x0A, 0xFF, 0x00, 0x01, 0x11, 0x00, 0x04, 0x00, 0x00, 0x01,
+	0xCC, 0x00, 0x0A, 0xFF, 0x00, 0x01, 0x11, 0x00, 0x04, 0x00, 0x00, 0x01, 0xCC, 0x00, 0x01, 0xFF,
+	0x1D, 0x14, 0x08, 0xFF, 0x00, 0x01, 0xAA, 0x00, 0x04, 0x00, 0x00, 0x01, 0x22, 0x00, 0x0A, 0xFF,
+	0x00, 0x01, 0xAA, 0x00, 0x04, 0x00, 0x00, 0x01, 0x22, 0x00, 0x0A, 0xFF, 0x00, 0x01, 0xAA, 0x00,
+	0x04, 0x00, 0x00, 0x01, 0x22, 0x00, 0x0A, 0xFF, 0x00, 0x01, 0xAA, 0x00, 0x04, 0x00, 0x00, 0x01,
+	0x22, 0x00, 0x0A, 0xFF, 0x00, 0x01, 0xAA, 0x00, 0x04, 0x00, 0x00, 0x01, 0x22, 0x00, 0x0A, 0xFF,
+	0x00, 0x01, 0xAA, 0x00, 0x04, 0x00, 0x00, 0x01, 0x22, 0x00, 0x0A, 0xFF, 0x00, 0x01, 0xAA, 0x00,
+	0x04, 0x00, 0x00, 0x01, 0x22, 0x00, 0x02, 0xFF, 0x1D, 0x14, 0x08, 0xFF, 0x00, 0x01, 0x44, 0x00,
+	0x04, 0x00, 0x00, 0x01, 0x88, 0x00, 0x0A, 0xFF, 0x00, 0x01, 0x44, 0x00, 0x04, 0x00, 0x00, 0x01,
+	0x88, 0x00, 0x0A, 0xFF, 0x00, 0x01, 0x44, 0x00, 0x04, 0x00, 0x00, 0x01, 0x88, 0x00, 0x0A, 0xFF,
+	0x00, 0x01, 0x44, 0x00, 0x04, 0x00, 0x00, 0x01, 0x88, 0x00, 0x0A, 0xFF, 0x00, 0x01, 0x44, 0x00,
+	0x04, 0x00, 0x00, 0x01, 0x88, 0x00, 0x0A, 0xFF, 0x00, 0x01, 0x44, 0x00, 0x04, 0x00, 0x00, 0x01,
+	0x88, 0x00, 0x0A, 0xFF, 0x00, 0x01, 0x44, 0x00, 0x04, 0x00, 0x00, 0x01, 0x88, 0x00, 0x02, 0xFF,
+	0x1D, 0x14, 0x07, 0xFF, 0x00, 0x01, 0xEE, 0x00, 0x05, 0x00, 0x00, 0x01, 0xEE, 0x00, 0x09, 0xFF,
+	0x00, 0x01, 0xEE, 0x00, 0x05, 0x00, 0x00, 0x01, 0xEE, 0x00, 0x09, 0xFF, 0x00, 0x01, 0xEE, 0x00,
+	0x05, 0x00, 0x00, 0x01, 0xEE, 0x00, 0x09, 0xFF, 0x00, 0x01, 0xEE, 0x00, 0x05, 0x00, 0x00, 0x01,
+	0xEE, 0x00, 0x09, 0xFF, 0x00, 0x01, 0xEE, 0x00, 0x05, 0x00, 0x00, 0x01, 0xEE, 0x00, 0x09, 0xFF,
+	0x00, 0x01, 0xEE, 0x00, 0x05, 0x00, 0x00, 0x01, 0xEE, 0x00, 0x09, 0xFF, 0x00, 0x01, 0xEE, 0x00,
+	0x05, 0x00, 0x00, 0x01, 0xEE, 0x00, 0x02, 0xFF, 0x1D, 0x14, 0x07, 0xFF, 0x00, 0x01, 0x99, 0x00,
+	0x04, 0x00, 0x00, 0x01, 0x44, 0x00, 0x0A, 0xFF, 0x00, 0x01, 0x99, 0x00, 0x04, 0x00, 0x00, 0x01,
+	0x44, 0x00, 0x0A, 0xFF, 0x00, 0x01, 0x99, 0x00, 0x04, 0x00, 0x00, 0x01, 0x44, 0x00, 0x0A, 0xFF,
+	0x00, 0x01, 0x99, 0x00, 0x04, 0x00, 0x00, 0x01, 0x44, 0x00, 0x0A, 0xFF, 0x00, 0x01, 0x99, 0x00,
+	0x04, 0x00, 0x00, 0x01, 0x44, 0x00, 0x0A, 0xFF, 0x00, 0x01, 0x99, 0x00, 0x04, 0x00, 0x00, 0x01,
+	0x44, 0x00, 0x0A, 0xFF, 0x00, 0x01, 0x99, 0x00, 0x04, 0x00, 0x00, 0x01, 0x44, 0x00, 0x03, 0xFF,
+	0x1D, 0x14, 0x07, 0xFF, 0x00, 0x01, 0x33, 0x00, 0x04, 0x00, 0x00, 0x01, 0xAA, 0x00, 0x0A, 0xFF,
+	0x00, 0x01, 0x33, 0x00, 0x04, 0x00, 0x00, 0x01, 0xAA, 0x00, 0x0A, 0xFF, 0x00, 0x01, 0x33, 0x00,
+	0x04, 0x00, 0x00, 0x01, 0xAA, 0x00, 0x0A, 0xFF, 0x00, 0x01, 0x33, 0x00, 0x04, 0x00, 0x00, 0x01,
+	0xAA, 0x00, 0x0A, 0xFF, 0x00, 0x01, 0x33, 0x00, 0x04, 0x00, 0x00, 0x01, 0xAA, 0x00, 0x0A, 0xFF,
+	0x00, 0x01, 0x33, 0x00, 0x04, 0x00, 0x00, 0x01, 0xAA, 0x00, 0x0A, 0xFF, 0x00, 0x01, 0x33, 0x00,
+	0x04, 0x00, 0x00, 0x01, 0xAA, 0x00, 0x03, 0xFF, 0x1D, 0x14, 0x06, 0xFF, 0x00, 0x01, 0xDD, 0x00,
+	0x04, 0x00, 0x00, 0x01, 0x11, 0x00, 0x0A, 0xFF, 0x00, 0x01, 0xDD, 0x00, 0x04, 0x00, 0x00, 0x01,
+	0x11, 0x00, 0x0A, 0xFF, 0x00, 0x01, 0xDD, 0x00, 0x04, 0x00, 0x00, 0x01, 0x11, 0x00, 0x0A, 0xFF,
+	0x00, 0x01, 0xDD, 0x00, 0x04, 0x00, 0x00, 0x01, 0x11, 0x00, 0x0A, 0xFF, 0x00, 0x01, 0xDD, 0x00,
+	0x04, 0x00, 0x00, 0x01, 0x11, 0x00, 0x0A, 0xFF, 0x00, 0x01, 0xDD, 0x00, 0x04, 0x00, 0x00, 0x01,
+	0x11, 0x00, 0x0A, 0xFF, 0x00, 0x01, 0xDD, 0x00, 0x04, 0x00, 0x00, 0x01, 0x11, 0x00, 0x04, 0xFF,
+	0x1D, 0x14, 0x06, 0xFF, 0x00, 0x01, 0x77, 0x00, 0x04, 0x00, 0x00, 0x01, 0x66, 0x00, 0x0A, 0xFF,
+	0x00, 0x01, 0x77, 0x00, 0x04, 0x00, 0x00, 0x01, 0x66, 0x00, 0x0A, 0xFF, 0x00, 0x01, 0x77, 0x00,
+	0x04, 0x00, 0x00, 0x01, 0x66, 0x00, 0x0A, 0xFF, 0x00, 0x01, 0x77, 0x00, 0x04, 0x00, 0x00, 0x01,
+	0x66, 0x00, 0x0A, 0xFF, 0x00, 0x01, 0x77, 0x00, 0x04, 0x00, 0x00, 0x01, 0x66, 0x00, 0x0A, 0xFF,
+	0x00, 0x01, 0x77, 0x00, 0x04, 0x00, 0x00, 0x01, 0x66, 0x00, 0x0A, 0xFF, 0x00, 0x01, 0x77, 0x00,
+	0x04, 0x00, 0x00, 0x01, 0x66, 0x00, 0x04, 0xFF, 0x1D, 0x14, 0x06, 0xFF, 0x00, 0x01, 0x11, 0x00,
+	0x04, 0x00, 0x00, 0x01, 0xCC, 0x00, 0x0A, 0xFF, 0x00, 0x01, 0x11, 0x00, 0x04, 0x00, 0x00, 0x01,
+	0xCC, 0x00, 0x0A, 0xFF, 0x00, 0x01, 0x11, 0x00, 0x04, 0x00, 0x00, 0x01, 0xCC, 0x00, 0x0A, 0xFF,
+	0x00, 0x01, 0x11, 0x00, 0x04, 0x00, 0x00, 0x01, 0xCC, 0x00, 0x0A, 0xFF, 0x00, 0x01, 0x11, 0x00,
+	0x04, 0x00, 0x00, 0x01, 0xCC, 0x00, 0x0A, 0xFF, 0x00, 0x01, 0x11, 0x00, 0x04, 0x00, 0x00, 0x01,
+	0xCC, 0x00, 0x0A, 0xFF, 0x00, 0x01, 0x11, 0x00, 0x04, 0x00, 0x00, 0x01, 0xCC, 0x00, 0x04, 0xFF,
+	0x1D, 0x14, 0x05, 0xFF, 0x00, 0x01, 0xBB, 0x00, 0x04, 0x00, 0x00, 0x01, 0x22, 0x00, 0x0A, 0xFF,
+	0x00, 0x01, 0xBB, 0x00, 0x04, 0x00, 0x00, 0x01, 0x22, 0x00, 0x0A, 0xFF, 0x00, 0x01, 0xBB, 0x00,
+	0x04, 0x00, 0x00, 0x01, 0x22, 0x00, 0x0A, 0xFF, 0x00, 0x01, 0xBB, 0x00, 0x04, 0x00, 0x00, 0x01,
+	0x22, 0x00, 0x0A, 0xFF, 0x00, 0x01, 0xBB, 0x00, 0x04, 0x00, 0x00, 0x01, 0x22, 0x00, 0x0A, 0xFF,
+	0x00, 0x01, 0xBB, 0x00, 0x04, 0x00, 0x00, 0x01, 0x22, 0x00, 0x0A, 0xFF, 0x00, 0x01, 0xBB, 0x00,
+	0x04, 0x00, 0x00, 0x01, 0x22, 0x00, 0x05, 0xFF, 0x1D, 0x14, 0x05, 0xFF, 0x00, 0x01, 0x55, 0x00,
+	0x04, 0x00, 0x00, 0x01, 0x88, 0x00, 0x0A, 0xFF, 0x00, 0x01, 0x55, 0x00, 0x04, 0x00, 0x00, 0x01,
+	0x88, 0x00, 0x0A, 0xFF, 0x00, 0x01, 0x55, 0x00, 0x04, 0x00, 0x00, 0x01, 0x88, 0x00, 0x0A, 0xFF,
+	0x00, 0x01, 0x55, 0x00, 0x04, 0x00, 0x00, 0x01, 0x88, 0x00, 0x0A, 0xFF, 0x00, 0x01, 0x55, 0x00,
+	0x04, 0x00, 0x00, 0x01, 0x88, 0x00, 0x0A, 0xFF, 0x00, 0x01, 0x55, 0x00, 0x04, 0x00, 0x00, 0x01,
+	0x88, 0x00, 0x0A, 0xFF, 0x00, 0x01, 0x55, 0x00, 0x04, 0x00, 0x00, 0x01, 0x88, 0x00, 0x05, 0xFF,
+	0x1D, 0x14, 0x04, 0xFF, 0x00, 0x01, 0xEE, 0x00, 0x05, 0x00, 0x00, 0x01, 0xEE, 0x00, 0x09, 0xFF,
+	0x00, 0x01, 0xEE, 0x00, 0x05, 0x00, 0x00, 0x01, 0xEE, 0x00, 0x09, 0xFF, 0x00, 0x01, 0xEE, 0x00,
+	0x05, 0x00, 0x00, 0x01, 0xEE, 0x00, 0x09, 0xFF, 0x00, 0x01, 0xEE, 0x00, 0x05, 0x00, 0x00, 0x01,
+	0xEE, 0x00, 0x09, 0xFF, 0x00, 0x01, 0xEE, 0x00, 0x05, 0x00, 0x00, 0x01, 0xEE, 0x00, 0x09, 0xFF,
+	0x00, 0x01, 0xEE, 0x00, 0x05, 0x00, 0x00, 0x01, 0xEE, 0x00, 0x09, 0xFF, 0x00, 0x01, 0xEE, 0x00,
+	0x05, 0x00, 0x00, 0x01, 0xEE, 0x00, 0x05, 0xFF, 0x1D, 0x14, 0x04, 0xFF, 0x00, 0x01, 0x99, 0x00,
+	0x04, 0x00, 0x00, 0x01, 0x44, 0x00, 0x0A, 0xFF, 0x00, 0x01, 0x99, 0x00, 0x04, 0x00, 0x00, 0x01,
+	0x44, 0x00, 0x0A, 0xFF, 0x00, 0x01, 0x99, 0x00, 0x04, 0x00, 0x00, 0x01, 0x44, 0x00, 0x0A, 0xFF,
+	0x00, 0x01, 0x99, 0x00, 0x04, 0x00, 0x00, 0x01, 0x44, 0x00, 0x0A, 0xFF, 0x00, 0x01, 0x99, 0x00,
+	0x04, 0x00, 0x00, 0x01, 0x44, 0x00, 0x0A, 0xFF, 0x00, 0x01, 0x99, 0x00, 0x04, 0x00, 0x00, 0x01,
+	0x44, 0x00, 0x0A, 0xFF, 0x00, 0x01, 0x99, 0x00, 0x04, 0x00, 0x00, 0x01, 0x44, 0x00, 0x06, 0xFF,
+	0x1D, 0x14, 0x04, 0xFF, 0x00, 0x01, 0x33, 0x00, 0x04, 0x00, 0x00, 0x01, 0xAA, 0x00, 0x0A, 0xFF,
+	0x00, 0x01, 0x33, 0x00, 0x04, 0x00, 0x00, 0x01, 0xAA, 0x00, 0x0A, 0xFF, 0x00, 0x01, 0x33, 0x00,
+	0x04, 0x00, 0x00, 0x01, 0xAA, 0x00, 0x0A, 0xFF, 0x00, 0x01, 0x33, 0x00, 0x04, 0x00, 0x00, 0x01,
+	0xAA, 0x00, 0x0A, 0xFF, 0x00, 0x01, 0x33, 0x00, 0x04, 0x00, 0x00, 0x01, 0xAA, 0x00, 0x0A, 0xFF,
+	0x00, 0x01, 0x33, 0x00, 0x04, 0x00, 0x00, 0x01, 0xAA, 0x00, 0x0A, 0xFF, 0x00, 0x01, 0x33, 0x00,
+	0x04, 0x00, 0x00, 0x01, 0xAA, 0x00, 0x06, 0xFF, 0x1D, 0x14, 0x03, 0xFF, 0x00, 0x01, 0xDD, 0x00,
+	0x04, 0x00, 0x00, 0x01, 0x11, 0x00, 0x0A, 0xFF, 0x00, 0x01, 0xDD, 0x00, 0x04, 0x00, 0x00, 0x01,
+	0x11, 0x00, 0x0A, 0xFF, 0x00, 0x01, 0xDD, 0x00, 0x04, 0x00, 0x00, 0x01, 0x11, 0x00, 0x0A, 0xFF,
+	0x00, 0x01, 0xDD, 0x00, 0x04, 0x00, 0x00, 0x01, 0x11, 0x00, 0x0A, 0xFF, 0x00, 0x01, 0xDD, 0x00,
+	0x04, 0x00, 0x00, 0x01, 0x11, 0x00, 0x0A, 0xFF, 0x00, 0x01, 0xDD, 0x00, 0x04, 0x00, 0x00, 0x01,
+	0x11, 0x00, 0x0A, 0xFF, 0x00, 0x01, 0xDD, 0x00, 0x04, 0x00, 0x00, 0x01, 0x11, 0x00, 0x07, 0xFF,
+	0x1D, 0x14, 0x03, 0xFF, 0x00, 0x01, 0x77, 0x00, 0x04, 0x00, 0x00, 0x01, 0x66, 0x00, 0x0A, 0xFF,
+	0x00, 0x01, 0x77, 0x00, 0x04, 0x00, 0x00, 0x01, 0x66, 0x00, 0x0A, 0xFF, 0x00, 0x01, 0x77, 0x00,
+	0x04, 0x00, 0x00, 0x01, 0x66, 0x00, 0x0A, 0xFF, 0x00, 0x01, 0x77, 0x00, 0x04, 0x00, 0x00, 0x01,
+	0x66, 0x00, 0x0A, 0xFF, 0x00, 0x01, 0x77, 0x00, 0x04, 0x00, 0x00, 0x01, 0x66, 0x00, 0x0A, 0xFF,
+	0x00, 0x01, 0x77, 0x00, 0x04, 0x00, 0x00, 0x01, 0x66, 0x00, 0x0A, 0xFF, 0x00, 0x01, 0x77, 0x00,
+	0x04, 0x00, 0x00, 0x01, 0x66, 0x00, 0x07, 0xFF, 0x1D, 0x14, 0x03, 0xFF, 0x00, 0x01, 0x11, 0x00,
+	0x04, 0x00, 0x00, 0x01, 0xCC, 0x00, 0x0A, 0xFF, 0x00, 0x01, 0x11, 0x00, 0x04, 0x00, 0x00, 0x01,
+	0xCC, 0x00, 0x0A, 0xFF, 0x00, 0x01, 0x11, 0x00, 0x04, 0x00, 0x00, 0x01, 0xCC, 0x00, 0x0A, 0xFF,
+	0x00, 0x01, 0x11, 0x00, 0x04, 0x00, 0x00, 0x01, 0xCC, 0x00, 0x0A, 0xFF, 0x00, 0x01, 0x11, 0x00,
+	0x04, 0x00, 0x00, 0x01, 0xCC, 0x00, 0x0A, 0xFF, 0x00, 0x01, 0x11, 0x00, 0x04, 0x00, 0x00, 0x01,
+	0xCC, 0x00, 0x0A, 0xFF, 0x00, 0x01, 0x11, 0x00, 0x04, 0x00, 0x00, 0x01, 0xCC, 0x00, 0x07, 0xFF,
+	0x1D, 0x14, 0x02, 0xFF, 0x00, 0x01, 0xBB, 0x00, 0x04, 0x00, 0x00, 0x01, 0x22, 0x00, 0x0A, 0xFF,
+	0x00, 0x01, 0xBB, 0x00, 0x04, 0x00, 0x00, 0x01, 0x22, 0x00, 0x0A, 0xFF, 0x00, 0x01, 0xBB, 0x00,
+	0x04, 0x00, 0x00, 0x01, 0x22, 0x00, 0x0A, 0xFF, 0x00, 0x01, 0xBB, 0x00, 0x04, 0x00, 0x00, 0x01,
+	0x22, 0x00, 0x0A, 0xFF, 0x00, 0x01, 0xBB, 0x00, 0x04, 0x00, 0x00, 0x01, 0x22, 0x00, 0x0A, 0xFF,
+	0x00, 0x01, 0xBB, 0x00, 0x04, 0x00, 0x00, 0x01, 0x22, 0x00, 0x0A, 0xFF, 0x00, 0x01, 0xBB, 0x00,
+	0x04, 0x00, 0x00, 0x01, 0x22, 0x00, 0x08, 0xFF, 0x1D, 0x14, 0x02, 0xFF, 0x00, 0x01, 0x55, 0x00,
+	0x04, 0x00, 0x00, 0x01, 0x88, 0x00, 0x0A, 0xFF, 0x00, 0x01, 0x55, 0x00, 0x04, 0x00, 0x00, 0x01,
+	0x88, 0x00, 0x0A, 0xFF, 0x00, 0x01, 0x55, 0x00, 0x04, 0x00, 0x00, 0x01, 0x88, 0x00, 0x0A, 0xFF,
+	0x00, 0x01, 0x55, 0x00, 0x04, 0x00, 0x00, 0x01, 0x88, 0x00, 0x0A, 0xFF, 0x00, 0x01, 0x55, 0x00,
+	0x04, 0x00, 0x00, 0x01, 0x88, 0x00, 0x0A, 0xFF, 0x00, 0x01, 0x55, 0x00, 0x04, 0x00, 0x00, 0x01,
+	0x88, 0x00, 0x0A, 0xFF, 0x00, 0x01, 0x55, 0x00, 0x04, 0x00, 0x00, 0x01, 0x88, 0x00, 0x08, 0xFF,
+	0x1D, 0x14, 0x01, 0xFF, 0x00, 0x01, 0xEE, 0x00, 0x05, 0x00, 0x00, 0x01, 0xEE, 0x00, 0x09, 0xFF,
+	0x00, 0x01, 0xEE, 0x00, 0x05, 0x00, 0x00, 0x01, 0xEE, 0x00, 0x09, 0xFF, 0x00, 0x01, 0xEE, 0x00,
+	0x05, 0x00, 0x00, 0x01, 0xEE, 0x00, 0x09, 0xFF, 0x00, 0x01, 0xEE, 0x00, 0x05, 0x00, 0x00, 0x01,
+	0xEE, 0x00, 0x09, 0xFF, 0x00, 0x01, 0xEE, 0x00, 0x05, 0x00, 0x00, 0x01, 0xEE, 0x00, 0x09, 0xFF,
+	0x00, 0x01, 0xEE, 0x00, 0x05, 0x00, 0x00, 0x01, 0xEE, 0x00, 0x09, 0xFF, 0x00, 0x01, 0xEE, 0x00,
+	0x05, 0x00, 0x00, 0x01, 0xEE, 0x00, 0x08, 0xFF, 0x1D, 0x14, 0x01, 0xFF, 0x00, 0x01, 0x99, 0x00,
+	0x04, 0x00, 0x00, 0x01, 0x44, 0x00, 0x0A, 0xFF, 0x00, 0x01, 0x99, 0x00, 0x04, 0x00, 0x00, 0x01,
+	0x44, 0x00, 0x0A, 0xFF, 0x00, 0x01, 0x99, 0x00, 0x04, 0x00, 0x00, 0x01, 0x44, 0x00, 0x0A, 0xFF,
+	0x00, 0x01, 0x99, 0x00, 0x04, 0x00, 0x00, 0x01, 0x44, 0x00, 0x0A, 0xFF, 0x00, 0x01, 0x99, 0x00,
+	0x04, 0x00, 0x00, 0x01, 0x44, 0x00, 0x0A, 0xFF, 0x00, 0x01, 0x99, 0x00, 0x04, 0x00, 0x00, 0x01,
+	0x44, 0x00, 0x0A, 0xFF, 0x00, 0x01, 0x99, 0x00, 0x04, 0x00, 0x00, 0x01, 0x44, 0x00, 0x09, 0xFF,
+	0x1D, 0x14, 0x01, 0xFF, 0x00, 0x01, 0x33, 0x00, 0x04, 0x00, 0x00, 0x01, 0xAA, 0x00, 0x0A, 0xFF,
+	0x00, 0x01, 0x33, 0x00, 0x04, 0x00, 0x00, 0x01, 0xAA, 0x00, 0x0A, 0xFF, 0x00, 0x01, 0x33, 0x00,
+	0x04, 0x00, 0x00, 0x01, 0xAA, 0x00, 0x0A, 0xFF, 0x00, 0x01, 0x33, 0x00, 0x04, 0x00, 0x00, 0x01,
+	0xAA, 0x00, 0x0A, 0xFF, 0x00, 0x01, 0x33, 0x00, 0x04, 0x00, 0x00, 0x01, 0xAA, 0x00, 0x0A, 0xFF,
+	0x00, 0x01, 0x33, 0x00, 0x04, 0x00, 0x00, 0x01, 0xAA, 0x00, 0x0A, 0xFF, 0x00, 0x01, 0x33, 0x00,
+	0x04, 0x00, 0x00, 0x01, 0xAA, 0x00, 0x09, 0xFF, 0x1C, 0x14, 0x01, 0xDD, 0x00, 0x04, 0x00, 0x00,
+	0x01, 0x11, 0x00, 0x0A, 0xFF, 0x00, 0x01, 0xDD, 0x00, 0x04, 0x00, 0x00, 0x01, 0x11, 0x00, 0x0A,
+	0xFF, 0x00, 0x01, 0xDD, 0x00, 0x04, 0x00, 0x00, 0x01, 0x11, 0x00, 0x0A, 0xFF, 0x00, 0x01, 0xDD,
+	0x00, 0x04, 0x00, 0x00, 0x01, 0x11, 0x00, 0x0A, 0xFF, 0x00, 0x01, 0xDD, 0x00, 0x04, 0x00, 0x00,
+	0x01, 0x11, 0x00, 0x0A, 0xFF, 0x00, 0x01, 0xDD, 0x00, 0x04, 0x00, 0x00, 0x01, 0x11, 0x00, 0x0A,
+	0xFF, 0x00, 0x01, 0xDD, 0x00, 0x04, 0x00, 0x00, 0x01, 0x11, 0x00, 0x0A, 0xFF, 0x1C, 0x14, 0x01,
+	0x77, 0x00, 0x04, 0x00, 0x00, 0x01, 0x66, 0x00, 0x0A, 0xFF, 0x00, 0x01, 0x77, 0x00, 0x04, 0x00,
+	0x00, 0x01, 0x66, 0x00, 0x0A, 0xFF, 0x00, 0x01, 0x77, 0x00, 0x04, 0x00, 0x00, 0x01, 0x66, 0x00,
+	0x0A, 0xFF, 0x00, 0x01, 0x77, 0x00, 0x04, 0x00, 0x00, 0x01, 0x66, 0x00, 0x0A, 0xFF, 0x00, 0x01,
+	0x77, 0x00, 0x04, 0x00, 0x00, 0x01, 0x66, 0x00, 0x0A, 0xFF, 0x00, 0x01, 0x77, 0x00, 0x04, 0x00,
+	0x00, 0x01, 0x66, 0x00, 0x0A, 0xFF, 0x00, 0x01, 0x77, 0x00, 0x04, 0x00, 0x00, 0x01, 0x66, 0x00,
+	0x0A, 0xFF,
+};
+constexpr uint8_t IconSprite_10d_S_runs[] = {
+	0x01, 0x23, 0x07, 0x00, 0x01, 0x21, 0x0B, 0x00, 0x01, 0x1F, 0x0F, 0x00, 0x01, 0x1E, 0x11, 0x00,
+	0x01, 0x1D, 0x13, 0x00, 0x03, 0x1C, 0x08, 0x00, 0x00, 0x05, 0xFF, 0x00, 0x08, 0x00, 0x04, 0x13,
+	0x05, 0x00, 0x04, 0x06, 0x00, 0x00, 0x09, 0xFF, 0x00, 0x06, 0x00, 0x04, 0x11, 0x09, 0x00, 0x01,
+	0x06, 0x00, 0x00, 0x0B, 0xFF, 0x00, 0x06, 0x00, 0x03, 0x0F, 0x11, 0x00, 0x00, 0x0D, 0xFF, 0x00,
+	0x05, 0x00, 0x03, 0x0E, 0x12, 0x00, 0x00, 0x0D, 0xFF, 0x00, 0x06, 0x00, 0x03, 0x0E, 0x11, 0x00,
+	0x00, 0x0F, 0xFF, 0x00, 0x05, 0x00, 0x05, 0x0D, 0x07, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x08, 0x00,
+	0x00, 0x0F, 0xFF, 0x00, 0x05, 0x00, 0x05, 0x0D, 0x05, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x06, 0x00,
+	0x00, 0x0F, 0xFF, 0x00, 0x05, 0x00, 0x05, 0x0C, 0x06, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x06, 0x00,
+	0x00, 0x0F, 0xFF, 0x00, 0x05, 0x00, 0x05, 0x0C, 0x05, 0x00, 0x00, 0x09, 0xFF, 0x00, 0x05, 0x00,
+	0x00, 0x0F, 0xFF, 0x00, 0x05, 0x00, 0x05, 0x05, 0x0C, 0x00, 0x00, 0x09, 0xFF, 0x00, 0x06, 0x00,
+	0x00, 0x0D, 0xFF, 0x00, 0x07, 0x00, 0x05, 0x03, 0x0E, 0x00, 0x00, 0x09, 0xFF, 0x00, 0x06, 0x00,
+	0x00, 0x0D, 0xFF, 0x00, 0x09, 0x00, 0x05, 0x02, 0x10, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x08, 0x00,
+	0x00, 0x0B, 0xFF, 0x00, 0x0B, 0x00, 0x05, 0x01, 0x11, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x09, 0x00,
+	0x00, 0x09, 0xFF, 0x00, 0x0D, 0x00, 0x03, 0x01, 0x08, 0x00, 0x00, 0x29, 0xFF, 0x00, 0x06, 0x00,
+	0x03, 0x00, 0x06, 0x00, 0x00, 0x2D, 0xFF, 0x00, 0x06, 0x00, 0x03, 0x00, 0x05, 0x00, 0x00, 0x2F,
+	0xFF, 0x00, 0x05, 0x00, 0x03, 0x00, 0x05, 0x00, 0x00, 0x2F, 0xFF, 0x00, 0x05, 0x00, 0x03, 0x00,
+	0x05, 0x00, 0x00, 0x2F, 0xFF, 0x00, 0x05, 0x00, 0x03, 0x00, 0x06, 0x00, 0x00, 0x2D, 0xFF, 0x00,
+	0x06, 0x00, 0x01, 0x01, 0x37, 0x00, 0x01, 0x01, 0x37, 0x00, 0x01, 0x02, 0x35, 0x00, 0x01, 0x03,
+	0x33, 0x00, 0x01, 0x05, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x03, 0x04, 0xFF, 0x00, 0x01,
+	0x77, 0x00, 0x01, 0x00, 0x00, 0x01, 0x44, 0x00, 0x04, 0xFF, 0x00, 0x01, 0x77, 0x00, 0x01, 0x00,
+	0x00, 0x01, 0x44, 0x00, 0x04, 0xFF, 0x00, 0x01, 0x77, 0x00, 0x01, 0x00, 0x00, 0x01, 0x44, 0x00,
+	0x04, 0xFF, 0x00, 0x01, 0x77, 0x00, 0x01, 0x00, 0x00, 0x01, 0x44, 0x00, 0x04, 0xFF, 0x00, 0x01,
+	0x77, 0x00, 0x01, 0x00, 0x00, 0x01, 0x44, 0x00, 0x04, 0xFF, 0x00, 0x01, 0x77, 0x00, 0x01, 0x00,
+	0x00, 0x01, 0x44, 0x00, 0x04, 0xFF, 0x00, 0x01, 0x77, 0x00, 0x01, 0x00, 0x00, 0x01, 0x44, 0x1C,
+	0x03, 0x04, 0xFF, 0x00, 0x01, 0x11, 0x00, 0x01, 0x00, 0x00, 0x01, 0xAA, 0x00, 0x04, 0xFF, 0x00,
+	0x01, 0x11, 0x00, 0x01, 0x00, 0x00, 0x01, 0xAA, 0x00, 0x04, 0xFF, 0x00, 0x01, 0x11, 0x00, 0x01,
+	0x00, 0x00, 0x01, 0xAA, 0x00, 0x04, 0xFF, 0x00, 0x01, 0x11, 0x00, 0x01, 0x00, 0x00, 0x01, 0xAA,
+	0x00, 0x04, 0xFF, 0x00, 0x01, 0x11, 0x00, 0x01, 0x00, 0x00, 0x01, 0xAA, 0x00, 0x04, 0xFF, 0x00,
+	0x01, 0x11, 0x00, 0x01, 0x00, 0x00, 0x01, 0xAA, 0x00, 0x04, 0xFF, 0x00, 0x01, 0x11, 0x00, 0x01,
+	0x00, 0x00, 0x01, 0xAA, 0x16, 0x03, 0x03, 0xFF, 0x00, 0x01, 0xBB, 0x00, 0x02, 0x00, 0x00, 0x04,
+	0xFF, 0x00, 0x01, 0xBB, 0x00, 0x02, 0x00, 0x00, 0x04, 0xFF, 0x00, 0x01, 0xBB, 0x00, 0x02, 0x00,
+	0x00, 0x04, 0xFF, 0x00, 0x01, 0xBB, 0x00, 0x02, 0x00, 0x00, 0x04, 0xFF, 0x00, 0x01, 0xBB, 0x00,
+	0x02, 0x00, 0x00, 0x04, 0xFF, 0x00, 0x01, 0xBB, 0x00, 0x02, 0x00, 0x00, 0x04, 0xFF, 0x00, 0x01,
+	0xBB, 0x00, 0x02, 0x00, 0x00, 0x01, 0xFF, 0x1D, 0x03, 0x03, 0xFF, 0x00, 0x01, 0x55, 0x00, 0x01,
+	0x00, 0x00, 0x01, 0x66, 0x00, 0x04, 0xFF, 0x00, 0x01, 0x55, 0x00, 0x01, 0x00, 0x00, 0x01, 0x66,
+	0x00, 0x04, 0xFF, 0x00, 0x01, 0x55, 0x00, 0x01, 0x00, 0x00, 0x01, 0x66, 0x00, 0x04, 0xFF, 0x00,
+	0x01, 0x55, 0x00, 0x01, 0x00, 0x00, 0x01, 0x66, 0x00, 0x04, 0xFF, 0x00, 0x01, 0x55, 0x00, 0x01,
+	0x00, 0x00, 0x01, 0x66, 0x00, 0x04, 0xFF, 0x00, 0x01, 0x55, 0x00, 0x01, 0x00, 0x00, 0x01, 0x66,
+	0x00, 0x04, 0xFF, 0x00, 0x01, 0x55, 0x00, 0x01, 0x00, 0x00, 0x01, 0x66, 0x00, 0x01, 0xFF, 0x1D,
+	0x03, 0x02, 0xFF, 0x00, 0x01, 0xEE, 0x00, 0x02, 0x00, 0x00, 0x01, 0xCC, 0x00, 0x03, 0xFF, 0x00,
+	0x01, 0xEE, 0x00, 0x02, 0x00, 0x00, 0x01, 0xCC, 0x00, 0x03, 0xFF, 0x00, 0x01, 0xEE, 0x00, 0x02,
+	0x00, 0x00, 0x01, 0xCC, 0x00, 0x03, 0xFF, 0x00, 0x01, 0xEE, 0x00, 0x02, 0x00, 0x00, 0x01, 0xCC,
+	0x00, 0x03, 0xFF, 0x00, 0x01, 0xEE, 0x00, 0x02, 0x00, 0x00, 0x01, 0xCC, 0x00, 0x03, 0xFF, 0x00,
+	0x01, 0xEE, 0x00, 0x02, 0x00, 0x00, 0x01, 0xCC, 0x00, 0x03, 0xFF, 0x00, 0x01, 0xEE, 0x00, 0x02,
+	0x00, 0x00, 0x01, 0xCC, 0x00, 0x01, 0xFF, 0x1D, 0x03, 0x02, 0xFF, 0x00, 0x01, 0x88, 0x00, 0x01,
+	0x00, 0x00, 0x01, 0x22, 0x00, 0x04, 0xFF, 0x00, 0x01, 0x88, 0x00, 0x01, 0x00, 0x00, 0x01, 0x22,
+	0x00, 0x04, 0xFF, 0x00, 0x01, 0x88, 0x00, 0x01, 0x00, 0x00, 0x01, 0x22, 0x00, 0x04, 0xFF, 0x00,
+	0x01, 0x88, 0x00, 0x01, 0x00, 0x00, 0x01, 0x22, 0x00, 0x04, 0xFF, 0x00, 0x01, 0x88, 0x00, 0x01,
+	0x00, 0x00, 0x01, 0x22, 0x00, 0x04, 0xFF, 0x00, 0x01, 0x88, 0x00, 0x01, 0x00, 0x00, 0x01, 0x22,
+	0x00, 0x04, 0xFF, 0x00, 0x01, 0x88, 0x00, 0x01, 0x00, 0x00, 0x01, 0x22, 0x00, 0x02, 0xFF, 0x1D,
+	0x03, 0x02, 0xFF, 0x00, 0x01, 0x22, 0x00, 0x01, 0x00, 0x00, 0x01, 0x88, 0x00, 0x04, 0xFF, 0x00,
+	0x01, 0x22, 0x00, 0x01, 0x00, 0x00, 0x01, 0x88, 0x00, 0x04, 0xFF, 0x00, 0x01, 0x22, 0x00, 0x01,
+	0x00, 0x00, 0x01, 0x88, 0x00, 0x04, 0xFF, 0x00, 0x01, 0x22, 0x00, 0x01, 0x00, 0x00, 0x01, 0x88,
+	0x00, 0x04, 0xFF, 0x00, 0x01, 0x22, 0x00, 0x01, 0x00, 0x00, 0x01, 0x88, 0x00, 0x04, 0xFF, 0x00,
+	0x01, 0x22, 0x00, 0x01, 0x00, 0x00, 0x01, 0x88, 0x00, 0x04, 0xFF, 0x00, 0x01, 0x22, 0x00, 0x01,
+	0x00, 0x00, 0x01, 0x88, 0x00, 0x02, 0xFF, 0x1D, 0x03, 0x01, 0xFF, 0x00, 0x01, 0xCC, 0x00, 0x02,
+	0x00, 0x00, 0x01, 0xEE, 0x00, 0x03, 0xFF, 0x00, 0x01, 0xCC, 0x00, 0x02, 0x00, 0x00, 0x01, 0xEE,
+	0x00, 0x03, 0xFF, 0x00, 0x01, 0xCC, 0x00, 0x02, 0x00, 0x00, 0x01, 0xEE, 0x00, 0x03, 0xFF, 0x00,
+	0x01, 0xCC, 0x00, 0x02, 0x00, 0x00, 0x01, 0xEE, 0x00, 0x03, 0xFF, 0x00, 0x01, 0xCC, 0x00, 0x02,
+	0x00, 0x00, 0x01, 0xEE, 0x00, 0x03, 0xFF, 0x00, 0x01, 0xCC, 0x00, 0x02, 0x00, 0x00, 0x01, 0xEE,
+	0x00, 0x03, 0xFF, 0x00, 0x01, 0xCC, 0x00, 0x02, 0x00, 0x00, 0x01, 0xEE, 0x00, 0x02, 0xFF, 0x1D,
+	0x03, 0x01, 0xFF, 0x00, 0x01, 0x66, 0x00, 0x01, 0x00, 0x00, 0x01, 0x44, 0x00, 0x04, 0xFF, 0x00,
+	0x01, 0x66, 0x00, 0x01, 0x00, 0x00, 0x01, 0x44, 0x00, 0x04, 0xFF, 0x00, 0x01, 0x66, 0x00, 0x01,
+	0x00, 0x00, 0x01, 0x44, 0x00, 0x04, 0xFF, 0x00, 0x01, 0x66, 0x00, 0x01, 0x00, 0x00, 0x01, 0x44,
+	0x00, 0x04, 0xFF, 0x00, 0x01, 0x66, 0x00, 0x01, 0x00, 0x00, 0x01, 0x44, 0x00, 0x04, 0xFF, 0x00,
+	0x01, 0x66, 0x00, 0x01, 0x00, 0x00, 0x01, 0x44, 0x00, 0x04, 0xFF, 0x00, 0x01, 0x66, 0x00, 0x01,
+	0x00, 0x00, 0x01, 0x44, 0x00, 0x03, 0xFF, 0x1D, 0x03, 0x01, 0xFF, 0x00, 0x01, 0x11, 0x00, 0x01,
+	0x00, 0x00, 0x01, 0xAA, 0x00, 0x04, 0xFF, 0x00, 0x01, 0x11, 0x00, 0x01, 0x00, 0x00, 0x01, 0xAA,
+	0x00, 0x04, 0xFF, 0x00, 0x01, 0x11, 0x00, 0x01, 0x00, 0x00, 0x01, 0xAA, 0x00, 0x04, 0xFF, 0x00,
+	0x01, 0x11, 0x00, 0x01, 0x00, 0x00, 0x01, 0xAA, 0x00, 0x04, 0xFF, 0x00, 0x01, 0x11, 0x00, 0x01,
+	0x00, 0x00, 0x01, 0xAA, 0x00, 0x04, 0xFF, 0x00, 0x01, 0x11, 0x00, 0x01, 0x00, 0x00, 0x01, 0xAA,
+	0x00, 0x04, 0xFF, 0x00, 0x01, 0x11, 0x00, 0x01, 0x00, 0x00, 0x01, 0xAA, 0x00, 0x03, 0xFF, 0x15,
+	0x03, 0x01, 0xAA, 0x00, 0x02, 0x00, 0x00, 0x04, 0xFF, 0x00, 0x01, 0xAA, 0x00, 0x02, 0x00, 0x00,
+	0x04, 0xFF, 0x00, 0x01, 0xAA, 0x00, 0x02, 0x00, 0x00, 0x04, 0xFF, 0x00, 0x01, 0xAA, 0x00, 0x02,
+	0x00, 0x00, 0x04, 0xFF, 0x00, 0x01, 0xAA, 0x00, 0x02, 0x00, 0x00, 0x04, 0xFF, 0x00, 0x01, 0xAA,
+	0x00, 0x02, 0x00, 0x00, 0x04, 0xFF, 0x00, 0x01, 0xAA, 0x00, 0x02, 0x00, 0x00, 0x04, 0xFF, 0x1C,
+	0x03, 0x01, 0x44, 0x00, 0x01, 0x00, 0x00, 0x01, 0x66, 0x00, 0x04, 0xFF, 0x00, 0x01, 0x44, 0x00,
+	0x01, 0x00, 0x00, 0x01, 0x66, 0x00, 0x04, 0xFF, 0x00, 0x01, 0x44, 0x00, 0x01, 0x00, 0x00, 0x01,
+	0x66, 0x00, 0x04, 0xFF, 0x00, 0x01, 0x44, 0x00, 0x01, 0x00, 0x00, 0x01, 0x66, 0x00, 0x04, 0xFF,
+	0x00, 0x01, 0x44, 0x00, 0x01, 0x00, 0x00, 0x01, 0x66, 0x00, 0x04, 0xFF, 0x00, 0x01, 0x44, 0x00,
+	0x01, 0x00, 0x00, 0x01, 0x66, 0x00, 0x04, 0xFF, 0x00, 0x01, 0x44, 0x00, 0x01, 0x00, 0x00, 0x01,
+	0x66, 0x00, 0x04, 0xFF,
+};
+constexpr uint8_t IconSprite_10n_L_runs[] = {
+	0x01, 0xBF, 0x07, 0xFF, 0x01, 0xBC, 0x0D, 0xFF, 0x01, 0xBA, 0x11, 0xFF, 0x01, 0xB9, 0x13, 0xFF,
+	0x01, 0xB7, 0x17, 0xFF, 0x01, 0xB6, 0x19, 0xFF, 0x02, 0xB3, 0x03, 0x00, 0x00, 0x19, 0xFF, 0x02,
+	0xB1, 0x04, 0x00, 0x00, 0x1B, 0xFF, 0x02, 0xB0, 0x04, 0x00, 0x00, 0x1D, 0xFF, 0x02, 0xAF, 0x05,
+	0x00, 0x00, 0x1D, 0xFF, 0x02, 0xAE, 0x05, 0x00, 0x00, 0x1F, 0xFF, 0x02, 0xAD, 0x06, 0x00, 0x00,
+	0x1F, 0xFF, 0x02, 0xAD, 0x06, 0x00, 0x00, 0x1F, 0xFF, 0x02, 0xAC, 0x06, 0x00, 0x00, 0x21, 0xFF,
+	0x02, 0xAC, 0x06, 0x00, 0x00, 0x21, 0xFF, 0x02, 0xAC, 0x06, 0x00, 0x00, 0x21, 0xFF, 0x02, 0xAC,
+	0x06, 0x00, 0x00, 0x21, 0xFF, 0x03, 0x69, 0x0B, 0x00, 0x38, 0x06, 0x00, 0x00, 0x21, 0xFF, 0x03,
+	0x64, 0x15, 0x00, 0x33, 0x06, 0x00, 0x00, 0x21, 0xFF, 0x03, 0x62, 0x19, 0x00, 0x31, 0x06, 0x00,
+	0x00, 0x21, 0xFF, 0x03, 0x5F, 0x1F, 0x00, 0x2F, 0x06, 0x00, 0x00, 0x1F, 0xFF, 0x03, 0x5D, 0x23,
+	0x00, 0x2D, 0x06, 0x00, 0x00, 0x1F, 0xFF, 0x05, 0x5C, 0x0D, 0x00, 0x00, 0x0B, 0xFF, 0x00, 0x0D,
+	0x00, 0x2D, 0x05, 0x00, 0x00, 0x1F, 0xFF, 0x05, 0x5A, 0x0B, 0x00, 0x00, 0x13, 0xFF, 0x00, 0x0B,
+	0x00, 0x2C, 0x05, 0x00, 0x00, 0x1D, 0xFF, 0x05, 0x59, 0x0A, 0x00, 0x00, 0x17, 0xFF, 0x00, 0x0A,
+	0x00, 0x2C, 0x04, 0x00, 0x00, 0x1D, 0xFF, 0x05, 0x58, 0x08, 0x00, 0x00, 0x1D, 0xFF, 0x00, 0x08,
+	0x00, 0x2C, 0x04, 0x00, 0x00, 0x1B, 0xFF, 0x05, 0x57, 0x08, 0x00, 0x00, 0x1F, 0xFF, 0x00, 0x08,
+	0x00, 0x2D, 0x03, 0x00, 0x00, 0x19, 0xFF, 0x04, 0x56, 0x07, 0x00, 0x00, 0x23, 0xFF, 0x00, 0x07,
+	0x00, 0x2F, 0x19, 0xFF, 0x04, 0x55, 0x07, 0x00, 0x00, 0x25, 0xFF, 0x00, 0x07, 0x00, 0x2F, 0x17,
+	0xFF, 0x04, 0x54, 0x07, 0x00, 0x00, 0x27, 0xFF, 0x00, 0x07, 0x00, 0x30, 0x13, 0xFF, 0x05, 0x37,
+	0x0B, 0x00, 0x11, 0x07, 0x00, 0x00, 0x29, 0xFF, 0x00, 0x07, 0x00, 0x30, 0x11, 0xFF, 0x05, 0x33,
+	0x13, 0x00, 0x0C, 0x07, 0x00, 0x00, 0x2B, 0xFF, 0x00, 0x07, 0x00, 0x31, 0x0D, 0xFF, 0x05, 0x31,
+	0x17, 0x00, 0x09, 0x07, 0x00, 0x00, 0x2D, 0xFF, 0x00, 0x07, 0x00, 0x33, 0x07, 0xFF, 0x04, 0x2F,
+	0x1B, 0x00, 0x07, 0x06, 0x00, 0x00, 0x2F, 0xFF, 0x00, 0x06, 0x00, 0x04, 0x2D, 0x1F, 0x00, 0x04,
+	0x06, 0x00, 0x00, 0x31, 0xFF, 0x00, 0x06, 0x00, 0x06, 0x2C, 0x0C, 0x00, 0x00, 0x09, 0xFF, 0x00,
+	0x0C, 0x00, 0x02, 0x06, 0x00, 0x00, 0x33, 0xFF, 0x00, 0x06, 0x00, 0x06, 0x2B, 0x09, 0x00, 0x00,
+	0x11, 0xFF, 0x00, 0x09, 0x00, 0x01, 0x06, 0x00, 0x00, 0x33, 0xFF, 0x00, 0x06, 0x00, 0x05, 0x29,
+	0x09, 0x00, 0x00, 0x15, 0xFF, 0x00, 0x0D, 0x00, 0x00, 0x35, 0xFF, 0x00, 0x06, 0x00, 0x05, 0x28,
+	0x08, 0x00, 0x00, 0x19, 0xFF, 0x00, 0x0A, 0x00, 0x00, 0x37, 0xFF, 0x00, 0x05, 0x00, 0x05, 0x27,
+	0x08, 0x00, 0x00, 0x1B, 0xFF, 0x00, 0x09, 0x00, 0x00, 0x37, 0xFF, 0x00, 0x05, 0x00, 0x05, 0x27,
+	0x07, 0x00, 0x00, 0x1D, 0xFF, 0x00, 0x08, 0x00, 0x00, 0x37, 0xFF, 0x00, 0x06, 0x00, 0x05, 0x26,
+	0x06, 0x00, 0x00, 0x21, 0xFF, 0x00, 0x05, 0x00, 0x00, 0x39, 0xFF, 0x00, 0x05, 0x00, 0x05, 0x25,
+	0x06, 0x00, 0x00, 0x23, 0xFF, 0x00, 0x04, 0x00, 0x00, 0x39, 0xFF, 0x00, 0x06, 0x00, 0x05, 0x24,
+	0x07, 0x00, 0x00, 0x23, 0xFF, 0x00, 0x03, 0x00, 0x00, 0x3B, 0xFF, 0x00, 0x05, 0x00, 0x05, 0x24,
+	0x06, 0x00, 0x00, 0x25, 0xFF, 0x00, 0x02, 0x00, 0x00, 0x3B, 0xFF, 0x00, 0x05, 0x00, 0x05, 0x23,
+	0x06, 0x00, 0x00, 0x27, 0xFF, 0x00, 0x01, 0x00, 0x00, 0x3B, 0xFF, 0x00, 0x05, 0x00, 0x03, 0x23,
+	0x05, 0x00, 0x00, 0x64, 0xFF, 0x00, 0x05, 0x00, 0x03, 0x22, 0x06, 0x00, 0x00, 0x65, 0xFF, 0x00,
+	0x05, 0x00, 0x03, 0x22, 0x05, 0x00, 0x00, 0x66, 0xFF, 0x00, 0x05, 0x00, 0x03, 0x21, 0x06, 0x00,
+	0x00, 0x66, 0xFF, 0x00, 0x05, 0x00, 0x03, 0x21, 0x05, 0x00, 0x00, 0x67, 0xFF, 0x00, 0x05, 0x00,
+	0x03, 0x21, 0x05, 0x00, 0x00, 0x67, 0xFF, 0x00, 0x05, 0x00, 0x03, 0x21, 0x05, 0x00, 0x00, 0x67,
+	0xFF, 0x00, 0x05, 0x00, 0x03, 0x20, 0x06, 0x00, 0x00, 0x67, 0xFF, 0x00, 0x05, 0x00, 0x03, 0x20,
+	0x05, 0x00, 0x00, 0x68, 0xFF, 0x00, 0x05, 0x00, 0x03, 0x20, 0x05, 0x00, 0x00, 0x68, 0xFF, 0x00,
+	0x05, 0x00, 0x03, 0x20, 0x05, 0x00, 0x00, 0x68, 0xFF, 0x00, 0x05, 0x00, 0x03, 0x20, 0x05, 0x00,
+	0x00, 0x68, 0xFF, 0x00, 0x05, 0x00, 0x03, 0x10, 0x15, 0x00, 0x00, 0x67, 0xFF, 0x00, 0x05, 0x00,
+	0x03, 0x0D, 0x18, 0x00, 0x00, 0x67, 0xFF, 0x00, 0x08, 0x00, 0x03, 0x0B, 0x1A, 0x00, 0x00, 0x67,
+	0xFF, 0x00, 0x0A, 0x00, 0x03, 0x09, 0x1C, 0x00, 0x00, 0x67, 0xFF, 0x00, 0x0C, 0x00, 0x03, 0x08,
+	0x0E, 0x00, 0x00, 0x76, 0xFF, 0x00, 0x0D, 0x00, 0x03, 0x07, 0x0A, 0x00, 0x00, 0x7F, 0xFF, 0x00,
+	0x0A, 0x00, 0x03, 0x06, 0x08, 0x00, 0x00, 0x85, 0xFF, 0x00, 0x08, 0x00, 0x03, 0x05, 0x07, 0x00,
+	0x00, 0x89, 0xFF, 0x00, 0x07, 0x00, 0x03, 0x04, 0x07, 0x00, 0x00, 0x8B, 0xFF, 0x00, 0x07, 0x00,
+	0x03, 0x03, 0x07, 0x00, 0x00, 0x8D, 0xFF, 0x00, 0x07, 0x00, 0x03, 0x03, 0x06, 0x00, 0x00, 0x8F,
+	0xFF, 0x00, 0x06, 0x00, 0x03, 0x02, 0x06, 0x00, 0x00, 0x91, 0xFF, 0x00, 0x06, 0x00, 0x03, 0x02,
+	0x05, 0x00, 0x00, 0x93, 0xFF, 0x00, 0x05, 0x00, 0x03, 0x01, 0x06, 0x00, 0x00, 0x93, 0xFF, 0x00,
+	0x06, 0x00, 0x03, 0x01, 0x05, 0x00, 0x00, 0x95, 0xFF, 0x00, 0x05, 0x00, 0x03, 0x01, 0x05, 0x00,
+	0x00, 0x95, 0xFF, 0x00, 0x05, 0x00, 0x03, 0x00, 0x06, 0x00, 0x00, 0x95, 0xFF, 0x00, 0x06, 0x00,
+	0x03, 0x00, 0x05, 0x00, 0x00, 0x97, 0xFF, 0x00, 0x05, 0x00, 0x03, 0x00, 0x05, 0x00, 0x00, 0x97,
+	0xFF, 0x00, 0x05, 0x00, 0x03, 0x00, 0x05, 0x00, 0x00, 0x97, 0xFF, 0x00, 0x05, 0x00, 0x03, 0x00,
+	0x05, 0x00, 0x00, 0x97, 0xFF, 0x00, 0x05, 0x00, 0x03, 0x00, 0x05, 0x00, 0x00, 0x97, 0xFF, 0x00,
+	0x05, 0x00, 0x03, 0x00, 0x05, 0x00, 0x00, 0x97, 0xFF, 0x00, 0x05, 0x00, 0x03, 0x00, 0x05, 0x00,
+	0x00, 0x97, 0xFF, 0x00, 0x05, 0x00, 0x03, 0x00, 0x06, 0x00, 0x00, 0x95, 0xFF, 0x00, 0x06, 0x00,
+	0x03, 0x01, 0x05, 0x00, 0x00, 0x95, 0xFF, 0x00, 0x05, 0x00, 0x03, 0x01, 0x05, 0x00, 0x00, 0x95,
+	0xFF, 0x00, 0x05, 0x00, 0x03, 0x01, 0x06, 0x00, 0x00, 0x93, 0xFF, 0x00, 0x06, 0x00, 0x03, 0x02,
+	0x05, 0x00, 0x00, 0x93, 0xFF, 0x00, 0x05, 0x00, 0x03, 0x02, 0x06, 0x00, 0x00, 0x91, 0xFF, 0x00,
+	0x06, 0x00, 0x03, 0x03, 0x06, 0x00, 0x00, 0x8F, 0xFF, 0x00, 0x06, 0x00, 0x03, 0x03, 0x07, 0x00,
+	0x00, 0x8D, 0xFF, 0x00, 0x07, 0x00, 0x03, 0x04, 0x07, 0x00, 0x00, 0x8B, 0xFF, 0x00, 0x07, 0x00,
+	0x03, 0x05, 0x07, 0x00, 0x00, 0x89, 0xFF, 0x00, 0x07, 0x00, 0x03, 0x06, 0x08, 0x00, 0x00, 0x85,
+	0xFF, 0x00, 0x08, 0x00, 0x03, 0x07, 0x0A, 0x00, 0x00, 0x7F, 0xFF, 0x00, 0x0A, 0x00, 0x01, 0x08,
+	0x91, 0x00, 0x01, 0x09, 0x8F, 0x00, 0x01, 0x0B, 0x8B, 0x00, 0x01, 0x0D, 0x87, 0x00, 0x01, 0x10,
+	0x81, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x14, 0x0A, 0xFF, 0x00, 0x01, 0x22, 0x00, 0x04, 0x00,
+	0x00, 0x01, 0xAA, 0x00, 0x0A, 0xFF, 0x00, 0x01, 0x22, 0x00, 0x04, 0x00, 0x00, 0x01, 0xAA, 0x00,
+	0x0A, 0xFF, 0x00, 0x01, 0x22, 0x00, 0x04, 0x00, 0x00, 0x01, 0xAA, 0x00, 0x0A, 0xFF, 0x00, 0x01,
+	0x22, 0x00, 0x04, 0x00, 0x00, 0x01, 0xAA, 0x00, 0x0A, 0xFF, 0x00, 0x01, 0x22, 0x00, 0x04, 0x00,
+	0x00, 0x01, 0xAA, 0x00, 0x0A, 0xFF, 0x00, 0x01, 0x22, 0x00, 0x04, 0x00, 0x00, 0x01, 0xAA, 0x00,
+	0x0A, 0xFF, 0x00, 0x01, 0x22, 0x00, 0x04, 0x00, 0x00, 0x01, 0xAA, 0x1D, 0x14, 0x09, 0xFF, 0x00,
+	0x01, 0xDD, 0x00, 0x04, 0x00, 0x00, 0x01, 0x11, 0x00, 0x0A, 0xFF, 0x00, 0x01, 0xDD, 0x00, 0x04,
+	0x00, 0x00, 0x01, 0x11, 0x00, 0x0A, 0xFF, 0x00, 0x01, 0xDD, 0x00, 0x04, 0x00, 0x00, 0x01, 0x11,
+	0x00, 0x0A, 0xFF, 0x00, 0x01, 0xDD, 0x00, 0x04, 0x00, 0x00, 0x01, 0x11, 0x00, 0x0A, 0xFF, 0x00,
+	0x01, 0xDD, 0x00, 0x04, 0x00, 0x00, 0x01, 0x11, 0x00, 0x0A, 0xFF, 0x00, 0x01, 0xDD, 0x00, 0x04,
+	0x00, 0x00, 0x01, 0x11, 0x00, 0x0A, 0xFF, 0x00, 0x01, 0xDD, 0x00, 0x04, 0x00, 0x00, 0x01, 0x11,
+	0x00, 0x01, 0xFF, 0x1D, 0x14, 0x09, 0xFF, 0x00, 0x01, 0x66, 0x00, 0x04, 0x00, 0x00, 0x01, 0x66,
+	0x00, 0x0A, 0xFF, 0x00, 0x01, 0x66, 0x00, 0x04, 0x00, 0x00, 0x01, 0x66, 0x00, 0x0A, 0xFF, 0x00,
+	0x01, 0x66, 0x00, 0x04, 0x00, 0x00, 0x01, 0x66, 0x00, 0x0A, 0xFF, 0x00, 0x01, 0x66, 0x00, 0x04,
+	0x00, 0x00, 0x01, 0x66, 0x00, 0x0A, 0xFF, 0x00, 0x01, 0x66, 0x00, 0x04, 0x00, 0x00, 0x01, 0x66,
+	0x00, 0x0A, 0xFF, 0x00, 0x01, 0x66, 0x00, 0x04, 0x00, 0x00, 0x01, 0x66, 0x00, 0x0A, 0xFF, 0x00,
+	0x01, 0x66, 0x00, 0x04, 0x00, 0x00, 0x01, 0x66, 0x00, 0x01, 0xFF, 0x1D, 0x14, 0x09, 0xFF, 0x00,
+	0x01, 0x11, 0x00, 0x04, 0x00, 0x00, 0x01, 0xCC, 0x00, 0x0A, 0xFF, 0x00, 0x01, 0x11, 0x00, 0x04,
+	0x00, 0x00, 0x01, 0xCC, 0x00, 0x0A, 0xFF, 0x00, 0x01, 0x11, 0x00, 0x04, 0x00, 0x00, 0x01, 0xCC,
+	0x00, 0x0A, 0xFF, 0x00, 0x01, 0x11, 0x00, 0x04, 0x00, 0x00, 0x01, 0xCC, 0x00, 0x0A, 0xFF, 0x00,
+	0x01, 0x11, 0x00, 0x04, 0x00, 0x00, 0x01, 0xCC, 0x00, 0x0A, 0xFF, 0x00, 0x01, 0x11, 0x00, 0x04,
+	0x00, 0x00, 0x01, 0xCC, 0x00, 0x0A, 0xFF, 0x00, 0x01, 0x11, 0x00, 0x04, 0x00, 0x00, 0x01, 0xCC,
+	0x00, 0x01, 0xFF, 0x1D, 0x14, 0x08, 0xFF, 0x00, 0x01, 0xAA, 0x00, 0x04, 0x00, 0x00, 0x01, 0x22,
+	0x00, 0x0A, 0xFF, 0x00, 0x01, 0xAA, 0x00, 0x04, 0x00, 0x00, 0x01, 0x22, 0x00, 0x0A, 0xFF, 0x00,
+	0x01, 0xAA, 0x00, 0x04, 0x00, 0x00, 0x01, 0x22, 0x00, 0x0A, 0xFF, 0x00, 0x01, 0xAA, 0x00, 0x04,
+	0x00, 0x00, 0x01, 0x22, 0x00, 0x0A, 0xFF, 0x00, 0x01, 0xAA, 0x00, 0x04, 0x00, 0x00, 0x01, 0x22,
+	0x00, 0x0A, 0xFF, 0x00, 0x01, 0xAA, 0x00, 0x04, 0x00, 0x00, 0x01, 0x22, 0x00, 0x0A, 0xFF, 0x00,
+	0x01, 0xAA, 0x00, 0x04, 0x00, 0x00, 0x01, 0x22, 0x00, 0x02, 0xFF, 0x1D, 0x14, 0x08, 0xFF, 0x00,
+	0x01, 0x44, 0x00, 0x04, 0x00, 0x00, 0x01, 0x88, 0x00, 0x0A, 0xFF, 0x00, 0x01, 0x44, 0x00, 0x04,
+	0x00, 0x00, 0x01, 0x88, 0x00, 0x0A, 0xFF, 0x00, 0x01, 0x44, 0x00, 0x04, 0x00, 0x00, 0x01, 0x88,
+	0x00, 0x0A, 0xFF, 0x00, 0x01, 0x44, 0x00, 0x04, 0x00, 0x00, 0x01, 0x88, 0x00, 0x0A, 0xFF, 0x00,
+	0x01, 0x44, 0x00, 0x04, 0x00, 0x00, 0x01, 0x88, 0x00, 0x0A, 0xFF, 0x00, 0x01, 0x44, 0x00, 0x04,
+	0x00, 0x00, 0x01, 0x88, 0x00, 0x0A, 0xFF, 0x00, 0x01, 0x44, 0x00, 0x04, 0x00, 0x00, 0x01, 0x88,
+	0x00, 0x02, 0xFF, 0x1D, 0x14, 0x07, 0xFF, 0x00, 0x01, 0xEE, 0x00, 0x05, 0x00, 0x00, 0x01, 0xEE,
+	0x00, 0x09, 0xFF, 0x00, 0x01, 0xEE, 0x00, 0x05, 0x00, 0x00, 0x01, 0xEE, 0x00, 0x09, 0xFF, 0x00,
+	0x01, 0xEE, 0x00, 0x05, 0x00, 0x00, 0x01, 0xEE, 0x00, 0x09, 0xFF, 0x00, 0x01, 0xEE, 0x00, 0x05,
+	0x00, 0x00, 0x01, 0xEE, 0x00, 0x09, 0xFF, 0x00, 0x01, 0xEE, 0x00, 0x05, 0x00, 0x00, 0x01, 0xEE,
+	0x00, 0x09, 0xFF, 0x00, 0x01, 0xEE, 0x00, 0x05, 0x00, 0x00, 0x01, 0xEE, 0x00, 0x09, 0xFF, 0x00,
+	0x01, 0xEE, 0x00, 0x05, 0x00, 0x00, 0x01, 0xEE, 0x00, 0x02, 0xFF, 0x1D, 0x14, 0x07, 0xFF, 0x00,
+	0x01, 0x99, 0x00, 0x04, 0x00, 0x00, 0x01, 0x44, 0x00, 0x0A, 0xFF, 0x00, 0x01, 0x99, 0x00, 0x04,
+	0x00, 0x00, 0x01, 0x44, 0x00, 0x0A, 0xFF, 0x00, 0x01, 0x99, 0x00, 0x04, 0x00, 0x00, 0x01, 0x44,
+	0x00, 0x0A, 0xFF, 0x00, 0x01, 0x99, 0x00, 0x04, 0x00, 0x00, 0x01, 0x44, 0x00, 0x0A, 0xFF, 0x00,
+	0x01, 0x99, 0x00, 0x04, 0x00, 0x00, 0x01, 0x44, 0x00, 0x0A, 0xFF, 0x00, 0x01, 0x99, 0x00, 0x04,
+	0x00, 0x00, 0x01, 0x44, 0x00, 0x0A, 0xFF, 0x00, 0x01, 0x99, 0x00, 0x04, 0x00, 0x00, 0x01, 0x44,
+	0x00, 0x03, 0xFF, 0x1D, 0x14, 0x07, 0xFF, 0x00, 0x01, 0x33, 0x00, 0x04, 0x00, 0x00, 0x01, 0xAA,
+	0x00, 0x0A, 0xFF, 0x00, 0x01, 0x33, 0x00, 0x04, 0x00, 0x00, 0x01, 0xAA, 0x00, 0x0A, 0xFF, 0x00,
+	0x01, 0x33, 0x00, 0x04, 0x00, 0x00, 0x01, 0xAA, 0x00, 0x0A, 0xFF, 0x00, 0x01, 0x33, 0x00, 0x04,
+	0x00, 0x00, 0x01, 0xAA, 0x00, 0x0A, 0xFF, 0x00, 0x01, 0x33, 0x00, 0x04, 0x00, 0x00, 0x01, 0xAA,
+	0x00, 0x0A, 0xFF, 0x00, 0x01, 0x33, 0x00, 0x04, 0x00, 0x00, 0x01, 0xAA, 0x00, 0x0A, 0xFF, 0x00,
+	0x01, 0x33, 0x00, 0x04, 0x00, 0x00, 0x01, 0xAA, 0x00, 0x03, 0xFF, 0x1D, 0x14, 0x06, 0xFF, 0x00,
+	0x01, 0xDD, 0x00, 0x04, 0x00, 0x00, 0x01, 0x11, 0x00, 0x0A, 0xFF, 0x00, 0x01, 0xDD, 0x00, 0x04,
+	0x00, 0x00, 0x01, 0x11, 0x00, 0x0A, 0xFF, 0x00, 0x01, 0xDD, 0x00, 0x04, 0x00, 0x00, 0x01, 0x11,
+	0x00, 0x0A, 0xFF, 0x00, 0x01, 0xDD, 0x00, 0x04, 0x00, 0x00, 0x01, 0x11, 0x00, 0x0A, 0xFF, 0x00,
+	0x01, 0xDD, 0x00, 0x04, 0x00, 0x00, 0x01, 0x11, 0x00, 0x0A, 0xFF, 0x00, 0x01, 0xDD, 0x00, 0x04,
+	0x00, 0x00, 0x01, 0x11, 0x00, 0x0A, 0xFF, 0x00, 0x01, 0xDD, 0x00, 0x04, 0x00, 0x00, 0x01, 0x11,
+	0x00, 0x04, 0xFF, 0x1D, 0x14, 0x06, 0xFF, 0x00, 0x01, 0x77, 0x00, 0x04, 0x00, 0x00, 0x01, 0x66,
+	0x00, 0x0A, 0xFF, 0x00, 0x01, 0x77, 0x00, 0x04, 0x00, 0x00, 0x01, 0x66, 0x00, 0x0A, 0xFF, 0x00,
+	0x01, 0x77, 0x00, 0x04, 0x00, 0x00, 0x01, 0x66, 0x00, 0x0A, 0xFF, 0x00, 0x01, 0x77, 0x00, 0x04,
+	0x00, 0x00, 0x01, 0x66, 0x00, 0x0A, 0xFF, 0x00, 0x01, 0x77, 0x00, 0x04, 0x00, 0x00, 0x01, 0x66,
+	0x00, 0x0A, 0xFF, 0x00, 0x01, 0x77, 0x00, 0x04, 0x00, 0x00, 0x01, 0x66, 0x00, 0x0A, 0xFF, 0x00,
+	0x01, 0x77, 0x00, 0x04, 0x00, 0x00, 0x01, 0x66, 0x00, 0x04, 0xFF, 0x1D, 0x14, 0x06, 0xFF, 0x00,
+	0x01, 0x11, 0x00, 0x04, 0x00, 0x00, 0x01, 0xCC, 0x00, 0x0A, 0xFF, 0x00, 0x01, 0x11, 0x00, 0x04,
+	0x00, 0x00, 0x01, 0xCC, 0x00, 0x0A, 0xFF, 0x00, 0x01, 0x11, 0x00, 0x04, 0x00, 0x00, 0x01, 0xCC,
+	0x00, 0x0A, 0xFF, 0x00, 0x01, 0x11, 0x00, 0x04, 0x00, 0x00, 0x01, 0xCC, 0x00, 0x0A, 0xFF, 0x00,
+	0x01, 0x11, 0x00, 0x04, 0x00, 0x00, 0x01, 0xCC, 0x00, 0x0A, 0xFF, 0x00, 0x01, 0x11, 0x00, 0x04,
+	0x00, 0x00, 0x01, 0xCC, 0x00, 0x0A, 0xFF, 0x00, 0x01, 0x11, 0x00, 0x04, 0x00, 0x00, 0x01, 0xCC,
+	0x00, 0x04, 0xFF, 0x1D, 0x14, 0x05, 0xFF, 0x00, 0x01, 0xBB, 0x00, 0x04, 0x00, 0x00, 0x01, 0x22,
+	0x00, 0x0A, 0xFF, 0x00, 0x01, 0xBB, 0x00, 0x04, 0x00, 0x00, 0x01, 0x22, 0x00, 0x0A, 0xFF, 0x00,
+	0x01, 0xBB, 0x00, 0x04, 0x00, 0x00, 0x01, 0x22, 0x00, 0x0A, 0xFF, 0x00, 0x01, 0xBB, 0x00, 0x04,
+	0x00, 0x00, 0x01, 0x22, 0x00, 0x0A, 0xFF, 0x00, 0x01, 0xBB, 0x00, 0x04, 0x00, 0x00, 0x01, 0x22,
+	0x00, 0x0A, 0xFF, 0x00, 0x01, 0xBB, 0x00, 0x04, 0x00, 0x00, 0x01, 0x22, 0x00, 0x0A, 0xFF, 0x00,
+	0x01, 0xBB, 0x00, 0x04, 0x00, 0x00, 0x01, 0x22, 0x00, 0x05, 0xFF, 0x1D, 0x14, 0x05, 0xFF, 0x00,
+	0x01, 0x55, 0x00, 0x04, 0x00, 0x00, 0x01, 0x88, 0x00, 0x0A, 0xFF, 0x00, 0x01, 0x55, 0x00, 0x04,
+	0x00, 0x00, 0x01, 0x88, 0x00, 0x0A, 0xFF, 0x00, 0x01, 0x55, 0x00, 0x04, 0x00, 0x00, 0x01, 0x88,
+	0x00, 0x0A, 0xFF, 0x00, 0x01, 0x55, 0x00, 0x04, 0x00, 0x00, 0x01, 0x88, 0x00, 0x0A, 0xFF, 0x00,
+	0x01, 0x55, 0x00, 0x04, 0x00, 0x00, 0x01, 0x88, 0x00, 0x0A, 0xFF, 0x00, 0x01, 0x55, 0x00, 0x04,
+	0x00, 0x00, 0x01, 0x88, 0x00, 0x0A, 0xFF, 0x00, 0x01, 0x55, 0x00, 0x04, 0x00, 0x00, 0x01, 0x88,
+	0x00, 0x05, 0xFF, 0x1D, 0x14, 0x04, 0xFF, 0x00, 0x01, 0xEE, 0x00, 0x05, 0x00, 0x00, 0x01, 0xEE,
+	0x00, 0x09, 0xFF, 0x00, 0x01, 0xEE, 0x00, 0x05, 0x00, 0x00, 0x01, 0xEE, 0x00, 0x09, 0xFF, 0x00,
+	0x01, 0xEE, 0x00, 0x05, 0x00, 0x00, 0x01, 0xEE, 0x00, 0x09, 0xFF, 0x00, 0x01, 0xEE, 0x00, 0x05,
+	0x00, 0x00, 0x01, 0xEE, 0x00, 0x09, 0xFF, 0x00, 0x01, 0xEE, 0x00, 0x05, 0x00, 0x00, 0x01, 0xEE,
+	0x00, 0x09, 0xFF, 0x00, 0x01, 0xEE, 0x00, 0x05, 0x00, 0x00, 0x01, 0xEE, 0x00, 0x09, 0xFF, 0x00,
+	0x01, 0xEE, 0x00, 0x05, 0x00, 0x00, 0x01, 0xEE, 0x00, 0x05, 0xFF, 0x1D, 0x14, 0x04, 0xFF, 0x00,
+	0x01, 0x99, 0x00, 0x04, 0x00, 0x00, 0x01, 0x44, 0x00, 0x0A, 0xFF, 0x00, 0x01, 0x99, 0x00, 0x04,
+	0x00, 0x00, 0x01, 0x44, 0x00, 0x0A, 0xFF, 0x00, 0x01, 0x99, 0x00, 0x04, 0x00, 0x00, 0x01, 0x44,
+	0x00, 0x0A, 0xFF, 0x00, 0x01, 0x99, 0x00, 0x04, 0x00, 0x00, 0x01, 0x44, 0x00, 0x0A, 0xFF, 0x00,
+	0x01, 0x99, 0x00, 0x04, 0x00, 0x00, 0x01, 0x44, 0x00, 0x0A, 0xFF, 0x00, 0x01, 0x99, 0x00, 0x04,
+	0x00, 0x00, 0x01, 0x44, 0x00, 0x0A, 0xFF, 0x00, 0x01, 0x99, 0x00, 0x04, 0x00, 0x00, 0x01, 0x44,
+	0x00, 0x06, 0xFF, 0x1D, 0x14, 0x04, 0xFF, 0x00, 0x01, 0x33, 0x00, 0x04, 0x00, 0x00, 0x01, 0xAA,
+	0x00, 0x0A, 0xFF, 0x00, 0x01, 0x33, 0x00, 0x04, 0x00, 0x00, 0x01, 0xAA, 0x00, 0x0A, 0xFF, 0x00,
+	0x01, 0x33, 0x00, 0x04, 0x00, 0x00, 0x01, 0xAA, 0x00, 0x0A, 0xFF, 0x00, 0x01, 0x33, 0x00, 0x04,
+	0x00, 0x00, 0x01, 0xAA, 0x00, 0x0A, 0xFF, 0x00, 0x01, 0x33, 0x00, 0x04, 0x00, 0x00, 0x01, 0xAA,
+	0x00, 0x0A, 0xFF, 0x00, 0x01, 0x33, 0x00, 0x04, 0x00, 0x00, 0x01, 0xAA, 0x00, 0x0A, 0xFF, 0x00,
+	0x01, 0x33, 0x00, 0x04, 0x00, 0x00, 0x01, 0xAA, 0x00, 0x06, 0xFF, 0x1D, 0x14, 0x03, 0xFF, 0x00,
+	0x01, 0xDD, 0x00, 0x04, 0x00, 0x00, 0x01, 0x11, 0x00, 0x0A, 0xFF, 0x00, 0x01, 0xDD, 0x00, 0x04,
+	0x00, 0x00, 0x01, 0x11, 0x00, 0x0A, 0xFF, 0x00, 0x01, 0xDD, 0x00, 0x04, 0x00, 0x00, 0x01, 0x11,
+	0x00, 0x0A, 0xFF, 0x00, 0x01, 0xDD, 0x00, 0x04, 0x00, 0x00, 0x01, 0x11, 0x00, 0x0A, 0xFF, 0x00,
+	0x01, 0xDD, 0x00, 0x04, 0x00, 0x00, 0x01, 0x11, 0x00, 0x0A, 0xFF, 0x00, 0x01, 0xDD, 0x00, 0x04,
+	0x00, 0x00, 0x01, 0x11, 0x00, 0x0A, 0xFF, 0x00, 0x01, 0xDD, 0x00, 0x04, 0x00, 0x00, 0x01, 0x11,
+	0x00, 0x07, 0xFF, 0x1D, 0x14, 0x03, 0xFF, 0x00, 0x01, 0x77, 0x00, 0x04, 0x00, 0x00, 0x01, 0x66,
+	0x00, 0x0A, 0xFF, 0x00, 0x01, 0x77, 0x00, 0x04, 0x00, 0x00, 0x01, 0x66, 0x00, 0x0A, 0xFF, 0x00,
+	0x01, 0x77, 0x00, 0x04, 0x00, 0x00, 0x01, 0x66, 0x00, 0x0A, 0xFF, 0x00, 0x01, 0x77, 0x00, 0x04,
+	0x00, 0x00, 0x01, 0x66, 0x00, 0x0A, 0xFF, 0x00, 0x01, 0x77, 0x00, 0x04, 0x00, 0x00, 0x01, 0x66,
+	0x00, 0x0A, 0xFF, 0x00, 0x01, 0x77, 0x00, 0x04, 0x00, 0x00, 0x01, 0x66, 0x00, 0x0A, 0xFF, 0x00,
+	0x01, 0x77, 0x00, 0x04, 0x00, 0x00, 0x01, 0x66, 0x00, 0x07, 0xFF, 0x1D, 0x14, 0x03, 0xFF, 0x00,
+	0x01, 0x11, 0x00, 0x04, 0x00, 0x00, 0x01, 0xCC, 0x00, 0x0A, 0xFF, 0x00, 0x01, 0x11, 0x00, 0x04,
+	0x00, 0x00, 0x01, 0xCC, 0x00, 0x0A, 0xFF, 0x00, 0x01, 0x11, 0x00, 0x04, 0x00, 0x00, 0x01, 0xCC,
+	0x00, 0x0A, 0xFF, 0x00, 0x01, 0x11, 0x00, 0x04, 0x00, 0x00, 0x01, 0xCC, 0x00, 0x0A, 0xFF, 0x00,
+	0x01, 0x11, 0x00, 0x04, 0x00, 0x00, 0x01, 0xCC, 0x00, 0x0A, 0xFF, 0x00, 0x01, 0x11, 0x00, 0x04,
+	0x00, 0x00, 0x01, 0xCC, 0x00, 0x0A, 0xFF, 0x00, 0x01, 0x11, 0x00, 0x04, 0x00, 0x00, 0x01, 0xCC,
+	0x00, 0x07, 0xFF, 0x1D, 0x14, 0x02, 0xFF, 0x00, 0x01, 0xBB, 0x00, 0x04, 0x00, 0x00, 0x01, 0x22,
+	0x00, 0x0A, 0xFF, 0x00, 0x01, 0xBB, 0x00, 0x04, 0x00, 0x00, 0x01, 0x22, 0x00, 0x0A, 0xFF, 0x00,
+	0x01, 0xBB, 0x00, 0x04, 0x00, 0x00, 0x01, 0x22, 0x00, 0x0A, 0xFF, 0x00, 0x01, 0xBB, 0x00, 0x04,
+	0x00, 0x00, 0x01, 0x22, 0x00, 0x0A, 0xFF, 0x00, 0x01, 0xBB, 0x00, 0x04, 0x00, 0x00, 0x01, 0x22,
+	0x00, 0x0A, 0xFF, 0x00, 0x01, 0xBB, 0x00, 0x04, 0x00, 0x00, 0x01, 0x22, 0x00, 0x0A, 0xFF, 0x00,
+	0x01, 0xBB, 0x00, 0x04, 0x00, 0x00, 0x01, 0x22, 0x00, 0x08, 0xFF, 0x1D, 0x14, 0x02, 0xFF, 0x00,
+	0x01, 0x55, 0x00, 0x04, 0x00, 0x00, 0x01, 0x88, 0x00, 0x0A, 0xFF, 0x00, 0x01, 0x55, 0x00, 0x04,
+	0x00, 0x00, 0x01, 0x88, 0x00, 0x0A, 0xFF, 0x00, 0x01, 0x55, 0x00, 0x04, 0x00, 0x00, 0x01, 0x88,
+	0x00, 0x0A, 0xFF, 0x00, 0x01, 0x55, 0x00, 0x04, 0x00, 0x00, 0x01, 0x88, 0x00, 0x0A, 0xFF, 0x00,
+	0x01, 0x55, 0x00, 0x04, 0x00, 0x00, 0x01, 0x88, 0x00, 0x0A, 0xFF, 0x00, 0x01, 0x55, 0x00, 0x04,
+	0x00, 0x00, 0x01, 0x88, 0x00, 0x0A, 0xFF, 0x00, 0x01, 0x55, 0x00, 0x04, 0x00, 0x00, 0x01, 0x88,
+	0x00, 0x08, 0xFF, 0x1D, 0x14, 0x01, 0xFF, 0x00, 0x01, 0xEE, 0x00, 0x05, 0x00, 0x00, 0x01, 0xEE,
+	0x00, 0x09, 0xFF, 0x00, 0x01, 0xEE, 0x00, 0x05, 0x00, 0x00, 0x01, 0xEE, 0x00, 0x09, 0xFF, 0x00,
+	0x01, 0xEE, 0x00, 0x05, 0x00, 0x00, 0x01, 0xEE, 0x00, 0x09, 0xFF, 0x00, 0x01, 0xEE, 0x00, 0x05,
+	0x00, 0x00, 0x01, 0xEE, 0x00, 0x09, 0xFF, 0x00, 0x01, 0xEE, 0x00, 0x05, 0x00, 0x00, 0x01, 0xEE,
+	0x00, 0x09, 0xFF, 0x00, 0x01, 0xEE, 0x00, 0x05, 0x00, 0x00, 0x01, 0xEE, 0x00, 0x09, 0xFF, 0x00,
+	0x01, 0xEE, 0x00, 0x05, 0x00, 0x00, 0x01, 0xEE, 0x00, 0x08, 0xFF, 0x1D, 0x14, 0x01, 0xFF, 0x00,
+	0x01, 0x99, 0x00, 0x04, 0x00, 0x00, 0x01, 0x44, 0x00, 0x0A, 0xFF, 0x00, 0x01, 0x99, 0x00, 0x04,
+	0x00, 0x00, 0x01, 0x44, 0x00, 0x0A, 0xFF, 0x00, 0x01, 0x99, 0x00, 0x04, 0x00, 0x00, 0x01, 0x44,
+	0x00, 0x0A, 0xFF, 0x00, 0x01, 0x99, 0x00, 0x04, 0x00, 0x00, 0x01, 0x44, 0x00, 0x0A, 0xFF, 0x00,
+	0x01, 0x99, 0x00, 0x04, 0x00, 0x00, 0x01, 0x44, 0x00, 0x0A, 0xFF, 0x00, 0x01, 0x99, 0x00, 0x04,
+	0x00, 0x00, 0x01, 0x44, 0x00, 0x0A, 0xFF, 0x00, 0x01, 0x99, 0x00, 0x04, 0x00, 0x00, 0x01, 0x44,
+	0x00, 0x09, 0xFF, 0x1D, 0x14, 0x01, 0xFF, 0x00, 0x01, 0x33, 0x00, 0x04, 0x00, 0x00, 0x01, 0xAA,
+	0x00, 0x0A, 0xFF, 0x00, 0x01, 0x33, 0x00, 0x04, 0x00, 0x00, 0x01, 0xAA, 0x00, 0x0A, 0xFF, 0x00,
+	0x01, 0x33, 0x00, 0x04, 0x00, 0x00, 0x01, 0xAA, 0x00, 0x0A, 0xFF, 0x00, 0x01, 0x33, 0x00, 0x04,
+	0x00, 0x00, 0x01, 0xAA, 0x00, 0x0A, 0xFF, 0x00, 0x01, 0x33, 0x00, 0x04, 0x00, 0x00, 0x01, 0xAA,
+	0x00, 0x0A, 0xFF, 0x00, 0x01, 0x33, 0x00, 0x04, 0x00, 0x00, 0x01, 0xAA, 0x00, 0x0A, 0xFF, 0x00,
+	0x01, 0x33, 0x00, 0x04, 0x00, 0x00, 0x01, 0xAA, 0x00, 0x09, 0xFF, 0x1C, 0x14, 0x01, 0xDD, 0x00,
+	0x04, 0x00, 0x00, 0x01, 0x11, 0x00, 0x0A, 0xFF, 0x00, 0x01, 0xDD, 0x00, 0x04, 0x00, 0x00, 0x01,
+	0x11, 0x00, 0x0A, 0xFF, 0x00, 0x01, 0xDD, 0x00, 0x04, 0x00, 0x00, 0x01, 0x11, 0x00, 0x0A, 0xFF,
+	0x00, 0x01, 0xDD, 0x00, 0x04, 0x00, 0x00, 0x01, 0x11, 0x00, 0x0A, 0xFF, 0x00, 0x01, 0xDD, 0x00,
+	0x04, 0x00, 0x00, 0x01, 0x11, 0x00, 0x0A, 0xFF, 0x00, 0x01, 0xDD, 0x00, 0x04, 0x00, 0x00, 0x01,
+	0x11, 0x00, 0x0A, 0xFF, 0x00, 0x01, 0xDD, 0x00, 0x04, 0x00, 0x00, 0x01, 0x11, 0x00, 0x0A, 0xFF,
+	0x1C, 0x14, 0x01, 0x77, 0x00, 0x04, 0x00, 0x00, 0x01, 0x66, 0x00, 0x0A, 0xFF, 0x00, 0x01, 0x77,
+	0x00, 0x04, 0x00, 0x00, 0x01, 0x66, 0x00, 0x0A, 0xFF, 0x00, 0x01, 0x77, 0x00, 0x04, 0x00, 0x00,
+	0x01, 0x66, 0x00, 0x0A, 0xFF, 0x00, 0x01, 0x77, 0x00, 0x04, 0x00, 0x00, 0x01, 0x66, 0x00, 0x0A,
+	0xFF, 0x00, 0x01, 0x77, 0x00, 0x04, 0x00, 0x00, 0x01, 0x66, 0x00, 0x0A, 0xFF, 0x00, 0x01, 0x77,
+	0x00, 0x04, 0x00, 0x00, 0x01, 0x66, 0x00, 0x0A, 0xFF, 0x00, 0x01, 0x77, 0x00, 0x04, 0x00, 0x00,
+	0x01, 0x66, 0x00, 0x0A, 0xFF,
+};
+constexpr uint8_t IconSprite_10n_S_runs[] = {
+	0x01, 0x4A, 0x07, 0xFF, 0x01, 0x47, 0x0D, 0xFF, 0x01, 0x45, 0x11, 0xFF, 0x01, 0x44, 0x13, 0xFF,
+	0x01, 0x42, 0x17, 0xFF, 0x01, 0x41, 0x19, 0xFF, 0x02, 0x3E, 0x03, 0x00, 0x00, 0x19, 0xFF, 0x02,
+	0x3C, 0x04, 0x00, 0x00, 0x1B, 0xFF, 0x02, 0x3B, 0x04, 0x00, 0x00, 0x1D, 0xFF, 0x02, 0x3A, 0x05,
+	0x00, 0x00, 0x1D, 0xFF, 0x02, 0x39, 0x05, 0x00, 0x00, 0x1F, 0xFF, 0x02, 0x38, 0x06, 0x00, 0x00,
+	0x1F, 0xFF, 0x02, 0x38, 0x06, 0x00, 0x00, 0x1F, 0xFF, 0x02, 0x37, 0x06, 0x00, 0x00, 0x21, 0xFF,
+	0x02, 0x37, 0x06, 0x00, 0x00, 0x21, 0xFF, 0x02, 0x37, 0x06, 0x00, 0x00, 0x21, 0xFF, 0x02, 0x37,
+	0x06, 0x00, 0x00, 0x21, 0xFF, 0x02, 0x37, 0x06, 0x00, 0x00, 0x21, 0xFF, 0x02, 0x37, 0x06, 0x00,
+	0x00, 0x21, 0xFF, 0x02, 0x37, 0x06, 0x00, 0x00, 0x21, 0xFF, 0x02, 0x38, 0x06, 0x00, 0x00, 0x1F,
+	0xFF, 0x02, 0x38, 0x06, 0x00, 0x00, 0x1F, 0xFF, 0x02, 0x39, 0x05, 0x00, 0x00, 0x1F, 0xFF, 0x02,
+	0x3A, 0x05, 0x00, 0x00, 0x1D, 0xFF, 0x02, 0x3B, 0x04, 0x00, 0x00, 0x1D, 0xFF, 0x02, 0x3C, 0x04,
+	0x00, 0x00, 0x1B, 0xFF, 0x02, 0x3E, 0x03, 0x00, 0x00, 0x19, 0xFF, 0x01, 0x41, 0x19, 0xFF, 0x01,
+	0x42, 0x17, 0xFF, 0x01, 0x44, 0x13, 0xFF, 0x01, 0x45, 0x11, 0xFF, 0x01, 0x47, 0x0D, 0xFF, 0x01,
+	0x4A, 0x07, 0xFF, 0x00, 0x01, 0x23, 0x07, 0x00, 0x01, 0x21, 0x0B, 0x00, 0x01, 0x1F, 0x0F, 0x00,
+	0x01, 0x1E, 0x11, 0x00, 0x01, 0x1D, 0x13, 0x00, 0x03, 0x1C, 0x08, 0x00, 0x00, 0x05, 0xFF, 0x00,
+	0x08, 0x00, 0x04, 0x13, 0x05, 0x00, 0x04, 0x06, 0x00, 0x00, 0x09, 0xFF, 0x00, 0x06, 0x00, 0x04,
+	0x11, 0x09, 0x00, 0x01, 0x06, 0x00, 0x00, 0x0B, 0xFF, 0x00, 0x06, 0x00, 0x03, 0x0F, 0x11, 0x00,
+	0x00, 0x0D, 0xFF, 0x00, 0x05, 0x00, 0x03, 0x0E, 0x12, 0x00, 0x00, 0x0D, 0xFF, 0x00, 0x06, 0x00,
+	0x03, 0x0E, 0x11, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x05, 0x00, 0x05, 0x0D, 0x07, 0x00, 0x00, 0x03,
+	0xFF, 0x00, 0x08, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x05, 0x00, 0x05, 0x0D, 0x05, 0x00, 0x00, 0x07,
+	0xFF, 0x00, 0x06, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x05, 0x00, 0x05, 0x0C, 0x06, 0x00, 0x00, 0x07,
+	0xFF, 0x00, 0x06, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x05, 0x00, 0x05, 0x0C, 0x05, 0x00, 0x00, 0x09,
+	0xFF, 0x00, 0x05, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x05, 0x00, 0x05, 0x05, 0x0C, 0x00, 0x00, 0x09,
+	0xFF, 0x00, 0x06, 0x00, 0x00, 0x0D, 0xFF, 0x00, 0x07, 0x00, 0x05, 0x03, 0x0E, 0x00, 0x00, 0x09,
+	0xFF, 0x00, 0x06, 0x00, 0x00, 0x0D, 0xFF, 0x00, 0x09, 0x00, 0x05, 0x02, 0x10, 0x00, 0x00, 0x07,
+	0xFF, 0x00, 0x08, 0x00, 0x00, 0x0B, 0xFF, 0x00, 0x0B, 0x00, 0x05, 0x01, 0x11, 0x00, 0x00, 0x07,
+	0xFF, 0x00, 0x09, 0x00, 0x00, 0x09, 0xFF, 0x00, 0x0D, 0x00, 0x03, 0x01, 0x08, 0x00, 0x00, 0x29,
+	0xFF, 0x00, 0x06, 0x00, 0x03, 0x00, 0x06, 0x00, 0x00, 0x2D, 0xFF, 0x00, 0x06, 0x00, 0x03, 0x00,
+	0x05, 0x00, 0x00, 0x2F, 0xFF, 0x00, 0x05, 0x00, 0x03, 0x00, 0x05, 0x00, 0x00, 0x2F, 0xFF, 0x00,
+	0x05, 0x00, 0x03, 0x00, 0x05, 0x00, 0x00, 0x2F, 0xFF, 0x00, 0x05, 0x00, 0x03, 0x00, 0x06, 0x00,
+	0x00, 0x2D, 0xFF, 0x00, 0x06, 0x00, 0x01, 0x01, 0x37, 0x00, 0x01, 0x01, 0x37, 0x00, 0x01, 0x02,
+	0x35, 0x00, 0x01, 0x03, 0x33, 0x00, 0x01, 0x05, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x03,
+	0x04, 0xFF, 0x00, 0x01, 0x77, 0x00, 0x01, 0x00, 0x00, 0x01, 0x44, 0x00, 0x04, 0xFF, 0x00, 0x01,
+	0x77, 0x00, 0x01, 0x00, 0x00, 0x01, 0x44, 0x00, 0x04, 0xFF, 0x00, 0x01, 0x77, 0x00, 0x01, 0x00,
+	0x00, 0x01, 0x44, 0x00, 0x04, 0xFF, 0x00, 0x01, 0x77, 0x00, 0x01, 0x00, 0x00, 0x01, 0x44, 0x00,
+	0x04, 0xFF, 0x00, 0x01, 0x77, 0x00, 0x01, 0x00, 0x00, 0x01, 0x44, 0x00, 0x04, 0xFF, 0x00, 0x01,
+	0x77, 0x00, 0x01, 0x00, 0x00, 0x01, 0x44, 0x00, 0x04, 0xFF, 0x00, 0x01, 0x77, 0x00, 0x01, 0x00,
+	0x00, 0x01, 0x44, 0x1C, 0x03, 0x04, 0xFF, 0x00, 0x01, 0x11, 0x00, 0x01, 0x00, 0x00, 0x01, 0xAA,
+	0x00, 0x04, 0xFF, 0x00, 0x01, 0x11, 0x00, 0x01, 0x00, 0x00, 0x01, 0xAA, 0x00, 0x04, 0xFF, 0x00,
+	0x01, 0x11, 0x00, 0x01, 0x00, 0x00, 0x01, 0xAA, 0x00, 0x04, 0xFF, 0x00, 0x01, 0x11, 0x00, 0x01,
+	0x00, 0x00, 0x01, 0xAA, 0x00, 0x04, 0xFF, 0x00, 0x01, 0x11, 0x00, 0x01, 0x00, 0x00, 0x01, 0xAA,
+	0x00, 0x04, 0xFF, 0x00, 0x01, 0x11, 0x00, 0x01, 0x00, 0x00, 0x01, 0xAA, 0x00, 0x04, 0xFF, 0x00,
+	0x01, 0x11, 0x00, 0x01, 0x00, 0x00, 0x01, 0xAA, 0x16, 0x03, 0x03, 0xFF, 0x00, 0x01, 0xBB, 0x00,
+	0x02, 0x00, 0x00, 0x04, 0xFF, 0x00, 0x01, 0xBB, 0x00, 0x02, 0x00, 0x00, 0x04, 0xFF, 0x00, 0x01,
+	0xBB, 0x00, 0x02, 0x00, 0x00, 0x04, 0xFF, 0x00, 0x01, 0xBB, 0x00, 0x02, 0x00, 0x00, 0x04, 0xFF,
+	0x00, 0x01, 0xBB, 0x00, 0x02, 0x00, 0x00, 0x04, 0xFF, 0x00, 0x01, 0xBB, 0x00, 0x02, 0x00, 0x00,
+	0x04, 0xFF, 0x00, 0x01, 0xBB, 0x00, 0x02, 0x00, 0x00, 0x01, 0xFF, 0x1D, 0x03, 0x03, 0xFF, 0x00,
+	0x01, 0x55, 0x00, 0x01, 0x00, 0x00, 0x01, 0x66, 0x00, 0x04, 0xFF, 0x00, 0x01, 0x55, 0x00, 0x01,
+	0x00, 0x00, 0x01, 0x66, 0x00, 0x04, 0xFF, 0x00, 0x01, 0x55, 0x00, 0x01, 0x00, 0x00, 0x01, 0x66,
+	0x00, 0x04, 0xFF, 0x00, 0x01, 0x55, 0x00, 0x01, 0x00, 0x00, 0x01, 0x66, 0x00, 0x04, 0xFF, 0x00,
+	0x01, 0x55, 0x00, 0x01, 0x00, 0x00, 0x01, 0x66, 0x00, 0x04, 0xFF, 0x00, 0x01, 0x55, 0x00, 0x01,
+	0x00, 0x00, 0x01, 0x66, 0x00, 0x04, 0xFF, 0x00, 0x01, 0x55, 0x00, 0x01, 0x00, 0x00, 0x01, 0x66,
+	0x00, 0x01, 0xFF, 0x1D, 0x03, 0x02, 0xFF, 0x00, 0x01, 0xEE, 0x00, 0x02, 0x00, 0x00, 0x01, 0xCC,
+	0x00, 0x03, 0xFF, 0x00, 0x01, 0xEE, 0x00, 0x02, 0x00, 0x00, 0x01, 0xCC, 0x00, 0x03, 0xFF, 0x00,
+	0x01, 0xEE, 0x00, 0x02, 0x00, 0x00, 0x01, 0xCC, 0x00, 0x03, 0xFF, 0x00, 0x01, 0xEE, 0x00, 0x02,
+	0x00, 0x00, 0x01, 0xCC, 0x00, 0x03, 0xFF, 0x00, 0x01, 0xEE, 0x00, 0x02, 0x00, 0x00, 0x01, 0xCC,
+	0x00, 0x03, 0xFF, 0x00, 0x01, 0xEE, 0x00, 0x02, 0x00, 0x00, 0x01, 0xCC, 0x00, 0x03, 0xFF, 0x00,
+	0x01, 0xEE, 0x00, 0x02, 0x00, 0x00, 0x01, 0xCC, 0x00, 0x01, 0xFF, 0x1D, 0x03, 0x02, 0xFF, 0x00,
+	0x01, 0x88, 0x00, 0x01, 0x00, 0x00, 0x01, 0x22, 0x00, 0x04, 0xFF, 0x00, 0x01, 0x88, 0x00, 0x01,
+	0x00, 0x00, 0x01, 0x22, 0x00, 0x04, 0xFF, 0x00, 0x01, 0x88, 0x00, 0x01, 0x00, 0x00, 0x01, 0x22,
+	0x00, 0x04, 0xFF, 0x00, 0x01, 0x88, 0x00, 0x01, 0x00, 0x00, 0x01, 0x22, 0x00, 0x04, 0xFF, 0x00,
+	0x01, 0x88, 0x00, 0x01, 0x00, 0x00, 0x01, 0x22, 0x00, 0x04, 0xFF, 0x00, 0x01, 0x88, 0x00, 0x01,
+	0x00, 0x00, 0x01, 0x22, 0x00, 0x04, 0xFF, 0x00, 0x01, 0x88, 0x00, 0x01, 0x00, 0x00, 0x01, 0x22,
+	0x00, 0x02, 0xFF, 0x1D, 0x03, 0x02, 0xFF, 0x00, 0x01, 0x22, 0x00, 0x01, 0x00, 0x00, 0x01, 0x88,
+	0x00, 0x04, 0xFF, 0x00, 0x01, 0x22, 0x00, 0x01, 0x00, 0x00, 0x01, 0x88, 0x00, 0x04, 0xFF, 0x00,
+	0x01, 0x22, 0x00, 0x01, 0x00, 0x00, 0x01, 0x88, 0x00, 0x04, 0xFF, 0x00, 0x01, 0x22, 0x00, 0x01,
+	0x00, 0x00, 0x01, 0x88, 0x00, 0x04, 0xFF, 0x00, 0x01, 0x22, 0x00, 0x01, 0x00, 0x00, 0x01, 0x88,
+	0x00, 0x04, 0xFF, 0x00, 0x01, 0x22, 0x00, 0x01, 0x00, 0x00, 0x01, 0x88, 0x00, 0x04, 0xFF, 0x00,
+	0x01, 0x22, 0x00, 0x01, 0x00, 0x00, 0x01, 0x88, 0x00, 0x02, 0xFF, 0x1D, 0x03, 0x01, 0xFF, 0x00,
+	0x01, 0xCC, 0x00, 0x02, 0x00, 0x00, 0x01, 0xEE, 0x00, 0x03, 0xFF, 0x00, 0x01, 0xCC, 0x00, 0x02,
+	0x00, 0x00, 0x01, 0xEE, 0x00, 0x03, 0xFF, 0x00, 0x01, 0xCC, 0x00, 0x02, 0x00, 0x00, 0x01, 0xEE,
+	0x00, 0x03, 0xFF, 0x00, 0x01, 0xCC, 0x00, 0x02, 0x00, 0x00, 0x01, 0xEE, 0x00, 0x03, 0xFF, 0x00,
+	0x01, 0xCC, 0x00, 0x02, 0x00, 0x00, 0x01, 0xEE, 0x00, 0x03, 0xFF, 0x00, 0x01, 0xCC, 0x00, 0x02,
+	0x00, 0x00, 0x01, 0xEE, 0x00, 0x03, 0xFF, 0x00, 0x01, 0xCC, 0x00, 0x02, 0x00, 0x00, 0x01, 0xEE,
+	0x00, 0x02, 0xFF, 0x1D, 0x03, 0x01, 0xFF, 0x00, 0x01, 0x66, 0x00, 0x01, 0x00, 0x00, 0x01, 0x44,
+	0x00, 0x04, 0xFF, 0x00, 0x01, 0x66, 0x00, 0x01, 0x00, 0x00, 0x01, 0x44, 0x00, 0x04, 0xFF, 0x00,
+	0x01, 0x66, 0x00, 0x01, 0x00, 0x00, 0x01, 0x44, 0x00, 0x04, 0xFF, 0x00, 0x01, 0x66, 0x00, 0x01,
+	0x00, 0x00, 0x01, 0x44, 0x00, 0x04, 0xFF, 0x00, 0x01, 0x66, 0x00, 0x01, 0x00, 0x00, 0x01, 0x44,
+	0x00, 0x04, 0xFF, 0x00, 0x01, 0x66, 0x00, 0x01, 0x00, 0x00, 0x01, 0x44, 0x00, 0x04, 0xFF, 0x00,
+	0x01, 0x66, 0x00, 0x01, 0x00, 0x00, 0x01, 0x44, 0x00, 0x03, 0xFF, 0x1D, 0x03, 0x01, 0xFF, 0x00,
+	0x01, 0x11, 0x00, 0x01, 0x00, 0x00, 0x01, 0xAA, 0x00, 0x04, 0xFF, 0x00, 0x01, 0x11, 0x00, 0x01,
+	0x00, 0x00, 0x01, 0xAA, 0x00, 0x04, 0xFF, 0x00, 0x01, 0x11, 0x00, 0x01, 0x00, 0x00, 0x01, 0xAA,
+	0x00, 0x04, 0xFF, 0x00, 0x01, 0x11, 0x00, 0x01, 0x00, 0x00, 0x01, 0xAA, 0x00, 0x04, 0xFF, 0x00,
+	0x01, 0x11, 0x00, 0x01, 0x00, 0x00, 0x01, 0xAA, 0x00, 0x04, 0xFF, 0x00, 0x01, 0x11, 0x00, 0x01,
+	0x00, 0x00, 0x01, 0xAA, 0x00, 0x04, 0xFF, 0x00, 0x01, 0x11, 0x00, 0x01, 0x00, 0x00, 0x01, 0xAA,
+	0x00, 0x03, 0xFF, 0x15, 0x03, 0x01, 0xAA, 0x00, 0x02, 0x00, 0x00, 0x04, 0xFF, 0x00, 0x01, 0xAA,
+	0x00, 0x02, 0x00, 0x00, 0x04, 0xFF, 0x00, 0x01, 0xAA, 0x00, 0x02, 0x00, 0x00, 0x04, 0xFF, 0x00,
+	0x01, 0xAA, 0x00, 0x02, 0x00, 0x00, 0x04, 0xFF, 0x00, 0x01, 0xAA, 0x00, 0x02, 0x00, 0x00, 0x04,
+	0xFF, 0x00, 0x01, 0xAA, 0x00, 0x02, 0x00, 0x00, 0x04, 0xFF, 0x00, 0x01, 0xAA, 0x00, 0x02, 0x00,
+	0x00, 0x04, 0xFF, 0x1C, 0x03, 0x01, 0x44, 0x00, 0x01, 0x00, 0x00, 0x01, 0x66, 0x00, 0x04, 0xFF,
+	0x00, 0x01, 0x44, 0x00, 0x01, 0x00, 0x00, 0x01, 0x66, 0x00, 0x04, 0xFF, 0x00, 0x01, 0x44, 0x00,
+	0x01, 0x00, 0x00, 0x01, 0x66, 0x00, 0x04, 0xFF, 0x00, 0x01, 0x44, 0x00, 0x01, 0x00, 0x00, 0x01,
+	0x66, 0x00, 0x04, 0xFF, 0x00, 0x01, 0x44, 0x00, 0x01, 0x00, 0x00, 0x01, 0x66, 0x00, 0x04, 0xFF,
+	0x00, 0x01, 0x44, 0x00, 0x01, 0x00, 0x00, 0x01, 0x66, 0x00, 0x04, 0xFF, 0x00, 0x01, 0x44, 0x00,
+	0x01, 0x00, 0x00, 0x01, 0x66, 0x00, 0x04, 0xFF,
+};
+constexpr uint8_t IconSprite_11d_L_runs[] = {
+	0x01, 0x69, 0x0B, 0x00, 0x01, 0x64, 0x15, 0x00, 0x01, 0x62, 0x19, 0x00, 0x01, 0x5F, 0x1F, 0x00,
+	0x01, 0x5D, 0x23, 0x00, 0x03, 0x5C, 0x0D, 0x00, 0x00, 0x0B, 0xFF, 0x00, 0x0D, 0x00, 0x03, 0x5A,
+	0x0B, 0x00, 0x00, 0x13, 0xFF, 0x00, 0x0B, 0x00, 0x03, 0x59, 0x0A, 0x00, 0x00, 0x17, 0xFF, 0x00,
+	0x0A, 0x00, 0x03, 0x58, 0x08, 0x00, 0x00, 0x1D, 0xFF, 0x00, 0x08, 0x00, 0x03, 0x57, 0x08, 0x00,
+	0x00, 0x1F, 0xFF, 0x00, 0x08, 0x00, 0x03, 0x56, 0x07, 0x00, 0x00, 0x23, 0xFF, 0x00, 0x07, 0x00,
+	0x03, 0x55, 0x07, 0x00, 0x00, 0x25, 0xFF, 0x00, 0x07, 0x00, 0x03, 0x54, 0x07, 0x00, 0x00, 0x27,
+	0xFF, 0x00, 0x07, 0x00, 0x04, 0x37, 0x0B, 0x00, 0x11, 0x07, 0x00, 0x00, 0x29, 0xFF, 0x00, 0x07,
+	0x00, 0x04, 0x33, 0x13, 0x00, 0x0C, 0x07, 0x00, 0x00, 0x2B, 0xFF, 0x00, 0x07, 0x00, 0x04, 0x31,
+	0x17, 0x00, 0x09, 0x07, 0x00, 0x00, 0x2D, 0xFF, 0x00, 0x07, 0x00, 0x04, 0x2F, 0x1B, 0x00, 0x07,
+	0x06, 0x00, 0x00, 0x2F, 0xFF, 0x00, 0x06, 0x00, 0x04, 0x2D, 0x1F, 0x00, 0x04, 0x06, 0x00, 0x00,
+	0x31, 0xFF, 0x00, 0x06, 0x00, 0x06, 0x2C, 0x0C, 0x00, 0x00, 0x09, 0xFF, 0x00, 0x0C, 0x00, 0x02,
+	0x06, 0x00, 0x00, 0x33, 0xFF, 0x00, 0x06, 0x00, 0x06, 0x2B, 0x09, 0x00, 0x00, 0x11, 0xFF, 0x00,
+	0x09, 0x00, 0x01, 0x06, 0x00, 0x00, 0x33, 0xFF, 0x00, 0x06, 0x00, 0x05, 0x29, 0x09, 0x00, 0x00,
+	0x15, 0xFF, 0x00, 0x0D, 0x00, 0x00, 0x35, 0xFF, 0x00, 0x06, 0x00, 0x05, 0x28, 0x08, 0x00, 0x00,
+	0x19, 0xFF, 0x00, 0x0A, 0x00, 0x00, 0x37, 0xFF, 0x00, 0x05, 0x00, 0x05, 0x27, 0x08, 0x00, 0x00,
+	0x1B, 0xFF, 0x00, 0x09, 0x00, 0x00, 0x37, 0xFF, 0x00, 0x05, 0x00, 0x05, 0x27, 0x07, 0x00, 0x00,
+	0x1D, 0xFF, 0x00, 0x08, 0x00, 0x00, 0x37, 0xFF, 0x00, 0x06, 0x00, 0x05, 0x26, 0x06, 0x00, 0x00,
+	0x21, 0xFF, 0x00, 0x05, 0x00, 0x00, 0x39, 0xFF, 0x00, 0x05, 0x00, 0x05, 0x25, 0x06, 0x00, 0x00,
+	0x23, 0xFF, 0x00, 0x04, 0x00, 0x00, 0x39, 0xFF, 0x00, 0x06, 0x00, 0x05, 0x24, 0x07, 0x00, 0x00,
+	0x23, 0xFF, 0x00, 0x03, 0x00, 0x00, 0x3B, 0xFF, 0x00, 0x05, 0x00, 0x05, 0x24, 0x06, 0x00, 0x00,
+	0x25, 0xFF, 0x00, 0x02, 0x00, 0x00, 0x3B, 0xFF, 0x00, 0x05, 0x00, 0x05, 0x23, 0x06, 0x00, 0x00,
+	0x27, 0xFF, 0x00, 0x01, 0x00, 0x00, 0x3B, 0xFF, 0x00, 0x05, 0x00, 0x03, 0x23, 0x05, 0x00, 0x00,
+	0x64, 0xFF, 0x00, 0x05, 0x00, 0x03, 0x22, 0x06, 0x00, 0x00, 0x65, 0xFF, 0x00, 0x05, 0x00, 0x03,
+	0x22, 0x05, 0x00, 0x00, 0x66, 0xFF, 0x00, 0x05, 0x00, 0x03, 0x21, 0x06, 0x00, 0x00, 0x66, 0xFF,
+	0x00, 0x05, 0x00, 0x03, 0x21, 0x05, 0x00, 0x00, 0x67, 0xFF, 0x00, 0x05, 0x00, 0x03, 0x21, 0x05,
+	0x00, 0x00, 0x67, 0xFF, 0x00, 0x05, 0x00, 0x03, 0x21, 0x05, 0x00, 0x00, 0x67, 0xFF, 0x00, 0x05,
+	0x00, 0x03, 0x20, 0x06, 0x00, 0x00, 0x67, 0xFF, 0x00, 0x05, 0x00, 0x03, 0x20, 0x05, 0x00, 0x00,
+	0x68, 0xFF, 0x00, 0x05, 0x00, 0x03, 0x20, 0x05, 0x00, 0x00, 0x68, 0xFF, 0x00, 0x05, 0x00, 0x03,
+	0x20, 0x05, 0x00, 0x00, 0x68, 0xFF, 0x00, 0x05, 0x00, 0x03, 0x20, 0x05, 0x00, 0x00, 0x68, 0xFF,
+	0x00, 0x05, 0x00, 0x03, 0x10, 0x15, 0x00, 0x00, 0x67, 0xFF, 0x00, 0x05, 0x00, 0x03, 0x0D, 0x18,
+	0x00, 0x00, 0x67, 0xFF, 0x00, 0x08, 0x00, 0x03, 0x0B, 0x1A, 0x00, 0x00, 0x67, 0xFF, 0x00, 0x0A,
+	0x00, 0x03, 0x09, 0x1C, 0x00, 0x00, 0x67, 0xFF, 0x00, 0x0C, 0x00, 0x03, 0x08, 0x0E, 0x00, 0x00,
+	0x76, 0xFF, 0x00, 0x0D, 0x00, 0x03, 0x07, 0x0A, 0x00, 0x00, 0x7F, 0xFF, 0x00, 0x0A, 0x00, 0x03,
+	0x06, 0x08, 0x00, 0x00, 0x85, 0xFF, 0x00, 0x08, 0x00, 0x03, 0x05, 0x07, 0x00, 0x00, 0x89, 0xFF,
+	0x00, 0x07, 0x00, 0x03, 0x04, 0x07, 0x00, 0x00, 0x8B, 0xFF, 0x00, 0x07, 0x00, 0x03, 0x03, 0x07,
+	0x00, 0x00, 0x8D, 0xFF, 0x00, 0x07, 0x00, 0x03, 0x03, 0x06, 0x00, 0x00, 0x8F, 0xFF, 0x00, 0x06,
+	0x00, 0x03, 0x02, 0x06, 0x00, 0x00, 0x91, 0xFF, 0x00, 0x06, 0x00, 0x03, 0x02, 0x05, 0x00, 0x00,
+	0x93, 0xFF, 0x00, 0x05, 0x00, 0x03, 0x01, 0x06, 0x00, 0x00, 0x93, 0xFF, 0x00, 0x06, 0x00, 0x03,
+	0x01, 0x05, 0x00, 0x00, 0x95, 0xFF, 0x00, 0x05, 0x00, 0x03, 0x01, 0x05, 0x00, 0x00, 0x95, 0xFF,
+	0x00, 0x05, 0x00, 0x03, 0x00, 0x06, 0x00, 0x00, 0x95, 0xFF, 0x00, 0x06, 0x00, 0x03, 0x00, 0x05,
+	0x00, 0x00, 0x97, 0xFF, 0x00, 0x05, 0x00, 0x03, 0x00, 0x05, 0x00, 0x00, 0x97, 0xFF, 0x00, 0x05,
+	0x00, 0x03, 0x00, 0x05, 0x00, 0x00, 0x97, 0xFF, 0x00, 0x05, 0x00, 0x03, 0x00, 0x05, 0x00, 0x00,
+	0x97, 0xFF, 0x00, 0x05, 0x00, 0x03, 0x00, 0x05, 0x00, 0x00, 0x97, 0xFF, 0x00, 0x05, 0x00, 0x03,
+	0x00, 0x05, 0x00, 0x00, 0x97, 0xFF, 0x00, 0x05, 0x00, 0x03, 0x00, 0x05, 0x00, 0x00, 0x97, 0xFF,
+	0x00, 0x05, 0x00, 0x03, 0x00, 0x06, 0x00, 0x00, 0x95, 0xFF, 0x00, 0x06, 0x00, 0x03, 0x01, 0x05,
+	0x00, 0x00, 0x95, 0xFF, 0x00, 0x05, 0x00, 0x03, 0x01, 0x05, 0x00, 0x00, 0x95, 0xFF, 0x00, 0x05,
+	0x00, 0x03, 0x01, 0x06, 0x00, 0x00, 0x93, 0xFF, 0x00, 0x06, 0x00, 0x03, 0x02, 0x05, 0x00, 0x00,
+	0x93, 0xFF, 0x00, 0x05, 0x00, 0x03, 0x02, 0x06, 0x00, 0x00, 0x91, 0xFF, 0x00, 0x06, 0x00, 0x03,
+	0x03, 0x06, 0x00, 0x00, 0x8F, 0xFF, 0x00, 0x06, 0x00, 0x03, 0x03, 0x07, 0x00, 0x00, 0x8D, 0xFF,
+	0x00, 0x07, 0x00, 0x03, 0x04, 0x07, 0x00, 0x00, 0x8B, 0xFF, 0x00, 0x07, 0x00, 0x03, 0x05, 0x07,
+	0x00, 0x00, 0x89, 0xFF, 0x00, 0x07, 0x00, 0x03, 0x06, 0x08, 0x00, 0x00, 0x85, 0xFF, 0x00, 0x08,
+	0x00, 0x03, 0x07, 0x0A, 0x00, 0x00, 0x7F, 0xFF, 0x00, 0x0A, 0x00, 0x01, 0x08, 0x91, 0x00, 0x01,
+	0x09, 0x8F, 0x00, 0x01, 0x0B, 0x8B, 0x00, 0x01, 0x0D, 0x87, 0x00, 0x01, 0x10, 0x81, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x28, 0x03, 0x00, 0x1B, 0x03, 0x00, 0x1B,
+	0x03, 0x00, 0x1B, 0x03, 0x00, 0x04, 0x27, 0x03, 0x00, 0x1B, 0x03, 0x00, 0x1B, 0x03, 0x00, 0x1B,
+	0x03, 0x00, 0x04, 0x26, 0x03, 0x00, 0x1B, 0x03, 0x00, 0x1B, 0x03, 0x00, 0x1B, 0x03, 0x00, 0x04,
+	0x25, 0x03, 0x00, 0x1B, 0x03, 0x00, 0x1B, 0x03, 0x00, 0x1B, 0x03, 0x00, 0x04, 0x24, 0x03, 0x00,
+	0x1B, 0x03, 0x00, 0x1B, 0x03, 0x00, 0x1B, 0x03, 0x00, 0x04, 0x23, 0x03, 0x00, 0x1B, 0x03, 0x00,
+	0x1B, 0x03, 0x00, 0x1B, 0x03, 0x00, 0x04, 0x22, 0x03, 0x00, 0x1B, 0x03, 0x00, 0x1B, 0x03, 0x00,
+	0x1B, 0x03, 0x00, 0x04, 0x21, 0x03, 0x00, 0x1B, 0x03, 0x00, 0x1B, 0x03, 0x00, 0x1B, 0x03, 0x00,
+	0x04, 0x20, 0x03, 0x00, 0x1B, 0x03, 0x00, 0x1B, 0x03, 0x00, 0x1B, 0x03, 0x00, 0x04, 0x1F, 0x03,
+	0x00, 0x1B, 0x03, 0x00, 0x1B, 0x03, 0x00, 0x1B, 0x03, 0x00, 0x04, 0x1E, 0x17, 0x00, 0x07, 0x17,
+	0x00, 0x07, 0x17, 0x00, 0x07, 0x17, 0x00, 0x04, 0x1E, 0x16, 0x00, 0x08, 0x16, 0x00, 0x08, 0x16,
+	0x00, 0x08, 0x16, 0x00, 0x04, 0x1E, 0x16, 0x00, 0x08, 0x16, 0x00, 0x08, 0x15, 0x00, 0x09, 0x15,
+	0x00, 0x04, 0x30, 0x03, 0x00, 0x1B, 0x03, 0x00, 0x1B, 0x03, 0x00, 0x1A, 0x03, 0x00, 0x04, 0x30,
+	0x03, 0x00, 0x1A, 0x03, 0x00, 0x1B, 0x03, 0x00, 0x1A, 0x03, 0x00, 0x04, 0x2F, 0x03, 0x00, 0x1B,
+	0x03, 0x00, 0x1A, 0x03, 0x00, 0x1B, 0x03, 0x00, 0x04, 0x2E, 0x03, 0x00, 0x1B, 0x03, 0x00, 0x1A,
+	0x03, 0x00, 0x1B, 0x03, 0x00, 0x04, 0x2E, 0x03, 0x00, 0x1A, 0x03, 0x00, 0x1A, 0x03, 0x00, 0x1B,
+	0x03, 0x00, 0x04, 0x2D, 0x03, 0x00, 0x1A, 0x03, 0x00, 0x1B, 0x03, 0x00, 0x1A, 0x03, 0x00, 0x04,
+	0x2D, 0x03, 0x00, 0x1A, 0x03, 0x00, 0x1A, 0x03, 0x00, 0x1A, 0x03, 0x00, 0x04, 0x2C, 0x03, 0x00,
+	0x1A, 0x03, 0x00, 0x1A, 0x03, 0x00, 0x1A, 0x03, 0x00, 0x04, 0x2B, 0x03, 0x00, 0x1A, 0x03, 0x00,
+	0x1A, 0x03, 0x00, 0x1A, 0x03, 0x00, 0x04, 0x2B, 0x03, 0x00, 0x1A, 0x03, 0x00, 0x19, 0x03, 0x00,
+	0x1A, 0x03, 0x00, 0x04, 0x2A, 0x03, 0x00, 0x1A, 0x03, 0x00, 0x1A, 0x03, 0x00, 0x19, 0x03, 0x00,
+	0x04, 0x2A, 0x03, 0x00, 0x19, 0x03, 0x00, 0x1A, 0x03, 0x00, 0x19, 0x03, 0x00, 0x04, 0x29, 0x03,
+	0x00, 0x1A, 0x03, 0x00, 0x19, 0x03, 0x00, 0x1A, 0x03, 0x00, 0x04, 0x28, 0x03, 0x00, 0x1A, 0x03,
+	0x00, 0x19, 0x03, 0x00, 0x1A, 0x03, 0x00, 0x04, 0x28, 0x03, 0x00, 0x19, 0x03, 0x00, 0x19, 0x03,
+	0x00, 0x1A, 0x03, 0x00, 0x04, 0x27, 0x03, 0x00, 0x19, 0x03, 0x00, 0x1A, 0x03, 0x00, 0x19, 0x03,
+	0x00, 0x04, 0x27, 0x03, 0x00, 0x19, 0x03, 0x00, 0x19, 0x03, 0x00, 0x19, 0x03, 0x00, 0x04, 0x26,
+	0x03, 0x00, 0x19, 0x03, 0x00, 0x19, 0x03, 0x00, 0x19, 0x03, 0x00,
+};
+constexpr uint8_t IconSprite_11d_S_runs[] = {
+	0x01, 0x23, 0x07, 0x00, 0x01, 0x21, 0x0B, 0x00, 0x01, 0x1F, 0x0F, 0x00, 0x01, 0x1E, 0x11, 0x00,
+	0x01, 0x1D, 0x13, 0x00, 0x03, 0x1C, 0x08, 0x00, 0x00, 0x05, 0xFF, 0x00, 0x08, 0x00, 0x04, 0x13,
+	0x05, 0x00, 0x04, 0x06, 0x00, 0x00, 0x09, 0xFF, 0x00, 0x06, 0x00, 0x04, 0x11, 0x09, 0x00, 0x01,
+	0x06, 0x00, 0x00, 0x0B, 0xFF, 0x00, 0x06, 0x00, 0x03, 0x0F, 0x11, 0x00, 0x00, 0x0D, 0xFF, 0x00,
+	0x05, 0x00, 0x03, 0x0E, 0x12, 0x00, 0x00, 0x0D, 0xFF, 0x00, 0x06, 0x00, 0x03, 0x0E, 0x11, 0x00,
+	0x00, 0x0F, 0xFF, 0x00, 0x05, 0x00, 0x05, 0x0D, 0x07, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x08, 0x00,
+	0x00, 0x0F, 0xFF, 0x00, 0x05, 0x00, 0x05, 0x0D, 0x05, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x06, 0x00,
+	0x00, 0x0F, 0xFF, 0x00, 0x05, 0x00, 0x05, 0x0C, 0x06, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x06, 0x00,
+	0x00, 0x0F, 0xFF, 0x00, 0x05, 0x00, 0x05, 0x0C, 0x05, 0x00, 0x00, 0x09, 0xFF, 0x00, 0x05, 0x00,
+	0x00, 0x0F, 0xFF, 0x00, 0x05, 0x00, 0x05, 0x05, 0x0C, 0x00, 0x00, 0x09, 0xFF, 0x00, 0x06, 0x00,
+	0x00, 0x0D, 0xFF, 0x00, 0x07, 0x00, 0x05, 0x03, 0x0E, 0x00, 0x00, 0x09, 0xFF, 0x00, 0x06, 0x00,
+	0x00, 0x0D, 0xFF, 0x00, 0x09, 0x00, 0x05, 0x02, 0x10, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x08, 0x00,
+	0x00, 0x0B, 0xFF, 0x00, 0x0B, 0x00, 0x05, 0x01, 0x11, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x09, 0x00,
+	0x00, 0x09, 0xFF, 0x00, 0x0D, 0x00, 0x03, 0x01, 0x08, 0x00, 0x00, 0x29, 0xFF, 0x00, 0x06, 0x00,
+	0x03, 0x00, 0x06, 0x00, 0x00, 0x2D, 0xFF, 0x00, 0x06, 0x00, 0x03, 0x00, 0x05, 0x00, 0x00, 0x2F,
+	0xFF, 0x00, 0x05, 0x00, 0x03, 0x00, 0x05, 0x00, 0x00, 0x2F, 0xFF, 0x00, 0x05, 0x00, 0x03, 0x00,
+	0x05, 0x00, 0x00, 0x2F, 0xFF, 0x00, 0x05, 0x00, 0x03, 0x00, 0x06, 0x00, 0x00, 0x2D, 0xFF, 0x00,
+	0x06, 0x00, 0x01, 0x01, 0x37, 0x00, 0x01, 0x01, 0x37, 0x00, 0x01, 0x02, 0x35, 0x00, 0x01, 0x03,
+	0x33, 0x00, 0x01, 0x05, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x08, 0x03,
+	0x00, 0x0C, 0x03, 0x00, 0x0C, 0x03, 0x00, 0x0C, 0x03, 0x00, 0x04, 0x07, 0x03, 0x00, 0x0C, 0x03,
+	0x00, 0x0C, 0x03, 0x00, 0x0C, 0x03, 0x00, 0x04, 0x06, 0x03, 0x00, 0x0C, 0x03, 0x00, 0x0C, 0x03,
+	0x00, 0x0C, 0x03, 0x00, 0x04, 0x05, 0x03, 0x00, 0x0C, 0x03, 0x00, 0x0C, 0x03, 0x00, 0x0C, 0x03,
+	0x00, 0x04, 0x04, 0x03, 0x00, 0x0C, 0x03, 0x00, 0x0C, 0x03, 0x00, 0x0C, 0x03, 0x00, 0x04, 0x03,
+	0x0D, 0x00, 0x02, 0x0D, 0x00, 0x02, 0x0D, 0x00, 0x02, 0x0D, 0x00, 0x04, 0x03, 0x0C, 0x00, 0x03,
+	0x0C, 0x00, 0x03, 0x0C, 0x00, 0x03, 0x0C, 0x00, 0x04, 0x03, 0x0C, 0x00, 0x03, 0x0C, 0x00, 0x03,
+	0x0B, 0x00, 0x04, 0x0B, 0x00, 0x04, 0x0B, 0x03, 0x00, 0x0C, 0x03, 0x00, 0x0C, 0x03, 0x00, 0x0B,
+	0x03, 0x00, 0x04, 0x0B, 0x03, 0x00, 0x0B, 0x03, 0x00, 0x0C, 0x03, 0x00, 0x0B, 0x03, 0x00, 0x04,
+	0x0A, 0x03, 0x00, 0x0C, 0x03, 0x00, 0x0B, 0x03, 0x00, 0x0C, 0x03, 0x00, 0x04, 0x09, 0x03, 0x00,
+	0x0C, 0x03, 0x00, 0x0B, 0x03, 0x00, 0x0C, 0x03, 0x00, 0x04, 0x09, 0x03, 0x00, 0x0B, 0x03, 0x00,
+	0x0B, 0x03, 0x00, 0x0C, 0x03, 0x00, 0x04, 0x08, 0x03, 0x00, 0x0B, 0x03, 0x00, 0x0C, 0x03, 0x00,
+	0x0B, 0x03, 0x00, 0x04, 0x08, 0x03, 0x00, 0x0B, 0x03, 0x00, 0x0B, 0x03, 0x00, 0x0B, 0x03, 0x00,
+	0x04, 0x07, 0x03, 0x00, 0x0B, 0x03, 0x00, 0x0B, 0x03, 0x00, 0x0B, 0x03, 0x00,
+};
+constexpr uint8_t IconSprite_11n_L_runs[] = {
+	0x01, 0xBF, 0x07, 0xFF, 0x01, 0xBC, 0x0D, 0xFF, 0x01, 0xBA, 0x11, 0xFF, 0x01, 0xB9, 0x13, 0xFF,
+	0x01, 0xB7, 0x17, 0xFF, 0x01, 0xB6, 0x19, 0xFF, 0x02, 0xB3, 0x03, 0x00, 0x00, 0x19, 0xFF, 0x03,
+	0x69, 0x0B, 0x00, 0x3D, 0x04, 0x00, 0x00, 0x1B, 0xFF, 0x03, 0x64, 0x15, 0x00, 0x37, 0x04, 0x00,
+	0x00, 0x1D, 0xFF, 0x03, 0x62, 0x19, 0x00, 0x34, 0x05, 0x00, 0x00, 0x1D, 0xFF, 0x03, 0x5F, 0x1F,
+	0x00, 0x30, 0x05, 0x00, 0x00, 0x1F, 0xFF, 0x03, 0x5D, 0x23, 0x00, 0x2D, 0x06, 0x00, 0x00, 0x1F,
+	0xFF, 0x05, 0x5C, 0x0D, 0x00, 0x00, 0x0B, 0xFF, 0x00, 0x0D, 0x00, 0x2C, 0x06, 0x00, 0x00, 0x1F,
+	0xFF, 0x05, 0x5A, 0x0B, 0x00, 0x00, 0x13, 0xFF, 0x00, 0x0B, 0x00, 0x29, 0x06, 0x00, 0x00, 0x21,
+	0xFF, 0x05, 0x59, 0x0A, 0x00, 0x00, 0x17, 0xFF, 0x00, 0x0A, 0x00, 0x28, 0x06, 0x00, 0x00, 0x21,
+	0xFF, 0x05, 0x58, 0x08, 0x00, 0x00, 0x1D, 0xFF, 0x00, 0x08, 0x00, 0x27, 0x06, 0x00, 0x00, 0x21,
+	0xFF, 0x05, 0x57, 0x08, 0x00, 0x00, 0x1F, 0xFF, 0x00, 0x08, 0x00, 0x26, 0x06, 0x00, 0x00, 0x21,
+	0xFF, 0x05, 0x56, 0x07, 0x00, 0x00, 0x23, 0xFF, 0x00, 0x07, 0x00, 0x25, 0x06, 0x00, 0x00, 0x21,
+	0xFF, 0x05, 0x55, 0x07, 0x00, 0x00, 0x25, 0xFF, 0x00, 0x07, 0x00, 0x24, 0x06, 0x00, 0x00, 0x21,
+	0xFF, 0x05, 0x54, 0x07, 0x00, 0x00, 0x27, 0xFF, 0x00, 0x07, 0x00, 0x23, 0x06, 0x00, 0x00, 0x21,
+	0xFF, 0x06, 0x37, 0x0B, 0x00, 0x11, 0x07, 0x00, 0x00, 0x29, 0xFF, 0x00, 0x07, 0x00, 0x23, 0x06,
+	0x00, 0x00, 0x1F, 0xFF, 0x06, 0x33, 0x13, 0x00, 0x0C, 0x07, 0x00, 0x00, 0x2B, 0xFF, 0x00, 0x07,
+	0x00, 0x22, 0x06, 0x00, 0x00, 0x1F, 0xFF, 0x06, 0x31, 0x17, 0x00, 0x09, 0x07, 0x00, 0x00, 0x2D,
+	0xFF, 0x00, 0x07, 0x00, 0x22, 0x05, 0x00, 0x00, 0x1F, 0xFF, 0x06, 0x2F, 0x1B, 0x00, 0x07, 0x06,
+	0x00, 0x00, 0x2F, 0xFF, 0x00, 0x06, 0x00, 0x23, 0x05, 0x00, 0x00, 0x1D, 0xFF, 0x06, 0x2D, 0x1F,
+	0x00, 0x04, 0x06, 0x00, 0x00, 0x31, 0xFF, 0x00, 0x06, 0x00, 0x23, 0x04, 0x00, 0x00, 0x1D, 0xFF,
+	0x08, 0x2C, 0x0C, 0x00, 0x00, 0x09, 0xFF, 0x00, 0x0C, 0x00, 0x02, 0x06, 0x00, 0x00, 0x33, 0xFF,
+	0x00, 0x06, 0x00, 0x23, 0x04, 0x00, 0x00, 0x1B, 0xFF, 0x08, 0x2B, 0x09, 0x00, 0x00, 0x11, 0xFF,
+	0x00, 0x09, 0x00, 0x01, 0x06, 0x00, 0x00, 0x33, 0xFF, 0x00, 0x06, 0x00, 0x25, 0x03, 0x00, 0x00,
+	0x19, 0xFF, 0x06, 0x29, 0x09, 0x00, 0x00, 0x15, 0xFF, 0x00, 0x0D, 0x00, 0x00, 0x35, 0xFF, 0x00,
+	0x06, 0x00, 0x27, 0x19, 0xFF, 0x06, 0x28, 0x08, 0x00, 0x00, 0x19, 0xFF, 0x00, 0x0A, 0x00, 0x00,
+	0x37, 0xFF, 0x00, 0x05, 0x00, 0x28, 0x17, 0xFF, 0x06, 0x27, 0x08, 0x00, 0x00, 0x1B, 0xFF, 0x00,
+	0x09, 0x00, 0x00, 0x37, 0xFF, 0x00, 0x05, 0x00, 0x2A, 0x13, 0xFF, 0x06, 0x27, 0x07, 0x00, 0x00,
+	0x1D, 0xFF, 0x00, 0x08, 0x00, 0x00, 0x37, 0xFF, 0x00, 0x06, 0x00, 0x2A, 0x11, 0xFF, 0x06, 0x26,
+	0x06, 0x00, 0x00, 0x21, 0xFF, 0x00, 0x05, 0x00, 0x00, 0x39, 0xFF, 0x00, 0x05, 0x00, 0x2C, 0x0D,
+	0xFF, 0x06, 0x25, 0x06, 0x00, 0x00, 0x23, 0xFF, 0x00, 0x04, 0x00, 0x00, 0x39, 0xFF, 0x00, 0x06,
+	0x00, 0x2E, 0x07, 0xFF, 0x05, 0x24, 0x07, 0x00, 0x00, 0x23, 0xFF, 0x00, 0x03, 0x00, 0x00, 0x3B,
+	0xFF, 0x00, 0x05, 0x00, 0x05, 0x24, 0x06, 0x00, 0x00, 0x25, 0xFF, 0x00, 0x02, 0x00, 0x00, 0x3B,
+	0xFF, 0x00, 0x05, 0x00, 0x05, 0x23, 0x06, 0x00, 0x00, 0x27, 0xFF, 0x00, 0x01, 0x00, 0x00, 0x3B,
+	0xFF, 0x00, 0x05, 0x00, 0x03, 0x23, 0x05, 0x00, 0x00, 0x64, 0xFF, 0x00, 0x05, 0x00, 0x03, 0x22,
+	0x06, 0x00, 0x00, 0x65, 0xFF, 0x00, 0x05, 0x00, 0x03, 0x22, 0x05, 0x00, 0x00, 0x66, 0xFF, 0x00,
+	0x05, 0x00, 0x03, 0x21, 0x06, 0x00, 0x00, 0x66, 0xFF, 0x00, 0x05, 0x00, 0x03, 0x21, 0x05, 0x00,
+	0x00, 0x67, 0xFF, 0x00, 0x05, 0x00, 0x03, 0x21, 0x05, 0x00, 0x00, 0x67, 0xFF, 0x00, 0x05, 0x00,
+	0x03, 0x21, 0x05, 0x00, 0x00, 0x67, 0xFF, 0x00, 0x05, 0x00, 0x03, 0x20, 0x06, 0x00, 0x00, 0x67,
+	0xFF, 0x00, 0x05, 0x00, 0x03, 0x20, 0x05, 0x00, 0x00, 0x68, 0xFF, 0x00, 0x05, 0x00, 0x03, 0x20,
+	0x05, 0x00, 0x00, 0x68, 0xFF, 0x00, 0x05, 0x00, 0x03, 0x20, 0x05, 0x00, 0x00, 0x68, 0xFF, 0x00,
+	0x05, 0x00, 0x03, 0x20, 0x05, 0x00, 0x00, 0x68, 0xFF, 0x00, 0x05, 0x00, 0x03, 0x10, 0x15, 0x00,
+	0x00, 0x67, 0xFF, 0x00, 0x05, 0x00, 0x03, 0x0D, 0x18, 0x00, 0x00, 0x67, 0xFF, 0x00, 0x08, 0x00,
+	0x03, 0x0B, 0x1A, 0x00, 0x00, 0x67, 0xFF, 0x00, 0x0A, 0x00, 0x03, 0x09, 0x1C, 0x00, 0x00, 0x67,
+	0xFF, 0x00, 0x0C, 0x00, 0x03, 0x08, 0x0E, 0x00, 0x00, 0x76, 0xFF, 0x00, 0x0D, 0x00, 0x03, 0x07,
+	0x0A, 0x00, 0x00, 0x7F, 0xFF, 0x00, 0x0A, 0x00, 0x03, 0x06, 0x08, 0x00, 0x00, 0x85, 0xFF, 0x00,
+	0x08, 0x00, 0x03, 0x05, 0x07, 0x00, 0x00, 0x89, 0xFF, 0x00, 0x07, 0x00, 0x03, 0x04, 0x07, 0x00,
+	0x00, 0x8B, 0xFF, 0x00, 0x07, 0x00, 0x03, 0x03, 0x07, 0x00, 0x00, 0x8D, 0xFF, 0x00, 0x07, 0x00,
+	0x03, 0x03, 0x06, 0x00, 0x00, 0x8F, 0xFF, 0x00, 0x06, 0x00, 0x03, 0x02, 0x06, 0x00, 0x00, 0x91,
+	0xFF, 0x00, 0x06, 0x00, 0x03, 0x02, 0x05, 0x00, 0x00, 0x93, 0xFF, 0x00, 0x05, 0x00, 0x03, 0x01,
+	0x06, 0x00, 0x00, 0x93, 0xFF, 0x00, 0x06, 0x00, 0x03, 0x01, 0x05, 0x00, 0x00, 0x95, 0xFF, 0x00,
+	0x05, 0x00, 0x03, 0x01, 0x05, 0x00, 0x00, 0x95, 0xFF, 0x00, 0x05, 0x00, 0x03, 0x00, 0x06, 0x00,
+	0x00, 0x95, 0xFF, 0x00, 0x06, 0x00, 0x03, 0x00, 0x05, 0x00, 0x00, 0x97, 0xFF, 0x00, 0x05, 0x00,
+	0x03, 0x00, 0x05, 0x00, 0x00, 0x97, 0xFF, 0x00, 0x05, 0x00, 0x03, 0x00, 0x05, 0x00, 0x00, 0x97,
+	0xFF, 0x00, 0x05, 0x00, 0x03, 0x00, 0x05, 0x00, 0x00, 0x97, 0xFF, 0x00, 0x05, 0x00, 0x03, 0x00,
+	0x05, 0x00, 0x00, 0x97, 0xFF, 0x00, 0x05, 0x00, 0x03, 0x00, 0x05, 0x00, 0x00, 0x97, 0xFF, 0x00,
+	0x05, 0x00, 0x03, 0x00, 0x05, 0x00, 0x00, 0x97, 0xFF, 0x00, 0x05, 0x00, 0x03, 0x00, 0x06, 0x00,
+	0x00, 0x95, 0xFF, 0x00, 0x06, 0x00, 0x03, 0x01, 0x05, 0x00, 0x00, 0x95, 0xFF, 0x00, 0x05, 0x00,
+	0x03, 0x01, 0x05, 0x00, 0x00, 0x95, 0xFF, 0x00, 0x05, 0x00, 0x03, 0x01, 0x06, 0x00, 0x00, 0x93,
+	0xFF, 0x00, 0x06, 0x00, 0x03, 0x02, 0x05, 0x00, 0x00, 0x93, 0xFF, 0x00, 0x05, 0x00, 0x03, 0x02,
+	0x06, 0x00, 0x00, 0x91, 0xFF, 0x00, 0x06, 0x00, 0x03, 0x03, 0x06, 0x00, 0x00, 0x8F, 0xFF, 0x00,
+	0x06, 0x00, 0x03, 0x03, 0x07, 0x00, 0x00, 0x8D, 0xFF, 0x00, 0x07, 0x00, 0x03, 0x04, 0x07, 0x00,
+	0x00, 0x8B, 0xFF, 0x00, 0x07, 0x00, 0x03, 0x05, 0x07, 0x00, 0x00, 0x89, 0xFF, 0x00, 0x07, 0x00,
+	0x03, 0x06, 0x08, 0x00, 0x00, 0x85, 0xFF, 0x00, 0x08, 0x00, 0x03, 0x07, 0x0A, 0x00, 0x00, 0x7F,
+	0xFF, 0x00, 0x0A, 0x00, 0x01, 0x08, 0x91, 0x00, 0x01, 0x09, 0x8F, 0x00, 0x01, 0x0B, 0x8B, 0x00,
+	0x01, 0x0D, 0x87, 0x00, 0x01, 0x10, 0x81, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x04, 0x28, 0x03, 0x00, 0x1B, 0x03, 0x00, 0x1B, 0x03, 0x00, 0x1B, 0x03, 0x00, 0x04, 0x27,
+	0x03, 0x00, 0x1B, 0x03, 0x00, 0x1B, 0x03, 0x00, 0x1B, 0x03, 0x00, 0x04, 0x26, 0x03, 0x00, 0x1B,
+	0x03, 0x00, 0x1B, 0x03, 0x00, 0x1B, 0x03, 0x00, 0x04, 0x25, 0x03, 0x00, 0x1B, 0x03, 0x00, 0x1B,
+	0x03, 0x00, 0x1B, 0x03, 0x00, 0x04, 0x24, 0x03, 0x00, 0x1B, 0x03, 0x00, 0x1B, 0x03, 0x00, 0x1B,
+	0x03, 0x00, 0x04, 0x23, 0x03, 0x00, 0x1B, 0x03, 0x00, 0x1B, 0x03, 0x00, 0x1B, 0x03, 0x00, 0x04,
+	0x22, 0x03, 0x00, 0x1B, 0x03, 0x00, 0x1B, 0x03, 0x00, 0x1B, 0x03, 0x00, 0x04, 0x21, 0x03, 0x00,
+	0x1B, 0x03, 0x00, 0x1B, 0x03, 0x00, 0x1B, 0x03, 0x00, 0x04, 0x20, 0x03, 0x00, 0x1B, 0x03, 0x00,
+	0x1B, 0x03, 0x00, 0x1B, 0x03, 0x00, 0x04, 0x1F, 0x03, 0x00, 0x1B, 0x03, 0x00, 0x1B, 0x03, 0x00,
+	0x1B, 0x03, 0x00, 0x04, 0x1E, 0x17, 0x00, 0x07, 0x17, 0x00, 0x07, 0x17, 0x00, 0x07, 0x17, 0x00,
+	0x04, 0x1E, 0x16, 0x00, 0x08, 0x16, 0x00, 0x08, 0x16, 0x00, 0x08, 0x16, 0x00, 0x04, 0x1E, 0x16,
+	0x00, 0x08, 0x16, 0x00, 0x08, 0x15, 0x00, 0x09, 0x15, 0x00, 0x04, 0x30, 0x03, 0x00, 0x1B, 0x03,
+	0x00, 0x1B, 0x03, 0x00, 0x1A, 0x03, 0x00, 0x04, 0x30, 0x03, 0x00, 0x1A, 0x03, 0x00, 0x1B, 0x03,
+	0x00, 0x1A, 0x03, 0x00, 0x04, 0x2F, 0x03, 0x00, 0x1B, 0x03, 0x00, 0x1A, 0x03, 0x00, 0x1B, 0x03,
+	0x00, 0x04, 0x2E, 0x03, 0x00, 0x1B, 0x03, 0x00, 0x1A, 0x03, 0x00, 0x1B, 0x03, 0x00, 0x04, 0x2E,
+	0x03, 0x00, 0x1A, 0x03, 0x00, 0x1A, 0x03, 0x00, 0x1B, 0x03, 0x00, 0x04, 0x2D, 0x03, 0x00, 0x1A,
+	0x03, 0x00, 0x1B, 0x03, 0x00, 0x1A, 0x03, 0x00, 0x04, 0x2D, 0x03, 0x00, 0x1A, 0x03, 0x00, 0x1A,
+	0x03, 0x00, 0x1A, 0x03, 0x00, 0x04, 0x2C, 0x03, 0x00, 0x1A, 0x03, 0x00, 0x1A, 0x03, 0x00, 0x1A,
+	0x03, 0x00, 0x04, 0x2B, 0x03, 0x00, 0x1A, 0x03, 0x00, 0x1A, 0x03, 0x00, 0x1A, 0x03, 0x00, 0x04,
+	0x2B, 0x03, 0x00, 0x1A, 0x03, 0x00, 0x19, 0x03, 0x00, 0x1A, 0x03, 0x00, 0x04, 0x2A, 0x03, 0x00,
+	0x1A, 0x03, 0x00, 0x1A, 0x03, 0x00, 0x19, 0x03, 0x00, 0x04, 0x2A, 0x03, 0x00, 0x19, 0x03, 0x00,
+	0x1A, 0x03, 0x00, 0x19, 0x03, 0x00, 0x04, 0x29, 0x03, 0x00, 0x1A, 0x03, 0x00, 0x19, 0x03, 0x00,
+	0x1A, 0x03, 0x00, 0x04, 0x28, 0x03, 0x00, 0x1A, 0x03, 0x00, 0x19, 0x03, 0x00, 0x1A, 0x03, 0x00,
+	0x04, 0x28, 0x03, 0x00, 0x19, 0x03, 0x00, 0x19, 0x03, 0x00, 0x1A, 0x03, 0x00, 0x04, 0x27, 0x03,
+	0x00, 0x19, 0x03, 0x00, 0x1A, 0x03, 0x00, 0x19, 0x03, 0x00, 0x04, 0x27, 0x03, 0x00, 0x19, 0x03,
+	0x00, 0x19, 0x03, 0x00, 0x19, 0x03, 0x00, 0x04, 0x26, 0x03, 0x00, 0x19, 0x03, 0x00, 0x19, 0x03,
+	0x00, 0x19, 0x03, 0x00,
+};
+constexpr uint8_t IconSprite_11n_S_runs[] = {
+	0x01, 0x4A, 0x07, 0xFF, 0x01, 0x47, 0x0D, 0xFF, 0x01, 0x45, 0x11, 0xFF, 0x01, 0x44, 0x13, 0xFF,
+	0x01, 0x42, 0x17, 0xFF, 0x01, 0x41, 0x19, 0xFF, 0x02, 0x3E, 0x03, 0x00, 0x00, 0x19, 0xFF, 0x02,
+	0x3C, 0x04, 0x00, 0x00, 0x1B, 0xFF, 0x02, 0x3B, 0x04, 0x00, 0x00, 0x1D, 0xFF, 0x02, 0x3A, 0x05,
+	0x00, 0x00, 0x1D, 0xFF, 0x02, 0x39, 0x05, 0x00, 0x00, 0x1F, 0xFF, 0x02, 0x38, 0x06, 0x00, 0x00,
+	0x1F, 0xFF, 0x02, 0x38, 0x06, 0x00, 0x00, 0x1F, 0xFF, 0x02, 0x37, 0x06, 0x00, 0x00, 0x21, 0xFF,
+	0x02, 0x37, 0x06, 0x00, 0x00, 0x21, 0xFF, 0x02, 0x37, 0x06, 0x00, 0x00, 0x21, 0xFF, 0x02, 0x37,
+	0x06, 0x00, 0x00, 0x21, 0xFF, 0x02, 0x37, 0x06, 0x00, 0x00, 0x21, 0xFF, 0x02, 0x37, 0x06, 0x00,
+	0x00, 0x21, 0xFF, 0x02, 0x37, 0x06, 0x00, 0x00, 0x21, 0xFF, 0x02, 0x38, 0x06, 0x00, 0x00, 0x1F,
+	0xFF, 0x02, 0x38, 0x06, 0x00, 0x00, 0x1F, 0xFF, 0x02, 0x39, 0x05, 0x00, 0x00, 0x1F, 0xFF, 0x02,
+	0x3A, 0x05, 0x00, 0x00, 0x1D, 0xFF, 0x03, 0x23, 0x07, 0x00, 0x11, 0x04, 0x00, 0x00, 0x1D, 0xFF,
+	0x03, 0x21, 0x0B, 0x00, 0x10, 0x04, 0x00, 0x00, 0x1B, 0xFF, 0x03, 0x1F, 0x0F, 0x00, 0x10, 0x03,
+	0x00, 0x00, 0x19, 0xFF, 0x02, 0x1E, 0x11, 0x00, 0x12, 0x19, 0xFF, 0x02, 0x1D, 0x13, 0x00, 0x12,
+	0x17, 0xFF, 0x04, 0x1C, 0x08, 0x00, 0x00, 0x05, 0xFF, 0x00, 0x08, 0x00, 0x13, 0x13, 0xFF, 0x05,
+	0x13, 0x05, 0x00, 0x04, 0x06, 0x00, 0x00, 0x09, 0xFF, 0x00, 0x06, 0x00, 0x14, 0x11, 0xFF, 0x05,
+	0x11, 0x09, 0x00, 0x01, 0x06, 0x00, 0x00, 0x0B, 0xFF, 0x00, 0x06, 0x00, 0x15, 0x0D, 0xFF, 0x04,
+	0x0F, 0x11, 0x00, 0x00, 0x0D, 0xFF, 0x00, 0x05, 0x00, 0x18, 0x07, 0xFF, 0x03, 0x0E, 0x12, 0x00,
+	0x00, 0x0D, 0xFF, 0x00, 0x06, 0x00, 0x03, 0x0E, 0x11, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x05, 0x00,
+	0x05, 0x0D, 0x07, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x08, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x05, 0x00,
+	0x05, 0x0D, 0x05, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x06, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x05, 0x00,
+	0x05, 0x0C, 0x06, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x06, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x05, 0x00,
+	0x05, 0x0C, 0x05, 0x00, 0x00, 0x09, 0xFF, 0x00, 0x05, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x05, 0x00,
+	0x05, 0x05, 0x0C, 0x00, 0x00, 0x09, 0xFF, 0x00, 0x06, 0x00, 0x00, 0x0D, 0xFF, 0x00, 0x07, 0x00,
+	0x05, 0x03, 0x0E, 0x00, 0x00, 0x09, 0xFF, 0x00, 0x06, 0x00, 0x00, 0x0D, 0xFF, 0x00, 0x09, 0x00,
+	0x05, 0x02, 0x10, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x08, 0x00, 0x00, 0x0B, 0xFF, 0x00, 0x0B, 0x00,
+	0x05, 0x01, 0x11, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x09, 0x00, 0x00, 0x09, 0xFF, 0x00, 0x0D, 0x00,
+	0x03, 0x01, 0x08, 0x00, 0x00, 0x29, 0xFF, 0x00, 0x06, 0x00, 0x03, 0x00, 0x06, 0x00, 0x00, 0x2D,
+	0xFF, 0x00, 0x06, 0x00, 0x03, 0x00, 0x05, 0x00, 0x00, 0x2F, 0xFF, 0x00, 0x05, 0x00, 0x03, 0x00,
+	0x05, 0x00, 0x00, 0x2F, 0xFF, 0x00, 0x05, 0x00, 0x03, 0x00, 0x05, 0x00, 0x00, 0x2F, 0xFF, 0x00,
+	0x05, 0x00, 0x03, 0x00, 0x06, 0x00, 0x00, 0x2D, 0xFF, 0x00, 0x06, 0x00, 0x01, 0x01, 0x37, 0x00,
+	0x01, 0x01, 0x37, 0x00, 0x01, 0x02, 0x35, 0x00, 0x01, 0x03, 0x33, 0x00, 0x01, 0x05, 0x2F, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x08, 0x03, 0x00, 0x0C, 0x03, 0x00, 0x0C, 0x03,
+	0x00, 0x0C, 0x03, 0x00, 0x04, 0x07, 0x03, 0x00, 0x0C, 0x03, 0x00, 0x0C, 0x03, 0x00, 0x0C, 0x03,
+	0x00, 0x04, 0x06, 0x03, 0x00, 0x0C, 0x03, 0x00, 0x0C, 0x03, 0x00, 0x0C, 0x03, 0x00, 0x04, 0x05,
+	0x03, 0x00, 0x0C, 0x03, 0x00, 0x0C, 0x03, 0x00, 0x0C, 0x03, 0x00, 0x04, 0x04, 0x03, 0x00, 0x0C,
+	0x03, 0x00, 0x0C, 0x03, 0x00, 0x0C, 0x03, 0x00, 0x04, 0x03, 0x0D, 0x00, 0x02, 0x0D, 0x00, 0x02,
+	0x0D, 0x00, 0x02, 0x0D, 0x00, 0x04, 0x03, 0x0C, 0x00, 0x03, 0x0C, 0x00, 0x03, 0x0C, 0x00, 0x03,
+	0x0C, 0x00, 0x04, 0x03, 0x0C, 0x00, 0x03, 0x0C, 0x00, 0x03, 0x0B, 0x00, 0x04, 0x0B, 0x00, 0x04,
+	0x0B, 0x03, 0x00, 0x0C, 0x03, 0x00, 0x0C, 0x03, 0x00, 0x0B, 0x03, 0x00, 0x04, 0x0B, 0x03, 0x00,
+	0x0B, 0x03, 0x00, 0x0C, 0x03, 0x00, 0x0B, 0x03, 0x00, 0x04, 0x0A, 0x03, 0x00, 0x0C, 0x03, 0x00,
+	0x0B, 0x03, 0x00, 0x0C, 0x03, 0x00, 0x04, 0x09, 0x03, 0x00, 0x0C, 0x03, 0x00, 0x0B, 0x03, 0x00,
+	0x0C, 0x03, 0x00, 0x04, 0x09, 0x03, 0x00, 0x0B, 0x03, 0x00, 0x0B, 0x03, 0x00, 0x0C, 0x03, 0x00,
+	0x04, 0x08, 0x03, 0x00, 0x0B, 0x03, 0x00, 0x0C, 0x03, 0x00, 0x0B, 0x03, 0x00, 0x04, 0x08, 0x03,
+	0x00, 0x0B, 0x03, 0x00, 0x0B, 0x03, 0x00, 0x0B, 0x03, 0x00, 0x04, 0x07, 0x03, 0x00, 0x0B, 0x03,
+	0x00, 0x0B, 0x03, 0x00, 0x0B, 0x03, 0x00,
+};
+constexpr uint8_t IconSprite_13d_L_runs[] = {
+	0x01, 0x69, 0x0B, 0x00, 0x01, 0x64, 0x15, 0x00, 0x01, 0x62, 0x19, 0x00, 0x01, 0x5F, 0x1F, 0x00,
+	0x01, 0x5D, 0x23, 0x00, 0x03, 0x5C, 0x0D, 0x00, 0x00, 0x0B, 0xFF, 0x00, 0x0D, 0x00, 0x03, 0x5A,
+	0x0B, 0x00, 0x00, 0x13, 0xFF, 0x00, 0x0B, 0x00, 0x03, 0x59, 0x0A, 0x00, 0x00, 0x17, 0xFF, 0x00,
+	0x0A, 0x00, 0x03, 0x58, 0x08, 0x00, 0x00, 0x1D, 0xFF, 0x00, 0x08, 0x00, 0x03, 0x57, 0x08, 0x00,
+	0x00, 0x1F, 0xFF, 0x00, 0x08, 0x00, 0x03, 0x56, 0x07, 0x00, 0x00, 0x23, 0xFF, 0x00, 0x07, 0x00,
+	0x03, 0x55, 0x07, 0x00, 0x00, 0x25, 0xFF, 0x00, 0x07, 0x00, 0x03, 0x54, 0x07, 0x00, 0x00, 0x27,
+	0xFF, 0x00, 0x07, 0x00, 0x04, 0x37, 0x0B, 0x00, 0x11, 0x07, 0x00, 0x00, 0x29, 0xFF, 0x00, 0x07,
+	0x00, 0x04, 0x33, 0x13, 0x00, 0x0C, 0x07, 0x00, 0x00, 0x2B, 0xFF, 0x00, 0x07, 0x00, 0x04, 0x31,
+	0x17, 0x00, 0x09, 0x07, 0x00, 0x00, 0x2D, 0xFF, 0x00, 0x07, 0x00, 0x04, 0x2F, 0x1B, 0x00, 0x07,
+	0x06, 0x00, 0x00, 0x2F, 0xFF, 0x00, 0x06, 0x00, 0x04, 0x2D, 0x1F, 0x00, 0x04, 0x06, 0x00, 0x00,
+	0x31, 0xFF, 0x00, 0x06, 0x00, 0x06, 0x2C, 0x0C, 0x00, 0x00, 0x09, 0xFF, 0x00, 0x0C, 0x00, 0x02,
+	0x06, 0x00, 0x00, 0x33, 0xFF, 0x00, 0x06, 0x00, 0x06, 0x2B, 0x09, 0x00, 0x00, 0x11, 0xFF, 0x00,
+	0x09, 0x00, 0x01, 0x06, 0x00, 0x00, 0x33, 0xFF, 0x00, 0x06, 0x00, 0x05, 0x29, 0x09, 0x00, 0x00,
+	0x15, 0xFF, 0x00, 0x0D, 0x00, 0x00, 0x35, 0xFF, 0x00, 0x06, 0x00, 0x05, 0x28, 0x08, 0x00, 0x00,
+	0x19, 0xFF, 0x00, 0x0A, 0x00, 0x00, 0x37, 0xFF, 0x00, 0x05, 0x00, 0x05, 0x27, 0x08, 0x00, 0x00,
+	0x1B, 0xFF, 0x00, 0x09, 0x00, 0x00, 0x37, 0xFF, 0x00, 0x05, 0x00, 0x05, 0x27, 0x07, 0x00, 0x00,
+	0x1D, 0xFF, 0x00, 0x08, 0x00, 0x00, 0x37, 0xFF, 0x00, 0x06, 0x00, 0x05, 0x26, 0x06, 0x00, 0x00,
+	0x21, 0xFF, 0x00, 0x05, 0x00, 0x00, 0x39, 0xFF, 0x00, 0x05, 0x00, 0x05, 0x25, 0x06, 0x00, 0x00,
+	0x23, 0xFF, 0x00, 0x04, 0x00, 0x00, 0x39, 0xFF, 0x00, 0x06, 0x00, 0x05, 0x24, 0x07, 0x00, 0x00,
+	0x23, 0xFF, 0x00, 0x03, 0x00, 0x00, 0x3B, 0xFF, 0x00, 0x05, 0x00, 0x05, 0x24, 0x06, 0x00, 0x00,
+	0x25, 0xFF, 0x00, 0x02, 0x00, 0x00, 0x3B, 0xFF, 0x00, 0x05, 0x00, 0x05, 0x23, 0x06, 0x00, 0x00,
+	0x27, 0xFF, 0x00, 0x01, 0x00, 0x00, 0x3B, 0xFF, 0x00, 0x05, 0x00, 0x03, 0x23, 0x05, 0x00, 0x00,
+	0x64, 0xFF, 0x00, 0x05, 0x00, 0x03, 0x22, 0x06, 0x00, 0x00, 0x65, 0xFF, 0x00, 0x05, 0x00, 0x03,
+	0x22, 0x05, 0x00, 0x00, 0x66, 0xFF, 0x00, 0x05, 0x00, 0x03, 0x21, 0x06, 0x00, 0x00, 0x66, 0xFF,
+	0x00, 0x05, 0x00, 0x03, 0x21, 0x05, 0x00, 0x00, 0x67, 0xFF, 0x00, 0x05, 0x00, 0x03, 0x21, 0x05,
+	0x00, 0x00, 0x67, 0xFF, 0x00, 0x05, 0x00, 0x03, 0x21, 0x05, 0x00, 0x00, 0x67, 0xFF, 0x00, 0x05,
+	0x00, 0x03, 0x20, 0x06, 0x00, 0x00, 0x67, 0xFF, 0x00, 0x05, 0x00, 0x03, 0x20, 0x05, 0x00, 0x00,
+	0x68, 0xFF, 0x00, 0x05, 0x00, 0x03, 0x20, 0x05, 0x00, 0x00, 0x68, 0xFF, 0x00, 0x05, 0x00, 0x03,
+	0x20, 0x05, 0x00, 0x00, 0x68, 0xFF, 0x00, 0x05, 0x00, 0x03, 0x20, 0x05, 0x00, 0x00, 0x68, 0xFF,
+	0x00, 0x05, 0x00, 0x03, 0x10, 0x15, 0x00, 0x00, 0x67, 0xFF, 0x00, 0x05, 0x00, 0x03, 0x0D, 0x18,
+	0x00, 0x00, 0x67, 0xFF, 0x00, 0x08, 0x00, 0x03, 0x0B, 0x1A, 0x00, 0x00, 0x67, 0xFF, 0x00, 0x0A,
+	0x00, 0x03, 0x09, 0x1C, 0x00, 0x00, 0x67, 0xFF, 0x00, 0x0C, 0x00, 0x03, 0x08, 0x0E, 0x00, 0x00,
+	0x76, 0xFF, 0x00, 0x0D, 0x00, 0x03, 0x07, 0x0A, 0x00, 0x00, 0x7F, 0xFF, 0x00, 0x0A, 0x00, 0x03,
+	0x06, 0x08, 0x00, 0x00, 0x85, 0xFF, 0x00, 0x08, 0x00, 0x03, 0x05, 0x07, 0x00, 0x00, 0x89, 0xFF,
+	0x00, 0x07, 0x00, 0x03, 0x04, 0x07, 0x00, 0x00, 0x8B, 0xFF, 0x00, 0x07, 0x00, 0x03, 0x03, 0x07,
+	0x00, 0x00, 0x8D, 0xFF, 0x00, 0x07, 0x00, 0x03, 0x03, 0x06, 0x00, 0x00, 0x8F, 0xFF, 0x00, 0x06,
+	0x00, 0x03, 0x02, 0x06, 0x00, 0x00, 0x91, 0xFF, 0x00, 0x06, 0x00, 0x03, 0x02, 0x05, 0x00, 0x00,
+	0x93, 0xFF, 0x00, 0x05, 0x00, 0x03, 0x01, 0x06, 0x00, 0x00, 0x93, 0xFF, 0x00, 0x06, 0x00, 0x03,
+	0x01, 0x05, 0x00, 0x00, 0x95, 0xFF, 0x00, 0x05, 0x00, 0x03, 0x01, 0x05, 0x00, 0x00, 0x95, 0xFF,
+	0x00, 0x05, 0x00, 0x03, 0x00, 0x06, 0x00, 0x00, 0x95, 0xFF, 0x00, 0x06, 0x00, 0x03, 0x00, 0x05,
+	0x00, 0x00, 0x97, 0xFF, 0x00, 0x05, 0x00, 0x03, 0x00, 0x05, 0x00, 0x00, 0x97, 0xFF, 0x00, 0x05,
+	0x00, 0x03, 0x00, 0x05, 0x00, 0x00, 0x97, 0xFF, 0x00, 0x05, 0x00, 0x03, 0x00, 0x05, 0x00, 0x00,
+	0x97, 0xFF, 0x00, 0x05, 0x00, 0x03, 0x00, 0x05, 0x00, 0x00, 0x97, 0xFF, 0x00, 0x05, 0x00, 0x03,
+	0x00, 0x05, 0x00, 0x00, 0x97, 0xFF, 0x00, 0x05, 0x00, 0x03, 0x00, 0x05, 0x00, 0x00, 0x97, 0xFF,
+	0x00, 0x05, 0x00, 0x03, 0x00, 0x06, 0x00, 0x00, 0x95, 0xFF, 0x00, 0x06, 0x00, 0x03, 0x01, 0x05,
+	0x00, 0x00, 0x95, 0xFF, 0x00, 0x05, 0x00, 0x03, 0x01, 0x05, 0x00, 0x00, 0x95, 0xFF, 0x00, 0x05,
+	0x00, 0x03, 0x01, 0x06, 0x00, 0x00, 0x93, 0xFF, 0x00, 0x06, 0x00, 0x03, 0x02, 0x05, 0x00, 0x00,
+	0x93, 0xFF, 0x00, 0x05, 0x00, 0x03, 0x02, 0x06, 0x00, 0x00, 0x91, 0xFF, 0x00, 0x06, 0x00, 0x03,
+	0x03, 0x06, 0x00, 0x00, 0x8F, 0xFF, 0x00, 0x06, 0x00, 0x03, 0x03, 0x07, 0x00, 0x00, 0x8D, 0xFF,
+	0x00, 0x07, 0x00, 0x03, 0x04, 0x07, 0x00, 0x00, 0x8B, 0xFF, 0x00, 0x07, 0x00, 0x03, 0x05, 0x07,
+	0x00, 0x00, 0x89, 0xFF, 0x00, 0x07, 0x00, 0x03, 0x06, 0x08, 0x00, 0x00, 0x85, 0xFF, 0x00, 0x08,
+	0x00, 0x03, 0x07, 0x0A, 0x00, 0x00, 0x7F, 0xFF, 0x00, 0x0A, 0x00, 0x01, 0x08, 0x91, 0x00, 0x01,
+	0x09, 0x8F, 0x00, 0x01, 0x0B, 0x8B, 0x00, 0x01, 0x0D, 0x87, 0x00, 0x01, 0x10, 0x81, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x15, 0x07, 0xFF, 0x00, 0x04, 0x00, 0x00,
+	0x01, 0x44, 0x00, 0x07, 0xFF, 0x0C, 0x07, 0xFF, 0x00, 0x04, 0x00, 0x00, 0x01, 0x44, 0x00, 0x07,
+	0xFF, 0x0C, 0x07, 0xFF, 0x00, 0x04, 0x00, 0x00, 0x01, 0x44, 0x00, 0x07, 0xFF, 0x0C, 0x07, 0xFF,
+	0x00, 0x04, 0x00, 0x00, 0x01, 0x44, 0x00, 0x07, 0xFF, 0x14, 0x15, 0x07, 0xFF, 0x00, 0x01, 0x11,
+	0x00, 0x03, 0x00, 0x00, 0x01, 0x66, 0x00, 0x07, 0xFF, 0x0C, 0x07, 0xFF, 0x00, 0x01, 0x11, 0x00,
+	0x03, 0x00, 0x00, 0x01, 0x66, 0x00, 0x07, 0xFF, 0x0C, 0x07, 0xFF, 0x00, 0x01, 0x11, 0x00, 0x03,
+	0x00, 0x00, 0x01, 0x66, 0x00, 0x07, 0xFF, 0x0C, 0x07, 0xFF, 0x00, 0x01, 0x11, 0x00, 0x03, 0x00,
+	0x00, 0x01, 0x66, 0x00, 0x07, 0xFF, 0x14, 0x15, 0x07, 0xFF, 0x00, 0x01, 0x22, 0x00, 0x03, 0x00,
+	0x00, 0x01, 0x88, 0x00, 0x07, 0xFF, 0x0C, 0x07, 0xFF, 0x00, 0x01, 0x22, 0x00, 0x03, 0x00, 0x00,
+	0x01, 0x88, 0x00, 0x07, 0xFF, 0x0C, 0x07, 0xFF, 0x00, 0x01, 0x22, 0x00, 0x03, 0x00, 0x00, 0x01,
+	0x88, 0x00, 0x07, 0xFF, 0x0C, 0x07, 0xFF, 0x00, 0x01, 0x22, 0x00, 0x03, 0x00, 0x00, 0x01, 0x88,
+	0x00, 0x07, 0xFF, 0x14, 0x15, 0x07, 0xFF, 0x00, 0x01, 0x44, 0x00, 0x03, 0x00, 0x00, 0x01, 0x99,
+	0x00, 0x07, 0xFF, 0x0C, 0x07, 0xFF, 0x00, 0x01, 0x44, 0x00, 0x03, 0x00, 0x00, 0x01, 0x99, 0x00,
+	0x07, 0xFF, 0x0C, 0x07, 0xFF, 0x00, 0x01, 0x44, 0x00, 0x03, 0x00, 0x00, 0x01, 0x99, 0x00, 0x07,
+	0xFF, 0x0C, 0x07, 0xFF, 0x00, 0x01, 0x44, 0x00, 0x03, 0x00, 0x00, 0x01, 0x99, 0x00, 0x07, 0xFF,
+	0x14, 0x15, 0x07, 0xFF, 0x00, 0x01, 0x66, 0x00, 0x03, 0x00, 0x00, 0x01, 0xBB, 0x00, 0x07, 0xFF,
+	0x0C, 0x07, 0xFF, 0x00, 0x01, 0x66, 0x00, 0x03, 0x00, 0x00, 0x01, 0xBB, 0x00, 0x07, 0xFF, 0x0C,
+	0x07, 0xFF, 0x00, 0x01, 0x66, 0x00, 0x03, 0x00, 0x00, 0x01, 0xBB, 0x00, 0x07, 0xFF, 0x0C, 0x07,
+	0xFF, 0x00, 0x01, 0x66, 0x00, 0x03, 0x00, 0x00, 0x01, 0xBB, 0x00, 0x07, 0xFF, 0x38, 0x15, 0x01,
+	0xCC, 0x00, 0x01, 0x22, 0x00, 0x01, 0x77, 0x00, 0x01, 0xBB, 0x00, 0x03, 0xFF, 0x00, 0x01, 0x88,
+	0x00, 0x03, 0x00, 0x00, 0x01, 0xDD, 0x00, 0x02, 0xFF, 0x00, 0x01, 0xEE, 0x00, 0x01, 0xAA, 0x00,
+	0x01, 0x66, 0x00, 0x01, 0x22, 0x00, 0x01, 0xFF, 0x0C, 0x01, 0xCC, 0x00, 0x01, 0x22, 0x00, 0x01,
+	0x77, 0x00, 0x01, 0xBB, 0x00, 0x03, 0xFF, 0x00, 0x01, 0x88, 0x00, 0x03, 0x00, 0x00, 0x01, 0xDD,
+	0x00, 0x02, 0xFF, 0x00, 0x01, 0xEE, 0x00, 0x01, 0xAA, 0x00, 0x01, 0x66, 0x00, 0x01, 0x22, 0x00,
+	0x01, 0xFF, 0x0C, 0x01, 0xCC, 0x00, 0x01, 0x22, 0x00, 0x01, 0x77, 0x00, 0x01, 0xBB, 0x00, 0x03,
+	0xFF, 0x00, 0x01, 0x88, 0x00, 0x03, 0x00, 0x00, 0x01, 0xDD, 0x00, 0x02, 0xFF, 0x00, 0x01, 0xEE,
+	0x00, 0x01, 0xAA, 0x00, 0x01, 0x66, 0x00, 0x01, 0x22, 0x00, 0x01, 0xFF, 0x0C, 0x01, 0xCC, 0x00,
+	0x01, 0x22, 0x00, 0x01, 0x77, 0x00, 0x01, 0xBB, 0x00, 0x03, 0xFF, 0x00, 0x01, 0x88, 0x00, 0x03,
+	0x00, 0x00, 0x01, 0xDD, 0x00, 0x02, 0xFF, 0x00, 0x01, 0xEE, 0x00, 0x01, 0xAA, 0x00, 0x01, 0x66,
+	0x00, 0x01, 0x22, 0x00, 0x01, 0xFF, 0x2C, 0x15, 0x01, 0xAA, 0x00, 0x04, 0x00, 0x00, 0x01, 0x44,
+	0x00, 0x01, 0x99, 0x00, 0x01, 0x88, 0x00, 0x03, 0x00, 0x00, 0x01, 0xBB, 0x00, 0x01, 0x88, 0x00,
+	0x01, 0x33, 0x00, 0x04, 0x00, 0x00, 0x01, 0xEE, 0x0C, 0x01, 0xAA, 0x00, 0x04, 0x00, 0x00, 0x01,
+	0x44, 0x00, 0x01, 0x99, 0x00, 0x01, 0x88, 0x00, 0x03, 0x00, 0x00, 0x01, 0xBB, 0x00, 0x01, 0x88,
+	0x00, 0x01, 0x33, 0x00, 0x04, 0x00, 0x00, 0x01, 0xEE, 0x0C, 0x01, 0xAA, 0x00, 0x04, 0x00, 0x00,
+	0x01, 0x44, 0x00, 0x01, 0x99, 0x00, 0x01, 0x88, 0x00, 0x03, 0x00, 0x00, 0x01, 0xBB, 0x00, 0x01,
+	0x88, 0x00, 0x01, 0x33, 0x00, 0x04, 0x00, 0x00, 0x01, 0xEE, 0x0C, 0x01, 0xAA, 0x00, 0x04, 0x00,
+	0x00, 0x01, 0x44, 0x00, 0x01, 0x99, 0x00, 0x01, 0x88, 0x00, 0x03, 0x00, 0x00, 0x01, 0xBB, 0x00,
+	0x01, 0x88, 0x00, 0x01, 0x33, 0x00, 0x04, 0x00, 0x00, 0x01, 0xEE, 0x0C, 0x15, 0x01, 0x77, 0x00,
+	0x11, 0x00, 0x00, 0x01, 0xCC, 0x0C, 0x01, 0x77, 0x00, 0x11, 0x00, 0x00, 0x01, 0xCC, 0x0C, 0x01,
+	0x77, 0x00, 0x11, 0x00, 0x00, 0x01, 0xCC, 0x0C, 0x01, 0x77, 0x00, 0x11, 0x00, 0x00, 0x01, 0xCC,
+	0x0C, 0x15, 0x01, 0x55, 0x00, 0x11, 0x00, 0x00, 0x01, 0x99, 0x0C, 0x01, 0x55, 0x00, 0x11, 0x00,
+	0x00, 0x01, 0x99, 0x0C, 0x01, 0x55, 0x00, 0x11, 0x00, 0x00, 0x01, 0x99, 0x0C, 0x01, 0x55, 0x00,
+	0x11, 0x00, 0x00, 0x01, 0x99, 0x24, 0x15, 0x01, 0x77, 0x00, 0x01, 0x44, 0x00, 0x01, 0x33, 0x00,
+	0x01, 0x11, 0x00, 0x0B, 0x00, 0x00, 0x01, 0x11, 0x00, 0x01, 0x22, 0x00, 0x01, 0x44, 0x00, 0x01,
+	0xAA, 0x0C, 0x01, 0x77, 0x00, 0x01, 0x44, 0x00, 0x01, 0x33, 0x00, 0x01, 0x11, 0x00, 0x0B, 0x00,
+	0x00, 0x01, 0x11, 0x00, 0x01, 0x22, 0x00, 0x01, 0x44, 0x00, 0x01, 0xAA, 0x0C, 0x01, 0x77, 0x00,
+	0x01, 0x44, 0x00, 0x01, 0x33, 0x00, 0x01, 0x11, 0x00, 0x0B, 0x00, 0x00, 0x01, 0x11, 0x00, 0x01,
+	0x22, 0x00, 0x01, 0x44, 0x00, 0x01, 0xAA, 0x0C, 0x01, 0x77, 0x00, 0x01, 0x44, 0x00, 0x01, 0x33,
+	0x00, 0x01, 0x11, 0x00, 0x0B, 0x00, 0x00, 0x01, 0x11, 0x00, 0x01, 0x22, 0x00, 0x01, 0x44, 0x00,
+	0x01, 0xAA, 0x18, 0x15, 0x05, 0xFF, 0x00, 0x01, 0xEE, 0x00, 0x01, 0x22, 0x00, 0x05, 0x00, 0x00,
+	0x01, 0x66, 0x00, 0x06, 0xFF, 0x0C, 0x05, 0xFF, 0x00, 0x01, 0xEE, 0x00, 0x01, 0x22, 0x00, 0x05,
+	0x00, 0x00, 0x01, 0x66, 0x00, 0x06, 0xFF, 0x0C, 0x05, 0xFF, 0x00, 0x01, 0xEE, 0x00, 0x01, 0x22,
+	0x00, 0x05, 0x00, 0x00, 0x01, 0x66, 0x00, 0x06, 0xFF, 0x0C, 0x05, 0xFF, 0x00, 0x01, 0xEE, 0x00,
+	0x01, 0x22, 0x00, 0x05, 0x00, 0x00, 0x01, 0x66, 0x00, 0x06, 0xFF, 0x14, 0x15, 0x05, 0xFF, 0x00,
+	0x01, 0x66, 0x00, 0x07, 0x00, 0x00, 0x01, 0xBB, 0x00, 0x05, 0xFF, 0x0C, 0x05, 0xFF, 0x00, 0x01,
+	0x66, 0x00, 0x07, 0x00, 0x00, 0x01, 0xBB, 0x00, 0x05, 0xFF, 0x0C, 0x05, 0xFF, 0x00, 0x01, 0x66,
+	0x00, 0x07, 0x00, 0x00, 0x01, 0xBB, 0x00, 0x05, 0xFF, 0x0C, 0x05, 0xFF, 0x00, 0x01, 0x66, 0x00,
+	0x07, 0x00, 0x00, 0x01, 0xBB, 0x00, 0x05, 0xFF, 0x20, 0x15, 0x04, 0xFF, 0x00, 0x01, 0xBB, 0x00,
+	0x04, 0x00, 0x00, 0x01, 0x66, 0x00, 0x03, 0x00, 0x00, 0x01, 0x11, 0x00, 0x01, 0xEE, 0x00, 0x04,
+	0xFF, 0x0C, 0x04, 0xFF, 0x00, 0x01, 0xBB, 0x00, 0x04, 0x00, 0x00, 0x01, 0x66, 0x00, 0x03, 0x00,
+	0x00, 0x01, 0x11, 0x00, 0x01, 0xEE, 0x00, 0x04, 0xFF, 0x0C, 0x04, 0xFF, 0x00, 0x01, 0xBB, 0x00,
+	0x04, 0x00, 0x00, 0x01, 0x66, 0x00, 0x03, 0x00, 0x00, 0x01, 0x11, 0x00, 0x01, 0xEE, 0x00, 0x04,
+	0xFF, 0x0C, 0x04, 0xFF, 0x00, 0x01, 0xBB, 0x00, 0x04, 0x00, 0x00, 0x01, 0x66, 0x00, 0x03, 0x00,
+	0x00, 0x01, 0x11, 0x00, 0x01, 0xEE, 0x00, 0x04, 0xFF, 0x24, 0x15, 0x03, 0xFF, 0x00, 0x01, 0xEE,
+	0x00, 0x01, 0x11, 0x00, 0x03, 0x00, 0x00, 0x01, 0x55, 0x00, 0x01, 0xEE, 0x00, 0x04, 0x00, 0x00,
+	0x01, 0x44, 0x00, 0x04, 0xFF, 0x0C, 0x03, 0xFF, 0x00, 0x01, 0xEE, 0x00, 0x01, 0x11, 0x00, 0x03,
+	0x00, 0x00, 0x01, 0x55, 0x00, 0x01, 0xEE, 0x00, 0x04, 0x00, 0x00, 0x01, 0x44, 0x00, 0x04, 0xFF,
+	0x0C, 0x03, 0xFF, 0x00, 0x01, 0xEE, 0x00, 0x01, 0x11, 0x00, 0x03, 0x00, 0x00, 0x01, 0x55, 0x00,
+	0x01, 0xEE, 0x00, 0x04, 0x00, 0x00, 0x01, 0x44, 0x00, 0x04, 0xFF, 0x0C, 0x03, 0xFF, 0x00, 0x01,
+	0xEE, 0x00, 0x01, 0x11, 0x00, 0x03, 0x00, 0x00, 0x01, 0x55, 0x00, 0x01, 0xEE, 0x00, 0x04, 0x00,
+	0x00, 0x01, 0x44, 0x00, 0x04, 0xFF, 0x24, 0x15, 0x03, 0xFF, 0x00, 0x01, 0x44, 0x00, 0x04, 0x00,
+	0x00, 0x01, 0xCC, 0x00, 0x01, 0xFF, 0x00, 0x01, 0x77, 0x00, 0x04, 0x00, 0x00, 0x01, 0x88, 0x00,
+	0x03, 0xFF, 0x0C, 0x03, 0xFF, 0x00, 0x01, 0x44, 0x00, 0x04, 0x00, 0x00, 0x01, 0xCC, 0x00, 0x01,
+	0xFF, 0x00, 0x01, 0x77, 0x00, 0x04, 0x00, 0x00, 0x01, 0x88, 0x00, 0x03, 0xFF, 0x0C, 0x03, 0xFF,
+	0x00, 0x01, 0x44, 0x00, 0x04, 0x00, 0x00, 0x01, 0xCC, 0x00, 0x01, 0xFF, 0x00, 0x01, 0x77, 0x00,
+	0x04, 0x00, 0x00, 0x01, 0x88, 0x00, 0x03, 0xFF, 0x0C, 0x03, 0xFF, 0x00, 0x01, 0x44, 0x00, 0x04,
+	0x00, 0x00, 0x01, 0xCC, 0x00, 0x01, 0xFF, 0x00, 0x01, 0x77, 0x00, 0x04, 0x00, 0x00, 0x01, 0x88,
+	0x00, 0x03, 0xFF, 0x24, 0x15, 0x02, 0xFF, 0x00, 0x01, 0x99, 0x00, 0x04, 0x00, 0x00, 0x01, 0x33,
+	0x00, 0x02, 0xFF, 0x00, 0x01, 0xEE, 0x00, 0x05, 0x00, 0x00, 0x01, 0xDD, 0x00, 0x02, 0xFF, 0x0C,
+	0x02, 0xFF, 0x00, 0x01, 0x99, 0x00, 0x04, 0x00, 0x00, 0x01, 0x33, 0x00, 0x02, 0xFF, 0x00, 0x01,
+	0xEE, 0x00, 0x05, 0x00, 0x00, 0x01, 0xDD, 0x00, 0x02, 0xFF, 0x0C, 0x02, 0xFF, 0x00, 0x01, 0x99,
+	0x00, 0x04, 0x00, 0x00, 0x01, 0x33, 0x00, 0x02, 0xFF, 0x00, 0x01, 0xEE, 0x00, 0x05, 0x00, 0x00,
+	0x01, 0xDD, 0x00, 0x02, 0xFF, 0x0C, 0x02, 0xFF, 0x00, 0x01, 0x99, 0x00, 0x04, 0x00, 0x00, 0x01,
+	0x33, 0x00, 0x02, 0xFF, 0x00, 0x01, 0xEE, 0x00, 0x05, 0x00, 0x00, 0x01, 0xDD, 0x00, 0x02, 0xFF,
+	0x2C, 0x15, 0x03, 0xFF, 0x00, 0x01, 0xAA, 0x00, 0x01, 0x22, 0x00, 0x02, 0x00, 0x00, 0x01, 0xAA,
+	0x00, 0x03, 0xFF, 0x00, 0x01, 0x66, 0x00, 0x02, 0x00, 0x00, 0x01, 0x33, 0x00, 0x01, 0xCC, 0x00,
+	0x03, 0xFF, 0x0C, 0x03, 0xFF, 0x00, 0x01, 0xAA, 0x00, 0x01, 0x22, 0x00, 0x02, 0x00, 0x00, 0x01,
+	0xAA, 0x00, 0x03, 0xFF, 0x00, 0x01, 0x66, 0x00, 0x02, 0x00, 0x00, 0x01, 0x33, 0x00, 0x01, 0xCC,
+	0x00, 0x03, 0xFF, 0x0C, 0x03, 0xFF, 0x00, 0x01, 0xAA, 0x00, 0x01, 0x22, 0x00, 0x02, 0x00, 0x00,
+	0x01, 0xAA, 0x00, 0x03, 0xFF, 0x00, 0x01, 0x66, 0x00, 0x02, 0x00, 0x00, 0x01, 0x33, 0x00, 0x01,
+	0xCC, 0x00, 0x03, 0xFF, 0x0C, 0x03, 0xFF, 0x00, 0x01, 0xAA, 0x00, 0x01, 0x22, 0x00, 0x02, 0x00,
+	0x00, 0x01, 0xAA, 0x00, 0x03, 0xFF, 0x00, 0x01, 0x66, 0x00, 0x02, 0x00, 0x00, 0x01, 0x33, 0x00,
+	0x01, 0xCC, 0x00, 0x03, 0xFF, 0x20, 0x15, 0x05, 0xFF, 0x00, 0x01, 0x99, 0x00, 0x01, 0x33, 0x00,
+	0x04, 0xFF, 0x00, 0x01, 0xDD, 0x00, 0x01, 0x22, 0x00, 0x01, 0xAA, 0x00, 0x05, 0xFF, 0x0C, 0x05,
+	0xFF, 0x00, 0x01, 0x99, 0x00, 0x01, 0x33, 0x00, 0x04, 0xFF, 0x00, 0x01, 0xDD, 0x00, 0x01, 0x22,
+	0x00, 0x01, 0xAA, 0x00, 0x05, 0xFF, 0x0C, 0x05, 0xFF, 0x00, 0x01, 0x99, 0x00, 0x01, 0x33, 0x00,
+	0x04, 0xFF, 0x00, 0x01, 0xDD, 0x00, 0x01, 0x22, 0x00, 0x01, 0xAA, 0x00, 0x05, 0xFF, 0x0C, 0x05,
+	0xFF, 0x00, 0x01, 0x99, 0x00, 0x01, 0x33, 0x00, 0x04, 0xFF, 0x00, 0x01, 0xDD, 0x00, 0x01, 0x22,
+	0x00, 0x01, 0xAA, 0x00, 0x05, 0xFF, 0x04, 0x15, 0x13, 0xFF, 0x0C, 0x13, 0xFF, 0x0C, 0x13, 0xFF,
+	0x0C, 0x13, 0xFF,
+};
+constexpr uint8_t IconSprite_13d_S_runs[] = {
+	0x01, 0x23, 0x07, 0x00, 0x01, 0x21, 0x0B, 0x00, 0x01, 0x1F, 0x0F, 0x00, 0x01, 0x1E, 0x11, 0x00,
+	0x01, 0x1D, 0x13, 0x00, 0x03, 0x1C, 0x08, 0x00, 0x00, 0x05, 0xFF, 0x00, 0x08, 0x00, 0x04, 0x13,
+	0x05, 0x00, 0x04, 0x06, 0x00, 0x00, 0x09, 0xFF, 0x00, 0x06, 0x00, 0x04, 0x11, 0x09, 0x00, 0x01,
+	0x06, 0x00, 0x00, 0x0B, 0xFF, 0x00, 0x06, 0x00, 0x03, 0x0F, 0x11, 0x00, 0x00, 0x0D, 0xFF, 0x00,
+	0x05, 0x00, 0x03, 0x0E, 0x12, 0x00, 0x00, 0x0D, 0xFF, 0x00, 0x06, 0x00, 0x03, 0x0E, 0x11, 0x00,
+	0x00, 0x0F, 0xFF, 0x00, 0x05, 0x00, 0x05, 0x0D, 0x07, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x08, 0x00,
+	0x00, 0x0F, 0xFF, 0x00, 0x05, 0x00, 0x05, 0x0D, 0x05, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x06, 0x00,
+	0x00, 0x0F, 0xFF, 0x00, 0x05, 0x00, 0x05, 0x0C, 0x06, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x06, 0x00,
+	0x00, 0x0F, 0xFF, 0x00, 0x05, 0x00, 0x05, 0x0C, 0x05, 0x00, 0x00, 0x09, 0xFF, 0x00, 0x05, 0x00,
+	0x00, 0x0F, 0xFF, 0x00, 0x05, 0x00, 0x05, 0x05, 0x0C, 0x00, 0x00, 0x09, 0xFF, 0x00, 0x06, 0x00,
+	0x00, 0x0D, 0xFF, 0x00, 0x07, 0x00, 0x05, 0x03, 0x0E, 0x00, 0x00, 0x09, 0xFF, 0x00, 0x06, 0x00,
+	0x00, 0x0D, 0xFF, 0x00, 0x09, 0x00, 0x05, 0x02, 0x10, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x08, 0x00,
+	0x00, 0x0B, 0xFF, 0x00, 0x0B, 0x00, 0x05, 0x01, 0x11, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x09, 0x00,
+	0x00, 0x09, 0xFF, 0x00, 0x0D, 0x00, 0x03, 0x01, 0x08, 0x00, 0x00, 0x29, 0xFF, 0x00, 0x06, 0x00,
+	0x03, 0x00, 0x06, 0x00, 0x00, 0x2D, 0xFF, 0x00, 0x06, 0x00, 0x03, 0x00, 0x05, 0x00, 0x00, 0x2F,
+	0xFF, 0x00, 0x05, 0x00, 0x03, 0x00, 0x05, 0x00, 0x00, 0x2F, 0xFF, 0x00, 0x05, 0x00, 0x03, 0x00,
+	0x05, 0x00, 0x00, 0x2F, 0xFF, 0x00, 0x05, 0x00, 0x03, 0x00, 0x06, 0x00, 0x00, 0x2D, 0xFF, 0x00,
+	0x06, 0x00, 0x01, 0x01, 0x37, 0x00, 0x01, 0x01, 0x37, 0x00, 0x01, 0x02, 0x35, 0x00, 0x01, 0x03,
+	0x33, 0x00, 0x01, 0x05, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x03, 0x03,
+	0xFF, 0x00, 0x01, 0x99, 0x00, 0x01, 0x00, 0x00, 0x01, 0x55, 0x00, 0x03, 0xFF, 0x04, 0x03, 0xFF,
+	0x00, 0x01, 0x99, 0x00, 0x01, 0x00, 0x00, 0x01, 0x55, 0x00, 0x03, 0xFF, 0x04, 0x03, 0xFF, 0x00,
+	0x01, 0x99, 0x00, 0x01, 0x00, 0x00, 0x01, 0x55, 0x00, 0x03, 0xFF, 0x04, 0x03, 0xFF, 0x00, 0x01,
+	0x99, 0x00, 0x01, 0x00, 0x00, 0x01, 0x55, 0x00, 0x03, 0xFF, 0x14, 0x03, 0x03, 0xFF, 0x00, 0x01,
+	0xBB, 0x00, 0x01, 0x00, 0x00, 0x01, 0x77, 0x00, 0x03, 0xFF, 0x04, 0x03, 0xFF, 0x00, 0x01, 0xBB,
+	0x00, 0x01, 0x00, 0x00, 0x01, 0x77, 0x00, 0x03, 0xFF, 0x04, 0x03, 0xFF, 0x00, 0x01, 0xBB, 0x00,
+	0x01, 0x00, 0x00, 0x01, 0x77, 0x00, 0x03, 0xFF, 0x04, 0x03, 0xFF, 0x00, 0x01, 0xBB, 0x00, 0x01,
+	0x00, 0x00, 0x01, 0x77, 0x00, 0x03, 0xFF, 0x24, 0x03, 0x01, 0xDD, 0x00, 0x01, 0x66, 0x00, 0x01,
+	0xBB, 0x00, 0x01, 0xCC, 0x00, 0x01, 0x00, 0x00, 0x01, 0x88, 0x00, 0x01, 0xCC, 0x00, 0x01, 0x77,
+	0x00, 0x01, 0xAA, 0x04, 0x01, 0xDD, 0x00, 0x01, 0x66, 0x00, 0x01, 0xBB, 0x00, 0x01, 0xCC, 0x00,
+	0x01, 0x00, 0x00, 0x01, 0x88, 0x00, 0x01, 0xCC, 0x00, 0x01, 0x77, 0x00, 0x01, 0xAA, 0x04, 0x01,
+	0xDD, 0x00, 0x01, 0x66, 0x00, 0x01, 0xBB, 0x00, 0x01, 0xCC, 0x00, 0x01, 0x00, 0x00, 0x01, 0x88,
+	0x00, 0x01, 0xCC, 0x00, 0x01, 0x77, 0x00, 0x01, 0xAA, 0x04, 0x01, 0xDD, 0x00, 0x01, 0x66, 0x00,
+	0x01, 0xBB, 0x00, 0x01, 0xCC, 0x00, 0x01, 0x00, 0x00, 0x01, 0x88, 0x00, 0x01, 0xCC, 0x00, 0x01,
+	0x77, 0x00, 0x01, 0xAA, 0x0C, 0x03, 0x01, 0xAA, 0x00, 0x07, 0x00, 0x00, 0x01, 0x55, 0x04, 0x01,
+	0xAA, 0x00, 0x07, 0x00, 0x00, 0x01, 0x55, 0x04, 0x01, 0xAA, 0x00, 0x07, 0x00, 0x00, 0x01, 0x55,
+	0x04, 0x01, 0xAA, 0x00, 0x07, 0x00, 0x00, 0x01, 0x55, 0x20, 0x03, 0x01, 0xDD, 0x00, 0x01, 0xAA,
+	0x00, 0x01, 0x88, 0x00, 0x01, 0x11, 0x00, 0x02, 0x00, 0x00, 0x01, 0x77, 0x00, 0x01, 0x99, 0x00,
+	0x01, 0xCC, 0x04, 0x01, 0xDD, 0x00, 0x01, 0xAA, 0x00, 0x01, 0x88, 0x00, 0x01, 0x11, 0x00, 0x02,
+	0x00, 0x00, 0x01, 0x77, 0x00, 0x01, 0x99, 0x00, 0x01, 0xCC, 0x04, 0x01, 0xDD, 0x00, 0x01, 0xAA,
+	0x00, 0x01, 0x88, 0x00, 0x01, 0x11, 0x00, 0x02, 0x00, 0x00, 0x01, 0x77, 0x00, 0x01, 0x99, 0x00,
+	0x01, 0xCC, 0x04, 0x01, 0xDD, 0x00, 0x01, 0xAA, 0x00, 0x01, 0x88, 0x00, 0x01, 0x11, 0x00, 0x02,
+	0x00, 0x00, 0x01, 0x77, 0x00, 0x01, 0x99, 0x00, 0x01, 0xCC, 0x1C, 0x03, 0x02, 0xFF, 0x00, 0x01,
+	0x99, 0x00, 0x01, 0x00, 0x00, 0x01, 0x22, 0x00, 0x01, 0x00, 0x00, 0x01, 0x55, 0x00, 0x02, 0xFF,
+	0x04, 0x02, 0xFF, 0x00, 0x01, 0x99, 0x00, 0x01, 0x00, 0x00, 0x01, 0x22, 0x00, 0x01, 0x00, 0x00,
+	0x01, 0x55, 0x00, 0x02, 0xFF, 0x04, 0x02, 0xFF, 0x00, 0x01, 0x99, 0x00, 0x01, 0x00, 0x00, 0x01,
+	0x22, 0x00, 0x01, 0x00, 0x00, 0x01, 0x55, 0x00, 0x02, 0xFF, 0x04, 0x02, 0xFF, 0x00, 0x01, 0x99,
+	0x00, 0x01, 0x00, 0x00, 0x01, 0x22, 0x00, 0x01, 0x00, 0x00, 0x01, 0x55, 0x00, 0x02, 0xFF, 0x20,
+	0x03, 0x01, 0xFF, 0x00, 0x01, 0xDD, 0x00, 0x02, 0x00, 0x00, 0x01, 0xDD, 0x00, 0x01, 0x22, 0x00,
+	0x01, 0x00, 0x00, 0x01, 0x99, 0x00, 0x01, 0xFF, 0x04, 0x01, 0xFF, 0x00, 0x01, 0xDD, 0x00, 0x02,
+	0x00, 0x00, 0x01, 0xDD, 0x00, 0x01, 0x22, 0x00, 0x01, 0x00, 0x00, 0x01, 0x99, 0x00, 0x01, 0xFF,
+	0x04, 0x01, 0xFF, 0x00, 0x01, 0xDD, 0x00, 0x02, 0x00, 0x00, 0x01, 0xDD, 0x00, 0x01, 0x22, 0x00,
+	0x01, 0x00, 0x00, 0x01, 0x99, 0x00, 0x01, 0xFF, 0x04, 0x01, 0xFF, 0x00, 0x01, 0xDD, 0x00, 0x02,
+	0x00, 0x00, 0x01, 0xDD, 0x00, 0x01, 0x22, 0x00, 0x01, 0x00, 0x00, 0x01, 0x99, 0x00, 0x01, 0xFF,
+	0x24, 0x03, 0x01, 0xFF, 0x00, 0x01, 0xEE, 0x00, 0x01, 0x77, 0x00, 0x01, 0x66, 0x00, 0x01, 0xFF,
+	0x00, 0x01, 0xAA, 0x00, 0x01, 0x44, 0x00, 0x01, 0xDD, 0x00, 0x01, 0xFF, 0x04, 0x01, 0xFF, 0x00,
+	0x01, 0xEE, 0x00, 0x01, 0x77, 0x00, 0x01, 0x66, 0x00, 0x01, 0xFF, 0x00, 0x01, 0xAA, 0x00, 0x01,
+	0x44, 0x00, 0x01, 0xDD, 0x00, 0x01, 0xFF, 0x04, 0x01, 0xFF, 0x00, 0x01, 0xEE, 0x00, 0x01, 0x77,
+	0x00, 0x01, 0x66, 0x00, 0x01, 0xFF, 0x00, 0x01, 0xAA, 0x00, 0x01, 0x44, 0x00, 0x01, 0xDD, 0x00,
+	0x01, 0xFF, 0x04, 0x01, 0xFF, 0x00, 0x01, 0xEE, 0x00, 0x01, 0x77, 0x00, 0x01, 0x66, 0x00, 0x01,
+	0xFF, 0x00, 0x01, 0xAA, 0x00, 0x01, 0x44, 0x00, 0x01, 0xDD, 0x00, 0x01, 0xFF, 0x04, 0x03, 0x09,
+	0xFF, 0x04, 0x09, 0xFF, 0x04, 0x09, 0xFF, 0x04, 0x09, 0xFF,
+};
+constexpr uint8_t IconSprite_13n_L_runs[] = {
+	0x01, 0xBF, 0x07, 0xFF, 0x01, 0xBC, 0x0D, 0xFF, 0x02, 0x69, 0x0B, 0x00, 0x46, 0x11, 0xFF, 0x02,
+	0x64, 0x15, 0x00, 0x40, 0x13, 0xFF, 0x02, 0x62, 0x19, 0x00, 0x3C, 0x17, 0xFF, 0x02, 0x5F, 0x1F,
+	0x00, 0x38, 0x19, 0xFF, 0x03, 0x5D, 0x23, 0x00, 0x33, 0x03, 0x00, 0x00, 0x19, 0xFF, 0x05, 0x5C,
+	0x0D, 0x00, 0x00, 0x0B, 0xFF, 0x00, 0x0D, 0x00, 0x30, 0x04, 0x00, 0x00, 0x1B, 0xFF, 0x05, 0x5A,
+	0x0B, 0x00, 0x00, 0x13, 0xFF, 0x00, 0x0B, 0x00, 0x2D, 0x04, 0x00, 0x00, 0x1D, 0xFF, 0x05, 0x59,
+	0x0A, 0x00, 0x00, 0x17, 0xFF, 0x00, 0x0A, 0x00, 0x2B, 0x05, 0x00, 0x00, 0x1D, 0xFF, 0x05, 0x58,
+	0x08, 0x00, 0x00, 0x1D, 0xFF, 0x00, 0x08, 0x00, 0x29, 0x05, 0x00, 0x00, 0x1F, 0xFF, 0x05, 0x57,
+	0x08, 0x00, 0x00, 0x1F, 0xFF, 0x00, 0x08, 0x00, 0x27, 0x06, 0x00, 0x00, 0x1F, 0xFF, 0x05, 0x56,
+	0x07, 0x00, 0x00, 0x23, 0xFF, 0x00, 0x07, 0x00, 0x26, 0x06, 0x00, 0x00, 0x1F, 0xFF, 0x05, 0x55,
+	0x07, 0x00, 0x00, 0x25, 0xFF, 0x00, 0x07, 0x00, 0x24, 0x06, 0x00, 0x00, 0x21, 0xFF, 0x05, 0x54,
+	0x07, 0x00, 0x00, 0x27, 0xFF, 0x00, 0x07, 0x00, 0x23, 0x06, 0x00, 0x00, 0x21, 0xFF, 0x06, 0x37,
+	0x0B, 0x00, 0x11, 0x07, 0x00, 0x00, 0x29, 0xFF, 0x00, 0x07, 0x00, 0x22, 0x06, 0x00, 0x00, 0x21,
+	0xFF, 0x06, 0x33, 0x13, 0x00, 0x0C, 0x07, 0x00, 0x00, 0x2B, 0xFF, 0x00, 0x07, 0x00, 0x21, 0x06,
+	0x00, 0x00, 0x21, 0xFF, 0x06, 0x31, 0x17, 0x00, 0x09, 0x07, 0x00, 0x00, 0x2D, 0xFF, 0x00, 0x07,
+	0x00, 0x20, 0x06, 0x00, 0x00, 0x21, 0xFF, 0x06, 0x2F, 0x1B, 0x00, 0x07, 0x06, 0x00, 0x00, 0x2F,
+	0xFF, 0x00, 0x06, 0x00, 0x20, 0x06, 0x00, 0x00, 0x21, 0xFF, 0x06, 0x2D, 0x1F, 0x00, 0x04, 0x06,
+	0x00, 0x00, 0x31, 0xFF, 0x00, 0x06, 0x00, 0x1F, 0x06, 0x00, 0x00, 0x21, 0xFF, 0x08, 0x2C, 0x0C,
+	0x00, 0x00, 0x09, 0xFF, 0x00, 0x0C, 0x00, 0x02, 0x06, 0x00, 0x00, 0x33, 0xFF, 0x00, 0x06, 0x00,
+	0x1F, 0x06, 0x00, 0x00, 0x1F, 0xFF, 0x08, 0x2B, 0x09, 0x00, 0x00, 0x11, 0xFF, 0x00, 0x09, 0x00,
+	0x01, 0x06, 0x00, 0x00, 0x33, 0xFF, 0x00, 0x06, 0x00, 0x1F, 0x06, 0x00, 0x00, 0x1F, 0xFF, 0x07,
+	0x29, 0x09, 0x00, 0x00, 0x15, 0xFF, 0x00, 0x0D, 0x00, 0x00, 0x35, 0xFF, 0x00, 0x06, 0x00, 0x1F,
+	0x05, 0x00, 0x00, 0x1F, 0xFF, 0x07, 0x28, 0x08, 0x00, 0x00, 0x19, 0xFF, 0x00, 0x0A, 0x00, 0x00,
+	0x37, 0xFF, 0x00, 0x05, 0x00, 0x20, 0x05, 0x00, 0x00, 0x1D, 0xFF, 0x07, 0x27, 0x08, 0x00, 0x00,
+	0x1B, 0xFF, 0x00, 0x09, 0x00, 0x00, 0x37, 0xFF, 0x00, 0x05, 0x00, 0x21, 0x04, 0x00, 0x00, 0x1D,
+	0xFF, 0x07, 0x27, 0x07, 0x00, 0x00, 0x1D, 0xFF, 0x00, 0x08, 0x00, 0x00, 0x37, 0xFF, 0x00, 0x06,
+	0x00, 0x21, 0x04, 0x00, 0x00, 0x1B, 0xFF, 0x07, 0x26, 0x06, 0x00, 0x00, 0x21, 0xFF, 0x00, 0x05,
+	0x00, 0x00, 0x39, 0xFF, 0x00, 0x05, 0x00, 0x23, 0x03, 0x00, 0x00, 0x19, 0xFF, 0x06, 0x25, 0x06,
+	0x00, 0x00, 0x23, 0xFF, 0x00, 0x04, 0x00, 0x00, 0x39, 0xFF, 0x00, 0x06, 0x00, 0x25, 0x19, 0xFF,
+	0x06, 0x24, 0x07, 0x00, 0x00, 0x23, 0xFF, 0x00, 0x03, 0x00, 0x00, 0x3B, 0xFF, 0x00, 0x05, 0x00,
+	0x26, 0x17, 0xFF, 0x06, 0x24, 0x06, 0x00, 0x00, 0x25, 0xFF, 0x00, 0x02, 0x00, 0x00, 0x3B, 0xFF,
+	0x00, 0x05, 0x00, 0x28, 0x13, 0xFF, 0x06, 0x23, 0x06, 0x00, 0x00, 0x27, 0xFF, 0x00, 0x01, 0x00,
+	0x00, 0x3B, 0xFF, 0x00, 0x05, 0x00, 0x29, 0x11, 0xFF, 0x04, 0x23, 0x05, 0x00, 0x00, 0x64, 0xFF,
+	0x00, 0x05, 0x00, 0x2B, 0x0D, 0xFF, 0x04, 0x22, 0x06, 0x00, 0x00, 0x65, 0xFF, 0x00, 0x05, 0x00,
+	0x2D, 0x07, 0xFF, 0x03, 0x22, 0x05, 0x00, 0x00, 0x66, 0xFF, 0x00, 0x05, 0x00, 0x03, 0x21, 0x06,
+	0x00, 0x00, 0x66, 0xFF, 0x00, 0x05, 0x00, 0x03, 0x21, 0x05, 0x00, 0x00, 0x67, 0xFF, 0x00, 0x05,
+	0x00, 0x03, 0x21, 0x05, 0x00, 0x00, 0x67, 0xFF, 0x00, 0x05, 0x00, 0x03, 0x21, 0x05, 0x00, 0x00,
+	0x67, 0xFF, 0x00, 0x05, 0x00, 0x03, 0x20, 0x06, 0x00, 0x00, 0x67, 0xFF, 0x00, 0x05, 0x00, 0x03,
+	0x20, 0x05, 0x00, 0x00, 0x68, 0xFF, 0x00, 0x05, 0x00, 0x03, 0x20, 0x05, 0x00, 0x00, 0x68, 0xFF,
+	0x00, 0x05, 0x00, 0x03, 0x20, 0x05, 0x00, 0x00, 0x68, 0xFF, 0x00, 0x05, 0x00, 0x03, 0x20, 0x05,
+	0x00, 0x00, 0x68, 0xFF, 0x00, 0x05, 0x00, 0x03, 0x10, 0x15, 0x00, 0x00, 0x67, 0xFF, 0x00, 0x05,
+	0x00, 0x03, 0x0D, 0x18, 0x00, 0x00, 0x67, 0xFF, 0x00, 0x08, 0x00, 0x03, 0x0B, 0x1A, 0x00, 0x00,
+	0x67, 0xFF, 0x00, 0x0A, 0x00, 0x03, 0x09, 0x1C, 0x00, 0x00, 0x67, 0xFF, 0x00, 0x0C, 0x00, 0x03,
+	0x08, 0x0E, 0x00, 0x00, 0x76, 0xFF, 0x00, 0x0D, 0x00, 0x03, 0x07, 0x0A, 0x00, 0x00, 0x7F, 0xFF,
+	0x00, 0x0A, 0x00, 0x03, 0x06, 0x08, 0x00, 0x00, 0x85, 0xFF, 0x00, 0x08, 0x00, 0x03, 0x05, 0x07,
+	0x00, 0x00, 0x89, 0xFF, 0x00, 0x07, 0x00, 0x03, 0x04, 0x07, 0x00, 0x00, 0x8B, 0xFF, 0x00, 0x07,
+	0x00, 0x03, 0x03, 0x07, 0x00, 0x00, 0x8D, 0xFF, 0x00, 0x07, 0x00, 0x03, 0x03, 0x06, 0x00, 0x00,
+	0x8F, 0xFF, 0x00, 0x06, 0x00, 0x03, 0x02, 0x06, 0x00, 0x00, 0x91, 0xFF, 0x00, 0x06, 0x00, 0x03,
+	0x02, 0x05, 0x00, 0x00, 0x93, 0xFF, 0x00, 0x05, 0x00, 0x03, 0x01, 0x06, 0x00, 0x00, 0x93, 0xFF,
+	0x00, 0x06, 0x00, 0x03, 0x01, 0x05, 0x00, 0x00, 0x95, 0xFF, 0x00, 0x05, 0x00, 0x03, 0x01, 0x05,
+	0x00, 0x00, 0x95, 0xFF, 0x00, 0x05, 0x00, 0x03, 0x00, 0x06, 0x00, 0x00, 0x95, 0xFF, 0x00, 0x06,
+	0x00, 0x03, 0x00, 0x05, 0x00, 0x00, 0x97, 0xFF, 0x00, 0x05, 0x00, 0x03, 0x00, 0x05, 0x00, 0x00,
+	0x97, 0xFF, 0x00, 0x05, 0x00, 0x03, 0x00, 0x05, 0x00, 0x00, 0x97, 0xFF, 0x00, 0x05, 0x00, 0x03,
+	0x00, 0x05, 0x00, 0x00, 0x97, 0xFF, 0x00, 0x05, 0x00, 0x03, 0x00, 0x05, 0x00, 0x00, 0x97, 0xFF,
+	0x00, 0x05, 0x00, 0x03, 0x00, 0x05, 0x00, 0x00, 0x97, 0xFF, 0x00, 0x05, 0x00, 0x03, 0x00, 0x05,
+	0x00, 0x00, 0x97, 0xFF, 0x00, 0x05, 0x00, 0x03, 0x00, 0x06, 0x00, 0x00, 0x95, 0xFF, 0x00, 0x06,
+	0x00, 0x03, 0x01, 0x05, 0x00, 0x00, 0x95, 0xFF, 0x00, 0x05, 0x00, 0x03, 0x01, 0x05, 0x00, 0x00,
+	0x95, 0xFF, 0x00, 0x05, 0x00, 0x03, 0x01, 0x06, 0x00, 0x00, 0x93, 0xFF, 0x00, 0x06, 0x00, 0x03,
+	0x02, 0x05, 0x00, 0x00, 0x93, 0xFF, 0x00, 0x05, 0x00, 0x03, 0x02, 0x06, 0x00, 0x00, 0x91, 0xFF,
+	0x00, 0x06, 0x00, 0x03, 0x03, 0x06, 0x00, 0x00, 0x8F, 0xFF, 0x00, 0x06, 0x00, 0x03, 0x03, 0x07,
+	0x00, 0x00, 0x8D, 0xFF, 0x00, 0x07, 0x00, 0x03, 0x04, 0x07, 0x00, 0x00, 0x8B, 0xFF, 0x00, 0x07,
+	0x00, 0x03, 0x05, 0x07, 0x00, 0x00, 0x89, 0xFF, 0x00, 0x07, 0x00, 0x03, 0x06, 0x08, 0x00, 0x00,
+	0x85, 0xFF, 0x00, 0x08, 0x00, 0x03, 0x07, 0x0A, 0x00, 0x00, 0x7F, 0xFF, 0x00, 0x0A, 0x00, 0x01,
+	0x08, 0x91, 0x00, 0x01, 0x09, 0x8F, 0x00, 0x01, 0x0B, 0x8B, 0x00, 0x01, 0x0D, 0x87, 0x00, 0x01,
+	0x10, 0x81, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x15, 0x07, 0xFF,
+	0x00, 0x04, 0x00, 0x00, 0x01, 0x44, 0x00, 0x07, 0xFF, 0x0C, 0x07, 0xFF, 0x00, 0x04, 0x00, 0x00,
+	0x01, 0x44, 0x00, 0x07, 0xFF, 0x0C, 0x07, 0xFF, 0x00, 0x04, 0x00, 0x00, 0x01, 0x44, 0x00, 0x07,
+	0xFF, 0x0C, 0x07, 0xFF, 0x00, 0x04, 0x00, 0x00, 0x01, 0x44, 0x00, 0x07, 0xFF, 0x14, 0x15, 0x07,
+	0xFF, 0x00, 0x01, 0x11, 0x00, 0x03, 0x00, 0x00, 0x01, 0x66, 0x00, 0x07, 0xFF, 0x0C, 0x07, 0xFF,
+	0x00, 0x01, 0x11, 0x00, 0x03, 0x00, 0x00, 0x01, 0x66, 0x00, 0x07, 0xFF, 0x0C, 0x07, 0xFF, 0x00,
+	0x01, 0x11, 0x00, 0x03, 0x00, 0x00, 0x01, 0x66, 0x00, 0x07, 0xFF, 0x0C, 0x07, 0xFF, 0x00, 0x01,
+	0x11, 0x00, 0x03, 0x00, 0x00, 0x01, 0x66, 0x00, 0x07, 0xFF, 0x14, 0x15, 0x07, 0xFF, 0x00, 0x01,
+	0x22, 0x00, 0x03, 0x00, 0x00, 0x01, 0x88, 0x00, 0x07, 0xFF, 0x0C, 0x07, 0xFF, 0x00, 0x01, 0x22,
+	0x00, 0x03, 0x00, 0x00, 0x01, 0x88, 0x00, 0x07, 0xFF, 0x0C, 0x07, 0xFF, 0x00, 0x01, 0x22, 0x00,
+	0x03, 0x00, 0x00, 0x01, 0x88, 0x00, 0x07, 0xFF, 0x0C, 0x07, 0xFF, 0x00, 0x01, 0x22, 0x00, 0x03,
+	0x00, 0x00, 0x01, 0x88, 0x00, 0x07, 0xFF, 0x14, 0x15, 0x07, 0xFF, 0x00, 0x01, 0x44, 0x00, 0x03,
+	0x00, 0x00, 0x01, 0x99, 0x00, 0x07, 0xFF, 0x0C, 0x07, 0xFF, 0x00, 0x01, 0x44, 0x00, 0x03, 0x00,
+	0x00, 0x01, 0x99, 0x00, 0x07, 0xFF, 0x0C, 0x07, 0xFF, 0x00, 0x01, 0x44, 0x00, 0x03, 0x00, 0x00,
+	0x01, 0x99, 0x00, 0x07, 0xFF, 0x0C, 0x07, 0xFF, 0x00, 0x01, 0x44, 0x00, 0x03, 0x00, 0x00, 0x01,
+	0x99, 0x00, 0x07, 0xFF, 0x14, 0x15, 0x07, 0xFF, 0x00, 0x01, 0x66, 0x00, 0x03, 0x00, 0x00, 0x01,
+	0xBB, 0x00, 0x07, 0xFF, 0x0C, 0x07, 0xFF, 0x00, 0x01, 0x66, 0x00, 0x03, 0x00, 0x00, 0x01, 0xBB,
+	0x00, 0x07, 0xFF, 0x0C, 0x07, 0xFF, 0x00, 0x01, 0x66, 0x00, 0x03, 0x00, 0x00, 0x01, 0xBB, 0x00,
+	0x07, 0xFF, 0x0C, 0x07, 0xFF, 0x00, 0x01, 0x66, 0x00, 0x03, 0x00, 0x00, 0x01, 0xBB, 0x00, 0x07,
+	0xFF, 0x38, 0x15, 0x01, 0xCC, 0x00, 0x01, 0x22, 0x00, 0x01, 0x77, 0x00, 0x01, 0xBB, 0x00, 0x03,
+	0xFF, 0x00, 0x01, 0x88, 0x00, 0x03, 0x00, 0x00, 0x01, 0xDD, 0x00, 0x02, 0xFF, 0x00, 0x01, 0xEE,
+	0x00, 0x01, 0xAA, 0x00, 0x01, 0x66, 0x00, 0x01, 0x22, 0x00, 0x01, 0xFF, 0x0C, 0x01, 0xCC, 0x00,
+	0x01, 0x22, 0x00, 0x01, 0x77, 0x00, 0x01, 0xBB, 0x00, 0x03, 0xFF, 0x00, 0x01, 0x88, 0x00, 0x03,
+	0x00, 0x00, 0x01, 0xDD, 0x00, 0x02, 0xFF, 0x00, 0x01, 0xEE, 0x00, 0x01, 0xAA, 0x00, 0x01, 0x66,
+	0x00, 0x01, 0x22, 0x00, 0x01, 0xFF, 0x0C, 0x01, 0xCC, 0x00, 0x01, 0x22, 0x00, 0x01, 0x77, 0x00,
+	0x01, 0xBB, 0x00, 0x03, 0xFF, 0x00, 0x01, 0x88, 0x00, 0x03, 0x00, 0x00, 0x01, 0xDD, 0x00, 0x02,
+	0xFF, 0x00, 0x01, 0xEE, 0x00, 0x01, 0xAA, 0x00, 0x01, 0x66, 0x00, 0x01, 0x22, 0x00, 0x01, 0xFF,
+	0x0C, 0x01, 0xCC, 0x00, 0x01, 0x22, 0x00, 0x01, 0x77, 0x00, 0x01, 0xBB, 0x00, 0x03, 0xFF, 0x00,
+	0x01, 0x88, 0x00, 0x03, 0x00, 0x00, 0x01, 0xDD, 0x00, 0x02, 0xFF, 0x00, 0x01, 0xEE, 0x00, 0x01,
+	0xAA, 0x00, 0x01, 0x66, 0x00, 0x01, 0x22, 0x00, 0x01, 0xFF, 0x2C, 0x15, 0x01, 0xAA, 0x00, 0x04,
+	0x00, 0x00, 0x01, 0x44, 0x00, 0x01, 0x99, 0x00, 0x01, 0x88, 0x00, 0x03, 0x00, 0x00, 0x01, 0xBB,
+	0x00, 0x01, 0x88, 0x00, 0x01, 0x33, 0x00, 0x04, 0x00, 0x00, 0x01, 0xEE, 0x0C, 0x01, 0xAA, 0x00,
+	0x04, 0x00, 0x00, 0x01, 0x44, 0x00, 0x01, 0x99, 0x00, 0x01, 0x88, 0x00, 0x03, 0x00, 0x00, 0x01,
+	0xBB, 0x00, 0x01, 0x88, 0x00, 0x01, 0x33, 0x00, 0x04, 0x00, 0x00, 0x01, 0xEE, 0x0C, 0x01, 0xAA,
+	0x00, 0x04, 0x00, 0x00, 0x01, 0x44, 0x00, 0x01, 0x99, 0x00, 0x01, 0x88, 0x00, 0x03, 0x00, 0x00,
+	0x01, 0xBB, 0x00, 0x01, 0x88, 0x00, 0x01, 0x33, 0x00, 0x04, 0x00, 0x00, 0x01, 0xEE, 0x0C, 0x01,
+	0xAA, 0x00, 0x04, 0x00, 0x00, 0x01, 0x44, 0x00, 0x01, 0x99, 0x00, 0x01, 0x88, 0x00, 0x03, 0x00,
+	0x00, 0x01, 0xBB, 0x00, 0x01, 0x88, 0x00, 0x01, 0x33, 0x00, 0x04, 0x00, 0x00, 0x01, 0xEE, 0x0C,
+	0x15, 0x01, 0x77, 0x00, 0x11, 0x00, 0x00, 0x01, 0xCC, 0x0C, 0x01, 0x77, 0x00, 0x11, 0x00, 0x00,
+	0x01, 0xCC, 0x0C, 0x01, 0x77, 0x00, 0x11, 0x00, 0x00, 0x01, 0xCC, 0x0C, 0x01, 0x77, 0x00, 0x11,
+	0x00, 0x00, 0x01, 0xCC, 0x0C, 0x15, 0x01, 0x55, 0x00, 0x11, 0x00, 0x00, 0x01, 0x99, 0x0C, 0x01,
+	0x55, 0x00, 0x11, 0x00, 0x00, 0x01, 0x99, 0x0C, 0x01, 0x55, 0x00, 0x11, 0x00, 0x00, 0x01, 0x99,
+	0x0C, 0x01, 0x55, 0x00, 0x11, 0x00, 0x00, 0x01, 0x99, 0x24, 0x15, 0x01, 0x77, 0x00, 0x01, 0x44,
+	0x00, 0x01, 0x33, 0x00, 0x01, 0x11, 0x00, 0x0B, 0x00, 0x00, 0x01, 0x11, 0x00, 0x01, 0x22, 0x00,
+	0x01, 0x44, 0x00, 0x01, 0xAA, 0x0C, 0x01, 0x77, 0x00, 0x01, 0x44, 0x00, 0x01, 0x33, 0x00, 0x01,
+	0x11, 0x00, 0x0B, 0x00, 0x00, 0x01, 0x11, 0x00, 0x01, 0x22, 0x00, 0x01, 0x44, 0x00, 0x01, 0xAA,
+	0x0C, 0x01, 0x77, 0x00, 0x01, 0x44, 0x00, 0x01, 0x33, 0x00, 0x01, 0x11, 0x00, 0x0B, 0x00, 0x00,
+	0x01, 0x11, 0x00, 0x01, 0x22, 0x00, 0x01, 0x44, 0x00, 0x01, 0xAA, 0x0C, 0x01, 0x77, 0x00, 0x01,
+	0x44, 0x00, 0x01, 0x33, 0x00, 0x01, 0x11, 0x00, 0x0B, 0x00, 0x00, 0x01, 0x11, 0x00, 0x01, 0x22,
+	0x00, 0x01, 0x44, 0x00, 0x01, 0xAA, 0x18, 0x15, 0x05, 0xFF, 0x00, 0x01, 0xEE, 0x00, 0x01, 0x22,
+	0x00, 0x05, 0x00, 0x00, 0x01, 0x66, 0x00, 0x06, 0xFF, 0x0C, 0x05, 0xFF, 0x00, 0x01, 0xEE, 0x00,
+	0x01, 0x22, 0x00, 0x05, 0x00, 0x00, 0x01, 0x66, 0x00, 0x06, 0xFF, 0x0C, 0x05, 0xFF, 0x00, 0x01,
+	0xEE, 0x00, 0x01, 0x22, 0x00, 0x05, 0x00, 0x00, 0x01, 0x66, 0x00, 0x06, 0xFF, 0x0C, 0x05, 0xFF,
+	0x00, 0x01, 0xEE, 0x00, 0x01, 0x22, 0x00, 0x05, 0x00, 0x00, 0x01, 0x66, 0x00, 0x06, 0xFF, 0x14,
+	0x15, 0x05, 0xFF, 0x00, 0x01, 0x66, 0x00, 0x07, 0x00, 0x00, 0x01, 0xBB, 0x00, 0x05, 0xFF, 0x0C,
+	0x05, 0xFF, 0x00, 0x01, 0x66, 0x00, 0x07, 0x00, 0x00, 0x01, 0xBB, 0x00, 0x05, 0xFF, 0x0C, 0x05,
+	0xFF, 0x00, 0x01, 0x66, 0x00, 0x07, 0x00, 0x00, 0x01, 0xBB, 0x00, 0x05, 0xFF, 0x0C, 0x05, 0xFF,
+	0x00, 0x01, 0x66, 0x00, 0x07, 0x00, 0x00, 0x01, 0xBB, 0x00, 0x05, 0xFF, 0x20, 0x15, 0x04, 0xFF,
+	0x00, 0x01, 0xBB, 0x00, 0x04, 0x00, 0x00, 0x01, 0x66, 0x00, 0x03, 0x00, 0x00, 0x01, 0x11, 0x00,
+	0x01, 0xEE, 0x00, 0x04, 0xFF, 0x0C, 0x04, 0xFF, 0x00, 0x01, 0xBB, 0x00, 0x04, 0x00, 0x00, 0x01,
+	0x66, 0x00, 0x03, 0x00, 0x00, 0x01, 0x11, 0x00, 0x01, 0xEE, 0x00, 0x04, 0xFF, 0x0C, 0x04, 0xFF,
+	0x00, 0x01, 0xBB, 0x00, 0x04, 0x00, 0x00, 0x01, 0x66, 0x00, 0x03, 0x00, 0x00, 0x01, 0x11, 0x00,
+	0x01, 0xEE, 0x00, 0x04, 0xFF, 0x0C, 0x04, 0xFF, 0x00, 0x01, 0xBB, 0x00, 0x04, 0x00, 0x00, 0x01,
+	0x66, 0x00, 0x03, 0x00, 0x00, 0x01, 0x11, 0x00, 0x01, 0xEE, 0x00, 0x04, 0xFF, 0x24, 0x15, 0x03,
+	0xFF, 0x00, 0x01, 0xEE, 0x00, 0x01, 0x11, 0x00, 0x03, 0x00, 0x00, 0x01, 0x55, 0x00, 0x01, 0xEE,
+	0x00, 0x04, 0x00, 0x00, 0x01, 0x44, 0x00, 0x04, 0xFF, 0x0C, 0x03, 0xFF, 0x00, 0x01, 0xEE, 0x00,
+	0x01, 0x11, 0x00, 0x03, 0x00, 0x00, 0x01, 0x55, 0x00, 0x01, 0xEE, 0x00, 0x04, 0x00, 0x00, 0x01,
+	0x44, 0x00, 0x04, 0xFF, 0x0C, 0x03, 0xFF, 0x00, 0x01, 0xEE, 0x00, 0x01, 0x11, 0x00, 0x03, 0x00,
+	0x00, 0x01, 0x55, 0x00, 0x01, 0xEE, 0x00, 0x04, 0x00, 0x00, 0x01, 0x44, 0x00, 0x04, 0xFF, 0x0C,
+	0x03, 0xFF, 0x00, 0x01, 0xEE, 0x00, 0x01, 0x11, 0x00, 0x03, 0x00, 0x00, 0x01, 0x55, 0x00, 0x01,
+	0xEE, 0x00, 0x04, 0x00, 0x00, 0x01, 0x44, 0x00, 0x04, 0xFF, 0x24, 0x15, 0x03, 0xFF, 0x00, 0x01,
+	0x44, 0x00, 0x04, 0x00, 0x00, 0x01, 0xCC, 0x00, 0x01, 0xFF, 0x00, 0x01, 0x77, 0x00, 0x04, 0x00,
+	0x00, 0x01, 0x88, 0x00, 0x03, 0xFF, 0x0C, 0x03, 0xFF, 0x00, 0x01, 0x44, 0x00, 0x04, 0x00, 0x00,
+	0x01, 0xCC, 0x00, 0x01, 0xFF, 0x00, 0x01, 0x77, 0x00, 0x04, 0x00, 0x00, 0x01, 0x88, 0x00, 0x03,
+	0xFF, 0x0C, 0x03, 0xFF, 0x00, 0x01, 0x44, 0x00, 0x04, 0x00, 0x00, 0x01, 0xCC, 0x00, 0x01, 0xFF,
+	0x00, 0x01, 0x77, 0x00, 0x04, 0x00, 0x00, 0x01, 0x88, 0x00, 0x03, 0xFF, 0x0C, 0x03, 0xFF, 0x00,
+	0x01, 0x44, 0x00, 0x04, 0x00, 0x00, 0x01, 0xCC, 0x00, 0x01, 0xFF, 0x00, 0x01, 0x77, 0x00, 0x04,
+	0x00, 0x00, 0x01, 0x88, 0x00, 0x03, 0xFF, 0x24, 0x15, 0x02, 0xFF, 0x00, 0x01, 0x99, 0x00, 0x04,
+	0x00, 0x00, 0x01, 0x33, 0x00, 0x02, 0xFF, 0x00, 0x01, 0xEE, 0x00, 0x05, 0x00, 0x00, 0x01, 0xDD,
+	0x00, 0x02, 0xFF, 0x0C, 0x02, 0xFF, 0x00, 0x01, 0x99, 0x00, 0x04, 0x00, 0x00, 0x01, 0x33, 0x00,
+	0x02, 0xFF, 0x00, 0x01, 0xEE, 0x00, 0x05, 0x00, 0x00, 0x01, 0xDD, 0x00, 0x02, 0xFF, 0x0C, 0x02,
+	0xFF, 0x00, 0x01, 0x99, 0x00, 0x04, 0x00, 0x00, 0x01, 0x33, 0x00, 0x02, 0xFF, 0x00, 0x01, 0xEE,
+	0x00, 0x05, 0x00, 0x00, 0x01, 0xDD, 0x00, 0x02, 0xFF, 0x0C, 0x02, 0xFF, 0x00, 0x01, 0x99, 0x00,
+	0x04, 0x00, 0x00, 0x01, 0x33, 0x00, 0x02, 0xFF, 0x00, 0x01, 0xEE, 0x00, 0x05, 0x00, 0x00, 0x01,
+	0xDD, 0x00, 0x02, 0xFF, 0x2C, 0x15, 0x03, 0xFF, 0x00, 0x01, 0xAA, 0x00, 0x01, 0x22, 0x00, 0x02,
+	0x00, 0x00, 0x01, 0xAA, 0x00, 0x03, 0xFF, 0x00, 0x01, 0x66, 0x00, 0x02, 0x00, 0x00, 0x01, 0x33,
+	0x00, 0x01, 0xCC, 0x00, 0x03, 0xFF, 0x0C, 0x03, 0xFF, 0x00, 0x01, 0xAA, 0x00, 0x01, 0x22, 0x00,
+	0x02, 0x00, 0x00, 0x01, 0xAA, 0x00, 0x03, 0xFF, 0x00, 0x01, 0x66, 0x00, 0x02, 0x00, 0x00, 0x01,
+	0x33, 0x00, 0x01, 0xCC, 0x00, 0x03, 0xFF, 0x0C, 0x03, 0xFF, 0x00, 0x01, 0xAA, 0x00, 0x01, 0x22,
+	0x00, 0x02, 0x00, 0x00, 0x01, 0xAA, 0x00, 0x03, 0xFF, 0x00, 0x01, 0x66, 0x00, 0x02, 0x00, 0x00,
+	0x01, 0x33, 0x00, 0x01, 0xCC, 0x00, 0x03, 0xFF, 0x0C, 0x03, 0xFF, 0x00, 0x01, 0xAA, 0x00, 0x01,
+	0x22, 0x00, 0x02, 0x00, 0x00, 0x01, 0xAA, 0x00, 0x03, 0xFF, 0x00, 0x01, 0x66, 0x00, 0x02, 0x00,
+	0x00, 0x01, 0x33, 0x00, 0x01, 0xCC, 0x00, 0x03, 0xFF, 0x20, 0x15, 0x05, 0xFF, 0x00, 0x01, 0x99,
+	0x00, 0x01, 0x33, 0x00, 0x04, 0xFF, 0x00, 0x01, 0xDD, 0x00, 0x01, 0x22, 0x00, 0x01, 0xAA, 0x00,
+	0x05, 0xFF, 0x0C, 0x05, 0xFF, 0x00, 0x01, 0x99, 0x00, 0x01, 0x33, 0x00, 0x04, 0xFF, 0x00, 0x01,
+	0xDD, 0x00, 0x01, 0x22, 0x00, 0x01, 0xAA, 0x00, 0x05, 0xFF, 0x0C, 0x05, 0xFF, 0x00, 0x01, 0x99,
+	0x00, 0x01, 0x33, 0x00, 0x04, 0xFF, 0x00, 0x01, 0xDD, 0x00, 0x01, 0x22, 0x00, 0x01, 0xAA, 0x00,
+	0x05, 0xFF, 0x0C, 0x05, 0xFF, 0x00, 0x01, 0x99, 0x00, 0x01, 0x33, 0x00, 0x04, 0xFF, 0x00, 0x01,
+	0xDD, 0x00, 0x01, 0x22, 0x00, 0x01, 0xAA, 0x00, 0x05, 0xFF, 0x04, 0x15, 0x13, 0xFF, 0x0C, 0x13,
+	0xFF, 0x0C, 0x13, 0xFF, 0x0C, 0x13, 0xFF,
+};
+constexpr uint8_t IconSprite_13n_S_runs[] = {
+	0x01, 0x4A, 0x07, 0xFF, 0x01, 0x47, 0x0D, 0xFF, 0x01, 0x45, 0x11, 0xFF, 0x01, 0x44, 0x13, 0xFF,
+	0x01, 0x42, 0x17, 0xFF, 0x01, 0x41, 0x19, 0xFF, 0x02, 0x3E, 0x03, 0x00, 0x00, 0x19, 0xFF, 0x02,
+	0x3C, 0x04, 0x00, 0x00, 0x1B, 0xFF, 0x02, 0x3B, 0x04, 0x00, 0x00, 0x1D, 0xFF, 0x02, 0x3A, 0x05,
+	0x00, 0x00, 0x1D, 0xFF, 0x02, 0x39, 0x05, 0x00, 0x00, 0x1F, 0xFF, 0x02, 0x38, 0x06, 0x00, 0x00,
+	0x1F, 0xFF, 0x02, 0x38, 0x06, 0x00, 0x00, 0x1F, 0xFF, 0x02, 0x37, 0x06, 0x00, 0x00, 0x21, 0xFF,
+	0x02, 0x37, 0x06, 0x00, 0x00, 0x21, 0xFF, 0x02, 0x37, 0x06, 0x00, 0x00, 0x21, 0xFF, 0x02, 0x37,
+	0x06, 0x00, 0x00, 0x21, 0xFF, 0x02, 0x37, 0x06, 0x00, 0x00, 0x21, 0xFF, 0x02, 0x37, 0x06, 0x00,
+	0x00, 0x21, 0xFF, 0x03, 0x23, 0x07, 0x00, 0x0D, 0x06, 0x00, 0x00, 0x21, 0xFF, 0x03, 0x21, 0x0B,
+	0x00, 0x0C, 0x06, 0x00, 0x00, 0x1F, 0xFF, 0x03, 0x1F, 0x0F, 0x00, 0x0A, 0x06, 0x00, 0x00, 0x1F,
+	0xFF, 0x03, 0x1E, 0x11, 0x00, 0x0A, 0x05, 0x00, 0x00, 0x1F, 0xFF, 0x03, 0x1D, 0x13, 0x00, 0x0A,
+	0x05, 0x00, 0x00, 0x1D, 0xFF, 0x05, 0x1C, 0x08, 0x00, 0x00, 0x05, 0xFF, 0x00, 0x08, 0x00, 0x0A,
+	0x04, 0x00, 0x00, 0x1D, 0xFF, 0x06, 0x13, 0x05, 0x00, 0x04, 0x06, 0x00, 0x00, 0x09, 0xFF, 0x00,
+	0x06, 0x00, 0x0B, 0x04, 0x00, 0x00, 0x1B, 0xFF, 0x06, 0x11, 0x09, 0x00, 0x01, 0x06, 0x00, 0x00,
+	0x0B, 0xFF, 0x00, 0x06, 0x00, 0x0C, 0x03, 0x00, 0x00, 0x19, 0xFF, 0x04, 0x0F, 0x11, 0x00, 0x00,
+	0x0D, 0xFF, 0x00, 0x05, 0x00, 0x0F, 0x19, 0xFF, 0x04, 0x0E, 0x12, 0x00, 0x00, 0x0D, 0xFF, 0x00,
+	0x06, 0x00, 0x0F, 0x17, 0xFF, 0x04, 0x0E, 0x11, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x05, 0x00, 0x11,
+	0x13, 0xFF, 0x06, 0x0D, 0x07, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x08, 0x00, 0x00, 0x0F, 0xFF, 0x00,
+	0x05, 0x00, 0x12, 0x11, 0xFF, 0x06, 0x0D, 0x05, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x06, 0x00, 0x00,
+	0x0F, 0xFF, 0x00, 0x05, 0x00, 0x14, 0x0D, 0xFF, 0x06, 0x0C, 0x06, 0x00, 0x00, 0x07, 0xFF, 0x00,
+	0x06, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x05, 0x00, 0x17, 0x07, 0xFF, 0x05, 0x0C, 0x05, 0x00, 0x00,
+	0x09, 0xFF, 0x00, 0x05, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x05, 0x00, 0x05, 0x05, 0x0C, 0x00, 0x00,
+	0x09, 0xFF, 0x00, 0x06, 0x00, 0x00, 0x0D, 0xFF, 0x00, 0x07, 0x00, 0x05, 0x03, 0x0E, 0x00, 0x00,
+	0x09, 0xFF, 0x00, 0x06, 0x00, 0x00, 0x0D, 0xFF, 0x00, 0x09, 0x00, 0x05, 0x02, 0x10, 0x00, 0x00,
+	0x07, 0xFF, 0x00, 0x08, 0x00, 0x00, 0x0B, 0xFF, 0x00, 0x0B, 0x00, 0x05, 0x01, 0x11, 0x00, 0x00,
+	0x07, 0xFF, 0x00, 0x09, 0x00, 0x00, 0x09, 0xFF, 0x00, 0x0D, 0x00, 0x03, 0x01, 0x08, 0x00, 0x00,
+	0x29, 0xFF, 0x00, 0x06, 0x00, 0x03, 0x00, 0x06, 0x00, 0x00, 0x2D, 0xFF, 0x00, 0x06, 0x00, 0x03,
+	0x00, 0x05, 0x00, 0x00, 0x2F, 0xFF, 0x00, 0x05, 0x00, 0x03, 0x00, 0x05, 0x00, 0x00, 0x2F, 0xFF,
+	0x00, 0x05, 0x00, 0x03, 0x00, 0x05, 0x00, 0x00, 0x2F, 0xFF, 0x00, 0x05, 0x00, 0x03, 0x00, 0x06,
+	0x00, 0x00, 0x2D, 0xFF, 0x00, 0x06, 0x00, 0x01, 0x01, 0x37, 0x00, 0x01, 0x01, 0x37, 0x00, 0x01,
+	0x02, 0x35, 0x00, 0x01, 0x03, 0x33, 0x00, 0x01, 0x05, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x14, 0x03, 0x03, 0xFF, 0x00, 0x01, 0x99, 0x00, 0x01, 0x00, 0x00, 0x01, 0x55, 0x00,
+	0x03, 0xFF, 0x04, 0x03, 0xFF, 0x00, 0x01, 0x99, 0x00, 0x01, 0x00, 0x00, 0x01, 0x55, 0x00, 0x03,
+	0xFF, 0x04, 0x03, 0xFF, 0x00, 0x01, 0x99, 0x00, 0x01, 0x00, 0x00, 0x01, 0x55, 0x00, 0x03, 0xFF,
+	0x04, 0x03, 0xFF, 0x00, 0x01, 0x99, 0x00, 0x01, 0x00, 0x00, 0x01, 0x55, 0x00, 0x03, 0xFF, 0x14,
+	0x03, 0x03, 0xFF, 0x00, 0x01, 0xBB, 0x00, 0x01, 0x00, 0x00, 0x01, 0x77, 0x00, 0x03, 0xFF, 0x04,
+	0x03, 0xFF, 0x00, 0x01, 0xBB, 0x00, 0x01, 0x00, 0x00, 0x01, 0x77, 0x00, 0x03, 0xFF, 0x04, 0x03,
+	0xFF, 0x00, 0x01, 0xBB, 0x00, 0x01, 0x00, 0x00, 0x01, 0x77, 0x00, 0x03, 0xFF, 0x04, 0x03, 0xFF,
+	0x00, 0x01, 0xBB, 0x00, 0x01, 0x00, 0x00, 0x01, 0x77, 0x00, 0x03, 0xFF, 0x24, 0x03, 0x01, 0xDD,
+	0x00, 0x01, 0x66, 0x00, 0x01, 0xBB, 0x00, 0x01, 0xCC, 0x00, 0x01, 0x00, 0x00, 0x01, 0x88, 0x00,
+	0x01, 0xCC, 0x00, 0x01, 0x77, 0x00, 0x01, 0xAA, 0x04, 0x01, 0xDD, 0x00, 0x01, 0x66, 0x00, 0x01,
+	0xBB, 0x00, 0x01, 0xCC, 0x00, 0x01, 0x00, 0x00, 0x01, 0x88, 0x00, 0x01, 0xCC, 0x00, 0x01, 0x77,
+	0x00, 0x01, 0xAA, 0x04, 0x01, 0xDD, 0x00, 0x01, 0x66, 0x00, 0x01, 0xBB, 0x00, 0x01, 0xCC, 0x00,
+	0x01, 0x00, 0x00, 0x01, 0x88, 0x00, 0x01, 0xCC, 0x00, 0x01, 0x77, 0x00, 0x01, 0xAA, 0x04, 0x01,
+	0xDD, 0x00, 0x01, 0x66, 0x00, 0x01, 0xBB, 0x00, 0x01, 0xCC, 0x00, 0x01, 0x00, 0x00, 0x01, 0x88,
+	0x00, 0x01, 0xCC, 0x00, 0x01, 0x77, 0x00, 0x01, 0xAA, 0x0C, 0x03, 0x01, 0xAA, 0x00, 0x07, 0x00,
+	0x00, 0x01, 0x55, 0x04, 0x01, 0xAA, 0x00, 0x07, 0x00, 0x00, 0x01, 0x55, 0x04, 0x01, 0xAA, 0x00,
+	0x07, 0x00, 0x00, 0x01, 0x55, 0x04, 0x01, 0xAA, 0x00, 0x07, 0x00, 0x00, 0x01, 0x55, 0x20, 0x03,
+	0x01, 0xDD, 0x00, 0x01, 0xAA, 0x00, 0x01, 0x88, 0x00, 0x01, 0x11, 0x00, 0x02, 0x00, 0x00, 0x01,
+	0x77, 0x00, 0x01, 0x99, 0x00, 0x01, 0xCC, 0x04, 0x01, 0xDD, 0x00, 0x01, 0xAA, 0x00, 0x01, 0x88,
+	0x00, 0x01, 0x11, 0x00, 0x02, 0x00, 0x00, 0x01, 0x77, 0x00, 0x01, 0x99, 0x00, 0x01, 0xCC, 0x04,
+	0x01, 0xDD, 0x00, 0x01, 0xAA, 0x00, 0x01, 0x88, 0x00, 0x01, 0x11, 0x00, 0x02, 0x00, 0x00, 0x01,
+	0x77, 0x00, 0x01, 0x99, 0x00, 0x01, 0xCC, 0x04, 0x01, 0xDD, 0x00, 0x01, 0xAA, 0x00, 0x01, 0x88,
+	0x00, 0x01, 0x11, 0x00, 0x02, 0x00, 0x00, 0x01, 0x77, 0x00, 0x01, 0x99, 0x00, 0x01, 0xCC, 0x1C,
+	0x03, 0x02, 0xFF, 0x00, 0x01, 0x99, 0x00, 0x01, 0x00, 0x00, 0x01, 0x22, 0x00, 0x01, 0x00, 0x00,
+	0x01, 0x55, 0x00, 0x02, 0xFF, 0x04, 0x02, 0xFF, 0x00, 0x01, 0x99, 0x00, 0x01, 0x00, 0x00, 0x01,
+	0x22, 0x00, 0x01, 0x00, 0x00, 0x01, 0x55, 0x00, 0x02, 0xFF, 0x04, 0x02, 0xFF, 0x00, 0x01, 0x99,
+	0x00, 0x01, 0x00, 0x00, 0x01, 0x22, 0x00, 0x01, 0x00, 0x00, 0x01, 0x55, 0x00, 0x02, 0xFF, 0x04,
+	0x02, 0xFF, 0x00, 0x01, 0x99, 0x00, 0x01, 0x00, 0x00, 0x01, 0x22, 0x00, 0x01, 0x00, 0x00, 0x01,
+	0x55, 0x00, 0x02, 0xFF, 0x20, 0x03, 0x01, 0xFF, 0x00, 0x01, 0xDD, 0x00, 0x02, 0x00, 0x00, 0x01,
+	0xDD, 0x00, 0x01, 0x22, 0x00, 0x01, 0x00, 0x00, 0x01, 0x99, 0x00, 0x01, 0xFF, 0x04, 0x01, 0xFF,
+	0x00, 0x01, 0xDD, 0x00, 0x02, 0x00, 0x00, 0x01, 0xDD, 0x00, 0x01, 0x22, 0x00, 0x01, 0x00, 0x00,
+	0x01, 0x99, 0x00, 0x01, 0xFF, 0x04, 0x01, 0xFF, 0x00, 0x01, 0xDD, 0x00, 0x02, 0x00, 0x00, 0x01,
+	0xDD, 0x00, 0x01, 0x22, 0x00, 0x01, 0x00, 0x00, 0x01, 0x99, 0x00, 0x01, 0xFF, 0x04, 0x01, 0xFF,
+	0x00, 0x01, 0xDD, 0x00, 0x02, 0x00, 0x00, 0x01, 0xDD, 0x00, 0x01, 0x22, 0x00, 0x01, 0x00, 0x00,
+	0x01, 0x99, 0x00, 0x01, 0xFF, 0x24, 0x03, 0x01, 0xFF, 0x00, 0x01, 0xEE, 0x00, 0x01, 0x77, 0x00,
+	0x01, 0x66, 0x00, 0x01, 0xFF, 0x00, 0x01, 0xAA, 0x00, 0x01, 0x44, 0x00, 0x01, 0xDD, 0x00, 0x01,
+	0xFF, 0x04, 0x01, 0xFF, 0x00, 0x01, 0xEE, 0x00, 0x01, 0x77, 0x00, 0x01, 0x66, 0x00, 0x01, 0xFF,
+	0x00, 0x01, 0xAA, 0x00, 0x01, 0x44, 0x00, 0x01, 0xDD, 0x00, 0x01, 0xFF, 0x04, 0x01, 0xFF, 0x00,
+	0x01, 0xEE, 0x00, 0x01, 0x77, 0x00, 0x01, 0x66, 0x00, 0x01, 0xFF, 0x00, 0x01, 0xAA, 0x00, 0x01,
+	0x44, 0x00, 0x01, 0xDD, 0x00, 0x01, 0xFF, 0x04, 0x01, 0xFF, 0x00, 0x01, 0xEE, 0x00, 0x01, 0x77,
+	0x00, 0x01, 0x66, 0x00, 0x01, 0xFF, 0x00, 0x01, 0xAA, 0x00, 0x01, 0x44, 0x00, 0x01, 0xDD, 0x00,
+	0x01, 0xFF, 0x04, 0x03, 0x09, 0xFF, 0x04, 0x09, 0xFF, 0x04, 0x09, 0xFF, 0x04, 0x09, 0xFF,
+};
+constexpr uint8_t IconSprite_50d_L_runs[] = {
+	0x01, 0x3C, 0x05, 0x00, 0x01, 0x3C, 0x05, 0x00, 0x01, 0x3C, 0x05, 0x00, 0x01, 0x3C, 0x05, 0x00,
+	0x01, 0x3C, 0x05, 0x00, 0x01, 0x3C, 0x05, 0x00, 0x01, 0x3C, 0x05, 0x00, 0x01, 0x3C, 0x05, 0x00,
+	0x01, 0x3C, 0x05, 0x00, 0x01, 0x3C, 0x05, 0x00, 0x03, 0x22, 0x01, 0x00, 0x19, 0x05, 0x00, 0x15,
+	0x01, 0x00, 0x03, 0x21, 0x03, 0x00, 0x18, 0x05, 0x00, 0x14, 0x03, 0x00, 0x03, 0x20, 0x05, 0x00,
+	0x17, 0x05, 0x00, 0x13, 0x05, 0x00, 0x03, 0x1F, 0x07, 0x00, 0x16, 0x05, 0x00, 0x12, 0x07, 0x00,
+	0x03, 0x1E, 0x09, 0x00, 0x10, 0x0B, 0xFF, 0x10, 0x09, 0x00, 0x03, 0x1F, 0x09, 0x00, 0x0C, 0x11,
+	0xFF, 0x0C, 0x09, 0x00, 0x03, 0x20, 0x09, 0x00, 0x08, 0x17, 0xFF, 0x08, 0x09, 0x00, 0x03, 0x21,
+	0x09, 0x00, 0x05, 0x1B, 0xFF, 0x05, 0x09, 0x00, 0x03, 0x22, 0x09, 0x00, 0x03, 0x1D, 0xFF, 0x03,
+	0x09, 0x00, 0x03, 0x23, 0x09, 0x00, 0x01, 0x1F, 0xFF, 0x01, 0x09, 0x00, 0x05, 0x24, 0x07, 0x00,
+	0x00, 0x0D, 0xFF, 0x00, 0x09, 0x00, 0x00, 0x0D, 0xFF, 0x00, 0x07, 0x00, 0x05, 0x25, 0x05, 0x00,
+	0x00, 0x0B, 0xFF, 0x00, 0x0F, 0x00, 0x00, 0x0B, 0xFF, 0x00, 0x05, 0x00, 0x05, 0x26, 0x03, 0x00,
+	0x00, 0x0A, 0xFF, 0x00, 0x13, 0x00, 0x00, 0x0A, 0xFF, 0x00, 0x03, 0x00, 0x05, 0x27, 0x01, 0x00,
+	0x00, 0x09, 0xFF, 0x00, 0x17, 0x00, 0x00, 0x09, 0xFF, 0x00, 0x01, 0x00, 0x03, 0x28, 0x08, 0xFF,
+	0x00, 0x19, 0x00, 0x00, 0x08, 0xFF, 0x05, 0x27, 0x08, 0xFF, 0x00, 0x0A, 0x00, 0x00, 0x07, 0xFF,
+	0x00, 0x0A, 0x00, 0x00, 0x08, 0xFF, 0x05, 0x26, 0x08, 0xFF, 0x00, 0x08, 0x00, 0x00, 0x0D, 0xFF,
+	0x00, 0x08, 0x00, 0x00, 0x08, 0xFF, 0x05, 0x25, 0x08, 0xFF, 0x00, 0x07, 0x00, 0x00, 0x11, 0xFF,
+	0x00, 0x07, 0x00, 0x00, 0x08, 0xFF, 0x05, 0x25, 0x07, 0xFF, 0x00, 0x07, 0x00, 0x00, 0x13, 0xFF,
+	0x00, 0x07, 0x00, 0x00, 0x07, 0xFF, 0x05, 0x24, 0x07, 0xFF, 0x00, 0x07, 0x00, 0x00, 0x15, 0xFF,
+	0x00, 0x07, 0x00, 0x00, 0x07, 0xFF, 0x05, 0x24, 0x07, 0xFF, 0x00, 0x06, 0x00, 0x00, 0x17, 0xFF,
+	0x00, 0x06, 0x00, 0x00, 0x07, 0xFF, 0x05, 0x24, 0x06, 0xFF, 0x00, 0x06, 0x00, 0x00, 0x19, 0xFF,
+	0x00, 0x06, 0x00, 0x00, 0x06, 0xFF, 0x05, 0x23, 0x07, 0xFF, 0x00, 0x05, 0x00, 0x00, 0x1B, 0xFF,
+	0x00, 0x05, 0x00, 0x00, 0x07, 0xFF, 0x05, 0x23, 0x06, 0xFF, 0x00, 0x06, 0x00, 0x00, 0x1B, 0xFF,
+	0x00, 0x06, 0x00, 0x00, 0x06, 0xFF, 0x05, 0x23, 0x06, 0xFF, 0x00, 0x05, 0x00, 0x00, 0x1D, 0xFF,
+	0x00, 0x05, 0x00, 0x00, 0x06, 0xFF, 0x05, 0x22, 0x07, 0xFF, 0x00, 0x05, 0x00, 0x00, 0x1D, 0xFF,
+	0x00, 0x05, 0x00, 0x00, 0x07, 0xFF, 0x05, 0x22, 0x06, 0xFF, 0x00, 0x06, 0x00, 0x00, 0x1D, 0xFF,
+	0x00, 0x06, 0x00, 0x00, 0x06, 0xFF, 0x05, 0x22, 0x06, 0xFF, 0x00, 0x05, 0x00, 0x00, 0x1F, 0xFF,
+	0x00, 0x05, 0x00, 0x00, 0x06, 0xFF, 0x05, 0x22, 0x06, 0xFF, 0x00, 0x05, 0x00, 0x00, 0x1F, 0xFF,
+	0x00, 0x05, 0x00, 0x00, 0x06, 0xFF, 0x05, 0x22, 0x06, 0xFF, 0x00, 0x05, 0x00, 0x00, 0x1F, 0xFF,
+	0x00, 0x05, 0x00, 0x00, 0x06, 0xFF, 0x07, 0x14, 0x0E, 0x00, 0x00, 0x06, 0xFF, 0x00, 0x05, 0x00,
+	0x00, 0x1F, 0xFF, 0x00, 0x05, 0x00, 0x00, 0x06, 0xFF, 0x00, 0x0D, 0x00, 0x07, 0x14, 0x0E, 0x00,
+	0x00, 0x06, 0xFF, 0x00, 0x05, 0x00, 0x00, 0x1F, 0xFF, 0x00, 0x05, 0x00, 0x00, 0x06, 0xFF, 0x00,
+	0x0D, 0x00, 0x07, 0x14, 0x0E, 0x00, 0x00, 0x06, 0xFF, 0x00, 0x05, 0x00, 0x00, 0x1F, 0xFF, 0x00,
+	0x05, 0x00, 0x00, 0x06, 0xFF, 0x00, 0x0D, 0x00, 0x07, 0x14, 0x0E, 0x00, 0x00, 0x06, 0xFF, 0x00,
+	0x05, 0x00, 0x00, 0x1F, 0xFF, 0x00, 0x05, 0x00, 0x00, 0x06, 0xFF, 0x00, 0x0D, 0x00, 0x07, 0x14,
+	0x0E, 0x00, 0x00, 0x06, 0xFF, 0x00, 0x06, 0x00, 0x00, 0x1D, 0xFF, 0x00, 0x06, 0x00, 0x00, 0x06,
+	0xFF, 0x00, 0x0D, 0x00, 0x05, 0x22, 0x07, 0xFF, 0x00, 0x05, 0x00, 0x00, 0x1D, 0xFF, 0x00, 0x05,
+	0x00, 0x00, 0x07, 0xFF, 0x05, 0x23, 0x06, 0xFF, 0x00, 0x05, 0x00, 0x00, 0x1D, 0xFF, 0x00, 0x05,
+	0x00, 0x00, 0x06, 0xFF, 0x05, 0x23, 0x06, 0xFF, 0x00, 0x06, 0x00, 0x00, 0x1B, 0xFF, 0x00, 0x06,
+	0x00, 0x00, 0x06, 0xFF, 0x05, 0x23, 0x07, 0xFF, 0x00, 0x05, 0x00, 0x00, 0x1B, 0xFF, 0x00, 0x05,
+	0x00, 0x00, 0x07, 0xFF, 0x05, 0x24, 0x06, 0xFF, 0x00, 0x06, 0x00, 0x00, 0x19, 0xFF, 0x00, 0x06,
+	0x00, 0x00, 0x06, 0xFF, 0x05, 0x24, 0x07, 0xFF, 0x00, 0x06, 0x00, 0x00, 0x17, 0xFF, 0x00, 0x06,
+	0x00, 0x00, 0x07, 0xFF, 0x05, 0x24, 0x07, 0xFF, 0x00, 0x07, 0x00, 0x00, 0x15, 0xFF, 0x00, 0x07,
+	0x00, 0x00, 0x07, 0xFF, 0x05, 0x25, 0x07, 0xFF, 0x00, 0x07, 0x00, 0x00, 0x13, 0xFF, 0x00, 0x07,
+	0x00, 0x00, 0x07, 0xFF, 0x05, 0x25, 0x08, 0xFF, 0x00, 0x07, 0x00, 0x00, 0x11, 0xFF, 0x00, 0x07,
+	0x00, 0x00, 0x08, 0xFF, 0x05, 0x26, 0x08, 0xFF, 0x00, 0x08, 0x00, 0x00, 0x0D, 0xFF, 0x00, 0x08,
+	0x00, 0x00, 0x08, 0xFF, 0x05, 0x27, 0x08, 0xFF, 0x00, 0x0A, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x0A,
+	0x00, 0x00, 0x08, 0xFF, 0x03, 0x28, 0x08, 0xFF, 0x00, 0x19, 0x00, 0x00, 0x08, 0xFF, 0x05, 0x27,
+	0x01, 0x00, 0x00, 0x09, 0xFF, 0x00, 0x17, 0x00, 0x00, 0x09, 0xFF, 0x00, 0x01, 0x00, 0x05, 0x26,
+	0x03, 0x00, 0x00, 0x0A, 0xFF, 0x00, 0x13, 0x00, 0x00, 0x0A, 0xFF, 0x00, 0x03, 0x00, 0x05, 0x25,
+	0x05, 0x00, 0x00, 0x0B, 0xFF, 0x00, 0x0F, 0x00, 0x00, 0x0B, 0xFF, 0x00, 0x05, 0x00, 0x05, 0x24,
+	0x07, 0x00, 0x00, 0x0D, 0xFF, 0x00, 0x09, 0x00, 0x00, 0x0D, 0xFF, 0x00, 0x07, 0x00, 0x03, 0x23,
+	0x09, 0x00, 0x01, 0x1F, 0xFF, 0x01, 0x09, 0x00, 0x03, 0x22, 0x09, 0x00, 0x03, 0x1D, 0xFF, 0x03,
+	0x09, 0x00, 0x03, 0x21, 0x09, 0x00, 0x05, 0x1B, 0xFF, 0x05, 0x09, 0x00, 0x03, 0x20, 0x09, 0x00,
+	0x08, 0x17, 0xFF, 0x08, 0x09, 0x00, 0x03, 0x1F, 0x09, 0x00, 0x0C, 0x11, 0xFF, 0x0C, 0x09, 0x00,
+	0x03, 0x1E, 0x09, 0x00, 0x10, 0x0B, 0xFF, 0x10, 0x09, 0x00, 0x03, 0x1F, 0x07, 0x00, 0x16, 0x05,
+	0x00, 0x12, 0x07, 0x00, 0x03, 0x20, 0x05, 0x00, 0x17, 0x05, 0x00, 0x13, 0x05, 0x00, 0x03, 0x21,
+	0x03, 0x00, 0x18, 0x05, 0x00, 0x14, 0x03, 0x00, 0x01, 0x00, 0x78, 0x00, 0x01, 0x00, 0x78, 0x00,
+	0x01, 0x00, 0x78, 0x00, 0x01, 0x00, 0x78, 0x00, 0x01, 0x00, 0x78, 0x00, 0x01, 0x3C, 0x05, 0x00,
+	0x01, 0x3C, 0x05, 0x00, 0x01, 0x3C, 0x05, 0x00, 0x01, 0x3C, 0x05, 0x00, 0x01, 0x3C, 0x05, 0x00,
+	0x01, 0x00, 0x78, 0x00, 0x01, 0x00, 0x78, 0x00, 0x01, 0x00, 0x78, 0x00, 0x01, 0x00, 0x78, 0x00,
+	0x01, 0x00, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x78, 0x00, 0x01, 0x00, 0x78,
+	0x00, 0x01, 0x00, 0x78, 0x00, 0x01, 0x00, 0x78, 0x00, 0x01, 0x00, 0x78, 0x00,
+};
+constexpr uint8_t IconSprite_50d_S_runs[] = {
+	0x01, 0x1E, 0x05, 0x00, 0x01, 0x1E, 0x05, 0x00, 0x03, 0x16, 0x01, 0x00, 0x07, 0x05, 0x00, 0x02,
+	0x01, 0x00, 0x03, 0x15, 0x03, 0x00, 0x06, 0x05, 0x00, 0x01, 0x03, 0x00, 0x02, 0x14, 0x05, 0x00,
+	0x05, 0x0A, 0x00, 0x03, 0x13, 0x07, 0x00, 0x02, 0x05, 0xFF, 0x00, 0x08, 0x00, 0x03, 0x12, 0x08,
+	0x00, 0x00, 0x09, 0xFF, 0x00, 0x07, 0x00, 0x05, 0x13, 0x05, 0x00, 0x00, 0x04, 0xFF, 0x00, 0x05,
+	0x00, 0x00, 0x04, 0xFF, 0x00, 0x04, 0x00, 0x05, 0x14, 0x03, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x09,
+	0x00, 0x00, 0x03, 0xFF, 0x00, 0x02, 0x00, 0x05, 0x15, 0x02, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x0B,
+	0x00, 0x00, 0x02, 0xFF, 0x00, 0x01, 0x00, 0x03, 0x16, 0x02, 0xFF, 0x00, 0x0D, 0x00, 0x00, 0x02,
+	0xFF, 0x03, 0x16, 0x02, 0xFF, 0x00, 0x0D, 0x00, 0x00, 0x02, 0xFF, 0x05, 0x15, 0x02, 0xFF, 0x00,
+	0x06, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x06, 0x00, 0x00, 0x02, 0xFF, 0x05, 0x15, 0x02, 0xFF, 0x00,
+	0x05, 0x00, 0x00, 0x05, 0xFF, 0x00, 0x05, 0x00, 0x00, 0x02, 0xFF, 0x07, 0x10, 0x05, 0x00, 0x00,
+	0x02, 0xFF, 0x00, 0x05, 0x00, 0x00, 0x05, 0xFF, 0x00, 0x05, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x04,
+	0x00, 0x07, 0x10, 0x05, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x05, 0x00, 0x00, 0x05, 0xFF, 0x00, 0x05,
+	0x00, 0x00, 0x02, 0xFF, 0x00, 0x04, 0x00, 0x07, 0x10, 0x05, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x06,
+	0x00, 0x00, 0x03, 0xFF, 0x00, 0x06, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x04, 0x00, 0x05, 0x10, 0x06,
+	0x00, 0x00, 0x02, 0xFF, 0x00, 0x0D, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x05, 0x00, 0x05, 0x10, 0x06,
+	0x00, 0x00, 0x02, 0xFF, 0x00, 0x0D, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x05, 0x00, 0x05, 0x14, 0x03,
+	0x00, 0x00, 0x02, 0xFF, 0x00, 0x0B, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x02, 0x00, 0x05, 0x13, 0x04,
+	0x00, 0x00, 0x03, 0xFF, 0x00, 0x09, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x03, 0x00, 0x05, 0x12, 0x06,
+	0x00, 0x00, 0x04, 0xFF, 0x00, 0x05, 0x00, 0x00, 0x04, 0xFF, 0x00, 0x05, 0x00, 0x03, 0x13, 0x07,
+	0x00, 0x00, 0x09, 0xFF, 0x00, 0x06, 0x00, 0x03, 0x14, 0x05, 0x00, 0x03, 0x05, 0xFF, 0x00, 0x07,
+	0x00, 0x03, 0x15, 0x03, 0x00, 0x06, 0x05, 0x00, 0x01, 0x03, 0x00, 0x03, 0x16, 0x01, 0x00, 0x07,
+	0x05, 0x00, 0x02, 0x01, 0x00, 0x01, 0x1E, 0x05, 0x00, 0x01, 0x1E, 0x05, 0x00, 0x00, 0x01, 0x00,
+	0x3C, 0x00, 0x01, 0x00, 0x3C, 0x00, 0x01, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x01, 0x00, 0x3C, 0x00,
+	0x01, 0x00, 0x3C, 0x00, 0x01, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x01, 0x00, 0x3C, 0x00, 0x01, 0x00,
+	0x3C, 0x00, 0x01, 0x00, 0x3C, 0x00,
+};
+constexpr uint8_t IconSprite_50n_L_runs[] = {
+	0x01, 0xAB, 0x07, 0xFF, 0x01, 0xA8, 0x0D, 0xFF, 0x01, 0xA6, 0x11, 0xFF, 0x01, 0xA5, 0x13, 0xFF,
+	0x01, 0xA3, 0x17, 0xFF, 0x01, 0xA2, 0x19, 0xFF, 0x02, 0x9F, 0x03, 0x00, 0x00, 0x19, 0xFF, 0x02,
+	0x9D, 0x04, 0x00, 0x00, 0x1B, 0xFF, 0x02, 0x9C, 0x04, 0x00, 0x00, 0x1D, 0xFF, 0x02, 0x9B, 0x05,
+	0x00, 0x00, 0x1D, 0xFF, 0x02, 0x9A, 0x05, 0x00, 0x00, 0x1F, 0xFF, 0x02, 0x99, 0x06, 0x00, 0x00,
+	0x1F, 0xFF, 0x02, 0x99, 0x06, 0x00, 0x00, 0x1F, 0xFF, 0x02, 0x98, 0x06, 0x00, 0x00, 0x21, 0xFF,
+	0x02, 0x98, 0x06, 0x00, 0x00, 0x21, 0xFF, 0x02, 0x98, 0x06, 0x00, 0x00, 0x21, 0xFF, 0x02, 0x98,
+	0x06, 0x00, 0x00, 0x21, 0xFF, 0x02, 0x98, 0x06, 0x00, 0x00, 0x21, 0xFF, 0x02, 0x98, 0x06, 0x00,
+	0x00, 0x21, 0xFF, 0x02, 0x98, 0x06, 0x00, 0x00, 0x21, 0xFF, 0x02, 0x99, 0x06, 0x00, 0x00, 0x1F,
+	0xFF, 0x02, 0x99, 0x06, 0x00, 0x00, 0x1F, 0xFF, 0x02, 0x9A, 0x05, 0x00, 0x00, 0x1F, 0xFF, 0x03,
+	0x3C, 0x05, 0x00, 0x5A, 0x05, 0x00, 0x00, 0x1D, 0xFF, 0x03, 0x3C, 0x05, 0x00, 0x5B, 0x04, 0x00,
+	0x00, 0x1D, 0xFF, 0x03, 0x3C, 0x05, 0x00, 0x5C, 0x04, 0x00, 0x00, 0x1B, 0xFF, 0x03, 0x3C, 0x05,
+	0x00, 0x5E, 0x03, 0x00, 0x00, 0x19, 0xFF, 0x02, 0x3C, 0x05, 0x00, 0x61, 0x19, 0xFF, 0x02, 0x3C,
+	0x05, 0x00, 0x62, 0x17, 0xFF, 0x02, 0x3C, 0x05, 0x00, 0x64, 0x13, 0xFF, 0x02, 0x3C, 0x05, 0x00,
+	0x65, 0x11, 0xFF, 0x02, 0x3C, 0x05, 0x00, 0x67, 0x0D, 0xFF, 0x02, 0x3C, 0x05, 0x00, 0x6A, 0x07,
+	0xFF, 0x03, 0x22, 0x01, 0x00, 0x19, 0x05, 0x00, 0x15, 0x01, 0x00, 0x03, 0x21, 0x03, 0x00, 0x18,
+	0x05, 0x00, 0x14, 0x03, 0x00, 0x03, 0x20, 0x05, 0x00, 0x17, 0x05, 0x00, 0x13, 0x05, 0x00, 0x03,
+	0x1F, 0x07, 0x00, 0x16, 0x05, 0x00, 0x12, 0x07, 0x00, 0x03, 0x1E, 0x09, 0x00, 0x10, 0x0B, 0xFF,
+	0x10, 0x09, 0x00, 0x03, 0x1F, 0x09, 0x00, 0x0C, 0x11, 0xFF, 0x0C, 0x09, 0x00, 0x03, 0x20, 0x09,
+	0x00, 0x08, 0x17, 0xFF, 0x08, 0x09, 0x00, 0x03, 0x21, 0x09, 0x00, 0x05, 0x1B, 0xFF, 0x05, 0x09,
+	0x00, 0x03, 0x22, 0x09, 0x00, 0x03, 0x1D, 0xFF, 0x03, 0x09, 0x00, 0x03, 0x23, 0x09, 0x00, 0x01,
+	0x1F, 0xFF, 0x01, 0x09, 0x00, 0x05, 0x24, 0x07, 0x00, 0x00, 0x0D, 0xFF, 0x00, 0x09, 0x00, 0x00,
+	0x0D, 0xFF, 0x00, 0x07, 0x00, 0x05, 0x25, 0x05, 0x00, 0x00, 0x0B, 0xFF, 0x00, 0x0F, 0x00, 0x00,
+	0x0B, 0xFF, 0x00, 0x05, 0x00, 0x05, 0x26, 0x03, 0x00, 0x00, 0x0A, 0xFF, 0x00, 0x13, 0x00, 0x00,
+	0x0A, 0xFF, 0x00, 0x03, 0x00, 0x05, 0x27, 0x01, 0x00, 0x00, 0x09, 0xFF, 0x00, 0x17, 0x00, 0x00,
+	0x09, 0xFF, 0x00, 0x01, 0x00, 0x03, 0x28, 0x08, 0xFF, 0x00, 0x19, 0x00, 0x00, 0x08, 0xFF, 0x05,
+	0x27, 0x08, 0xFF, 0x00, 0x0A, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x0A, 0x00, 0x00, 0x08, 0xFF, 0x05,
+	0x26, 0x08, 0xFF, 0x00, 0x08, 0x00, 0x00, 0x0D, 0xFF, 0x00, 0x08, 0x00, 0x00, 0x08, 0xFF, 0x05,
+	0x25, 0x08, 0xFF, 0x00, 0x07, 0x00, 0x00, 0x11, 0xFF, 0x00, 0x07, 0x00, 0x00, 0x08, 0xFF, 0x05,
+	0x25, 0x07, 0xFF, 0x00, 0x07, 0x00, 0x00, 0x13, 0xFF, 0x00, 0x07, 0x00, 0x00, 0x07, 0xFF, 0x05,
+	0x24, 0x07, 0xFF, 0x00, 0x07, 0x00, 0x00, 0x15, 0xFF, 0x00, 0x07, 0x00, 0x00, 0x07, 0xFF, 0x05,
+	0x24, 0x07, 0xFF, 0x00, 0x06, 0x00, 0x00, 0x17, 0xFF, 0x00, 0x06, 0x00, 0x00, 0x07, 0xFF, 0x05,
+	0x24, 0x06, 0xFF, 0x00, 0x06, 0x00, 0x00, 0x19, 0xFF, 0x00, 0x06, 0x00, 0x00, 0x06, 0xFF, 0x05,
+	0x23, 0x07, 0xFF, 0x00, 0x05, 0x00, 0x00, 0x1B, 0xFF, 0x00, 0x05, 0x00, 0x00, 0x07, 0xFF, 0x05,
+	0x23, 0x06, 0xFF, 0x00, 0x06, 0x00, 0x00, 0x1B, 0xFF, 0x00, 0x06, 0x00, 0x00, 0x06, 0xFF, 0x05,
+	0x23, 0x06, 0xFF, 0x00, 0x05, 0x00, 0x00, 0x1D, 0xFF, 0x00, 0x05, 0x00, 0x00, 0x06, 0xFF, 0x05,
+	0x22, 0x07, 0xFF, 0x00, 0x05, 0x00, 0x00, 0x1D, 0xFF, 0x00, 0x05, 0x00, 0x00, 0x07, 0xFF, 0x05,
+	0x22, 0x06, 0xFF, 0x00, 0x06, 0x00, 0x00, 0x1D, 0xFF, 0x00, 0x06, 0x00, 0x00, 0x06, 0xFF, 0x05,
+	0x22, 0x06, 0xFF, 0x00, 0x05, 0x00, 0x00, 0x1F, 0xFF, 0x00, 0x05, 0x00, 0x00, 0x06, 0xFF, 0x05,
+	0x22, 0x06, 0xFF, 0x00, 0x05, 0x00, 0x00, 0x1F, 0xFF, 0x00, 0x05, 0x00, 0x00, 0x06, 0xFF, 0x05,
+	0x22, 0x06, 0xFF, 0x00, 0x05, 0x00, 0x00, 0x1F, 0xFF, 0x00, 0x05, 0x00, 0x00, 0x06, 0xFF, 0x07,
+	0x14, 0x0E, 0x00, 0x00, 0x06, 0xFF, 0x00, 0x05, 0x00, 0x00, 0x1F, 0xFF, 0x00, 0x05, 0x00, 0x00,
+	0x06, 0xFF, 0x00, 0x0D, 0x00, 0x07, 0x14, 0x0E, 0x00, 0x00, 0x06, 0xFF, 0x00, 0x05, 0x00, 0x00,
+	0x1F, 0xFF, 0x00, 0x05, 0x00, 0x00, 0x06, 0xFF, 0x00, 0x0D, 0x00, 0x07, 0x14, 0x0E, 0x00, 0x00,
+	0x06, 0xFF, 0x00, 0x05, 0x00, 0x00, 0x1F, 0xFF, 0x00, 0x05, 0x00, 0x00, 0x06, 0xFF, 0x00, 0x0D,
+	0x00, 0x07, 0x14, 0x0E, 0x00, 0x00, 0x06, 0xFF, 0x00, 0x05, 0x00, 0x00, 0x1F, 0xFF, 0x00, 0x05,
+	0x00, 0x00, 0x06, 0xFF, 0x00, 0x0D, 0x00, 0x07, 0x14, 0x0E, 0x00, 0x00, 0x06, 0xFF, 0x00, 0x06,
+	0x00, 0x00, 0x1D, 0xFF, 0x00, 0x06, 0x00, 0x00, 0x06, 0xFF, 0x00, 0x0D, 0x00, 0x05, 0x22, 0x07,
+	0xFF, 0x00, 0x05, 0x00, 0x00, 0x1D, 0xFF, 0x00, 0x05, 0x00, 0x00, 0x07, 0xFF, 0x05, 0x23, 0x06,
+	0xFF, 0x00, 0x05, 0x00, 0x00, 0x1D, 0xFF, 0x00, 0x05, 0x00, 0x00, 0x06, 0xFF, 0x05, 0x23, 0x06,
+	0xFF, 0x00, 0x06, 0x00, 0x00, 0x1B, 0xFF, 0x00, 0x06, 0x00, 0x00, 0x06, 0xFF, 0x05, 0x23, 0x07,
+	0xFF, 0x00, 0x05, 0x00, 0x00, 0x1B, 0xFF, 0x00, 0x05, 0x00, 0x00, 0x07, 0xFF, 0x05, 0x24, 0x06,
+	0xFF, 0x00, 0x06, 0x00, 0x00, 0x19, 0xFF, 0x00, 0x06, 0x00, 0x00, 0x06, 0xFF, 0x05, 0x24, 0x07,
+	0xFF, 0x00, 0x06, 0x00, 0x00, 0x17, 0xFF, 0x00, 0x06, 0x00, 0x00, 0x07, 0xFF, 0x05, 0x24, 0x07,
+	0xFF, 0x00, 0x07, 0x00, 0x00, 0x15, 0xFF, 0x00, 0x07, 0x00, 0x00, 0x07, 0xFF, 0x05, 0x25, 0x07,
+	0xFF, 0x00, 0x07, 0x00, 0x00, 0x13, 0xFF, 0x00, 0x07, 0x00, 0x00, 0x07, 0xFF, 0x05, 0x25, 0x08,
+	0xFF, 0x00, 0x07, 0x00, 0x00, 0x11, 0xFF, 0x00, 0x07, 0x00, 0x00, 0x08, 0xFF, 0x05, 0x26, 0x08,
+	0xFF, 0x00, 0x08, 0x00, 0x00, 0x0D, 0xFF, 0x00, 0x08, 0x00, 0x00, 0x08, 0xFF, 0x05, 0x27, 0x08,
+	0xFF, 0x00, 0x0A, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x0A, 0x00, 0x00, 0x08, 0xFF, 0x03, 0x28, 0x08,
+	0xFF, 0x00, 0x19, 0x00, 0x00, 0x08, 0xFF, 0x05, 0x27, 0x01, 0x00, 0x00, 0x09, 0xFF, 0x00, 0x17,
+	0x00, 0x00, 0x09, 0xFF, 0x00, 0x01, 0x00, 0x05, 0x26, 0x03, 0x00, 0x00, 0x0A, 0xFF, 0x00, 0x13,
+	0x00, 0x00, 0x0A, 0xFF, 0x00, 0x03, 0x00, 0x05, 0x25, 0x05, 0x00, 0x00, 0x0B, 0xFF, 0x00, 0x0F,
+	0x00, 0x00, 0x0B, 0xFF, 0x00, 0x05, 0x00, 0x05, 0x24, 0x07, 0x00, 0x00, 0x0D, 0xFF, 0x00, 0x09,
+	0x00, 0x00, 0x0D, 0xFF, 0x00, 0x07, 0x00, 0x03, 0x23, 0x09, 0x00, 0x01, 0x1F, 0xFF, 0x01, 0x09,
+	0x00, 0x03, 0x22, 0x09, 0x00, 0x03, 0x1D, 0xFF, 0x03, 0x09, 0x00, 0x03, 0x21, 0x09, 0x00, 0x05,
+	0x1B, 0xFF, 0x05, 0x09, 0x00, 0x03, 0x20, 0x09, 0x00, 0x08, 0x17, 0xFF, 0x08, 0x09, 0x00, 0x03,
+	0x1F, 0x09, 0x00, 0x0C, 0x11, 0xFF, 0x0C, 0x09, 0x00, 0x03, 0x1E, 0x09, 0x00, 0x10, 0x0B, 0xFF,
+	0x10, 0x09, 0x00, 0x03, 0x1F, 0x07, 0x00, 0x16, 0x05, 0x00, 0x12, 0x07, 0x00, 0x03, 0x20, 0x05,
+	0x00, 0x17, 0x05, 0x00, 0x13, 0x05, 0x00, 0x03, 0x21, 0x03, 0x00, 0x18, 0x05, 0x00, 0x14, 0x03,
+	0x00, 0x01, 0x00, 0x78, 0x00, 0x01, 0x00, 0x78, 0x00, 0x01, 0x00, 0x78, 0x00, 0x01, 0x00, 0x78,
+	0x00, 0x01, 0x00, 0x78, 0x00, 0x01, 0x3C, 0x05, 0x00, 0x01, 0x3C, 0x05, 0x00, 0x01, 0x3C, 0x05,
+	0x00, 0x01, 0x3C, 0x05, 0x00, 0x01, 0x3C, 0x05, 0x00, 0x01, 0x00, 0x78, 0x00, 0x01, 0x00, 0x78,
+	0x00, 0x01, 0x00, 0x78, 0x00, 0x01, 0x00, 0x78, 0x00, 0x01, 0x00, 0x78, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x01, 0x00, 0x78, 0x00, 0x01, 0x00, 0x78, 0x00, 0x01, 0x00, 0x78, 0x00, 0x01, 0x00,
+	0x78, 0x00, 0x01, 0x00, 0x78, 0x00,
+};
+constexpr uint8_t IconSprite_50n_S_runs[] = {
+	0x01, 0x4C, 0x07, 0xFF, 0x01, 0x49, 0x0D, 0xFF, 0x01, 0x47, 0x11, 0xFF, 0x01, 0x46, 0x13, 0xFF,
+	0x01, 0x44, 0x17, 0xFF, 0x01, 0x43, 0x19, 0xFF, 0x02, 0x40, 0x03, 0x00, 0x00, 0x19, 0xFF, 0x02,
+	0x3E, 0x04, 0x00, 0x00, 0x1B, 0xFF, 0x02, 0x3D, 0x04, 0x00, 0x00, 0x1D, 0xFF, 0x02, 0x3C, 0x05,
+	0x00, 0x00, 0x1D, 0xFF, 0x02, 0x3B, 0x05, 0x00, 0x00, 0x1F, 0xFF, 0x02, 0x3A, 0x06, 0x00, 0x00,
+	0x1F, 0xFF, 0x02, 0x3A, 0x06, 0x00, 0x00, 0x1F, 0xFF, 0x02, 0x39, 0x06, 0x00, 0x00, 0x21, 0xFF,
+	0x02, 0x39, 0x06, 0x00, 0x00, 0x21, 0xFF, 0x02, 0x39, 0x06, 0x00, 0x00, 0x21, 0xFF, 0x02, 0x39,
+	0x06, 0x00, 0x00, 0x21, 0xFF, 0x02, 0x39, 0x06, 0x00, 0x00, 0x21, 0xFF, 0x02, 0x39, 0x06, 0x00,
+	0x00, 0x21, 0xFF, 0x02, 0x39, 0x06, 0x00, 0x00, 0x21, 0xFF, 0x02, 0x3A, 0x06, 0x00, 0x00, 0x1F,
+	0xFF, 0x02, 0x3A, 0x06, 0x00, 0x00, 0x1F, 0xFF, 0x02, 0x3B, 0x05, 0x00, 0x00, 0x1F, 0xFF, 0x02,
+	0x3C, 0x05, 0x00, 0x00, 0x1D, 0xFF, 0x02, 0x3D, 0x04, 0x00, 0x00, 0x1D, 0xFF, 0x02, 0x3E, 0x04,
+	0x00, 0x00, 0x1B, 0xFF, 0x02, 0x40, 0x03, 0x00, 0x00, 0x19, 0xFF, 0x02, 0x1E, 0x05, 0x00, 0x20,
+	0x19, 0xFF, 0x02, 0x1E, 0x05, 0x00, 0x21, 0x17, 0xFF, 0x04, 0x16, 0x01, 0x00, 0x07, 0x05, 0x00,
+	0x02, 0x01, 0x00, 0x20, 0x13, 0xFF, 0x04, 0x15, 0x03, 0x00, 0x06, 0x05, 0x00, 0x01, 0x03, 0x00,
+	0x20, 0x11, 0xFF, 0x03, 0x14, 0x05, 0x00, 0x05, 0x0A, 0x00, 0x21, 0x0D, 0xFF, 0x04, 0x13, 0x07,
+	0x00, 0x02, 0x05, 0xFF, 0x00, 0x08, 0x00, 0x23, 0x07, 0xFF, 0x03, 0x12, 0x08, 0x00, 0x00, 0x09,
+	0xFF, 0x00, 0x07, 0x00, 0x05, 0x13, 0x05, 0x00, 0x00, 0x04, 0xFF, 0x00, 0x05, 0x00, 0x00, 0x04,
+	0xFF, 0x00, 0x04, 0x00, 0x05, 0x14, 0x03, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x09, 0x00, 0x00, 0x03,
+	0xFF, 0x00, 0x02, 0x00, 0x05, 0x15, 0x02, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x0B, 0x00, 0x00, 0x02,
+	0xFF, 0x00, 0x01, 0x00, 0x03, 0x16, 0x02, 0xFF, 0x00, 0x0D, 0x00, 0x00, 0x02, 0xFF, 0x03, 0x16,
+	0x02, 0xFF, 0x00, 0x0D, 0x00, 0x00, 0x02, 0xFF, 0x05, 0x15, 0x02, 0xFF, 0x00, 0x06, 0x00, 0x00,
+	0x03, 0xFF, 0x00, 0x06, 0x00, 0x00, 0x02, 0xFF, 0x05, 0x15, 0x02, 0xFF, 0x00, 0x05, 0x00, 0x00,
+	0x05, 0xFF, 0x00, 0x05, 0x00, 0x00, 0x02, 0xFF, 0x07, 0x10, 0x05, 0x00, 0x00, 0x02, 0xFF, 0x00,
+	0x05, 0x00, 0x00, 0x05, 0xFF, 0x00, 0x05, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x04, 0x00, 0x07, 0x10,
+	0x05, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x05, 0x00, 0x00, 0x05, 0xFF, 0x00, 0x05, 0x00, 0x00, 0x02,
+	0xFF, 0x00, 0x04, 0x00, 0x07, 0x10, 0x05, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x06, 0x00, 0x00, 0x03,
+	0xFF, 0x00, 0x06, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x04, 0x00, 0x05, 0x10, 0x06, 0x00, 0x00, 0x02,
+	0xFF, 0x00, 0x0D, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x05, 0x00, 0x05, 0x10, 0x06, 0x00, 0x00, 0x02,
+	0xFF, 0x00, 0x0D, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x05, 0x00, 0x05, 0x14, 0x03, 0x00, 0x00, 0x02,
+	0xFF, 0x00, 0x0B, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x02, 0x00, 0x05, 0x13, 0x04, 0x00, 0x00, 0x03,
+	0xFF, 0x00, 0x09, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x03, 0x00, 0x05, 0x12, 0x06, 0x00, 0x00, 0x04,
+	0xFF, 0x00, 0x05, 0x00, 0x00, 0x04, 0xFF, 0x00, 0x05, 0x00, 0x03, 0x13, 0x07, 0x00, 0x00, 0x09,
+	0xFF, 0x00, 0x06, 0x00, 0x03, 0x14, 0x05, 0x00, 0x03, 0x05, 0xFF, 0x00, 0x07, 0x00, 0x03, 0x15,
+	0x03, 0x00, 0x06, 0x05, 0x00, 0x01, 0x03, 0x00, 0x03, 0x16, 0x01, 0x00, 0x07, 0x05, 0x00, 0x02,
+	0x01, 0x00, 0x01, 0x1E, 0x05, 0x00, 0x01, 0x1E, 0x05, 0x00, 0x00, 0x01, 0x00, 0x3C, 0x00, 0x01,
+	0x00, 0x3C, 0x00, 0x01, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x01, 0x00, 0x3C, 0x00, 0x01, 0x00, 0x3C,
+	0x00, 0x01, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x01, 0x00, 0x3C, 0x00, 0x01, 0x00, 0x3C, 0x00, 0x01,
+	0x00, 0x3C, 0x00,
+};
+
+constexpr IconSpriteSpec IconSprites[] = {
+    {"01d", true, false, 0, -68, -68, 136, 136, IconSprite_01d_L_runs},
+    {"01d", false, false, 0, -24, -14, 48, 48, IconSprite_01d_S_runs},
+    {"01n", true, false, 0, -68, -68, 199, 136, IconSprite_01n_L_runs},
+    {"01n", false, false, 0, -24, -41, 90, 75, IconSprite_01n_S_runs},
+    {"02d", true, false, 0, -66, -57, 149, 91, IconSprite_02d_L_runs},
+    {"02d", false, false, 0, -38, -21, 71, 45, IconSprite_02d_S_runs},
+    {"02n", true, false, 0, -66, -63, 197, 97, IconSprite_02n_L_runs},
+    {"02n", false, false, 0, -38, -41, 104, 65, IconSprite_02n_S_runs},
+    {"03d", true, true, 102, -75, -45, 148, 79, IconSprite_03d_L_y102_runs},
+    {"03d", true, true, 120, -75, -49, 148, 83, IconSprite_03d_L_y120_runs},
+    {"03d", false, true, 305, -36, -23, 73, 48, IconSprite_03d_S_y305_runs},
+    {"03n", true, true, 102, -75, -63, 206, 97, IconSprite_03n_L_y102_runs},
+    {"03n", true, true, 120, -75, -63, 206, 97, IconSprite_03n_L_y120_runs},
+    {"03n", false, true, 305, -36, -41, 102, 66, IconSprite_03n_S_y305_runs},
+    {"04d", true, false, 0, -80, -61, 161, 97, IconSprite_04d_L_runs},
+    {"04d", false, false, 0, -38, -23, 67, 46, IconSprite_04d_S_runs},
+    {"04n", true, false, 0, -80, -63, 211, 99, IconSprite_04n_L_runs},
+    {"04n", false, false, 0, -38, -41, 104, 64, IconSprite_04n_S_runs},
+    {"09d", true, false, 0, -80, -61, 161, 128, IconSprite_09d_L_runs},
+    {"09d", false, false, 0, -38, -23, 63, 62, IconSprite_09d_S_runs},
+    {"09n", true, false, 0, -80, -63, 211, 130, IconSprite_09n_L_runs},
+    {"09n", false, false, 0, -38, -41, 104, 80, IconSprite_09n_S_runs},
+    {"10d", true, false, 0, -80, -46, 161, 113, IconSprite_10d_L_runs},
+    {"10d", false, false, 0, -28, -7, 57, 46, IconSprite_10d_S_runs},
+    {"10n", true, false, 0, -80, -63, 211, 130, IconSprite_10n_L_runs},
+    {"10n", false, false, 0, -28, -41, 94, 80, IconSprite_10n_S_runs},
+    {"11d", true, false, 0, -80, -56, 161, 122, IconSprite_11d_L_runs},
+    {"11d", false, false, 0, -28, -17, 61, 53, IconSprite_11d_S_runs},
+    {"11n", true, false, 0, -80, -63, 211, 129, IconSprite_11n_L_runs},
+    {"11n", false, false, 0, -28, -41, 94, 77, IconSprite_11n_S_runs},
+    {"13d", true, false, 0, -80, -61, 161, 110, IconSprite_13d_L_runs},
+    {"13d", false, false, 0, -28, -22, 57, 46, IconSprite_13d_S_runs},
+    {"13n", true, false, 0, -80, -63, 211, 112, IconSprite_13n_L_runs},
+    {"13n", false, false, 0, -28, -41, 94, 65, IconSprite_13n_S_runs},
+    {"50d", true, false, 0, -60, -40, 120, 95, IconSprite_50d_L_runs},
+    {"50d", false, false, 0, -30, -14, 60, 42, IconSprite_50d_S_runs},
+    {"50n", true, false, 0, -60, -63, 191, 118, IconSprite_50n_L_runs},
+    {"50n", false, false, 0, -30, -41, 96, 69, IconSprite_50n_S_runs},
+};
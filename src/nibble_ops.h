@@ -0,0 +1,266 @@
+/*
+ * Copyright (c) 2024 zahical. All rights reserved.
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+/**
+ * @file Bulk operations on packed 4bpp pixels.
+ *
+ * Each byte holds two pixels, one per nibble. The functions here transform whole byte ranges, all the nibbles at once:
+ * the portable versions work a machine word at a time (SWAR, "SIMD within a register": 8 pixels per 32-bit word on
+ * the ESP32, 16 per 64-bit word on the host), and on the host SSE2 or NEON is used when available, 32 pixels per
+ * vector. See FbView::invert_rect() and friends for the callers.
+ *
+ * Nibbles are always the 4-bit color, not the 8-bit one of the drawing API.
+ */
+
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+#if defined(HOST_BUILD) && defined(__SSE2__)
+#include <emmintrin.h>
+#define NIBBLE_OPS_SSE2 1
+#define NIBBLE_OPS_SIMD 1
+#elif defined(HOST_BUILD) && defined(__ARM_NEON)
+#include <arm_neon.h>
+#define NIBBLE_OPS_NEON 1
+#define NIBBLE_OPS_SIMD 1
+#endif
+
+namespace nibble_ops
+{
+
+/// Word-at-a-time implementations; see the dispatching functions below.
+namespace swar
+{
+using Word = uintptr_t;
+
+/// `b` in every byte of a word
+constexpr Word bytes(uint8_t b) { return ~Word{0} / 0xFF * b; }
+
+inline Word load(uint8_t const *p)
+{
+    Word w;
+    memcpy(&w, p, sizeof(w));
+    return w;
+}
+
+inline void store(uint8_t *p, Word w) { memcpy(p, &w, sizeof(w)); }
+
+/**
+ * @brief Applies `op` to the low and to the high nibbles of every word of `p`, spread out to one per byte (values
+ * 0..15 in 0x0F0F...); the remaining bytes are left to `tail`.
+ */
+template <typename FWord, typename FTail>
+void for_each(uint8_t *p, size_t n, FWord&& op, FTail&& tail)
+{
+    constexpr Word lo = bytes(0x0F);
+
+    for (; n >= sizeof(Word); n -= sizeof(Word), p += sizeof(Word))
+    {
+        Word const w = load(p);
+        store(p, op(w & lo) | op((w >> 4) & lo) << 4);
+    }
+
+    for (; n > 0; n--, p++)
+        *p = tail(*p & 0x0F) | tail(*p >> 4) << 4;
+}
+
+inline void invert(uint8_t *p, size_t n)
+{
+    for (; n >= sizeof(Word); n -= sizeof(Word), p += sizeof(Word))
+        store(p, ~load(p));
+
+    for (; n > 0; n--, p++)
+        *p = ~*p;
+}
+
+/// Saturating add of `delta` (-15..15) to every nibble.
+inline void add(uint8_t *p, size_t n, int8_t delta)
+{
+    constexpr Word one = bytes(0x01);
+
+    if (delta >= 0)
+    {
+        Word const d = bytes(delta);
+        // n + d <= 30; where it's > 15 (bit 4 set), all 4 bits are set
+        for_each(
+            p, n,
+            [d](Word v) {
+                v += d;
+                return (v | ((v >> 4) & one) * 0x0F) & bytes(0x0F);
+            },
+            [delta](uint8_t v) { return v + delta > 15 ? 15 : v + delta; });
+    }
+    else
+    {
+        Word const d = bytes(-delta);
+        // (16 + n) - d >= 1, no borrows between bytes; where it's < 16 (bit 4 clear), the result is 0
+        for_each(
+            p, n,
+            [d](Word v) {
+                v = (v | bytes(0x10)) - d;
+                return v & ((v >> 4) & one) * 0x0F;
+            },
+            [delta](uint8_t v) { return v + delta < 0 ? 0 : v + delta; });
+    }
+}
+
+/// Every nibble becomes 15 if it's >= `level` (0..15), 0 otherwise.
+inline void threshold(uint8_t *p, size_t n, uint8_t level)
+{
+    Word const d = bytes(16 - level);
+    // n + (16 - level) has bit 4 set iff n >= level
+    for_each(
+        p, n, [d](Word v) { return ((v + d) >> 4 & bytes(0x01)) * 0x0F; },
+        [level](uint8_t v) { return v >= level ? 15 : 0; });
+}
+} // namespace swar
+
+#if NIBBLE_OPS_SIMD
+/// Vector implementations of the bulk of a range, return the number of bytes done (a multiple of 16).
+namespace simd
+{
+#if NIBBLE_OPS_SSE2
+template <typename FVec>
+size_t for_each(uint8_t *p, size_t n, FVec&& op)
+{
+    __m128i const lo = _mm_set1_epi8(0x0F);
+    size_t i         = 0;
+
+    for (; i + 16 <= n; i += 16)
+    {
+        __m128i const v = _mm_loadu_si128(reinterpret_cast<__m128i const *>(p + i));
+        __m128i const l = op(_mm_and_si128(v, lo));
+        __m128i const h = op(_mm_and_si128(_mm_srli_epi16(v, 4), lo));
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(p + i), _mm_or_si128(l, _mm_slli_epi16(h, 4)));
+    }
+    return i;
+}
+
+inline size_t invert(uint8_t *p, size_t n)
+{
+    size_t i = 0;
+    for (; i + 16 <= n; i += 16)
+    {
+        __m128i const v = _mm_loadu_si128(reinterpret_cast<__m128i const *>(p + i));
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(p + i), _mm_xor_si128(v, _mm_set1_epi8(-1)));
+    }
+    return i;
+}
+
+inline size_t add(uint8_t *p, size_t n, int8_t delta)
+{
+    __m128i const d = _mm_set1_epi8(delta >= 0 ? delta : -delta);
+    if (delta >= 0)
+        return for_each(p, n, [d](__m128i v) { return _mm_min_epu8(_mm_add_epi8(v, d), _mm_set1_epi8(0x0F)); });
+    return for_each(p, n, [d](__m128i v) { return _mm_subs_epu8(v, d); });
+}
+
+inline size_t threshold(uint8_t *p, size_t n, uint8_t level)
+{
+    __m128i const t = _mm_set1_epi8(level);
+    return for_each(p, n, [t](__m128i v) {
+        return _mm_and_si128(_mm_cmpeq_epi8(_mm_max_epu8(v, t), v), _mm_set1_epi8(0x0F));
+    });
+}
+#else
+template <typename FVec>
+size_t for_each(uint8_t *p, size_t n, FVec&& op)
+{
+    uint8x16_t const lo = vdupq_n_u8(0x0F);
+    size_t i            = 0;
+
+    for (; i + 16 <= n; i += 16)
+    {
+        uint8x16_t const v = vld1q_u8(p + i);
+        uint8x16_t const l = op(vandq_u8(v, lo));
+        uint8x16_t const h = op(vshrq_n_u8(v, 4));
+        vst1q_u8(p + i, vorrq_u8(l, vshlq_n_u8(h, 4)));
+    }
+    return i;
+}
+
+inline size_t invert(uint8_t *p, size_t n)
+{
+    size_t i = 0;
+    for (; i + 16 <= n; i += 16)
+        vst1q_u8(p + i, vmvnq_u8(vld1q_u8(p + i)));
+    return i;
+}
+
+inline size_t add(uint8_t *p, size_t n, int8_t delta)
+{
+    uint8x16_t const d = vdupq_n_u8(delta >= 0 ? delta : -delta);
+    if (delta >= 0)
+        return for_each(p, n, [d](uint8x16_t v) { return vminq_u8(vaddq_u8(v, d), vdupq_n_u8(0x0F)); });
+    return for_each(p, n, [d](uint8x16_t v) { return vqsubq_u8(v, d); });
+}
+
+inline size_t threshold(uint8_t *p, size_t n, uint8_t level)
+{
+    uint8x16_t const t = vdupq_n_u8(level);
+    return for_each(p, n, [t](uint8x16_t v) {
+        return vandq_u8(vcgeq_u8(v, t), vdupq_n_u8(0x0F));
+    });
+}
+#endif
+} // namespace simd
+#endif
+
+/// Inverts every nibble (15 - n).
+inline void invert(uint8_t *p, size_t n)
+{
+    size_t done = 0;
+#if NIBBLE_OPS_SIMD
+    done = simd::invert(p, n);
+#endif
+    swar::invert(p + done, n - done);
+}
+
+/// Saturating add of `delta` (-15..15) to every nibble.
+inline void add(uint8_t *p, size_t n, int8_t delta)
+{
+    size_t done = 0;
+#if NIBBLE_OPS_SIMD
+    done = simd::add(p, n, delta);
+#endif
+    swar::add(p + done, n - done, delta);
+}
+
+/// Every nibble becomes 15 if it's >= `level` (0..15), 0 otherwise.
+inline void threshold(uint8_t *p, size_t n, uint8_t level)
+{
+    size_t done = 0;
+#if NIBBLE_OPS_SIMD
+    done = simd::threshold(p, n, level);
+#endif
+    swar::threshold(p + done, n - done, level);
+}
+
+/**
+ * @brief Packs `pixels` (even) nibbles into bits, 8 pixels per byte with the first one in the lowest bit: a bit is set
+ * where the nibble is < `level` (0..16), i.e. dark. The 1bpp format of the EPD driver's epd_draw_frame_1bit().
+ */
+inline void pack_1bit(uint8_t const *src, uint8_t *dst, size_t pixels, uint8_t level)
+{
+    // the two bits of a byte: the low nibble's, then the high one's
+    auto dark = [level](uint8_t b) { return ((b & 0x0F) < level) | ((b >> 4) < level) << 1; };
+
+    size_t const bytes = pixels / 2;
+    size_t i           = 0;
+    for (; i + 4 <= bytes; i += 4)
+        *dst++ = dark(src[i]) | dark(src[i + 1]) << 2 | dark(src[i + 2]) << 4 | dark(src[i + 3]) << 6;
+
+    if (i < bytes)
+    {
+        uint8_t last = 0;
+        for (unsigned shift = 0; i < bytes; i++, shift += 2)
+            last |= dark(src[i]) << shift;
+        *dst = last;
+    }
+}
+
+} // namespace nibble_ops
@@ -0,0 +1,139 @@
+/*
+ * Copyright (c) 2024 zahical. All rights reserved.
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+/**
+ * @file Refresh policy implementation.
+ */
+
+#include "refresh_policy.h"
+#include "config.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+
+namespace
+{
+constexpr uint32_t Magic = 0x52465331; // "RFS1"
+
+constexpr int32_t Stride     = EPD_WIDTH / 2;
+constexpr int32_t RegionW    = RefreshState::RegionW;
+constexpr int32_t RegionH    = RefreshState::RegionH;
+constexpr int32_t RegionSize = RegionW * RegionH;
+static_assert(RegionW * RefreshState::Cols == EPD_WIDTH && RegionH * RefreshState::Rows == EPD_HEIGHT,
+              "the regions should tile the screen");
+static_assert(RegionW % 2 == 0, "regions should start on a framebuffer byte");
+
+/// Fills in the change of every region, see RefreshPlan::change. Only the dirty areas are looked at.
+void measure_change(RefreshPlan& plan, uint8_t const *prev, uint8_t const *next)
+{
+    uint32_t sums[RefreshState::Rows][RefreshState::Cols] = {};
+
+    for (size_t i = 0; i < plan.dirty.count; i++)
+    {
+        Rect_t const& r = plan.dirty.rects[i];
+        for (int32_t y = r.y; y < r.y + r.height; y++)
+        {
+            uint32_t *row_sums = sums[y / RegionH];
+            for (int32_t b = r.x / 2; b < (r.x + r.width) / 2; b++)
+            {
+                uint8_t const p = prev[y * Stride + b], n = next[y * Stride + b];
+                row_sums[b * 2 / RegionW] += std::abs((p & 0x0F) - (n & 0x0F)) + std::abs((p >> 4) - (n >> 4));
+            }
+        }
+    }
+
+    for (int32_t ry = 0; ry < RefreshState::Rows; ry++)
+        for (int32_t rx = 0; rx < RefreshState::Cols; rx++)
+            plan.change[ry][rx] = sums[ry][rx] * 100 / (15 * RegionSize);
+}
+
+/// Calls `f(row, col)` for every region the dirty areas of `plan` overlap.
+template <typename F>
+void for_each_changed_region(RefreshPlan const& plan, F&& f)
+{
+    bool seen[RefreshState::Rows][RefreshState::Cols] = {};
+
+    for (size_t i = 0; i < plan.dirty.count; i++)
+    {
+        Rect_t const& r = plan.dirty.rects[i];
+        for (int32_t ry = r.y / RegionH; ry <= (r.y + r.height - 1) / RegionH; ry++)
+            for (int32_t rx = r.x / RegionW; rx <= (r.x + r.width - 1) / RegionW; rx++)
+                if (!seen[ry][rx])
+                {
+                    seen[ry][rx] = true;
+                    f(ry, rx);
+                }
+    }
+}
+
+bool too_old(RefreshState const& state, int64_t now)
+{
+    return now - state.last_full >= std::chrono::seconds{cfg::FullRefreshMaxAge}.count();
+}
+} // namespace
+
+void init_refresh_state(RefreshState& state)
+{
+    if (state.magic != Magic) memset(&state, 0, sizeof(state));
+}
+
+RefreshPlan plan_refresh(RefreshState const& state, uint8_t const *prev, uint8_t const *next, int64_t now)
+{
+    RefreshPlan plan{};
+
+    auto decide = [&plan](Refresh kind, char const *reason) -> RefreshPlan& {
+        plan.kind   = kind;
+        plan.reason = reason;
+        return plan;
+    };
+
+    if (!prev) return decide(Refresh::Full, "the screen content is not known");
+    if (state.magic != Magic) return decide(Refresh::Full, "no refresh history");
+    if (too_old(state, now)) return decide(Refresh::Full, "too long since the last full refresh");
+
+    plan.dirty = find_dirty_rects(prev, next);
+    if (plan.dirty.count == 0) return decide(Refresh::None, "nothing changed");
+    if (plan.dirty.rows > int32_t(cfg::PartialRowsLimit)) return decide(Refresh::Full, "too much changed");
+
+    measure_change(plan, prev, next);
+
+    char const *limit = nullptr;
+    for_each_changed_region(plan, [&](int32_t ry, int32_t rx) {
+        if (state.partials[ry][rx] + 1u >= cfg::FullRefreshEvery)
+            limit = "a region is at its limit of partial refreshes";
+        else if (!limit && state.change[ry][rx] + plan.change[ry][rx] >= cfg::RegionChangeLimit)
+            limit = "a region changed too much since the last full refresh";
+    });
+    if (limit) return decide(Refresh::Full, limit);
+
+    return decide(Refresh::Partial, "");
+}
+
+void record_partial_refresh(RefreshState& state, RefreshPlan const& plan)
+{
+    for_each_changed_region(plan, [&](int32_t ry, int32_t rx) {
+        state.partials[ry][rx] = std::min(state.partials[ry][rx] + 1, 0xFF);
+        state.change[ry][rx]   = std::min(state.change[ry][rx] + plan.change[ry][rx], 0xFFFF);
+    });
+}
+
+void record_full_refresh(RefreshState& state, int64_t now)
+{
+    memset(&state, 0, sizeof(state));
+    state.magic     = Magic;
+    state.last_full = now;
+}
+
+bool full_refresh_due(RefreshState const& state, int64_t now)
+{
+    if (state.magic != Magic || too_old(state, now)) return true;
+
+    for (int32_t ry = 0; ry < RefreshState::Rows; ry++)
+        for (int32_t rx = 0; rx < RefreshState::Cols; rx++)
+            if (state.partials[ry][rx] + 1u >= cfg::FullRefreshEvery) return true;
+    return false;
+}
@@ -0,0 +1,86 @@
+/*
+ * Copyright (c) 2024 zahical. All rights reserved.
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+/**
+ * @file Choosing between a full, a partial and no refresh of the screen.
+ *
+ * A partial refresh (see dirty_rects.h) leaves some ghosting behind: the more of it, the more often an area has been
+ * redrawn since it was last fully cleared, and the more its grey levels changed. A full refresh clears it all, but
+ * takes much longer. So the screen is split into a grid of regions, and for each the partial refreshes since the last
+ * full one and the grey level change they made are counted; these, along with the time since the last full refresh,
+ * decide the next refresh (see plan_refresh()). The thresholds are in config.cpp.
+ *
+ * The counters are a few hundred bytes, meant to be kept in RTC memory across deep sleep.
+ */
+
+#pragma once
+#include "dirty_rects.h"
+
+#include <cstdint>
+
+enum class Refresh : uint8_t
+{
+    None,
+    Partial,
+    Full,
+};
+
+/// The partial refresh history of the screen.
+struct RefreshState
+{
+    // regions of 120 x 90 pixels
+    static constexpr int32_t Cols    = 8;
+    static constexpr int32_t Rows    = 6;
+    static constexpr int32_t RegionW = EPD_WIDTH / Cols;
+    static constexpr int32_t RegionH = EPD_HEIGHT / Rows;
+
+    uint32_t magic;
+    /// When the last full refresh was done, in seconds.
+    int64_t last_full;
+    /// The partial refreshes of every region since then.
+    uint8_t partials[Rows][Cols];
+    /// The grey level change they made in every region, in % of all of its pixels going from black to white.
+    uint16_t change[Rows][Cols];
+};
+
+struct RefreshPlan
+{
+    Refresh kind;
+    /// Why, for the log.
+    char const *reason;
+    /// The areas that changed.
+    DirtyRects dirty;
+    /// The grey level change of every region, see RefreshState::change.
+    uint8_t change[RefreshState::Rows][RefreshState::Cols];
+};
+
+/**
+ * @brief Clears `state` if it's not valid (as after a cold boot), but leaves it not valid: what's on the screen then
+ * isn't known, so the next refresh is a full one, and only record_full_refresh() makes `state` valid again.
+ */
+void init_refresh_state(RefreshState& state);
+
+/**
+ * @brief Decides how the screen goes from showing the full-screen framebuffer `prev` (null if that's not known) to
+ * showing `next`, at `now` (in seconds).
+ *
+ * A full refresh, if `prev` is not known, or cfg::FullRefreshMaxAge has passed since the last full refresh; else none,
+ * if the frames are the same; else a full one, if the changes span more than cfg::PartialRowsLimit rows, or if any
+ * changed region would reach cfg::FullRefreshEvery partial refreshes or cfg::RegionChangeLimit change; else a partial
+ * refresh of the changed areas.
+ */
+RefreshPlan plan_refresh(RefreshState const& state, uint8_t const *prev, uint8_t const *next, int64_t now);
+
+/// Updates `state` after a partial refresh of `plan`.
+void record_partial_refresh(RefreshState& state, RefreshPlan const& plan);
+
+/// Updates `state` after a full refresh at `now`.
+void record_full_refresh(RefreshState& state, int64_t now);
+
+/**
+ * @brief Whether a full refresh is due at `now` whatever the next frame: it's too long since the last one, or some
+ * region is at its limit of partial refreshes (that region might not change, so this errs on the side of a full one).
+ */
+bool full_refresh_due(RefreshState const& state, int64_t now);
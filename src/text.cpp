@@ -0,0 +1,264 @@
+/*
+ * Copyright (c) 2024 zahical. All rights reserved.
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+/**
+ * @file Text measuring and drawing implementation.
+ *
+ * The measuring and drawing logic follows the EPD driver's font.c closely, so that the output stays pixel-identical.
+ */
+
+#include "text.h"
+
+#ifndef HOST_BUILD
+#include "zlib/zlib.h" // the one bundled with the EPD driver
+#else
+#include <zlib.h>
+#endif
+
+#include <algorithm>
+#include <cstdlib>
+
+namespace
+{
+
+constexpr uint16_t NoGlyph = 0xFFFF;
+
+constexpr FontProperties default_props = {.fg_color = 0, .bg_color = 15, .fallback_glyph = 0, .flags = 0};
+
+/// Decodes the next UTF-8 code point and advances `str` past it. Returns 0 at the end of the string.
+uint32_t next_cp(char const *& str)
+{
+    uint8_t const *s = reinterpret_cast<uint8_t const *>(str);
+    if (*s == 0) return 0;
+
+    int len;
+    uint32_t cp;
+    if (*s < 0x80)
+        len = 1, cp = *s;
+    else if ((*s & 0xE0) == 0xC0)
+        len = 2, cp = *s & 0x1F;
+    else if ((*s & 0xF0) == 0xE0)
+        len = 3, cp = *s & 0x0F;
+    else
+        len = 4, cp = *s & 0x07;
+
+    int i = 1;
+    for (; i < len && s[i] != 0; i++)
+        cp = (cp << 6) | (s[i] & 0x3F);
+
+    str += i; // don't skip past the terminator of a truncated sequence
+    return cp;
+}
+
+GFXglyph const *find_glyph_or_fallback(FontFace const& face, uint32_t cp, FontProperties const& props)
+{
+    GFXglyph const *glyph = find_glyph(face, cp);
+    return glyph ? glyph : find_glyph(face, props.fallback_glyph);
+}
+
+/// Moves the cursor (*x) forward and extends the given bounds with the glyph's bounds, when drawn at (x, y).
+void add_char_bounds(FontFace const& face, uint32_t cp, int32_t *x, int32_t *y, int32_t *minx, int32_t *miny,
+                     int32_t *maxx, int32_t *maxy, FontProperties const& props)
+{
+    GFXglyph const *glyph = find_glyph_or_fallback(face, cp, props);
+    if (!glyph) return;
+
+    int32_t x1 = *x + glyph->left;
+    int32_t y1 = *y + (glyph->top - glyph->height);
+    int32_t x2 = x1 + glyph->width;
+    int32_t y2 = y1 + glyph->height;
+
+    // background needs to be taken into account
+    if (props.flags & DRAW_BACKGROUND)
+    {
+        *minx = std::min(*x, std::min(*minx, x1));
+        *maxx = std::max(std::max(*x + glyph->advance_x, x2), *maxx);
+        *miny = std::min(*y + face.font->descender, std::min(*miny, y1));
+        *maxy = std::max(face.font->descender + face.font->advance_y, std::max(*maxy, y2));
+    }
+    else
+    {
+        *minx = std::min(*minx, x1);
+        *miny = std::min(*miny, y1);
+        *maxx = std::max(*maxx, x2);
+        *maxy = std::max(*maxy, y2);
+    }
+    *x += glyph->advance_x;
+}
+
+void draw_char(FontFace const& face, ScreenView& fb, int32_t *cursor_x, int32_t cursor_y, uint32_t cp,
+               FontProperties const& props)
+{
+    GFXglyph const *glyph = find_glyph_or_fallback(face, cp, props);
+    if (!glyph) return;
+
+    int32_t const width      = glyph->width;
+    int32_t const height     = glyph->height;
+    int32_t const byte_width = width / 2 + width % 2;
+
+    // clip the glyph box once; glyphs that are entirely outside don't even get decompressed
+    Rect_t const clip       = fb.clip();
+    int32_t const top       = cursor_y - glyph->top;
+    int32_t const start_pos = *cursor_x + glyph->left;
+    int32_t const first_y   = std::max(0, clip.y - top);
+    int32_t const end_y     = std::min(height, clip.y + clip.height - top);
+    int32_t const first_xx  = std::max(clip.x, start_pos);
+    int32_t const max_xx    = std::min(start_pos + width, clip.x + clip.width);
+
+    *cursor_x += glyph->advance_x;
+
+    if (first_y >= end_y || first_xx >= max_xx) return;
+
+    unsigned long bitmap_size = byte_width * height;
+    uint8_t *bitmap;
+    if (face.font->compressed)
+    {
+        bitmap = (uint8_t *)malloc(bitmap_size);
+        if (!bitmap) return;
+        uncompress(bitmap, &bitmap_size, &face.font->bitmap[glyph->data_offset], glyph->compressed_size);
+    }
+    else
+        bitmap = &face.font->bitmap[glyph->data_offset];
+
+    uint8_t color_lut[16];
+    int32_t const color_difference = (int32_t)props.fg_color - (int32_t)props.bg_color;
+    for (int32_t c = 0; c < 16; c++)
+        color_lut[c] = std::max(0, std::min(15, props.bg_color + c * color_difference / 15));
+
+    for (int32_t y = first_y; y < end_y; y++)
+    {
+        uint8_t *row          = fb.row(top + y);
+        uint8_t const *bm_row = &bitmap[y * byte_width];
+
+        for (int32_t xx = first_xx, x = first_xx - start_pos; xx < max_xx; xx++, x++)
+        {
+            uint8_t bm = (x & 1) ? bm_row[x / 2] >> 4 : bm_row[x / 2] & 0x0F;
+            ScreenView::put(xx, row, color_lut[bm]);
+        }
+    }
+
+    if (face.font->compressed) free(bitmap);
+}
+
+} // namespace
+
+GFXglyph const *find_glyph(FontFace const& face, uint32_t code_point)
+{
+    if (code_point < 256 && face.latin1)
+    {
+        uint16_t index = face.latin1[code_point];
+        return index == NoGlyph ? nullptr : &face.font->glyph[index];
+    }
+
+    // the intervals are sorted and don't overlap
+    UnicodeInterval const *begin = face.font->intervals;
+    UnicodeInterval const *end   = begin + face.font->interval_count;
+    UnicodeInterval const *it    = std::lower_bound(
+        begin, end, code_point, [](UnicodeInterval const& i, uint32_t cp) { return i.last < cp; });
+
+    if (it == end || code_point < it->first) return nullptr;
+
+    return &face.font->glyph[it->offset + (code_point - it->first)];
+}
+
+void text_bounds(FontFace const& face, char const *str, int32_t *x, int32_t *y, int32_t *x1, int32_t *y1, int32_t *w,
+                 int32_t *h, FontProperties const *props)
+{
+    FontProperties const& p = props ? *props : default_props;
+
+    if (*str == '\0')
+    {
+        *w  = 0;
+        *h  = 0;
+        *y1 = *y;
+        *x1 = *x;
+        return;
+    }
+
+    int32_t minx = 100000, miny = 100000, maxx = -1, maxy = -1;
+    int32_t original_x = *x;
+
+    while (uint32_t cp = next_cp(str))
+        add_char_bounds(face, cp, x, y, &minx, &miny, &maxx, &maxy, p);
+
+    *x1 = std::min(original_x, minx);
+    *w  = maxx - *x1;
+    *y1 = miny;
+    *h  = maxy - miny;
+}
+
+Rect_t text_box(FontFace const& face, char const *str, int32_t cursor_x, int32_t cursor_y, FontProperties const *props)
+{
+    FontProperties const& p = props ? *props : default_props;
+
+    if (*str == '\0') return {cursor_x, cursor_y, 0, 0};
+
+    int32_t left = cursor_x, right = cursor_x, top = cursor_y, bottom = cursor_y;
+
+    if (p.flags & DRAW_BACKGROUND)
+    {
+        // the background, as draw_text() fills it
+        int32_t x = cursor_x, y = cursor_y, x1, y1, w, h;
+        text_bounds(face, str, &x, &y, &x1, &y1, &w, &h, &p);
+
+        right  = cursor_x + w;
+        top    = cursor_y - (face.font->advance_y - (cursor_y - y1));
+        bottom = top + face.font->advance_y;
+    }
+
+    int32_t x = cursor_x;
+    while (uint32_t cp = next_cp(str))
+    {
+        GFXglyph const *glyph = find_glyph_or_fallback(face, cp, p);
+        if (!glyph) continue;
+
+        left   = std::min(left, x + glyph->left);
+        right  = std::max(right, x + glyph->left + glyph->width);
+        top    = std::min(top, cursor_y - glyph->top);
+        bottom = std::max(bottom, cursor_y - glyph->top + glyph->height);
+        x += glyph->advance_x;
+    }
+
+    return {left, top, right - left, bottom - top};
+}
+
+void draw_text(FontFace const& face, char const *str, int32_t *cursor_x, int32_t *cursor_y, ScreenView& fb,
+               FontProperties const *props)
+{
+    if (*str == '\0') return;
+
+    FontProperties const& p = props ? *props : default_props;
+
+    if (p.flags & DRAW_BACKGROUND)
+    {
+        int32_t x1 = 0, y1 = 0, w = 0, h = 0;
+        int32_t tmp_x = *cursor_x, tmp_y = *cursor_y;
+        text_bounds(face, str, &tmp_x, &tmp_y, &x1, &y1, &w, &h, &p);
+
+        int32_t baseline_height = *cursor_y - y1;
+        for (int32_t l = 0; l < face.font->advance_y; l++)
+            fb.hline(*cursor_x, *cursor_y - (face.font->advance_y - baseline_height) + l, w, p.bg_color << 4);
+    }
+
+    while (uint32_t cp = next_cp(str))
+        draw_char(face, fb, cursor_x, *cursor_y, cp, p);
+}
+
+void draw_text_multiline(FontFace const& face, char const *str, int32_t *cursor_x, int32_t *cursor_y, ScreenView& fb)
+{
+    int32_t const line_start = *cursor_x;
+
+    while (uint32_t cp = next_cp(str))
+    {
+        if (cp == '\n')
+        {
+            *cursor_x = line_start;
+            *cursor_y += face.font->advance_y;
+        }
+        else
+            draw_char(face, fb, cursor_x, *cursor_y, cp, default_props);
+    }
+    *cursor_y += face.font->advance_y;
+}
\ No newline at end of file
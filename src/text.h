@@ -0,0 +1,67 @@
+/*
+ * Copyright (c) 2024 zahical. All rights reserved.
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+/**
+ * @file Text measuring and drawing.
+ *
+ * Drop-in replacements for the EPD driver's get_text_bounds(), write_mode() and write_string(), producing exactly the
+ * same output. The driver finds a glyph by scanning the font's unicode intervals for every character, both when
+ * measuring and when drawing; these use the direct Latin-1 glyph index emitted by scripts/fontconvert.py instead and
+ * only fall back to a binary search of the intervals for code points above 0xFF.
+ */
+
+#pragma once
+#include "fb_view.h"
+#include <epd_driver.h>
+
+#include <cstdint>
+
+/**
+ * @brief A font, along with its direct code point to glyph index table for the Latin-1 range.
+ */
+struct FontFace
+{
+    GFXfont const *font;
+    /// Glyph index for code points 0..255, 0xFFFF if the font has no glyph for it (the `<Name>Latin1` table).
+    uint16_t const *latin1;
+};
+
+/**
+ * @brief Finds the glyph for a code point.
+ *
+ * @return nullptr, if the font has no such glyph.
+ */
+GFXglyph const *find_glyph(FontFace const& face, uint32_t code_point);
+
+/**
+ * @brief Gets the bounds of a string, when drawn at (x, y). Same as get_text_bounds().
+ *
+ * Set `props` to nullptr to use the defaults.
+ */
+void text_bounds(FontFace const& face, char const *str, int32_t *x, int32_t *y, int32_t *x1, int32_t *y1, int32_t *w,
+                 int32_t *h, FontProperties const *props);
+
+/**
+ * @brief Gets the framebuffer area draw_text() may draw to, with the same arguments (the cursor is not moved).
+ *
+ * Unlike text_bounds(), this is the exact extent of the glyph boxes (and of the background, if drawn). Set `props` to
+ * nullptr to use the defaults.
+ */
+Rect_t text_box(FontFace const& face, char const *str, int32_t cursor_x, int32_t cursor_y, FontProperties const *props);
+
+/**
+ * @brief Draws a single line of text to the framebuffer. Same as write_mode() with a non-null framebuffer.
+ *
+ * Drawing is clipped to the view's clip rect. Set `props` to nullptr to use the defaults.
+ */
+void draw_text(FontFace const& face, char const *str, int32_t *cursor_x, int32_t *cursor_y, ScreenView& fb,
+               FontProperties const *props);
+
+/**
+ * @brief Draws a (multi-line) string to the framebuffer. Same as write_string().
+ *
+ * Drawing is clipped to the view's clip rect.
+ */
+void draw_text_multiline(FontFace const& face, char const *str, int32_t *cursor_x, int32_t *cursor_y, ScreenView& fb);
\ No newline at end of file
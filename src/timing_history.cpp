@@ -0,0 +1,150 @@
+/*
+ * Copyright (c) 2024 zahical. All rights reserved.
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+/**
+ * @file Timing history implementation.
+ */
+
+#include "timing_history.h"
+
+#include <Arduino.h>
+#include <esp_attr.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+
+namespace
+{
+constexpr size_t Phases = size_t(TimeEvent::_MAX);
+
+constexpr uint32_t Magic = 0x31484d54 ^ Phases; // "TMH1"
+
+/// Codes are 2 + log(ms) / log(Step), rounded; 1 is under a millisecond, 0 a phase not measured in that cycle.
+constexpr double Step = 1.08;
+
+struct History
+{
+    uint32_t magic;
+    /// The slot the next cycle goes into.
+    uint16_t next;
+    uint16_t count;
+    uint8_t codes[HistoryCycles][Phases];
+};
+
+RTC_DATA_ATTR History history;
+
+#ifdef HOST_BUILD
+char const *const HistoryPath = "timing_history.bin";
+#endif
+
+/// Makes `history` valid: on the host, reads it from its file.
+History& get_history()
+{
+#ifdef HOST_BUILD
+    static bool loaded = false;
+    if (!loaded)
+    {
+        loaded  = true;
+        FILE *f = fopen(HistoryPath, "rb");
+        if (f)
+        {
+            if (fread(&history, sizeof(history), 1, f) != 1) history.magic = 0;
+            fclose(f);
+        }
+    }
+#endif
+
+    if (history.magic != Magic || history.count > HistoryCycles || history.next >= HistoryCycles)
+    {
+        history       = {};
+        history.magic = Magic;
+    }
+    return history;
+}
+
+void store_history()
+{
+#ifdef HOST_BUILD
+    FILE *f = fopen(HistoryPath, "wb");
+    if (!f) return;
+    fwrite(&history, sizeof(history), 1, f);
+    fclose(f);
+#endif
+}
+
+uint8_t encode(uint32_t ms)
+{
+    return ms == 0 ? 1 : uint8_t(std::min(255.0, 2 + std::round(std::log(ms) / std::log(Step))));
+}
+
+uint32_t decode(uint8_t code) { return code <= 1 ? 0 : uint32_t(std::lround(std::pow(Step, code - 2))); }
+
+void print_summary(char const *name, PhaseSummary const& s)
+{
+    if (s.cycles == 0) return;
+
+    Serial.println(String(name) + ": last " + String(s.last_ms) + " ms, p50 " + String(s.p50_ms) + " ms, p90 " +
+                   String(s.p90_ms) + " ms, max " + String(s.max_ms) + " ms");
+}
+
+} // namespace
+
+void record_timing_history()
+{
+    History& h = get_history();
+
+    for (size_t p = 0; p < Phases; p++)
+    {
+        SpanStats const stats = get_span_stats(SpanId(p));
+        h.codes[h.next][p]    = stats.count == 0 ? 0 : encode((stats.total_us + 500) / 1000);
+    }
+
+    h.next  = (h.next + 1) % HistoryCycles;
+    h.count = std::min<size_t>(h.count + 1, HistoryCycles);
+    store_history();
+}
+
+PhaseSummary timing_summary(std::initializer_list<TimeEvent> phases)
+{
+    History const& h = get_history();
+
+    PhaseSummary s;
+    uint32_t sums[HistoryCycles];
+    size_t n = 0;
+    for (size_t c = 0; c < h.count; c++)
+    {
+        uint32_t sum  = 0;
+        bool measured = false;
+        for (TimeEvent e : phases)
+        {
+            uint8_t const code = h.codes[c][size_t(e)];
+            if (code == 0) continue;
+            sum += decode(code);
+            measured = true;
+        }
+        if (!measured) continue;
+
+        if (c == (h.next + HistoryCycles - 1) % HistoryCycles) s.last_ms = sum;
+        sums[n++] = sum;
+    }
+    if (n == 0) return s;
+
+    // nearest rank
+    std::sort(sums, sums + n);
+    s.cycles = n;
+    s.p50_ms = sums[(n * 50 + 99) / 100 - 1];
+    s.p90_ms = sums[(n * 90 + 99) / 100 - 1];
+    s.max_ms = sums[n - 1];
+    return s;
+}
+
+void dump_timing_history()
+{
+    Serial.println("Over the last " + String((int)get_history().count) + " cycles:");
+
+    for (size_t p = 0; p < Phases; p++)
+        print_summary(span_name(SpanId(p)), timing_summary({TimeEvent(p)}));
+}
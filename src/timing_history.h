@@ -0,0 +1,44 @@
+/*
+ * Copyright (c) 2024 zahical. All rights reserved.
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+/**
+ * @file The phase durations (see timings.h) of the last refresh cycles, kept across deep sleep.
+ *
+ * A ring buffer of the last HistoryCycles cycles, a week of the default schedule, in RTC memory (on the host, in a file
+ * next to output.png); it survives deep sleep but not a power loss. To fit, every duration is stored in a byte, on a
+ * logarithmic scale: it comes back within about 4% of what was measured, which is plenty to tell a regression from the
+ * usual spread.
+ */
+
+#pragma once
+#include "timings.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+
+/// The number of cycles kept.
+constexpr size_t HistoryCycles = 112;
+
+/// The durations of some phases, taken together, over the cycles kept.
+struct PhaseSummary
+{
+    /// The cycles in which any of the phases was measured.
+    uint16_t cycles = 0;
+    /// In the last cycle kept, 0 if none of the phases was measured then.
+    uint32_t last_ms = 0;
+    uint32_t p50_ms  = 0;
+    uint32_t p90_ms  = 0;
+    uint32_t max_ms  = 0;
+};
+
+/// Adds the phase durations of this cycle to the history, replacing the oldest cycle if it's full.
+void record_timing_history();
+
+/// The summary of the sum of the durations of `phases` in each cycle kept.
+PhaseSummary timing_summary(std::initializer_list<TimeEvent> phases);
+
+/// Prints the summary of every phase using Serial.print().
+void dump_timing_history();
@@ -5,15 +5,26 @@
 
 /**
  * @file Timings implementation.
- */ 
+ */
 
 #include "timings.h"
+
+#ifndef NO_TIMINGS
+
 #include <Arduino.h>
+#include <algorithm>
+#include <atomic>
 #include <cassert>
 #include <chrono>
+#include <cstring>
+#include <mutex>
 #include <type_traits>
 
-using std::chrono::milliseconds;
+#ifndef HOST_BUILD
+#include <esp_timer.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
+#endif
 
 namespace
 {
@@ -25,73 +36,312 @@ constexpr typename std::underlying_type<E>::type to_val(E e) noexcept
     return static_cast<typename std::underlying_type<E>::type>(e);
 }
 
-using timing_t = unsigned long; // ret type of millis()
+/// Of the spans defined by name.
+constexpr size_t MaxSpans = 32;
+/// Spans under different parents are different nodes.
+constexpr size_t MaxNodes = 96;
+/// Of the spans open at once on a task.
+constexpr size_t MaxDepth = 12;
+/// Of the tasks with spans open at once; the host renders on a thread pool.
+#ifndef HOST_BUILD
+constexpr size_t MaxTasks = 8;
+#else
+constexpr size_t MaxTasks = 64;
+#endif
 
-struct Timing
-{
-    char const *const name;
-    timing_t start;
-    timing_t end;
-};
+using NodeId            = uint8_t;
+constexpr NodeId NoNode = 0xFF;
+static_assert(MaxNodes < NoNode && to_val(TimeEvent::_MAX) + MaxSpans <= 0xFF, "ids should fit in 8 bits");
 
 // clang-format off
-static Timing timings[] =
-{
-    {.name = "Power cycle"},
-    {.name = "Connect WiFi"},
-    {.name = "Set up NTP"},
-    {.name = "Sync time"},
-    {.name = "Fetch weather"},
-    {.name = "Parse weather"},
-    {.name = "Fetch forecast"},
-    {.name = "Parse forecast"},
-    {.name = "Fetch AQI"},
-    {.name = "Parse AQI"},
-    {.name = "Close HTTP"},
-    {.name = "Draw UI"},
-    {.name = "Power-on screen"},
-    {.name = "Clear screen"},
-    {.name = "Update screen"},
+constexpr char const *event_names[] =
+{
+    "Power cycle",
+    "Connect WiFi",
+    "Set up NTP",
+    "Sync time",
+    "Fetch weather",
+    "Parse weather",
+    "Fetch forecast",
+    "Parse forecast",
+    "Fetch AQI",
+    "Parse AQI",
+    "Close HTTP",
+    "Draw UI",
+    "Power-on screen",
+    "Clear screen",
+    "Update screen",
+    "Screen on",
 };
 // clang-format on
 
-static_assert(sizeof(timings) / sizeof(timings[0]) == to_val(TimeEvent::_MAX),
-              "timings[] should be the same size (and in the same order) as enum class TimeEvent.");
+static_assert(sizeof(event_names) / sizeof(event_names[0]) == to_val(TimeEvent::_MAX),
+              "event_names[] should be the same size (and in the same order) as enum class TimeEvent.");
 
-} // namespace
+/// The names of the spans defined by define_span(), after the TimeEvent ones.
+char const *span_names[MaxSpans];
+/// Guarded by `definitions`, like span_names.
+size_t span_count = 0;
+
+/// A span under a parent, and its occurrences there.
+struct Node
+{
+    SpanId span;
+    NodeId parent;
+    std::atomic<uint32_t> count, total_us, min_us, max_us;
+};
+
+Node nodes[MaxNodes];
+/// The nodes [0, node_count) are complete; new ones are only added under the lock.
+std::atomic<size_t> node_count{0};
+
+/// Guards the definition of spans and nodes; measuring them takes no lock.
+std::mutex definitions;
+
+struct OpenSpan
+{
+    SpanId span;
+    NodeId node;
+    int64_t start_us;
+};
+
+std::atomic<SpanObserver> observer{nullptr};
+
+/**
+ * The spans open on a task.
+ *
+ * Not thread_local: ESP-IDF reserves the static TLS segment on the stack of every task, the system ones included. An
+ * entry belongs to a task only while it has spans open, and only that task uses it then.
+ */
+struct TaskSpans
+{
+    /// The owner, null when free.
+    std::atomic<void const *> task{nullptr};
+    OpenSpan open[MaxDepth];
+    size_t count = 0;
+    /// The spans begun when `open` was full, not measured.
+    size_t dropped = 0;
+};
 
-void mark_event(TimeEvent e)
+TaskSpans task_spans[MaxTasks];
+
+/// Identifies the calling task (thread).
+void const *current_task()
 {
-    assert(timings[to_val(e)].start == 0);
-    timings[to_val(e)].start = millis();
+#ifndef HOST_BUILD
+    return xTaskGetCurrentTaskHandle();
+#else
+    static thread_local char id; // threads have no such stack cost on the host
+    return &id;
+#endif
 }
 
-void mark_event_done(TimeEvent e)
+/// The entry of the calling task; with `claim`, a free one is taken if it has none. Null if there's none.
+TaskSpans *get_task_spans(bool claim)
 {
-    assert(timings[to_val(e)].start != 0);
-    timings[to_val(e)].end = millis();
+    void const *const task = current_task();
+    for (TaskSpans& t : task_spans)
+        if (t.task.load(std::memory_order_acquire) == task) return &t;
+    if (!claim) return nullptr;
+
+    for (TaskSpans& t : task_spans)
+    {
+        void const *free = nullptr;
+        if (t.task.compare_exchange_strong(free, task, std::memory_order_acquire)) return &t;
+    }
+    return nullptr;
 }
 
-milliseconds get_event_duration(TimeEvent e)
+int64_t now_us()
 {
-    auto start = timings[to_val(e)].start;
-    auto end   = timings[to_val(e)].end;
+#ifndef HOST_BUILD
+    return esp_timer_get_time();
+#else
+    using namespace std::chrono;
+    return duration_cast<microseconds>(steady_clock::now().time_since_epoch()).count();
+#endif
+}
 
-    return start == 0 || end == 0 ? milliseconds::zero() : milliseconds{end - start};
+NodeId find_node(SpanId span, NodeId parent, size_t from, size_t to)
+{
+    for (size_t i = from; i < to; i++)
+        if (nodes[i].span == span && nodes[i].parent == parent) return NodeId(i);
+    return NoNode;
 }
 
-void dump_timings()
+/// The node of `span` under `parent`; added on the first occurrence. NoNode if there's no room.
+NodeId get_node(SpanId span, NodeId parent)
 {
-    for (size_t i = 0; i < sizeof(timings) / sizeof(timings[0]); i++)
+    size_t const count = node_count.load(std::memory_order_acquire);
+    NodeId node        = find_node(span, parent, 0, count);
+    if (node != NoNode) return node;
+
+    std::lock_guard<std::mutex> lock{definitions};
+
+    // it might have been added by another task in the meantime
+    size_t const now_count = node_count.load(std::memory_order_relaxed);
+    node                   = find_node(span, parent, count, now_count);
+    if (node != NoNode || now_count == MaxNodes) return node;
+
+    Node& n  = nodes[now_count];
+    n.span   = span;
+    n.parent = parent;
+    n.min_us = UINT32_MAX;
+    node_count.store(now_count + 1, std::memory_order_release);
+    return NodeId(now_count);
+}
+
+void record(NodeId node, uint32_t us)
+{
+    if (node == NoNode) return;
+
+    Node& n = nodes[node];
+    n.count.fetch_add(1, std::memory_order_relaxed);
+    n.total_us.fetch_add(us, std::memory_order_relaxed);
+
+    uint32_t min = n.min_us.load(std::memory_order_relaxed);
+    while (us < min && !n.min_us.compare_exchange_weak(min, us, std::memory_order_relaxed))
+        ;
+    uint32_t max = n.max_us.load(std::memory_order_relaxed);
+    while (us > max && !n.max_us.compare_exchange_weak(max, us, std::memory_order_relaxed))
+        ;
+}
+
+/// Prints the nodes under `parent`, and theirs, indented by `depth`.
+void dump_children(NodeId parent, int depth)
+{
+    size_t const count = node_count.load(std::memory_order_acquire);
+    for (size_t i = 0; i < count; i++)
     {
-        auto start = timings[i].start;
-        auto end   = timings[i].end;
-        if (start == 0 || end == 0) continue;
+        Node const& n = nodes[i];
+        if (n.parent != parent) continue;
+
+        uint32_t const times = n.count.load(std::memory_order_relaxed);
+        uint32_t const total = n.total_us.load(std::memory_order_relaxed);
 
         // printf() is not mocked
-        Serial.print(timings[i].name);
+        for (int d = 0; d < depth; d++)
+            Serial.print("  ");
+        Serial.print(span_name(n.span));
         Serial.print(": ");
-        Serial.print(String(end - start));
-        Serial.println(" millis");
+        Serial.print(String(total / 1000.0, 3));
+        if (times > 1)
+        {
+            Serial.print(" ms, ");
+            Serial.print(String(times));
+            Serial.print("x, min ");
+            Serial.print(String(n.min_us.load(std::memory_order_relaxed) / 1000.0, 3));
+            Serial.print(" max ");
+            Serial.print(String(n.max_us.load(std::memory_order_relaxed) / 1000.0, 3));
+        }
+        Serial.println(" ms");
+
+        dump_children(NodeId(i), depth + 1);
+    }
+}
+
+} // namespace
+
+SpanId define_span(char const *name)
+{
+    SpanId const first = to_val(TimeEvent::_MAX);
+
+    for (SpanId s = 0; s < first; s++)
+        if (strcmp(event_names[s], name) == 0) return s;
+
+    std::lock_guard<std::mutex> lock{definitions};
+
+    for (size_t i = 0; i < span_count; i++)
+        if (strcmp(span_names[i], name) == 0) return SpanId(first + i);
+
+    // out of room: measure it as the last one
+    if (span_count == MaxSpans) return SpanId(first + MaxSpans - 1);
+
+    span_names[span_count] = name;
+    return SpanId(first + span_count++);
+}
+
+void begin_span(SpanId s)
+{
+    // not measured when all the entries are taken
+    TaskSpans *const t = get_task_spans(true);
+    if (!t) return;
+
+    if (t->count == MaxDepth)
+    {
+        t->dropped++;
+        return;
+    }
+
+    NodeId const parent = t->count ? t->open[t->count - 1].node : NoNode;
+    t->open[t->count++] = {.span = s, .node = get_node(s, parent), .start_us = now_us()};
+}
+
+void end_span(SpanId s)
+{
+    int64_t const end = now_us();
+
+    TaskSpans *const t = get_task_spans(false);
+    if (!t) return;
+
+    if (t->dropped)
+        t->dropped--;
+    else
+    {
+        size_t i = t->count;
+        while (i > 0 && t->open[i - 1].span != s)
+            i--;
+        assert(i > 0 && "end_span() without begin_span()");
+        if (i == 0) return;
+
+        // the spans not ended within it end with it
+        SpanObserver const notify = observer.load(std::memory_order_acquire);
+        for (size_t j = t->count; j >= i; j--)
+        {
+            OpenSpan const& open = t->open[j - 1];
+            record(open.node, uint32_t(end - open.start_us));
+            if (notify) notify(open.span, open.start_us, end);
+        }
+        t->count = i - 1;
     }
-}
\ No newline at end of file
+
+    if (t->count == 0 && t->dropped == 0) t->task.store(nullptr, std::memory_order_release);
+}
+
+SpanStats get_span_stats(SpanId s)
+{
+    SpanStats stats;
+    size_t const count = node_count.load(std::memory_order_acquire);
+    for (size_t i = 0; i < count; i++)
+    {
+        Node const& n = nodes[i];
+        if (n.span != s || n.count == 0) continue;
+
+        stats.min_us = stats.count ? std::min<uint32_t>(stats.min_us, n.min_us) : uint32_t(n.min_us);
+        stats.max_us = std::max<uint32_t>(stats.max_us, n.max_us);
+        stats.count += n.count;
+        stats.total_us += n.total_us;
+    }
+    return stats;
+}
+
+char const *span_name(SpanId s)
+{
+    return s < to_val(TimeEvent::_MAX) ? event_names[s] : span_names[s - to_val(TimeEvent::_MAX)];
+}
+
+void dump_timings() { dump_children(NoNode, 0); }
+
+void observe_spans(SpanObserver o) { observer.store(o, std::memory_order_release); }
+
+int64_t span_clock_us() { return now_us(); }
+
+void record_span(SpanId s, int64_t begin_us, int64_t end_us)
+{
+    record(get_node(s, NoNode), uint32_t(end_us - begin_us));
+
+    SpanObserver const notify = observer.load(std::memory_order_acquire);
+    if (notify) notify(s, begin_us, end_us);
+}
+
+#endif
@@ -5,10 +5,19 @@
 
 /**
  * @file Support for measuring the durations of refresh cycle phases.
+ *
+ * A phase is measured as a span: from begin_span() to end_span(), in microseconds. Spans nest: the span begun while
+ * another one is open on the same task (thread) is its child; and they can repeat, e.g. in a loop or on a retry, each
+ * occurrence adding to the count, total, min and max of the span under that parent. The refresh cycle phases of
+ * TimeEvent are predefined spans; others are defined by name, see TIMING_SPAN().
+ *
+ * All of it is in fixed-size tables, no heap is used. With NO_TIMINGS defined, it all compiles to nothing, and the
+ * durations are 0.
  */
 
 #pragma once
 #include <chrono>
+#include <cstdint>
 
 /**
  * @brief The type of the phase.
@@ -31,34 +40,133 @@ enum class TimeEvent : unsigned char
     PowerOnScreen,
     ClearScreen,
     UpdateScreen,
+    /// from powering the screen on to powering it off, which may be on another task; see record_span()
+    ScreenOn,
     _MAX
 };
 
+/// Identifies a span; the TimeEvent values are the first ones.
+using SpanId = uint8_t;
+
+/// The occurrences of a span, in microseconds.
+struct SpanStats
+{
+    uint32_t count    = 0;
+    uint32_t total_us = 0;
+    uint32_t min_us   = 0;
+    uint32_t max_us   = 0;
+};
+
+constexpr SpanId span_id(TimeEvent e) { return static_cast<SpanId>(e); }
+
+/**
+ * @brief Called on the task (thread) of a span as each occurrence of it ends, with its begin and end times in
+ * microseconds since boot (on the host, since an arbitrary point).
+ */
+using SpanObserver = void (*)(SpanId s, int64_t begin_us, int64_t end_us);
+
+#ifndef NO_TIMINGS
+
+/**
+ * @brief Returns the span named `name`, defining it on the first call; `name` must outlive it, e.g. a string literal.
+ *
+ * There's room for a few dozen spans; past that, the span is not measured.
+ */
+SpanId define_span(char const *name);
+
+/**
+ * @brief Marks the start of an occurrence of span `s`, a child of the innermost span open on the calling task.
+ *
+ * There's room for the open spans of a few tasks at once; past that, the span is not measured.
+ */
+void begin_span(SpanId s);
+
+/**
+ * @brief Marks the end of the occurrence of span `s` begun last on the calling task, and of any spans begun after it
+ * and still open.
+ */
+void end_span(SpanId s);
+
+/// The occurrences of span `s` so far, under any parent.
+SpanStats get_span_stats(SpanId s);
+
+/// The name of span `s`.
+char const *span_name(SpanId s);
+
+/**
+ * @brief Dumps all recorded spans, as a tree of parents and children, using Serial.print();
+ */
+void dump_timings();
+
+/// Sets the observer of the span occurrences, nullptr for none; e.g. to keep a trace of them.
+void observe_spans(SpanObserver observer);
+
+/// The time the spans are measured in, microseconds since boot (on the host, since an arbitrary point).
+int64_t span_clock_us();
+
+/**
+ * @brief Records an occurrence of span `s` from `begin_us` to `end_us` (see span_clock_us()), with no parent; for
+ * phases that begin and end on different tasks.
+ */
+void record_span(SpanId s, int64_t begin_us, int64_t end_us);
+
+#else
+
+inline SpanId define_span(char const *) { return 0; }
+inline void begin_span(SpanId) {}
+inline void end_span(SpanId) {}
+inline SpanStats get_span_stats(SpanId) { return {}; }
+inline char const *span_name(SpanId) { return ""; }
+inline void dump_timings() {}
+inline void observe_spans(SpanObserver) {}
+inline int64_t span_clock_us() { return 0; }
+inline void record_span(SpanId, int64_t, int64_t) {}
+
+#endif
+
 /**
  * @brief Marks the start of phase.
  *
- * Should only be called once per event type.
+ * May be called again after mark_event_done(), e.g. in a loop; the durations add up.
  */
-void mark_event(TimeEvent e);
+inline void mark_event(TimeEvent e) { begin_span(span_id(e)); }
 
 /**
  * @brief Marks the end of phase.
  *
- * Should only be called once after mark_event() has already been called for the same event.
+ * Should be called after mark_event() for the same event, on the same task, with the spans begun in between ended.
  */
-void mark_event_done(TimeEvent e);
+inline void mark_event_done(TimeEvent e) { end_span(span_id(e)); }
 
 /**
- * @brief Get the duration of a phase, in millis resolution.
+ * @brief Get the total duration of a phase, in millis resolution.
  *
- * Returns 0 of mark_event() or mark_event_done() has not been called for that event.
+ * Returns 0 if mark_event() and mark_event_done() have not been called for that event.
  */
-std::chrono::milliseconds get_event_duration(TimeEvent e);
+inline std::chrono::milliseconds get_event_duration(TimeEvent e)
+{
+    return std::chrono::milliseconds{get_span_stats(span_id(e)).total_us / 1000};
+}
 
 /**
- * @brief Dumps all recorded (non-zero) duration using Serial.print();
+ * @brief Helper type to automatically begin/end a span for a C++ scope.
+ *
+ * Remember to give the instance a name, e.g. `AutoSpan span{id}`, and _not_ `AutoSpan{id}` so that the temporary is
+ * not immediately destroyed.
  */
-void dump_timings();
+class AutoSpan
+{
+  public:
+    explicit AutoSpan(SpanId s) : _s(s) { begin_span(s); }
+
+    ~AutoSpan() { end_span(_s); }
+
+    AutoSpan(AutoSpan const&)            = delete;
+    AutoSpan& operator=(AutoSpan const&) = delete;
+
+  private:
+    SpanId _s;
+};
 
 /**
  * @brief Helper type to automatically mark()/mark_done() an event for a C++ scope.
@@ -66,13 +174,23 @@ void dump_timings();
  * Remember to give the instance a name, e.g. `AutoTiming time{TimeEvent::DrawUI}`, and
  * _not_ `AutoTiming{TimeEvent::DrawUI}` so that the temporary is not immediately destroyed.
  */
-class AutoTiming
+class AutoTiming : public AutoSpan
 {
   public:
-    AutoTiming(TimeEvent e) : _e(e) { mark_event(e); }
+    AutoTiming(TimeEvent e) : AutoSpan(span_id(e)) {}
+};
 
-    ~AutoTiming() { mark_event_done(_e); }
+#define TIMING_SPAN_CAT2(a, b) a##b
+#define TIMING_SPAN_CAT(a, b)  TIMING_SPAN_CAT2(a, b)
 
-  private:
-    TimeEvent _e;
-};
\ No newline at end of file
+/**
+ * @brief Measures the rest of the enclosing scope as span `name` (a string literal), e.g.
+ * `TIMING_SPAN("HTTP request");`. The span is looked up once per call site.
+ */
+#ifndef NO_TIMINGS
+#define TIMING_SPAN(name)                                                                \
+    static SpanId const TIMING_SPAN_CAT(timing_span_id_, __LINE__) = define_span(name); \
+    AutoSpan TIMING_SPAN_CAT(timing_span_, __LINE__){TIMING_SPAN_CAT(timing_span_id_, __LINE__)}
+#else
+#define TIMING_SPAN(name) static_cast<void>(0)
+#endif
@@ -0,0 +1,111 @@
+/*
+ * Copyright (c) 2024 zahical. All rights reserved.
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+/**
+ * @file Fixed-point sine/cosine lookup, for the UI geometry.
+ *
+ * The ESP32 has no double precision FPU, so every `cos(deg * PI / 180)` in the drawing code used to be a soft-float
+ * double computation. Here, angles are integers in "binary" units (FullTurn per turn), sines are read from a quarter
+ * wave table generated at compile time and the results are Q14 fixed-point numbers (One is 1.0).
+ *
+ * The angle step is 0.088 degrees and the table precision 1/16384, so for the radii used in the UI (up to a couple of
+ * hundred pixels) the lookup is within a small fraction of a pixel of the double precision result.
+ */
+
+#pragma once
+#include <array>
+#include <cstdint>
+
+// the table is built by a constexpr loop into an inline variable
+#if __cplusplus < 201703L
+#error "trig.h needs C++17, see build_flags in platformio.ini"
+#endif
+
+namespace trig
+{
+
+constexpr int32_t FracBits = 14;
+/// 1.0 in Q14
+constexpr int32_t One = 1 << FracBits;
+
+/// Binary angle units per turn (360 degrees)
+constexpr int32_t FullTurn    = 4096;
+constexpr int32_t QuarterTurn = FullTurn / 4;
+
+namespace detail
+{
+constexpr double Pi = 3.14159265358979323846;
+
+/// Taylor series sine, for 0 <= x <= pi/2; only used to generate the table at compile time.
+constexpr double taylor_sin(double x)
+{
+    double term = x, sum = x;
+    for (int n = 1; n < 12; n++)
+    {
+        term *= -x * x / ((2 * n) * (2 * n + 1));
+        sum += term;
+    }
+    return sum;
+}
+
+constexpr std::array<int16_t, QuarterTurn + 1> make_quarter_sine()
+{
+    std::array<int16_t, QuarterTurn + 1> t{};
+    for (int32_t i = 0; i <= QuarterTurn; i++)
+        t[i] = static_cast<int16_t>(taylor_sin(i * (Pi / 2) / QuarterTurn) * One + 0.5);
+    return t;
+}
+
+/// sin() in Q14 for the first quarter turn, both ends included.
+inline constexpr std::array<int16_t, QuarterTurn + 1> quarter_sine = make_quarter_sine();
+
+static_assert(quarter_sine[0] == 0 && quarter_sine[QuarterTurn] == One, "bad sine table");
+static_assert(quarter_sine[QuarterTurn / 2] == 11585, "bad sine table"); // sin(45) = 0.70711
+} // namespace detail
+
+/// Converts degrees to binary angle units, rounding to the nearest.
+constexpr int32_t from_deg(float deg)
+{
+    float const units = deg * (FullTurn / 360.0f);
+    return static_cast<int32_t>(units < 0 ? units - 0.5f : units + 0.5f);
+}
+
+/// Converts radians to binary angle units, rounding to the nearest.
+constexpr int32_t from_rad(float rad)
+{
+    float const units = rad * static_cast<float>(FullTurn / (2 * detail::Pi));
+    return static_cast<int32_t>(units < 0 ? units - 0.5f : units + 0.5f);
+}
+
+/// sin(angle) in Q14, for any angle (it wraps around).
+constexpr int32_t sin(int32_t angle)
+{
+    int32_t const a     = angle & (FullTurn - 1);
+    int32_t const index = a & (QuarterTurn - 1);
+
+    switch (a / QuarterTurn)
+    {
+    case 0: return detail::quarter_sine[index];
+    case 1: return detail::quarter_sine[QuarterTurn - index];
+    case 2: return -detail::quarter_sine[index];
+    default: return -detail::quarter_sine[QuarterTurn - index];
+    }
+}
+
+/// cos(angle) in Q14, for any angle (it wraps around).
+constexpr int32_t cos(int32_t angle) { return sin(angle + QuarterTurn); }
+
+/// v * q, where q is in Q14, rounded to the nearest integer.
+constexpr int32_t mul(int32_t v, int32_t q) { return (v * q + (One / 2)) >> FracBits; }
+
+struct Vec
+{
+    int32_t x, y;
+};
+
+/// The point at distance `r` from the origin, in the direction `angle` (0 is +x, a quarter turn is +y), rounded.
+constexpr Vec polar(int32_t r, int32_t angle) { return {mul(r, cos(angle)), mul(r, sin(angle))}; }
+
+} // namespace trig
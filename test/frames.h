@@ -0,0 +1,24 @@
+/*
+ * Copyright (c) 2024 zahical. All rights reserved.
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+/**
+ * @file Full-screen framebuffers, for the unit tests.
+ */
+
+#pragma once
+#include <epd_driver.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+using Bytes = std::vector<uint8_t>;
+
+/// Bytes per framebuffer row, 2 pixels each.
+constexpr size_t Stride    = EPD_WIDTH / 2;
+constexpr size_t FrameSize = Stride * EPD_HEIGHT;
+
+/// A white frame.
+inline Bytes const white(FrameSize, 0xFF);
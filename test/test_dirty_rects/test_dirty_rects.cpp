@@ -0,0 +1,150 @@
+/*
+ * Copyright (c) 2024 zahical. All rights reserved.
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+/**
+ * @file Unit tests for finding the changed areas of the screen.
+ */
+
+#include "../../src/dirty_rects.h"
+#include "../frames.h"
+#include "unity.h"
+
+void setUp(void)
+{
+    // unity
+}
+
+void tearDown(void)
+{
+    // unity
+}
+
+// ----------
+constexpr int32_t MergeGap = DirtyRects::MergeGap;
+
+/// A white frame with the framebuffer bytes `[left, right)` of `rows` changed.
+Bytes changed(std::initializer_list<int32_t> rows, int32_t left = 10, int32_t right = 11)
+{
+    Bytes f = white;
+    for (int32_t y : rows)
+        for (int32_t x = left; x < right; x++)
+            f[y * Stride + x] = 0x00;
+    return f;
+}
+
+bool rect_is(Rect_t const& r, int32_t x, int32_t y, int32_t width, int32_t height)
+{
+    return r.x == x && r.y == y && r.width == width && r.height == height;
+}
+
+void test_no_change()
+{
+    DirtyRects const d = find_dirty_rects(white.data(), white.data());
+    TEST_ASSERT_EQUAL(0, d.count);
+    TEST_ASSERT_EQUAL(0, d.rows);
+}
+
+void test_single_byte()
+{
+    Bytes const next   = changed({100});
+    DirtyRects const d = find_dirty_rects(white.data(), next.data());
+    TEST_ASSERT_EQUAL(1, d.count);
+    TEST_ASSERT(rect_is(d.rects[0], 20, 100, 2, 1));
+    TEST_ASSERT_EQUAL(1, d.rows);
+}
+
+void test_first_and_last_bytes()
+{
+    Bytes next                           = white;
+    next[0]                              = 0;
+    next[EPD_HEIGHT * Stride - 1]        = 0;
+    next[(EPD_HEIGHT - 1) * Stride + 10] = 0;
+
+    DirtyRects const d = find_dirty_rects(white.data(), next.data());
+    TEST_ASSERT_EQUAL(2, d.count);
+    TEST_ASSERT(rect_is(d.rects[0], 0, 0, 2, 1));
+    TEST_ASSERT(rect_is(d.rects[1], 20, EPD_HEIGHT - 1, EPD_WIDTH - 20, 1));
+}
+
+void test_merge_gap()
+{
+    // rows closer than MergeGap are one band, with the columns of both
+    Bytes next                           = changed({100});
+    next[(100 + MergeGap) * Stride + 40] = 0;
+    DirtyRects d                         = find_dirty_rects(white.data(), next.data());
+    TEST_ASSERT_EQUAL(1, d.count);
+    TEST_ASSERT(rect_is(d.rects[0], 20, 100, 62, MergeGap + 1));
+    TEST_ASSERT_EQUAL(MergeGap + 1, d.rows);
+
+    // one row further, they're two
+    next = changed({100, 101 + MergeGap});
+    d    = find_dirty_rects(white.data(), next.data());
+    TEST_ASSERT_EQUAL(2, d.count);
+    TEST_ASSERT(rect_is(d.rects[0], 20, 100, 2, 1));
+    TEST_ASSERT(rect_is(d.rects[1], 20, 101 + MergeGap, 2, 1));
+    TEST_ASSERT_EQUAL(2, d.rows);
+}
+
+void test_band_cap()
+{
+    // 10 bands, 50 rows apart, except for the gaps after 100 and 300
+    Bytes const next   = changed({0, 50, 100, 120, 200, 250, 300, 330, 400, 450});
+    DirtyRects const d = find_dirty_rects(white.data(), next.data());
+    TEST_ASSERT_EQUAL(DirtyRects::Max, d.count);
+
+    // the two smallest gaps are merged
+    int32_t const tops[]    = {0, 50, 100, 200, 250, 300, 400, 450};
+    int32_t const heights[] = {1, 1, 21, 1, 1, 31, 1, 1};
+    int32_t rows            = 0;
+    for (size_t i = 0; i < DirtyRects::Max; i++)
+    {
+        TEST_ASSERT(rect_is(d.rects[i], 20, tops[i], 2, heights[i]));
+        rows += heights[i];
+    }
+    TEST_ASSERT_EQUAL(rows, d.rows);
+}
+
+void test_band_cap_many_bands()
+{
+    // the worst case: as many bands as there can be
+    Bytes next = white;
+    for (int32_t y = 0; y < EPD_HEIGHT; y += MergeGap + 1)
+        next[y * Stride + y % Stride] = 0;
+
+    DirtyRects const d = find_dirty_rects(white.data(), next.data());
+    TEST_ASSERT_EQUAL(DirtyRects::Max, d.count);
+
+    // the bands are in order, don't overlap and cover every change
+    int32_t covered = 0;
+    for (size_t i = 0; i < d.count; i++)
+    {
+        if (i > 0) TEST_ASSERT(d.rects[i].y >= d.rects[i - 1].y + d.rects[i - 1].height);
+        covered += d.rects[i].height;
+    }
+    TEST_ASSERT_EQUAL(covered, d.rows);
+    for (int32_t y = 0; y < EPD_HEIGHT; y += MergeGap + 1)
+    {
+        bool in = false;
+        for (size_t i = 0; i < d.count; i++)
+            in |= y >= d.rects[i].y && y < d.rects[i].y + d.rects[i].height;
+        TEST_ASSERT(in);
+    }
+}
+
+// ----------
+
+int main(int argc, char **argv)
+{
+    UNITY_BEGIN();
+
+    RUN_TEST(test_no_change);
+    RUN_TEST(test_single_byte);
+    RUN_TEST(test_first_and_last_bytes);
+    RUN_TEST(test_merge_gap);
+    RUN_TEST(test_band_cap);
+    RUN_TEST(test_band_cap_many_bands);
+
+    UNITY_END();
+}
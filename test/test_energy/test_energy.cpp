@@ -0,0 +1,73 @@
+/*
+ * Copyright (c) 2024 zahical. All rights reserved.
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+/**
+ * @file Unit tests for the battery charge left.
+ */
+
+#include "../../src/config.h"
+#include "../../src/energy.h"
+#include "unity.h"
+
+void setUp(void)
+{
+    // unity
+}
+
+void tearDown(void)
+{
+    // unity
+}
+
+// ----------
+void test_battery_ends()
+{
+    TEST_ASSERT_EQUAL(100, battery_percentage(4.20f));
+    TEST_ASSERT_EQUAL(100, battery_percentage(4.35f));
+    TEST_ASSERT_EQUAL(0, battery_percentage(3.00f));
+}
+
+void test_battery_nearly_empty()
+{
+    // below its minimum, the fit rises again
+    TEST_ASSERT_EQUAL(0, battery_percentage(3.20f));
+    TEST_ASSERT_EQUAL(0, battery_percentage(3.30f));
+    TEST_ASSERT_EQUAL(0, battery_percentage(3.45f));
+    TEST_ASSERT_EQUAL(0, battery_percentage(3.52f));
+    TEST_ASSERT_EQUAL(0, battery_days(3.30f, 10));
+}
+
+void test_battery_monotonic()
+{
+    uint8_t last = 0;
+    for (int mv = 3000; mv <= 4300; mv += 5)
+    {
+        uint8_t const p = battery_percentage(mv / 1000.0f);
+        TEST_ASSERT_LESS_OR_EQUAL(p, last);
+        last = p;
+    }
+}
+
+void test_battery_days()
+{
+    // no reading: a full battery
+    TEST_ASSERT(battery_days(0, 10) == cfg::BatteryMah / 10);
+    TEST_ASSERT_EQUAL(0, battery_days(0, 0));
+
+    double const half = battery_days(3.75f, 10);
+    TEST_ASSERT(half > 0 && half < cfg::BatteryMah / 10);
+}
+
+int main(int argc, char **argv)
+{
+    UNITY_BEGIN();
+
+    RUN_TEST(test_battery_ends);
+    RUN_TEST(test_battery_nearly_empty);
+    RUN_TEST(test_battery_monotonic);
+    RUN_TEST(test_battery_days);
+
+    UNITY_END();
+}
@@ -0,0 +1,175 @@
+/*
+ * Copyright (c) 2024 zahical. All rights reserved.
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+/**
+ * @file Unit tests for planning the waveform an image is drawn in.
+ */
+
+#include "../../src/epd_waveform.h"
+#include "unity.h"
+
+#include <array>
+
+void setUp(void)
+{
+    // unity
+}
+
+void tearDown(void)
+{
+    // unity
+}
+
+// ----------
+DrawMode_t const modes[] = {BLACK_ON_WHITE, WHITE_ON_WHITE, WHITE_ON_BLACK};
+
+/// Whether the table of `frame` still drives level `n`: it does until the frame the level is done with.
+bool drives(uint8_t frame, uint8_t n, DrawMode_t mode)
+{
+    for (uint8_t k = 0; k <= frame; k++)
+        if (level_done(k, mode) == n) return false;
+    return true;
+}
+
+/// How long each of the 16 levels is driven for with `waveform`.
+std::array<int32_t, 16> drive_times(Waveform const& waveform, DrawMode_t mode)
+{
+    std::array<int32_t, 16> times{};
+    for (uint8_t s = 0; s < waveform.count; s++)
+        for (uint8_t n = 0; n < 16; n++)
+            if (drives(waveform.steps[s].frame, n, mode)) times[n] += waveform.steps[s].time;
+    return times;
+}
+
+void test_same_drive_times()
+{
+    for (DrawMode_t mode : modes)
+    {
+        auto const full = drive_times(full_waveform(mode), mode);
+        for (uint32_t levels = 0; levels < (1 << 16); levels++)
+        {
+            Waveform const planned = plan_waveform(uint16_t(levels), mode);
+            auto const times       = drive_times(planned, mode);
+            for (uint8_t n = 0; n < 16; n++)
+                if (levels & 1 << n) TEST_ASSERT_EQUAL_INT32(full[n], times[n]);
+        }
+    }
+}
+
+void test_steps_in_order_and_not_too_long()
+{
+    for (DrawMode_t mode : modes)
+        for (uint32_t levels = 0; levels < (1 << 16); levels++)
+        {
+            Waveform const planned = plan_waveform(uint16_t(levels), mode);
+            TEST_ASSERT_LESS_OR_EQUAL(LutFrameCount, planned.count);
+            for (uint8_t s = 0; s < planned.count; s++)
+            {
+                TEST_ASSERT_LESS_OR_EQUAL(MaxStepTime, planned.steps[s].time);
+                if (s > 0) TEST_ASSERT_GREATER_THAN(planned.steps[s - 1].frame, planned.steps[s].frame);
+            }
+        }
+}
+
+void test_driver_steps()
+{
+    // the driver's frame functions latch a row with an 8-bit time
+    for (DrawMode_t mode : modes)
+    {
+        auto const full = drive_times(full_waveform(mode), mode);
+        for (uint32_t levels = 0; levels < (1 << 16); levels++)
+        {
+            Waveform const planned = plan_waveform(uint16_t(levels), mode, DriverMaxStepTime);
+            TEST_ASSERT_LESS_OR_EQUAL(LutFrameCount + 1, planned.count);
+            for (uint8_t s = 0; s < planned.count; s++)
+            {
+                TEST_ASSERT_LESS_OR_EQUAL(DriverMaxStepTime, planned.steps[s].time);
+                if (s > 0) TEST_ASSERT_LESS_OR_EQUAL(planned.steps[s].frame, planned.steps[s - 1].frame);
+            }
+
+            auto const times = drive_times(planned, mode);
+            for (uint8_t n = 0; n < 16; n++)
+                if (levels & 1 << n) TEST_ASSERT_EQUAL_INT32(full[n], times[n]);
+        }
+    }
+
+    // the 300 frame, in two
+    Waveform const bw = plan_waveform(1 << 0 | 1 << 15, BLACK_ON_WHITE, DriverMaxStepTime);
+    TEST_ASSERT_EQUAL(6, bw.count);
+    TEST_ASSERT_EQUAL_INT32(150, bw.steps[4].time);
+    TEST_ASSERT_EQUAL_INT32(150, bw.steps[5].time);
+    TEST_ASSERT_EQUAL(bw.steps[4].frame, bw.steps[5].frame);
+}
+
+void test_all_levels()
+{
+    for (DrawMode_t mode : modes)
+    {
+        Waveform const full    = full_waveform(mode);
+        Waveform const planned = plan_waveform(0xFFFF, mode);
+        TEST_ASSERT_EQUAL(LutFrameCount, full.count);
+        TEST_ASSERT_EQUAL(LutFrameCount, planned.count);
+        for (uint8_t s = 0; s < LutFrameCount; s++)
+        {
+            TEST_ASSERT_EQUAL(full.steps[s].frame, planned.steps[s].frame);
+            TEST_ASSERT_EQUAL_INT32(full.steps[s].time, planned.steps[s].time);
+        }
+    }
+}
+
+void test_black_and_white()
+{
+    TEST_ASSERT_EQUAL(4, plan_waveform(1 << 0 | 1 << 15, BLACK_ON_WHITE).count);
+    TEST_ASSERT_EQUAL(4, plan_waveform(1 << 0 | 1 << 15, WHITE_ON_WHITE).count);
+    // white is driven here, and the last frames are the long ones
+    TEST_ASSERT_EQUAL(2, plan_waveform(1 << 0 | 1 << 15, WHITE_ON_BLACK).count);
+}
+
+void test_nothing_to_drive()
+{
+    // the level that's done with the first frame needs no frames at all
+    TEST_ASSERT_EQUAL(0, plan_waveform(0, BLACK_ON_WHITE).count);
+    TEST_ASSERT_EQUAL(0, plan_waveform(1 << 15, BLACK_ON_WHITE).count);
+    TEST_ASSERT_EQUAL(0, plan_waveform(1 << 0, WHITE_ON_BLACK).count);
+}
+
+void test_mono()
+{
+    Waveform const mono    = mono_waveform();
+    Waveform const planned = plan_waveform(1 << 0 | 1 << 15, BLACK_ON_WHITE, DriverMaxStepTime);
+    TEST_ASSERT_EQUAL(planned.count, mono.count);
+    for (uint8_t s = 0; s < mono.count; s++)
+    {
+        TEST_ASSERT_EQUAL(planned.steps[s].frame, mono.steps[s].frame);
+        TEST_ASSERT_EQUAL_INT32(planned.steps[s].time, mono.steps[s].time);
+        // it's drawn with the driver's epd_draw_frame_1bit()
+        TEST_ASSERT_LESS_OR_EQUAL(DriverMaxStepTime, mono.steps[s].time);
+    }
+    TEST_ASSERT_EQUAL_INT32(drive_times(full_waveform(BLACK_ON_WHITE), BLACK_ON_WHITE)[0],
+                            drive_times(mono, BLACK_ON_WHITE)[0]);
+}
+
+void test_used_levels()
+{
+    uint8_t const data[] = {0xFF, 0xF0, 0x5F};
+    TEST_ASSERT_EQUAL_HEX16(1 << 0 | 1 << 5 | 1 << 15, used_levels(data, sizeof data));
+    TEST_ASSERT_EQUAL_HEX16(0, used_levels(data, 0));
+}
+
+int main(int argc, char **argv)
+{
+    UNITY_BEGIN();
+
+    RUN_TEST(test_same_drive_times);
+    RUN_TEST(test_steps_in_order_and_not_too_long);
+    RUN_TEST(test_driver_steps);
+    RUN_TEST(test_all_levels);
+    RUN_TEST(test_black_and_white);
+    RUN_TEST(test_nothing_to_drive);
+    RUN_TEST(test_mono);
+    RUN_TEST(test_used_levels);
+
+    UNITY_END();
+}
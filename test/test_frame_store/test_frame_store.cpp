@@ -0,0 +1,192 @@
+/*
+ * Copyright (c) 2024 zahical. All rights reserved.
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+/**
+ * @file Unit tests for the screen frame compression.
+ */
+
+#include "../../src/frame_store.h"
+#include "../frames.h"
+#include "unity.h"
+
+void setUp(void)
+{
+    // unity
+}
+
+void tearDown(void)
+{
+    // unity
+}
+
+// ----------
+/// A frame that looks like a UI: white, with some boxes, text-like noise and grey gradients.
+Bytes ui_frame()
+{
+    Bytes f(FrameSize, 0xFF);
+    uint32_t seed = 1;
+    for (size_t y = 0; y < EPD_HEIGHT; y++)
+        for (size_t x = 0; x < Stride; x++)
+        {
+            uint8_t& b = f[y * Stride + x];
+            if (y % 90 == 0 || x % 60 == 0) b = 0x00;
+            if (y > 100 && y < 140 && x > 20 && x < 200)
+            {
+                seed = seed * 1103515245 + 12345;
+                b    = seed >> 24;
+            }
+            if (y > 300 && y < 400) b = uint8_t(x % 16 * 0x11);
+        }
+    return f;
+}
+
+/// The stream of the tokens (`literal` bytes, or a run of `count` `value`s) in the format of compress_frame().
+struct Stream
+{
+    Bytes bytes;
+
+    Stream& literals(size_t count, uint8_t value = 0)
+    {
+        varint(count << 1);
+        bytes.insert(bytes.end(), count, value);
+        return *this;
+    }
+
+    Stream& run(size_t count, uint8_t value = 0)
+    {
+        varint((count - FrameMinRun) << 1 | 1);
+        bytes.push_back(value);
+        return *this;
+    }
+
+    Stream& varint(size_t v)
+    {
+        for (; v >= 0x80; v >>= 7)
+            bytes.push_back((v & 0x7F) | 0x80);
+        bytes.push_back(v);
+        return *this;
+    }
+};
+
+bool decompress(Bytes const& in, Bytes& frame) { return decompress_frame(in.data(), in.size(), frame.data()); }
+
+Bytes compress(Bytes const& frame)
+{
+    Bytes out(FrameSize * 2);
+    out.resize(compress_frame(frame.data(), out.data(), out.size()));
+    return out;
+}
+
+void test_round_trip()
+{
+    Bytes const frame = ui_frame();
+    Bytes const c     = compress(frame);
+    TEST_ASSERT(!c.empty());
+    TEST_ASSERT(c.size() < FrameSize / 4);
+
+    Bytes back(FrameSize, 0x5A);
+    TEST_ASSERT(decompress(c, back));
+    TEST_ASSERT(back == frame);
+}
+
+void test_round_trip_white_and_noise()
+{
+    Bytes back(FrameSize);
+    TEST_ASSERT(decompress(compress(white), back));
+    TEST_ASSERT(back == white);
+
+    Bytes noise(FrameSize);
+    uint32_t seed = 7;
+    for (uint8_t& b : noise)
+    {
+        seed = seed * 1103515245 + 12345;
+        b    = seed >> 24;
+    }
+    Bytes const c = compress(noise);
+    TEST_ASSERT(!c.empty());
+    TEST_ASSERT(decompress(c, back));
+    TEST_ASSERT(back == noise);
+}
+
+void test_output_too_small()
+{
+    Bytes const frame = ui_frame();
+    size_t const size = compress(frame).size();
+
+    Bytes out(size);
+    TEST_ASSERT_EQUAL(size, compress_frame(frame.data(), out.data(), size));
+    TEST_ASSERT_EQUAL(0, compress_frame(frame.data(), out.data(), size - 1));
+    TEST_ASSERT_EQUAL(0, compress_frame(frame.data(), out.data(), 0));
+}
+
+void test_truncated_input()
+{
+    Bytes const c = compress(ui_frame());
+    Bytes back(FrameSize);
+
+    for (size_t size : {size_t(0), size_t(1), c.size() / 2, c.size() - 2, c.size() - 1})
+        TEST_ASSERT_FALSE(decompress_frame(c.data(), size, back.data()));
+
+    // a varint cut short
+    Bytes cut = Stream{}.varint(FrameSize << 1).bytes;
+    cut.pop_back();
+    TEST_ASSERT_FALSE(decompress(cut, back));
+}
+
+void test_bad_token_count()
+{
+    Bytes back(FrameSize);
+
+    // an empty literal token
+    TEST_ASSERT_FALSE(decompress(Stream{}.literals(0).run(FrameSize).bytes, back));
+
+    // runs and literals past the end of the frame
+    TEST_ASSERT_FALSE(decompress(Stream{}.run(FrameSize + 1).bytes, back));
+    TEST_ASSERT_FALSE(decompress(Stream{}.literals(10).run(FrameSize - 9).bytes, back));
+    TEST_ASSERT_FALSE(decompress(Stream{}.run(FrameSize - 5).literals(6).bytes, back));
+
+    // a literal token with fewer bytes than it says
+    Bytes short_literals = Stream{}.run(FrameSize - 10).literals(10).bytes;
+    short_literals.pop_back();
+    TEST_ASSERT_FALSE(decompress(short_literals, back));
+
+    // a varint longer than 32 bits
+    TEST_ASSERT_FALSE(decompress({0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x01, 0x00}, back));
+
+    // exactly the frame
+    TEST_ASSERT_TRUE(decompress(Stream{}.run(FrameSize - 10).literals(10).bytes, back));
+}
+
+void test_wrong_frame_size()
+{
+    Bytes back(FrameSize);
+
+    // the stream of a frame a row shorter or longer
+    TEST_ASSERT_FALSE(decompress(Stream{}.run(FrameSize - Stride).bytes, back));
+    TEST_ASSERT_FALSE(decompress(Stream{}.run(FrameSize).run(Stride).bytes, back));
+
+    // trailing bytes after the frame
+    Bytes trailing = Stream{}.run(FrameSize).bytes;
+    trailing.push_back(0);
+    TEST_ASSERT_FALSE(decompress(trailing, back));
+
+    TEST_ASSERT_TRUE(decompress(Stream{}.run(FrameSize, 0x00).bytes, back));
+}
+
+// ----------
+
+int main(int argc, char **argv)
+{
+    UNITY_BEGIN();
+
+    RUN_TEST(test_round_trip);
+    RUN_TEST(test_round_trip_white_and_noise);
+    RUN_TEST(test_output_too_small);
+    RUN_TEST(test_truncated_input);
+    RUN_TEST(test_bad_token_count);
+    RUN_TEST(test_wrong_frame_size);
+
+    UNITY_END();
+}
@@ -0,0 +1,198 @@
+/*
+ * Copyright (c) 2024 zahical. All rights reserved.
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+/**
+ * @file Unit tests for choosing between a full, a partial and no refresh of the screen.
+ */
+
+#include "../../src/config.h"
+#include "../../src/refresh_policy.h"
+#include "../frames.h"
+#include "unity.h"
+
+#include <chrono>
+#include <cstring>
+
+void setUp(void)
+{
+    // unity
+}
+
+void tearDown(void)
+{
+    // unity
+}
+
+// ----------
+constexpr int32_t RegionW = RefreshState::RegionW;
+constexpr int32_t RegionH = RefreshState::RegionH;
+
+int64_t const Start  = 1700000000;
+int64_t const MaxAge = std::chrono::seconds{cfg::FullRefreshMaxAge}.count();
+
+/// A white frame with the framebuffer bytes `[left, right)` of rows `[top, bottom)` black.
+Bytes changed(int32_t top, int32_t bottom, int32_t left = 10, int32_t right = 11)
+{
+    Bytes f = white;
+    for (int32_t y = top; y < bottom; y++)
+        memset(&f[y * Stride + left], 0x00, right - left);
+    return f;
+}
+
+/// The whole top left region black: a change of 100%.
+Bytes first_region_black() { return changed(0, RegionH, 0, RegionW / 2); }
+
+/// The state right after a full refresh at Start.
+RefreshState fresh_state()
+{
+    RefreshState state{};
+    record_full_refresh(state, Start);
+    return state;
+}
+
+void expect(RefreshPlan const& plan, Refresh kind, char const *reason)
+{
+    TEST_ASSERT_EQUAL(int(kind), int(plan.kind));
+    TEST_ASSERT_EQUAL_STRING(reason, plan.reason);
+}
+
+void test_screen_not_known()
+{
+    Bytes const next = changed(0, 1);
+    expect(plan_refresh(fresh_state(), nullptr, next.data(), Start), Refresh::Full, "the screen content is not known");
+}
+
+void test_no_history()
+{
+    RefreshState const state{};
+    Bytes const next = changed(0, 1);
+    expect(plan_refresh(state, white.data(), next.data(), Start), Refresh::Full, "no refresh history");
+}
+
+void test_too_old()
+{
+    RefreshState const state = fresh_state();
+    Bytes const next         = changed(0, 1);
+    expect(plan_refresh(state, white.data(), next.data(), Start + MaxAge - 1), Refresh::Partial, "");
+    expect(plan_refresh(state, white.data(), next.data(), Start + MaxAge), Refresh::Full,
+           "too long since the last full refresh");
+    TEST_ASSERT_FALSE(full_refresh_due(state, Start + MaxAge - 1));
+    TEST_ASSERT_TRUE(full_refresh_due(state, Start + MaxAge));
+}
+
+void test_nothing_changed()
+{
+    expect(plan_refresh(fresh_state(), white.data(), white.data(), Start), Refresh::None, "nothing changed");
+}
+
+void test_too_much_changed()
+{
+    Bytes const limit = changed(0, cfg::PartialRowsLimit);
+    Bytes const over  = changed(0, cfg::PartialRowsLimit + 1);
+    expect(plan_refresh(fresh_state(), white.data(), limit.data(), Start), Refresh::Partial, "");
+    expect(plan_refresh(fresh_state(), white.data(), over.data(), Start), Refresh::Full, "too much changed");
+}
+
+void test_partial_refresh_limit()
+{
+    RefreshState state = fresh_state();
+    Bytes const next   = changed(0, 1);
+
+    state.partials[0][0] = cfg::FullRefreshEvery - 2;
+    expect(plan_refresh(state, white.data(), next.data(), Start), Refresh::Partial, "");
+    TEST_ASSERT_FALSE(full_refresh_due(state, Start));
+
+    state.partials[0][0] = cfg::FullRefreshEvery - 1;
+    expect(plan_refresh(state, white.data(), next.data(), Start), Refresh::Full,
+           "a region is at its limit of partial refreshes");
+    TEST_ASSERT_TRUE(full_refresh_due(state, Start));
+
+    // only the regions that changed count
+    Bytes const elsewhere = changed(EPD_HEIGHT - 1, EPD_HEIGHT);
+    expect(plan_refresh(state, white.data(), elsewhere.data(), Start), Refresh::Partial, "");
+}
+
+void test_region_change_limit()
+{
+    RefreshState state = fresh_state();
+    Bytes const next   = first_region_black();
+
+    state.change[0][0] = cfg::RegionChangeLimit - 100 - 1;
+    expect(plan_refresh(state, white.data(), next.data(), Start), Refresh::Partial, "");
+
+    state.change[0][0] = cfg::RegionChangeLimit - 100;
+    expect(plan_refresh(state, white.data(), next.data(), Start), Refresh::Full,
+           "a region changed too much since the last full refresh");
+
+    // the partial refresh limit is reported first
+    state.partials[0][0] = cfg::FullRefreshEvery - 1;
+    expect(plan_refresh(state, white.data(), next.data(), Start), Refresh::Full,
+           "a region is at its limit of partial refreshes");
+}
+
+void test_partial_refresh()
+{
+    RefreshState state     = fresh_state();
+    Bytes const next       = first_region_black();
+    RefreshPlan const plan = plan_refresh(state, white.data(), next.data(), Start);
+
+    expect(plan, Refresh::Partial, "");
+    TEST_ASSERT_EQUAL(1, plan.dirty.count);
+    TEST_ASSERT_EQUAL(100, plan.change[0][0]);
+    TEST_ASSERT_EQUAL(0, plan.change[0][1]);
+
+    record_partial_refresh(state, plan);
+    TEST_ASSERT_EQUAL(1, state.partials[0][0]);
+    TEST_ASSERT_EQUAL(100, state.change[0][0]);
+    TEST_ASSERT_EQUAL(0, state.partials[0][1]);
+    TEST_ASSERT_EQUAL(0, state.partials[1][0]);
+
+    record_full_refresh(state, Start + 10);
+    TEST_ASSERT_EQUAL(0, state.partials[0][0]);
+    TEST_ASSERT_EQUAL(0, state.change[0][0]);
+    TEST_ASSERT_EQUAL(Start + 10, state.last_full);
+}
+
+void test_init_refresh_state()
+{
+    // what's left in RTC memory after a cold boot
+    RefreshState state;
+    memset(&state, 0xA5, sizeof(state));
+
+    init_refresh_state(state);
+    TEST_ASSERT_EQUAL(0, state.last_full);
+    TEST_ASSERT_EQUAL(0, state.partials[2][3]);
+    TEST_ASSERT_TRUE(full_refresh_due(state, Start));
+
+    // the screen may show a half-drawn frame, even if it's the same as the saved one
+    RefreshPlan const plan = plan_refresh(state, white.data(), white.data(), Start);
+    TEST_ASSERT_EQUAL(Refresh::Full, plan.kind);
+    TEST_ASSERT_EQUAL_STRING("no refresh history", plan.reason);
+
+    // only a full refresh makes it valid, which is then kept
+    record_full_refresh(state, Start);
+    TEST_ASSERT_FALSE(full_refresh_due(state, Start));
+    state.partials[2][3] = 1;
+    init_refresh_state(state);
+    TEST_ASSERT_EQUAL(Start, state.last_full);
+    TEST_ASSERT_EQUAL(1, state.partials[2][3]);
+}
+
+int main(int argc, char **argv)
+{
+    UNITY_BEGIN();
+
+    RUN_TEST(test_screen_not_known);
+    RUN_TEST(test_no_history);
+    RUN_TEST(test_too_old);
+    RUN_TEST(test_nothing_changed);
+    RUN_TEST(test_too_much_changed);
+    RUN_TEST(test_partial_refresh_limit);
+    RUN_TEST(test_region_change_limit);
+    RUN_TEST(test_partial_refresh);
+    RUN_TEST(test_init_refresh_state);
+
+    UNITY_END();
+}
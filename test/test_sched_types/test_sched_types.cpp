@@ -7,7 +7,7 @@
  * @file Unit tests for DailyTime.
  */
 
-#include "../src/schedule.h"
+#include "../../src/schedule.h"
 #include "unity.h"
 #include <chrono>
 